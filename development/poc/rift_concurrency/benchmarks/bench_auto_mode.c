@@ -0,0 +1,219 @@
+/**
+ * @file bench_auto_mode.c
+ * @brief Adaptive Mode Benchmark - CONCURRENCY_AUTO Against Fixed Modes
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Runs three workloads in each fixed mode and through rift_auto_spawn():
+ * many tiny tasks, where handing each to a thread costs more than the
+ * work; a few long CPU-bound tasks, which the single-thread scheduler
+ * keeps on one core; and tasks that sleep in the kernel, which hold a
+ * pool or hybrid worker while they wait. Each variant is timed from the
+ * first spawn until every task has run, best of several rounds, so the
+ * auto variant's best round runs on its settled classification; the
+ * per-site classification is printed at the end. Spawn logging is sent
+ * to /dev/null while timing.
+ */
+
+#include "rift_simulated.h"
+#include "rift_simulated_hybrid.h"
+#include "rift_true_concurrency.h"
+#include "rift_auto.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define BENCH_TINY_TASKS 20000
+#define BENCH_TINY_WORK 200
+#define BENCH_CPU_TASKS 8
+#define BENCH_CPU_WORK 20000000
+#define BENCH_BLOCKING_TASKS 32
+#define BENCH_BLOCKING_US 5000
+#define BENCH_ROUNDS 3
+#define BENCH_IN_FLIGHT 64               // Leaves registry room for run but unreaped tasks
+
+static _Atomic uint64_t g_done;
+static volatile uint64_t g_sink;
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static double now_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e3 + (double)now.tv_nsec / 1e6;
+}
+
+static void spin(uint64_t iterations) {
+    uint64_t state = iterations | 1;
+    for (uint64_t i = 0; i < iterations; i++) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    g_sink = state;
+}
+
+static void tiny_task(void* data) {
+    (void)data;
+    spin(BENCH_TINY_WORK);
+    atomic_fetch_add(&g_done, 1);
+}
+
+static void cpu_task(void* data) {
+    (void)data;
+    spin(BENCH_CPU_WORK);
+    atomic_fetch_add(&g_done, 1);
+}
+
+static void blocking_task(void* data) {
+    (void)data;
+    usleep(BENCH_BLOCKING_US);
+    atomic_fetch_add(&g_done, 1);
+}
+
+typedef struct {
+    const char* name;
+    const char* site;
+    void (*work)(void*);
+    uint32_t count;
+} bench_workload_t;
+
+static const bench_workload_t g_workloads[] = {
+    { "tiny tasks", "bench_auto_tiny", tiny_task, BENCH_TINY_TASKS },
+    { "cpu-bound", "bench_auto_cpu", cpu_task, BENCH_CPU_TASKS },
+    { "blocking", "bench_auto_blocking", blocking_task, BENCH_BLOCKING_TASKS },
+};
+
+#define BENCH_VARIANTS 4
+static const rift_concurrency_mode_t g_variant_modes[BENCH_VARIANTS] = {
+    CONCURRENCY_SIMULATED, CONCURRENCY_HYBRID, CONCURRENCY_TRUE_THREAD, CONCURRENCY_AUTO
+};
+static const char* g_variant_names[BENCH_VARIANTS] = {
+    "simulated", "hybrid", "thread pool", "auto"
+};
+
+static void bench_drive(void) {
+    // Nobody else drives the single-thread scheduler
+    if (rift_simulated_schedule_cycle() == 0) {
+        sched_yield();
+    }
+}
+
+/**
+ * @brief Spawn a workload in one mode and drive it to completion; ms
+ */
+static double bench_run(const bench_workload_t* workload, rift_concurrency_mode_t mode) {
+    rift_governance_policy_t policy = {0};
+    policy.mode = mode;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+
+    atomic_store(&g_done, 0);
+    double start = now_ms();
+    for (uint32_t i = 0; i < workload->count; i++) {
+        while (i - atomic_load(&g_done) >= BENCH_IN_FLIGHT) {
+            bench_drive();
+        }
+        uint64_t rift_id;
+        switch (mode) {
+        case CONCURRENCY_AUTO:
+            rift_id = rift_auto_spawn(0, &policy, workload->work, NULL, workload->site);
+            break;
+        case CONCURRENCY_TRUE_THREAD:
+            rift_id = rift_true_spawn_thread(0, &policy, workload->work, NULL, workload->site);
+            break;
+        default:
+            rift_id = rift_simulated_spawn(0, &policy, workload->work, NULL, workload->site);
+            break;
+        }
+        if (rift_id == 0) {
+            return -1.0;
+        }
+    }
+
+    while (atomic_load(&g_done) < workload->count) {
+        bench_drive();
+    }
+    return now_ms() - start;
+}
+
+int main(void) {
+    if (rift_simulated_init() != 0 || rift_hybrid_init(0) != 0 ||
+        rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    double best[3][BENCH_VARIANTS];
+    int status = 0;
+
+    quiet_begin();
+    for (int w = 0; w < 3; w++) {
+        for (int v = 0; v < BENCH_VARIANTS; v++) {
+            best[w][v] = -1.0;
+            for (int round = 0; round < BENCH_ROUNDS; round++) {
+                double elapsed = bench_run(&g_workloads[w], g_variant_modes[v]);
+                if (elapsed < 0) {
+                    status = 1;
+                    break;
+                }
+                if (best[w][v] < 0 || elapsed < best[w][v]) {
+                    best[w][v] = elapsed;
+                }
+            }
+        }
+    }
+    rift_auto_stats_t stats;
+    rift_auto_get_stats(&stats);
+    rift_auto_site_stats_t sites[3];
+    for (int w = 0; w < 3; w++) {
+        rift_auto_get_site(g_workloads[w].site, &sites[w]);
+    }
+    rift_true_concurrency_cleanup();
+    rift_hybrid_cleanup();
+    rift_simulated_cleanup();
+    quiet_end();
+
+    static const char* class_names[] = { "measuring", "short", "cpu-bound", "blocking" };
+    printf("\n=== AUTO MODE SELECTION (best of %d rounds, ms) ===\n", BENCH_ROUNDS);
+    printf("%-14s", "WORKLOAD");
+    for (int v = 0; v < BENCH_VARIANTS; v++) {
+        printf(" %-12s", g_variant_names[v]);
+    }
+    printf(" %s\n", "auto chose");
+    for (int w = 0; w < 3; w++) {
+        printf("%-14s", g_workloads[w].name);
+        for (int v = 0; v < BENCH_VARIANTS; v++) {
+            if (best[w][v] < 0) {
+                printf(" %-12s", "FAILED");
+            } else {
+                printf(" %-12.2f", best[w][v]);
+            }
+        }
+        printf(" %s (run %.1f us)\n", class_names[sites[w].site_class],
+               (double)sites[w].avg_run_ns / 1000.0);
+    }
+    printf("\nAuto spawns: %lu simulated, %lu hybrid, %lu thread (%lu dedicated), %lu process\n",
+           (unsigned long)stats.mode_spawns[CONCURRENCY_SIMULATED],
+           (unsigned long)stats.mode_spawns[CONCURRENCY_HYBRID],
+           (unsigned long)stats.mode_spawns[CONCURRENCY_TRUE_THREAD],
+           (unsigned long)stats.dedicated,
+           (unsigned long)stats.mode_spawns[CONCURRENCY_TRUE_PROCESS]);
+    printf("Measured spawn cost: thread %.1f us, hybrid %.1f us\n",
+           (double)stats.spawn_cost_ns[CONCURRENCY_TRUE_THREAD] / 1000.0,
+           (double)stats.spawn_cost_ns[CONCURRENCY_HYBRID] / 1000.0);
+    return status;
+}
@@ -0,0 +1,178 @@
+/**
+ * @file bench_backpressure.c
+ * @brief Backpressure Benchmark - Overloaded Producer on the Worker Pool
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * One producer spawns short pooled tasks as fast as it can, far faster than
+ * the workers drain them. Unbounded, the queue grows until the spawn
+ * registry is exhausted and further spawns fail, and every task waits
+ * behind the whole backlog. Bounded with max_queued, each overflow policy
+ * keeps the queue (and the contexts it holds) at the bound: blocking paces
+ * the producer, fail-fast sheds load, and caller-runs makes the producer do
+ * the excess work itself. For each run the benchmark reports spawn outcomes,
+ * the deepest queue, and how long tasks waited between spawn and start.
+ * Spawn logging is sent to /dev/null while timing.
+ */
+
+#include "rift_telemetry.h"
+#include "rift_true_concurrency.h"
+#include "rift_true_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define BENCH_TASKS 4000
+#define BENCH_TASK_US 50
+#define BENCH_MAX_QUEUED 32
+
+typedef struct {
+    uint64_t spawn_ns;                    // Set by the producer before spawning
+    uint64_t start_ns;                    // Set by the task when it starts
+} bench_task_t;
+
+static bench_task_t g_tasks[BENCH_TASKS];
+static _Atomic uint32_t g_done;
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static uint64_t now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static void bench_task(void* data) {
+    bench_task_t* task = data;
+    task->start_ns = now_ns();
+    uint64_t end = task->start_ns + BENCH_TASK_US * 1000;
+    while (now_ns() < end) {
+    }
+    atomic_fetch_add(&g_done, 1);
+}
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+typedef struct {
+    uint32_t spawned;
+    uint32_t refused;                     // Spawn returned 0
+    uint64_t ran_inline;
+    uint32_t peak_depth;
+    double p50_wait_ms;
+    double p99_wait_ms;
+    double max_wait_ms;
+    double elapsed_ms;
+} bench_result_t;
+
+static bench_result_t bench_run(uint32_t max_queued, rift_overflow_policy_t overflow) {
+    bench_result_t result = {0};
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_TRUE_THREAD;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+    policy.max_queued = max_queued;
+    policy.overflow_policy = overflow;
+
+    // Restart the pool so its peak depth covers this run only
+    rift_true_pool_cleanup();
+    rift_true_pool_init(0);
+    rift_backpressure_stats_t before;
+    rift_telemetry_get_backpressure_stats(&before);
+    atomic_store(&g_done, 0);
+
+    uint64_t start = now_ns();
+    for (uint32_t i = 0; i < BENCH_TASKS; i++) {
+        g_tasks[i].spawn_ns = now_ns();
+        g_tasks[i].start_ns = 0;
+        if (rift_true_spawn_thread(0, &policy, bench_task, &g_tasks[i],
+                                   "bench_backpressure") != 0) {
+            result.spawned++;
+        } else {
+            result.refused++;
+        }
+    }
+    while (atomic_load(&g_done) < result.spawned) {
+        sched_yield();
+    }
+    result.elapsed_ms = (double)(now_ns() - start) / 1e6;
+
+    rift_true_pool_stats_t pool_stats;
+    rift_true_pool_get_stats(&pool_stats);
+    result.peak_depth = pool_stats.queue_depth_peak;
+    rift_backpressure_stats_t after;
+    rift_telemetry_get_backpressure_stats(&after);
+    result.ran_inline = after.ran_inline - before.ran_inline;
+
+    static uint64_t waits[BENCH_TASKS];
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < BENCH_TASKS; i++) {
+        if (g_tasks[i].start_ns != 0) {
+            waits[count++] = g_tasks[i].start_ns - g_tasks[i].spawn_ns;
+        }
+    }
+    if (count > 0) {
+        qsort(waits, count, sizeof(waits[0]), compare_u64);
+        result.p50_wait_ms = (double)waits[count / 2] / 1e6;
+        result.p99_wait_ms = (double)waits[(count * 99) / 100] / 1e6;
+        result.max_wait_ms = (double)waits[count - 1] / 1e6;
+    }
+    return result;
+}
+
+int main(void) {
+    if (rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    static const char* names[4] = { "unbounded", "block", "fail-fast", "caller-runs" };
+    bench_result_t results[4];
+
+    quiet_begin();
+    results[0] = bench_run(0, OVERFLOW_BLOCK);
+    results[1] = bench_run(BENCH_MAX_QUEUED, OVERFLOW_BLOCK);
+    results[2] = bench_run(BENCH_MAX_QUEUED, OVERFLOW_FAIL_FAST);
+    results[3] = bench_run(BENCH_MAX_QUEUED, OVERFLOW_CALLER_RUNS);
+    rift_true_concurrency_cleanup();
+    quiet_end();
+
+    printf("\n=== BACKPRESSURE (%d spawns of %d us, max_queued %d) ===\n", BENCH_TASKS,
+           BENCH_TASK_US, BENCH_MAX_QUEUED);
+    printf("%-12s %-8s %-8s %-7s %-11s %-9s %-9s %-9s %s\n", "POLICY", "SPAWNED", "REFUSED",
+           "INLINE", "PEAK QUEUE", "P50 ms", "P99 ms", "MAX ms", "TOTAL ms");
+    int status = 0;
+    for (int i = 0; i < 4; i++) {
+        bench_result_t* result = &results[i];
+        printf("%-12s %-8u %-8u %-7lu %-11u %-9.2f %-9.2f %-9.2f %.1f\n", names[i],
+               result->spawned, result->refused, (unsigned long)result->ran_inline,
+               result->peak_depth, result->p50_wait_ms, result->p99_wait_ms,
+               result->max_wait_ms, result->elapsed_ms);
+        // A bounded queue may overshoot by the one spawn in flight per producer
+        if (i > 0 && result->peak_depth > BENCH_MAX_QUEUED + 1) {
+            status = 1;
+        }
+    }
+    if (results[1].spawned != BENCH_TASKS || results[3].spawned != BENCH_TASKS) {
+        status = 1; // Blocking and caller-runs never refuse
+    }
+    return status;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file bench_edf_deadlines.c
+ * @brief EDF Benchmark - Latency-Critical Tasks Behind a Batch Backlog
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Queues a backlog of batch tasks and then a handful of short
+ * latency-critical tasks that must finish within a few milliseconds of
+ * being spawned, on the single-thread scheduler and on the thread pool.
+ * Spawned as SCHEDULE_BATCH the critical tasks wait behind the backlog;
+ * spawned as SCHEDULE_EDF they overtake it. Deadlines are checked by the
+ * benchmark itself so both classes are measured the same way; telemetry's
+ * own met/missed counters are printed for the EDF runs. Finally a burst of
+ * EDF spawns claiming more runtime than fits before their deadline shows
+ * admission control refusing the excess. Spawn logging is sent to
+ * /dev/null while timing.
+ */
+
+#include "rift_telemetry.h"
+#include "rift_simulated.h"
+#include "rift_true_concurrency.h"
+#include "rift_true_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define BENCH_BATCH_TASKS 128
+#define BENCH_BATCH_US 2000
+#define BENCH_CRITICAL_TASKS 8             // 1 ms claims: all fit one runner's deadline
+#define BENCH_CRITICAL_US 200
+#define BENCH_DEADLINE_MS 10
+#define BENCH_CLAIM_MS 3
+#define BENCH_CLAIMS 16
+
+typedef struct {
+    uint64_t deadline_ns;                 // Spawn time plus BENCH_DEADLINE_MS
+    uint64_t finish_ns;                   // When the work returned
+} bench_critical_t;
+
+static bench_critical_t g_critical[BENCH_CRITICAL_TASKS];
+static _Atomic uint32_t g_done;
+static _Atomic uint64_t g_batch_finish_ns;
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static uint64_t now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static void busy_us(uint64_t us) {
+    uint64_t end = now_ns() + us * 1000;
+    while (now_ns() < end) {
+    }
+}
+
+static void batch_task(void* data) {
+    (void)data;
+    busy_us(BENCH_BATCH_US);
+    atomic_store(&g_batch_finish_ns, now_ns());
+    atomic_fetch_add(&g_done, 1);
+}
+
+static void critical_task(void* data) {
+    bench_critical_t* critical = data;
+    busy_us(BENCH_CRITICAL_US);
+    critical->finish_ns = now_ns();
+    atomic_fetch_add(&g_done, 1);
+}
+
+static void claim_task(void* data) {
+    (void)data;
+}
+
+typedef struct {
+    uint32_t met;
+    uint32_t missed;
+    double worst_late_ms;
+    double backlog_ms;                    // Until the last batch task finished
+    rift_deadline_stats_t telemetry;      // Telemetry's counters for this run
+    bool failed;
+} bench_result_t;
+
+static uint64_t bench_spawn(rift_concurrency_mode_t mode, const rift_governance_policy_t* policy,
+                            void (*work)(void*), void* data) {
+    if (mode == CONCURRENCY_SIMULATED) {
+        return rift_simulated_spawn(0, policy, work, data, "bench_edf_deadlines");
+    }
+    return rift_true_spawn_thread(0, policy, work, data, "bench_edf_deadlines");
+}
+
+/**
+ * @brief Backlog, then critical tasks of the given class; driven to completion
+ */
+static bench_result_t bench_run(rift_concurrency_mode_t mode,
+                                rift_schedule_class_t critical_class) {
+    bench_result_t result = {0};
+    rift_governance_policy_t policy = {0};
+    policy.mode = mode;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+
+    rift_deadline_stats_t before;
+    rift_telemetry_get_deadline_stats(&before);
+    atomic_store(&g_done, 0);
+    uint64_t start = now_ns();
+
+    for (uint32_t i = 0; i < BENCH_BATCH_TASKS; i++) {
+        result.failed |= bench_spawn(mode, &policy, batch_task, NULL) == 0;
+    }
+
+    rift_governance_policy_t critical_policy = policy;
+    critical_policy.schedule_class = critical_class;
+    critical_policy.deadline_ms = BENCH_DEADLINE_MS;
+    critical_policy.expected_runtime_ms = 1;
+    for (uint32_t i = 0; i < BENCH_CRITICAL_TASKS; i++) {
+        g_critical[i].deadline_ns = now_ns() + BENCH_DEADLINE_MS * 1000000ull;
+        g_critical[i].finish_ns = 0;
+        result.failed |= bench_spawn(mode, &critical_policy, critical_task, &g_critical[i]) == 0;
+    }
+
+    while (!result.failed && atomic_load(&g_done) < BENCH_BATCH_TASKS + BENCH_CRITICAL_TASKS) {
+        // Nobody else drives the single-thread scheduler
+        if (rift_simulated_schedule_cycle() == 0) {
+            sched_yield();
+        }
+    }
+    result.backlog_ms = (double)(atomic_load(&g_batch_finish_ns) - start) / 1e6;
+
+    for (uint32_t i = 0; i < BENCH_CRITICAL_TASKS; i++) {
+        if (g_critical[i].finish_ns <= g_critical[i].deadline_ns) {
+            result.met++;
+            continue;
+        }
+        result.missed++;
+        double late_ms = (double)(g_critical[i].finish_ns - g_critical[i].deadline_ns) / 1e6;
+        if (late_ms > result.worst_late_ms) {
+            result.worst_late_ms = late_ms;
+        }
+    }
+
+    rift_deadline_stats_t after;
+    rift_telemetry_get_deadline_stats(&after);
+    result.telemetry.met = after.met - before.met;
+    result.telemetry.missed = after.missed - before.missed;
+    return result;
+}
+
+/**
+ * @brief Spawn EDF tasks claiming BENCH_CLAIM_MS each until admission
+ *        refuses; the simulated scheduler holds them until driven
+ * @return Number admitted
+ */
+static uint32_t bench_admission(uint32_t* rejected) {
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_SIMULATED;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+    policy.schedule_class = SCHEDULE_EDF;
+    policy.deadline_ms = BENCH_DEADLINE_MS * 2;
+    policy.expected_runtime_ms = BENCH_CLAIM_MS;
+
+    uint32_t admitted = 0;
+    *rejected = 0;
+    for (uint32_t i = 0; i < BENCH_CLAIMS; i++) {
+        if (rift_simulated_spawn(0, &policy, claim_task, NULL, "bench_edf_admission") != 0) {
+            admitted++;
+        } else {
+            (*rejected)++;
+        }
+    }
+    while (rift_simulated_runnable_count() > 0) {
+        rift_simulated_schedule_cycle();
+    }
+    return admitted;
+}
+
+int main(void) {
+    if (rift_simulated_init() != 0 || rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    static const rift_concurrency_mode_t modes[2] = {
+        CONCURRENCY_SIMULATED, CONCURRENCY_TRUE_THREAD
+    };
+    static const char* mode_names[2] = { "simulated", "thread pool" };
+    static const char* class_names[2] = { "batch", "edf" };
+    bench_result_t results[2][2];
+
+    quiet_begin();
+    for (int m = 0; m < 2; m++) {
+        for (int c = 0; c < 2; c++) {
+            results[m][c] = bench_run(modes[m], c == 0 ? SCHEDULE_BATCH : SCHEDULE_EDF);
+        }
+    }
+    uint32_t rejected;
+    uint32_t admitted = bench_admission(&rejected);
+    rift_deadline_stats_t totals;
+    rift_telemetry_get_deadline_stats(&totals);
+    rift_true_pool_stats_t pool_stats;
+    rift_true_pool_get_stats(&pool_stats);
+    rift_true_concurrency_cleanup();
+    rift_simulated_cleanup();
+    quiet_end();
+
+    int status = 0;
+    printf("\n=== EDF DEADLINES (%d critical tasks, %d ms deadline, behind %d x %.1f ms "
+           "batch) ===\n", BENCH_CRITICAL_TASKS, BENCH_DEADLINE_MS, BENCH_BATCH_TASKS,
+           BENCH_BATCH_US / 1000.0);
+    printf("%-12s %-6s %-6s %-7s %-14s %-14s %s\n", "RUNNER", "CLASS", "MET", "MISSED",
+           "WORST LATE ms", "BACKLOG ms", "TELEMETRY met/missed");
+    for (int m = 0; m < 2; m++) {
+        for (int c = 0; c < 2; c++) {
+            bench_result_t* result = &results[m][c];
+            if (result->failed) {
+                printf("%-12s %-6s FAILED\n", mode_names[m], class_names[c]);
+                status = 1;
+                continue;
+            }
+            printf("%-12s %-6s %-6u %-7u %-14.2f %-14.2f", mode_names[m], class_names[c],
+                   result->met, result->missed, result->worst_late_ms, result->backlog_ms);
+            if (c == 0) {
+                printf(" -\n");
+            } else {
+                printf(" %lu/%lu\n", (unsigned long)result->telemetry.met,
+                       (unsigned long)result->telemetry.missed);
+            }
+        }
+    }
+    printf("\nPool: %u workers, %lu units queued by deadline\n", pool_stats.worker_count,
+           (unsigned long)pool_stats.tasks_deadline);
+    printf("Admission: %u of %d EDF spawns claiming %d ms within %d ms admitted, %u rejected\n",
+           admitted, BENCH_CLAIMS, BENCH_CLAIM_MS, BENCH_DEADLINE_MS * 2, rejected);
+    printf("Telemetry: %lu met, %lu missed, %lu rejected at admission\n",
+           (unsigned long)totals.met, (unsigned long)totals.missed,
+           (unsigned long)totals.rejected);
+    return status;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file bench_gang_start.c
+ * @brief Gang Start Benchmark - Start Skew of Dedicated Thread Batches
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Spawns batches of dedicated threads whose work stamps the time it starts,
+ * once as a plain batch, where each thread runs as soon as it is created,
+ * and once with gang_start, where every member parks until the last has
+ * been created and placed and all are released by one futex broadcast.
+ * For each batch size the benchmark reports the mean start skew (first
+ * member starting to last) over BENCH_ROUNDS batches, the mean time the
+ * spawn call took, and for gangs the skew telemetry recorded. With fewer
+ * CPUs than members, what is left of a gang's skew is its woken members
+ * waiting their turn for a CPU. Spawn logging is sent to /dev/null while
+ * timing.
+ */
+
+#include "rift_telemetry.h"
+#include "rift_true_concurrency.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define BENCH_ROUNDS 20
+#define BENCH_MAX_MEMBERS 64
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static uint64_t now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+typedef struct {
+    uint32_t members;
+    double plain_skew_us;
+    double plain_spawn_us;
+    double gang_skew_us;
+    double gang_spawn_us;
+    double telemetry_skew_us;
+    uint32_t failed;
+} bench_result_t;
+
+static uint64_t g_starts[BENCH_MAX_MEMBERS];
+
+static void bench_member(void* data) {
+    g_starts[(uintptr_t)data] = now_ns();
+}
+
+/**
+ * @brief Spawn one batch and wait for it
+ * @return Start skew in ns, 0 if the batch could not be spawned
+ */
+static uint64_t bench_batch(uint32_t members, bool gang, uint64_t* spawn_ns) {
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_TRUE_THREAD;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+    policy.dedicated_thread = true;
+    policy.gang_start = gang;
+
+    void* data[BENCH_MAX_MEMBERS];
+    for (uint32_t i = 0; i < members; i++) {
+        data[i] = (void*)(uintptr_t)i;
+    }
+    uint64_t start = now_ns();
+    uint64_t first_id = rift_true_spawn_batch(0, &policy, bench_member, data, members,
+                                              "bench_gang_start");
+    *spawn_ns = now_ns() - start;
+    if (first_id == 0) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < members; i++) {
+        rift_true_wait(first_id + i, 0);
+    }
+
+    uint64_t first = UINT64_MAX;
+    uint64_t last = 0;
+    for (uint32_t i = 0; i < members; i++) {
+        first = g_starts[i] < first ? g_starts[i] : first;
+        last = g_starts[i] > last ? g_starts[i] : last;
+    }
+    return last - first;
+}
+
+static bench_result_t bench_run(uint32_t members) {
+    bench_result_t result = { .members = members };
+    rift_gang_stats_t before;
+    rift_telemetry_get_gang_stats(&before);
+
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        for (int gang = 0; gang < 2; gang++) {
+            uint64_t spawn_ns;
+            uint64_t skew_ns = bench_batch(members, gang, &spawn_ns);
+            if (skew_ns == 0) {
+                result.failed++;
+                continue;
+            }
+            if (gang) {
+                result.gang_skew_us += (double)skew_ns / 1e3 / BENCH_ROUNDS;
+                result.gang_spawn_us += (double)spawn_ns / 1e3 / BENCH_ROUNDS;
+            } else {
+                result.plain_skew_us += (double)skew_ns / 1e3 / BENCH_ROUNDS;
+                result.plain_spawn_us += (double)spawn_ns / 1e3 / BENCH_ROUNDS;
+            }
+        }
+    }
+
+    rift_gang_stats_t after;
+    rift_telemetry_get_gang_stats(&after);
+    uint64_t gangs = after.gangs - before.gangs;
+    if (gangs > 0) {
+        result.telemetry_skew_us = (double)(after.total_skew_ns - before.total_skew_ns) /
+                                   1e3 / gangs;
+    }
+    if (gangs != BENCH_ROUNDS) {
+        result.failed++;
+    }
+    return result;
+}
+
+int main(void) {
+    if (rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    static const uint32_t sizes[] = { 8, 32, BENCH_MAX_MEMBERS };
+    bench_result_t results[3];
+
+    quiet_begin();
+    for (int i = 0; i < 3; i++) {
+        results[i] = bench_run(sizes[i]);
+    }
+    rift_true_concurrency_cleanup();
+    quiet_end();
+
+    printf("\n=== GANG START (dedicated threads, mean of %d batches) ===\n", BENCH_ROUNDS);
+    printf("%-8s %-15s %-15s %-15s %-15s %s\n", "THREADS", "PLAIN SKEW us", "GANG SKEW us",
+           "PLAIN SPAWN us", "GANG SPAWN us", "RECORDED SKEW us");
+    int status = 0;
+    for (int i = 0; i < 3; i++) {
+        bench_result_t* result = &results[i];
+        printf("%-8u %-15.1f %-15.1f %-15.1f %-15.1f %.1f\n", result->members,
+               result->plain_skew_us, result->gang_skew_us, result->plain_spawn_us,
+               result->gang_spawn_us, result->telemetry_skew_us);
+        if (result->failed != 0) {
+            status = 1;
+        }
+    }
+    // Releasing together must beat staggered creation on the largest gang
+    if (results[2].gang_skew_us >= results[2].plain_skew_us) {
+        status = 1;
+    }
+    return status;
+}
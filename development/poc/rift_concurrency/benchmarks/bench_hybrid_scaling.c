@@ -0,0 +1,92 @@
+/**
+ * @file bench_hybrid_scaling.c
+ * @brief Hybrid M:N Scalability Benchmark
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Runs a fixed set of CPU-bound, frequently yielding simulated tasks on the
+ * hybrid pool with 1 to 64 workers and reports throughput and speedup.
+ * Worker counts above the online CPU count measure oversubscription.
+ */
+
+#include "rift_simulated.h"
+#include "rift_simulated_hybrid.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define BENCH_TASK_COUNT 128
+#define BENCH_SLICES_PER_TASK 200
+#define BENCH_WORK_PER_SLICE 20000
+
+static volatile uint64_t g_sink;
+
+static void bench_task(void* data) {
+    uint64_t state = (uint64_t)(uintptr_t)data | 1;
+    for (int slice = 0; slice < BENCH_SLICES_PER_TASK; slice++) {
+        for (int i = 0; i < BENCH_WORK_PER_SLICE; i++) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        rift_simulated_yield();
+    }
+    g_sink = state;
+}
+
+static double elapsed_seconds(const struct timespec* start, const struct timespec* end) {
+    return (double)(end->tv_sec - start->tv_sec) +
+           (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+int main(void) {
+    static const uint32_t worker_counts[] = {1, 2, 4, 8, 16, 32, 64};
+    const size_t runs = sizeof(worker_counts) / sizeof(worker_counts[0]);
+    double seconds[sizeof(worker_counts) / sizeof(worker_counts[0])] = {0};
+    uint64_t steals[sizeof(worker_counts) / sizeof(worker_counts[0])] = {0};
+
+    if (rift_simulated_init() != 0) {
+        return 1;
+    }
+
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_HYBRID;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+
+    for (size_t r = 0; r < runs; r++) {
+        if (rift_hybrid_init(worker_counts[r]) != 0) {
+            return 1;
+        }
+
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        for (uintptr_t t = 0; t < BENCH_TASK_COUNT; t++) {
+            if (rift_hybrid_spawn(0, &policy, bench_task, (void*)t, "bench_hybrid_scaling") == 0) {
+                fprintf(stderr, "[BENCH] Spawn %lu failed\n", (unsigned long)t);
+                return 1;
+            }
+        }
+        rift_hybrid_wait();
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        seconds[r] = elapsed_seconds(&start, &end);
+
+        rift_hybrid_stats_t stats;
+        rift_hybrid_get_stats(&stats);
+        steals[r] = stats.steals;
+
+        rift_hybrid_cleanup();
+    }
+
+    rift_simulated_cleanup();
+
+    printf("\n=== HYBRID M:N SCALING (%d tasks x %d slices, %ld online CPUs) ===\n",
+           BENCH_TASK_COUNT, BENCH_SLICES_PER_TASK, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-8s %-12s %-16s %-10s %s\n", "WORKERS", "SECONDS", "SLICES/SEC", "SPEEDUP", "STEALS");
+    for (size_t r = 0; r < runs; r++) {
+        double slices = (double)BENCH_TASK_COUNT * BENCH_SLICES_PER_TASK;
+        printf("%-8u %-12.4f %-16.0f %-10.2f %lu\n", worker_counts[r], seconds[r],
+               slices / seconds[r], seconds[0] / seconds[r], (unsigned long)steals[r]);
+    }
+    return 0;
+}
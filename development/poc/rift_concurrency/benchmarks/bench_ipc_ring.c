@@ -0,0 +1,261 @@
+/**
+ * @file bench_ipc_ring.c
+ * @brief Shared-Memory IPC Ring Benchmark - Throughput and Wake Latency
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Streams messages from TRUE_PROCESS children to their parent through a
+ * bound IPC ring and reports throughput per message size, for one SPSC
+ * producer and for several MPSC producers. The consumer reads records in
+ * place. Wake latency is half the round trip of a one-message ping-pong
+ * between parent and child over a pair of rings, compared with the same
+ * ping-pong over pipes. Both sides block on every message, so the latency
+ * includes the futex wake and, on a single CPU, the context switch.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_ipc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define BENCH_STREAM_BYTES (1ull << 30)
+#define BENCH_RING_BYTES (4u << 20)
+#define BENCH_MPSC_PRODUCERS 4
+#define BENCH_PINGPONG_ROUNDS 20000
+#define BENCH_MAX_MESSAGE 65536
+
+typedef struct {
+    uint32_t message_size;
+    uint64_t message_count;               // Per producer
+} bench_stream_t;
+
+static uint8_t g_payload[BENCH_MAX_MESSAGE];
+static bench_stream_t g_stream;
+static rift_ipc_ring_t* g_down_ring;      // Parent -> child for ping-pong
+static int g_pipe_up[2];
+static int g_pipe_down[2];
+
+static double elapsed_seconds(const struct timespec* start, const struct timespec* end) {
+    return (double)(end->tv_sec - start->tv_sec) +
+           (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+// =============================================================================
+// CHILD WORK
+// =============================================================================
+
+static void stream_producer(void* data) {
+    bench_stream_t* stream = data;
+    rift_ipc_ring_t* ring = rift_ipc_parent_ring();
+    for (uint64_t i = 0; i < stream->message_count; i++) {
+        memcpy(g_payload, &i, sizeof(i));
+        if (rift_ipc_send(ring, g_payload, stream->message_size) != RIFT_IPC_OK) {
+            return;
+        }
+    }
+}
+
+static void ring_ponger(void* data) {
+    (void)data;
+    rift_ipc_ring_t* up = rift_ipc_parent_ring();
+    uint64_t value;
+    uint32_t length;
+    while (rift_ipc_recv(g_down_ring, &value, sizeof(value), &length) == RIFT_IPC_OK) {
+        rift_ipc_send(up, &value, sizeof(value));
+    }
+}
+
+static void pipe_ponger(void* data) {
+    (void)data;
+    close(g_pipe_down[1]); // Inherited copy would keep the pipe from reaching EOF
+    uint64_t value;
+    while (read(g_pipe_down[0], &value, sizeof(value)) == (ssize_t)sizeof(value)) {
+        if (write(g_pipe_up[1], &value, sizeof(value)) != (ssize_t)sizeof(value)) {
+            return;
+        }
+    }
+}
+
+// =============================================================================
+// MEASUREMENTS
+// =============================================================================
+
+/**
+ * @brief Stream BENCH_STREAM_BYTES from producers children; returns GB/s
+ */
+static double bench_stream(rift_ipc_kind_t kind, uint32_t producers, uint32_t message_size) {
+    rift_ipc_ring_t* ring = rift_ipc_create(kind, BENCH_RING_BYTES);
+    if (!ring) {
+        return -1.0;
+    }
+
+    g_stream.message_size = message_size;
+    g_stream.message_count = BENCH_STREAM_BYTES / message_size / producers;
+    void* data[BENCH_MPSC_PRODUCERS];
+    for (uint32_t i = 0; i < producers; i++) {
+        data[i] = &g_stream;
+    }
+
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_TRUE_PROCESS;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+    policy.ipc_ring = ring;
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    uint64_t first = rift_true_spawn_batch(0, &policy, stream_producer, data, producers,
+                                           "bench_ipc_ring");
+    if (first == 0) {
+        rift_ipc_destroy(ring);
+        return -1.0;
+    }
+
+    uint64_t received = 0;
+    uint64_t bytes = 0;
+    uint32_t length;
+    const void* payload;
+    while ((payload = rift_ipc_peek(ring, &length)) != NULL) {
+        uint64_t sequence;
+        memcpy(&sequence, payload, sizeof(sequence)); // Touch the record
+        (void)sequence;
+        bytes += length;
+        received++;
+        rift_ipc_consume(ring);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    for (uint32_t i = 0; i < producers; i++) {
+        rift_true_wait(first + i, 0);
+    }
+    rift_ipc_destroy(ring);
+
+    if (received != g_stream.message_count * producers) {
+        fprintf(stderr, "[BENCH] Lost messages: %lu of %lu\n", (unsigned long)received,
+                (unsigned long)(g_stream.message_count * producers));
+        return -1.0;
+    }
+    return (double)bytes / elapsed_seconds(&start, &end) / 1e9;
+}
+
+/**
+ * @brief One-way wake latency in ns over rings (use_ring) or pipes
+ */
+static double bench_pingpong(bool use_ring) {
+    rift_ipc_ring_t* up = NULL;
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_TRUE_PROCESS;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+
+    if (use_ring) {
+        up = rift_ipc_create(RIFT_IPC_SPSC, 4096);
+        g_down_ring = rift_ipc_create(RIFT_IPC_SPSC, 4096); // Inherited unbound
+        if (!up || !g_down_ring) {
+            return -1.0;
+        }
+        policy.ipc_ring = up;
+    } else if (pipe(g_pipe_up) != 0 || pipe(g_pipe_down) != 0) {
+        return -1.0;
+    }
+
+    uint64_t child = rift_true_spawn_process(0, &policy, use_ring ? ring_ponger : pipe_ponger,
+                                             NULL, "bench_ipc_ring");
+    if (child == 0) {
+        return -1.0;
+    }
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint64_t i = 0; i < BENCH_PINGPONG_ROUNDS; i++) {
+        uint64_t value = i;
+        uint32_t length;
+        if (use_ring) {
+            rift_ipc_send(g_down_ring, &value, sizeof(value));
+            rift_ipc_recv(up, &value, sizeof(value), &length);
+        } else if (write(g_pipe_down[1], &value, sizeof(value)) != (ssize_t)sizeof(value) ||
+                   read(g_pipe_up[0], &value, sizeof(value)) != (ssize_t)sizeof(value)) {
+            return -1.0;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (use_ring) {
+        rift_ipc_close(g_down_ring);
+    } else {
+        close(g_pipe_down[1]);
+    }
+    rift_true_wait(child, 0);
+
+    if (use_ring) {
+        rift_ipc_destroy(g_down_ring);
+        rift_ipc_destroy(up);
+    } else {
+        close(g_pipe_down[0]);
+        close(g_pipe_up[0]);
+        close(g_pipe_up[1]);
+    }
+    return elapsed_seconds(&start, &end) / BENCH_PINGPONG_ROUNDS / 2 * 1e9;
+}
+
+int main(void) {
+    if (rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    static const uint32_t sizes[] = { 64, 1024, 16384, 65536 };
+    const uint32_t size_count = sizeof(sizes) / sizeof(sizes[0]);
+    double spsc[4], mpsc[4];
+
+    quiet_begin();
+    for (uint32_t i = 0; i < size_count; i++) {
+        spsc[i] = bench_stream(RIFT_IPC_SPSC, 1, sizes[i]);
+        mpsc[i] = bench_stream(RIFT_IPC_MPSC, BENCH_MPSC_PRODUCERS, sizes[i]);
+    }
+    double ring_latency = bench_pingpong(true);
+    double pipe_latency = bench_pingpong(false);
+    quiet_end();
+
+    rift_true_concurrency_cleanup();
+
+    printf("\n=== IPC RING THROUGHPUT (%llu MB per row, %u KB ring) ===\n",
+           BENCH_STREAM_BYTES >> 20, BENCH_RING_BYTES >> 10);
+    printf("%-10s %-14s %s\n", "MESSAGE", "SPSC GB/S", "MPSC x4 GB/S");
+    for (uint32_t i = 0; i < size_count; i++) {
+        if (spsc[i] < 0 || mpsc[i] < 0) {
+            fprintf(stderr, "[BENCH] Stream failed at %u bytes\n", sizes[i]);
+            return 1;
+        }
+        printf("%-10u %-14.2f %.2f\n", sizes[i], spsc[i], mpsc[i]);
+    }
+
+    if (ring_latency < 0 || pipe_latency < 0) {
+        fprintf(stderr, "[BENCH] Ping-pong failed\n");
+        return 1;
+    }
+    printf("\n=== WAKE LATENCY (one way, %d round trips) ===\n", BENCH_PINGPONG_ROUNDS);
+    printf("%-10s %.0f ns\n", "ipc ring", ring_latency);
+    printf("%-10s %.0f ns\n", "pipe", pipe_latency);
+    return 0;
+}
@@ -0,0 +1,320 @@
+/**
+ * @file bench_parallel_for.c
+ * @brief Parallel Loop Benchmark - RIFT Parallel-For/Reduce Against OpenMP
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Runs the same three loops sequentially, with OpenMP and on the RIFT
+ * runtime: a uniform map, an irregular map whose iteration cost grows
+ * with the index (imbalanced under a static schedule) and a sum
+ * reduction. RIFT runs each loop as one governed task through
+ * rift_parallel_for()/rift_parallel_reduce(), and the map once more the
+ * old way, one rift_true_spawn_thread() per chunk, to show what per-chunk
+ * governance costs. Results are checked against the sequential run and
+ * the best of several repetitions is reported. Built with -fopenmp; spawn
+ * logging is sent to /dev/null while timing.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_parallel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <omp.h>
+
+#define BENCH_ELEMENTS (4 * 1024 * 1024)
+#define BENCH_IRREGULAR 16384
+#define BENCH_REPEAT 5
+#define BENCH_SPAWN_CHUNKS 64
+#define BENCH_GRAIN 4096
+
+static double g_input[BENCH_ELEMENTS];
+static double g_output[BENCH_ELEMENTS];
+static double g_expected[BENCH_ELEMENTS];
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static double now_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e3 + (double)now.tv_nsec / 1e6;
+}
+
+// =============================================================================
+// LOOP BODIES
+// =============================================================================
+
+static double uniform_cost(double x) {
+    double y = x;
+    for (int k = 0; k < 16; k++) {
+        y = y * 0.999 + 0.5 / (1.0 + y * y);
+    }
+    return y;
+}
+
+// Cost grows linearly with the index
+static double irregular_cost(int64_t i) {
+    double y = (double)i;
+    for (int64_t k = 0; k < i / 8; k++) {
+        y = y * 0.999 + 0.5 / (1.0 + y * y);
+    }
+    return y;
+}
+
+// noipa: every variant runs the same code, not a copy specialized on constant bounds
+__attribute__((noipa)) static void uniform_body(int64_t begin, int64_t end, void* data) {
+    (void)data;
+    for (int64_t i = begin; i < end; i++) {
+        g_output[i] = uniform_cost(g_input[i]);
+    }
+}
+
+__attribute__((noipa)) static void irregular_body(int64_t begin, int64_t end, void* data) {
+    (void)data;
+    for (int64_t i = begin; i < end; i++) {
+        g_output[i] = irregular_cost(i);
+    }
+}
+
+__attribute__((noipa)) static void sum_body(int64_t begin, int64_t end, void* data,
+                                            void* accumulator) {
+    (void)data;
+    double sum = 0.0;
+    for (int64_t i = begin; i < end; i++) {
+        sum += uniform_cost(g_input[i]);
+    }
+    *(double*)accumulator += sum;
+}
+
+static void sum_join(void* accumulator, const void* partial, void* data) {
+    (void)data;
+    *(double*)accumulator += *(const double*)partial;
+}
+
+typedef struct {
+    int64_t begin;
+    int64_t end;
+} bench_chunk_t;
+
+static void spawned_chunk(void* data) {
+    bench_chunk_t* chunk = data;
+    uniform_body(chunk->begin, chunk->end, NULL);
+}
+
+// =============================================================================
+// VARIANTS
+// =============================================================================
+
+typedef enum {
+    LOOP_UNIFORM,
+    LOOP_IRREGULAR,
+    LOOP_SUM
+} bench_loop_t;
+
+static int64_t loop_size(bench_loop_t loop) {
+    return loop == LOOP_IRREGULAR ? BENCH_IRREGULAR : BENCH_ELEMENTS;
+}
+
+static double run_sequential(bench_loop_t loop) {
+    double sum = 0.0;
+    switch (loop) {
+    case LOOP_UNIFORM:
+        uniform_body(0, BENCH_ELEMENTS, NULL);
+        break;
+    case LOOP_IRREGULAR:
+        irregular_body(0, BENCH_IRREGULAR, NULL);
+        break;
+    case LOOP_SUM:
+        sum_body(0, BENCH_ELEMENTS, NULL, &sum);
+        break;
+    }
+    return sum;
+}
+
+static double run_openmp(bench_loop_t loop, bool dynamic) {
+    double sum = 0.0;
+    int64_t count = loop_size(loop);
+    if (loop == LOOP_SUM) {
+        #pragma omp parallel for reduction(+:sum) schedule(static)
+        for (int64_t i = 0; i < count; i++) {
+            sum += uniform_cost(g_input[i]);
+        }
+    } else if (dynamic) {
+        #pragma omp parallel for schedule(dynamic, 64)
+        for (int64_t i = 0; i < count; i++) {
+            g_output[i] = loop == LOOP_UNIFORM ? uniform_cost(g_input[i]) : irregular_cost(i);
+        }
+    } else {
+        #pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < count; i++) {
+            g_output[i] = loop == LOOP_UNIFORM ? uniform_cost(g_input[i]) : irregular_cost(i);
+        }
+    }
+    return sum;
+}
+
+static double run_rift(bench_loop_t loop, const rift_governance_policy_t* policy, int64_t grain,
+                       int* status) {
+    rift_range_t range = { 0, loop_size(loop) };
+    double sum = 0.0;
+    double zero = 0.0;
+    switch (loop) {
+    case LOOP_UNIFORM:
+        *status |= RIFT_PARALLEL_FOR(0, policy, range, grain, uniform_body, NULL);
+        break;
+    case LOOP_IRREGULAR:
+        *status |= RIFT_PARALLEL_FOR(0, policy, range, grain, irregular_body, NULL);
+        break;
+    case LOOP_SUM:
+        *status |= RIFT_PARALLEL_REDUCE(0, policy, range, grain, sum_body, sum_join, &zero,
+                                        sizeof(double), NULL, &sum);
+        break;
+    }
+    return sum;
+}
+
+/**
+ * @brief Uniform map as one spawned RIFT task per chunk, waited for in turn
+ */
+static void run_spawn_per_chunk(const rift_governance_policy_t* policy, int* status) {
+    static bench_chunk_t chunks[BENCH_SPAWN_CHUNKS];
+    uint64_t ids[BENCH_SPAWN_CHUNKS];
+    int64_t size = BENCH_ELEMENTS / BENCH_SPAWN_CHUNKS;
+    for (uint32_t i = 0; i < BENCH_SPAWN_CHUNKS; i++) {
+        chunks[i].begin = (int64_t)i * size;
+        chunks[i].end = chunks[i].begin + size;
+        ids[i] = rift_true_spawn_thread(0, policy, spawned_chunk, &chunks[i],
+                                        "bench_parallel_for");
+        *status |= ids[i] == 0;
+    }
+    // Tasks that finished early may already be reaped; the output is checked
+    for (uint32_t i = 0; i < BENCH_SPAWN_CHUNKS; i++) {
+        if (ids[i] != 0) {
+            rift_true_wait(ids[i], 0);
+        }
+    }
+}
+
+static bool output_matches(bench_loop_t loop) {
+    int64_t count = loop_size(loop);
+    for (int64_t i = 0; i < count; i++) {
+        if (g_output[i] != g_expected[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    for (int64_t i = 0; i < BENCH_ELEMENTS; i++) {
+        g_input[i] = (double)(i % 1000) / 7.0;
+    }
+    if (rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_TRUE_THREAD;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+
+    static const char* loop_names[] = { "uniform map", "irregular map", "sum reduce" };
+    static const char* variant_names[] = {
+        "sequential", "openmp static", "openmp dynamic", "rift auto grain", "rift grain 4096",
+        "rift spawn/chunk"
+    };
+    double best[3][6];
+    bool valid[3][6];
+    int status = 0;
+
+    quiet_begin();
+    for (int loop = LOOP_UNIFORM; loop <= LOOP_SUM; loop++) {
+        double expected_sum = run_sequential((bench_loop_t)loop);
+        for (int64_t i = 0; i < loop_size((bench_loop_t)loop); i++) {
+            g_expected[i] = g_output[i];
+        }
+
+        for (int variant = 0; variant < 6; variant++) {
+            best[loop][variant] = -1.0;
+            valid[loop][variant] = true;
+            if (variant == 5 && loop != LOOP_UNIFORM) {
+                continue;
+            }
+            for (int repeat = 0; repeat < BENCH_REPEAT; repeat++) {
+                for (int64_t i = 0; i < loop_size((bench_loop_t)loop); i++) {
+                    g_output[i] = 0.0;
+                }
+                double start = now_ms();
+                double sum = 0.0;
+                int run_status = 0;
+                switch (variant) {
+                case 0: sum = run_sequential((bench_loop_t)loop); break;
+                case 1: sum = run_openmp((bench_loop_t)loop, false); break;
+                case 2: sum = run_openmp((bench_loop_t)loop, true); break;
+                case 3: sum = run_rift((bench_loop_t)loop, &policy, 0, &run_status); break;
+                case 4:
+                    sum = run_rift((bench_loop_t)loop, &policy, BENCH_GRAIN, &run_status);
+                    break;
+                case 5: run_spawn_per_chunk(&policy, &run_status); break;
+                }
+                double elapsed = now_ms() - start;
+
+                bool ok = run_status == 0;
+                if (loop == LOOP_SUM) {
+                    // Partial sums associate differently; allow rounding
+                    ok = ok && fabs(sum - expected_sum) <= 1e-9 * fabs(expected_sum);
+                } else {
+                    ok = ok && output_matches((bench_loop_t)loop);
+                }
+                valid[loop][variant] = valid[loop][variant] && ok;
+                if (best[loop][variant] < 0 || elapsed < best[loop][variant]) {
+                    best[loop][variant] = elapsed;
+                }
+            }
+        }
+    }
+
+    rift_parallel_stats_t stats;
+    rift_parallel_get_stats(&stats);
+    rift_true_concurrency_cleanup();
+    quiet_end();
+
+    printf("\n=== PARALLEL LOOPS (%d OpenMP threads, best of %d, ms) ===\n",
+           omp_get_max_threads(), BENCH_REPEAT);
+    printf("%-18s %-16s %-16s %s\n", "VARIANT", loop_names[0], loop_names[1], loop_names[2]);
+    for (int variant = 0; variant < 6; variant++) {
+        printf("%-18s", variant_names[variant]);
+        for (int loop = LOOP_UNIFORM; loop <= LOOP_SUM; loop++) {
+            if (best[loop][variant] < 0) {
+                printf(" %-16s", "-");
+            } else if (!valid[loop][variant]) {
+                printf(" %-16s", "WRONG");
+                status = 1;
+            } else {
+                printf(" %-16.2f", best[loop][variant]);
+            }
+        }
+        printf("\n");
+    }
+    printf("\nRIFT loops: %lu, %lu chunks, %lu lazy splits, %lu steals, %lu pool helpers\n",
+           (unsigned long)stats.loops, (unsigned long)stats.chunks, (unsigned long)stats.splits,
+           (unsigned long)stats.steals, (unsigned long)stats.helpers);
+    return status;
+}
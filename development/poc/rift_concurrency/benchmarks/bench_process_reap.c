@@ -0,0 +1,205 @@
+/**
+ * @file bench_process_reap.c
+ * @brief Process Reap Benchmark - Exit-to-Publish Latency
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Spawns TRUE_PROCESS children in batches that each exit after a random
+ * delay and reports the reaper's exit-latency histogram: the time from a
+ * child stamping its exit to the pidfd reaper publishing it. The same
+ * workload is then forked by hand and collected the way rift_true_wait()
+ * polled before the reaper, with waitpid(WNOHANG) sweeps and a 1 ms sleep,
+ * for comparison.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_reaper.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#define BENCH_ROUNDS 5
+#define BENCH_BATCH 200
+#define BENCH_MAX_DELAY_US 10000
+
+static uint32_t g_delays[BENCH_BATCH];
+
+static uint64_t now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static void delayed_exit(void* data) {
+    usleep(*(uint32_t*)data);
+}
+
+static void record_latency(uint64_t* buckets, uint64_t latency_ns) {
+    uint64_t micros = latency_ns / 1000;
+    uint32_t bucket = 0;
+    while (bucket < RIFT_REAPER_LATENCY_BUCKETS - 1 && micros >= (1ull << bucket)) {
+        bucket++;
+    }
+    buckets[bucket]++;
+}
+
+// =============================================================================
+// MEASUREMENTS
+// =============================================================================
+
+/**
+ * @brief Reap every batch through the pidfd reaper
+ */
+static int bench_reaper(rift_true_reaper_stats_t* stats) {
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_TRUE_PROCESS;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+
+    void* data[BENCH_BATCH];
+    for (uint32_t i = 0; i < BENCH_BATCH; i++) {
+        data[i] = &g_delays[i];
+    }
+
+    for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+        uint64_t first = rift_true_spawn_batch(0, &policy, delayed_exit, data, BENCH_BATCH,
+                                               "bench_process_reap");
+        if (first == 0) {
+            return -1;
+        }
+        for (uint32_t i = 0; i < BENCH_BATCH; i++) {
+            rift_true_wait(first + i, 0);
+        }
+    }
+    rift_true_reaper_get_stats(stats);
+    return stats->reaped >= BENCH_ROUNDS * BENCH_BATCH ? 0 : -1;
+}
+
+/**
+ * @brief Reap the same workload with waitpid(WNOHANG) sweeps and 1 ms sleeps
+ */
+static int bench_polling(rift_true_reaper_stats_t* stats) {
+    memset(stats, 0, sizeof(*stats));
+    _Atomic uint64_t* stamps = mmap(NULL, sizeof(uint64_t) * BENCH_BATCH,
+                                    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (stamps == MAP_FAILED) {
+        return -1;
+    }
+
+    for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {
+        pid_t pids[BENCH_BATCH];
+        for (uint32_t i = 0; i < BENCH_BATCH; i++) {
+            atomic_store(&stamps[i], 0);
+            pids[i] = fork();
+            if (pids[i] < 0) {
+                munmap(stamps, sizeof(uint64_t) * BENCH_BATCH);
+                return -1;
+            }
+            if (pids[i] == 0) {
+                usleep(g_delays[i]);
+                atomic_store(&stamps[i], now_ns());
+                _exit(0);
+            }
+        }
+
+        uint32_t remaining = BENCH_BATCH;
+        while (remaining > 0) {
+            for (uint32_t i = 0; i < BENCH_BATCH; i++) {
+                int status;
+                if (pids[i] > 0 && waitpid(pids[i], &status, WNOHANG) == pids[i]) {
+                    uint64_t latency = now_ns() - atomic_load(&stamps[i]);
+                    record_latency(stats->latency_buckets, latency);
+                    stats->latency_total_ns += latency;
+                    if (latency > stats->latency_max_ns) {
+                        stats->latency_max_ns = latency;
+                    }
+                    stats->reaped++;
+                    pids[i] = 0;
+                    remaining--;
+                }
+            }
+            if (remaining > 0) {
+                usleep(1000);
+            }
+        }
+    }
+    munmap(stamps, sizeof(uint64_t) * BENCH_BATCH);
+    return 0;
+}
+
+int main(void) {
+    srand(42);
+    for (uint32_t i = 0; i < BENCH_BATCH; i++) {
+        g_delays[i] = (uint32_t)(rand() % BENCH_MAX_DELAY_US);
+    }
+
+    if (rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    rift_true_reaper_stats_t reaper, polled;
+    quiet_begin();
+    int reaper_result = bench_reaper(&reaper);
+    rift_true_concurrency_cleanup();
+    int polled_result = bench_polling(&polled);
+    quiet_end();
+
+    if (reaper_result != 0 || polled_result != 0) {
+        fprintf(stderr, "[BENCH] Reap benchmark failed (reaper %d, polling %d)\n",
+                reaper_result, polled_result);
+        return 1;
+    }
+
+    printf("\n=== PROCESS EXIT LATENCY (%d children, exits spread over %d ms) ===\n",
+           BENCH_ROUNDS * BENCH_BATCH, BENCH_MAX_DELAY_US / 1000);
+    printf("%-12s %-12s %s\n", "BUCKET", "PIDFD", "WAITPID POLL");
+    for (uint32_t i = 0; i < RIFT_REAPER_LATENCY_BUCKETS; i++) {
+        if (reaper.latency_buckets[i] == 0 && polled.latency_buckets[i] == 0) {
+            continue;
+        }
+        char label[32];
+        if (i == RIFT_REAPER_LATENCY_BUCKETS - 1) {
+            snprintf(label, sizeof(label), ">=%llu us", 1ull << (i - 1));
+        } else {
+            snprintf(label, sizeof(label), "<%llu us", 1ull << i);
+        }
+        printf("%-12s %-12lu %lu\n", label, (unsigned long)reaper.latency_buckets[i],
+               (unsigned long)polled.latency_buckets[i]);
+    }
+
+    uint64_t stamped = reaper.reaped - reaper.unstamped;
+    printf("\n%-12s %-12s %s\n", "", "PIDFD", "WAITPID POLL");
+    printf("%-12s %-12lu %lu\n", "avg us",
+           (unsigned long)(stamped ? reaper.latency_total_ns / stamped / 1000 : 0),
+           (unsigned long)(polled.latency_total_ns / polled.reaped / 1000));
+    printf("%-12s <%-11lu <%lu\n", "p50 us",
+           (unsigned long)rift_true_reaper_latency_percentile(&reaper, 50),
+           (unsigned long)rift_true_reaper_latency_percentile(&polled, 50));
+    printf("%-12s <%-11lu <%lu\n", "p99 us",
+           (unsigned long)rift_true_reaper_latency_percentile(&reaper, 99),
+           (unsigned long)rift_true_reaper_latency_percentile(&polled, 99));
+    printf("%-12s %-12lu %lu\n", "max us", (unsigned long)(reaper.latency_max_ns / 1000),
+           (unsigned long)(polled.latency_max_ns / 1000));
+    return 0;
+}
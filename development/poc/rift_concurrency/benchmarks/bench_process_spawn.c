@@ -0,0 +1,155 @@
+/**
+ * @file bench_process_spawn.c
+ * @brief Process Spawn Rate Benchmark - fork vs Zygote by Parent RSS
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Starts the zygote while the parent is small, then grows the parent to
+ * 10 MB, 1 GB and 10 GB of touched memory and measures how many trivial
+ * TRUE_PROCESS tasks per second it can spawn by forking itself versus
+ * asking the zygote. "spawn/s" times the spawn calls only; "e2e/s" also
+ * includes waiting for every child to exit. Sizes that do not fit in 80%
+ * of MemAvailable are skipped.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_zygote.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#define BENCH_PROCESSES 64
+
+static void bench_child(void* data) {
+    (void)data;
+}
+
+static double elapsed_seconds(const struct timespec* start, const struct timespec* end) {
+    return (double)(end->tv_sec - start->tv_sec) +
+           (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static uint64_t available_bytes(void) {
+    FILE* file = fopen("/proc/meminfo", "r");
+    if (!file) {
+        return 0;
+    }
+
+    char line[128];
+    unsigned long kb = 0;
+    while (fgets(line, sizeof(line), file)) {
+        if (sscanf(line, "MemAvailable: %lu kB", &kb) == 1) {
+            break;
+        }
+    }
+    fclose(file);
+    return (uint64_t)kb * 1024;
+}
+
+/**
+ * @brief Spawn BENCH_PROCESSES children, then wait for all of them
+ * @return 0 on success, -1 if a spawn failed
+ */
+static int bench_spawn(const rift_governance_policy_t* policy, double* spawn_seconds,
+                       double* total_seconds) {
+    uint64_t ids[BENCH_PROCESSES];
+    struct timespec start, spawned, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < BENCH_PROCESSES; i++) {
+        ids[i] = rift_true_spawn_process(0, policy, bench_child, NULL, "bench_process_spawn");
+        if (ids[i] == 0) {
+            return -1;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &spawned);
+    for (int i = 0; i < BENCH_PROCESSES; i++) {
+        rift_true_wait(ids[i], 0);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    *spawn_seconds = elapsed_seconds(&start, &spawned);
+    *total_seconds = elapsed_seconds(&start, &end);
+    return 0;
+}
+
+int main(void) {
+    static const uint64_t sizes[] = {
+        10ULL << 20,
+        1ULL << 30,
+        10ULL << 30
+    };
+    static const char* labels[] = { "10 MB", "1 GB", "10 GB" };
+
+    if (rift_true_concurrency_init() != 0 || rift_true_zygote_start() != 0) {
+        return 1;
+    }
+
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_TRUE_PROCESS;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+
+    printf("\n=== PROCESS SPAWN RATE (%d children per run) ===\n", BENCH_PROCESSES);
+    printf("%-8s %-12s %-12s %-12s %-12s %s\n", "RSS", "FORK SPAWN/S", "FORK E2E/S",
+           "ZYG SPAWN/S", "ZYG E2E/S", "SPEEDUP");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        if (sizes[s] > available_bytes() / 10 * 8) {
+            printf("%-8s skipped (needs %lu MB, %lu MB available)\n", labels[s],
+                   (unsigned long)(sizes[s] >> 20), (unsigned long)(available_bytes() >> 20));
+            continue;
+        }
+
+        char* ballast = mmap(NULL, sizes[s], PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ballast == MAP_FAILED) {
+            printf("%-8s skipped (mmap failed)\n", labels[s]);
+            continue;
+        }
+        memset(ballast, 1, sizes[s]);
+
+        double fork_spawn, fork_total, zygote_spawn, zygote_total;
+        quiet_begin();
+        policy.zygote_spawn = false;
+        int fork_result = bench_spawn(&policy, &fork_spawn, &fork_total);
+        policy.zygote_spawn = true;
+        int zygote_result = bench_spawn(&policy, &zygote_spawn, &zygote_total);
+        quiet_end();
+        munmap(ballast, sizes[s]);
+
+        if (fork_result != 0 || zygote_result != 0) {
+            fprintf(stderr, "[BENCH] Spawn failed at %s\n", labels[s]);
+            return 1;
+        }
+
+        printf("%-8s %-12.0f %-12.0f %-12.0f %-12.0f %.1fx\n", labels[s],
+               BENCH_PROCESSES / fork_spawn, BENCH_PROCESSES / fork_total,
+               BENCH_PROCESSES / zygote_spawn, BENCH_PROCESSES / zygote_total,
+               fork_spawn / zygote_spawn);
+    }
+
+    quiet_begin();
+    rift_true_concurrency_cleanup();
+    quiet_end();
+    return 0;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file bench_subtree_quota.c
+ * @brief Subtree Quota Benchmark - Spawn Cost Under Nested Quotas
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Builds a chain of BENCH_DEPTH simulated tasks, each opening a subtree task
+ * quota, and has the innermost task spawn and finish short leaf tasks in
+ * waves. Every leaf counts against all BENCH_DEPTH quotas, so charging each
+ * ancestor directly would update BENCH_DEPTH shared counters per spawn.
+ * With batched reservations a spawn charges the innermost group only, and
+ * ancestors are touched when a reservation runs out or flows back. The same
+ * chain without quotas gives the baseline. For each run the benchmark
+ * reports the cost of a spawn-and-finish cycle and the number of ancestor
+ * updates (reservation refills plus returns) against the BENCH_DEPTH - 1
+ * per spawn that direct charging would need. Spawn logging is sent to
+ * /dev/null while timing.
+ */
+
+#include "rift_quota.h"
+#include "rift_simulated.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define BENCH_DEPTH 8
+#define BENCH_WAVE 16
+#define BENCH_WAVES 500
+#define BENCH_QUOTA 100000
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static uint64_t now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+typedef struct {
+    uint32_t spawned;
+    uint32_t refused;
+    uint64_t ancestor_updates;
+    double elapsed_ms;
+} bench_result_t;
+
+static bool g_quotas;
+static bench_result_t g_result;
+static uint32_t g_leaves_done;
+
+static rift_governance_policy_t bench_policy(uint32_t depth) {
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_SIMULATED;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+    if (g_quotas) {
+        policy.max_subtree_tasks = BENCH_QUOTA - depth;
+    }
+    return policy;
+}
+
+static void bench_leaf(void* data) {
+    (void)data;
+    g_leaves_done++;
+}
+
+static void bench_innermost(void) {
+    rift_governance_policy_t policy = bench_policy(BENCH_DEPTH);
+    policy.max_subtree_tasks = 0; // Leaves charge the innermost group directly
+
+    rift_quota_stats_t before;
+    rift_quota_get_stats(&before);
+    uint64_t start = now_ns();
+    for (uint32_t wave = 0; wave < BENCH_WAVES; wave++) {
+        uint32_t spawned = 0;
+        for (uint32_t i = 0; i < BENCH_WAVE; i++) {
+            if (rift_simulated_spawn(rift_current_id(), &policy, bench_leaf, NULL,
+                                     "bench_quota_leaf") != 0) {
+                spawned++;
+            } else {
+                g_result.refused++;
+            }
+        }
+        g_result.spawned += spawned;
+        while (g_leaves_done < g_result.spawned) {
+            rift_simulated_yield();
+        }
+    }
+    g_result.elapsed_ms = (double)(now_ns() - start) / 1e6;
+    rift_quota_stats_t after;
+    rift_quota_get_stats(&after);
+    g_result.ancestor_updates = (after.refills - before.refills) +
+                                (after.returns - before.returns);
+}
+
+static void bench_level(void* data) {
+    uint32_t depth = (uint32_t)(uintptr_t)data;
+    if (depth == BENCH_DEPTH) {
+        bench_innermost();
+        return;
+    }
+    rift_governance_policy_t policy = bench_policy(depth + 1);
+    if (rift_simulated_spawn(rift_current_id(), &policy, bench_level,
+                             (void*)(uintptr_t)(depth + 1), "bench_quota_level") == 0) {
+        g_result.refused++;
+    }
+}
+
+static bench_result_t bench_run(bool quotas) {
+    g_quotas = quotas;
+    g_leaves_done = 0;
+    g_result = (bench_result_t){0};
+    rift_governance_policy_t policy = bench_policy(1);
+    if (rift_simulated_spawn(0, &policy, bench_level, (void*)(uintptr_t)1,
+                             "bench_quota_level") == 0) {
+        g_result.refused++;
+    }
+    while (rift_simulated_runnable_count() > 0) {
+        rift_simulated_schedule_cycle();
+    }
+    return g_result;
+}
+
+int main(void) {
+    if (rift_simulated_init() != 0) {
+        return 1;
+    }
+
+    static const char* names[2] = { "no quotas", "nested quotas" };
+    bench_result_t results[2];
+
+    quiet_begin();
+    results[0] = bench_run(false);
+    results[1] = bench_run(true);
+    rift_quota_stats_t stats;
+    rift_quota_get_stats(&stats);
+    rift_simulated_cleanup();
+    quiet_end();
+
+    printf("\n=== SUBTREE QUOTAS (depth %d, %d waves of %d spawns) ===\n", BENCH_DEPTH,
+           BENCH_WAVES, BENCH_WAVE);
+    printf("%-14s %-8s %-8s %-10s %-18s %-18s %s\n", "CHAIN", "SPAWNED", "REFUSED", "NS/SPAWN",
+           "ANCESTOR UPDATES", "DIRECT CHARGING", "TOTAL ms");
+    int status = 0;
+    for (int i = 0; i < 2; i++) {
+        bench_result_t* result = &results[i];
+        double per_spawn = result->spawned > 0 ? 1.0 / result->spawned : 0.0;
+        uint64_t direct = i == 1 ? (uint64_t)result->spawned * (BENCH_DEPTH - 1) : 0;
+        printf("%-14s %-8u %-8u %-10.0f %-18lu %-18lu %.1f\n", names[i], result->spawned,
+               result->refused, result->elapsed_ms * 1e6 * per_spawn,
+               (unsigned long)result->ancestor_updates, (unsigned long)direct,
+               result->elapsed_ms);
+        if (result->spawned != BENCH_WAVES * BENCH_WAVE || result->refused != 0) {
+            status = 1;
+        }
+    }
+    // Batching must leave most spawns off the ancestors entirely
+    if (results[1].ancestor_updates >= results[1].spawned) {
+        status = 1;
+    }
+    if (stats.groups != 0) {
+        status = 1; // Every group is freed once its subtree finishes
+    }
+    return status;
+}
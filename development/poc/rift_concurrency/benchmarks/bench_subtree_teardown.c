@@ -0,0 +1,282 @@
+/**
+ * @file bench_subtree_teardown.c
+ * @brief Subtree Teardown Benchmark - Destroying a 10k-Node Task Tree
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Builds a task tree of a little over 10,000 nodes under one root task:
+ * 32 TRUE_PROCESS children, each spawning 10 process children of its own,
+ * each of which runs 31 dedicated threads. Only the 32 first-level
+ * processes are in this process's table; everything below them lives in
+ * their tables and process groups. The tree is then destroyed with
+ * rift_true_handle_parent_destruction(), which signals each first-level
+ * process group once, and timed until every process has been reaped. For
+ * comparison the same tree is torn down by signalling only the processes in
+ * our table, as teardown did before process groups (the rest of the tree
+ * survives), and by signalling every process individually, which needs PIDs
+ * a spawner does not have for processes forked inside its children.
+ */
+
+#include "rift_true_concurrency.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+
+#define BENCH_LEVEL1 32
+#define BENCH_LEVEL2 10
+#define BENCH_THREADS 31
+#define BENCH_PROCESSES (BENCH_LEVEL1 * (1 + BENCH_LEVEL2))
+#define BENCH_NODES (1 + BENCH_PROCESSES + BENCH_LEVEL1 * BENCH_LEVEL2 * BENCH_THREADS)
+#define BENCH_BUILD_TIMEOUT_S 120
+
+// Shared with every process in the tree
+typedef struct {
+    _Atomic uint32_t ready;               // Nodes running
+    _Atomic uint32_t process_count;
+    pid_t processes[BENCH_PROCESSES];
+} bench_tree_t;
+
+typedef enum {
+    TEARDOWN_PROCESS_GROUPS,              // rift_true_handle_parent_destruction()
+    TEARDOWN_TABLE_ONLY,                  // kill() per first-level process
+    TEARDOWN_EVERY_PROCESS                // kill() per process in the tree
+} bench_teardown_t;
+
+typedef struct {
+    uint32_t signals;
+    uint32_t survivors;                   // Processes still running after teardown
+    double gone_ms;                       // Until every process was reaped
+} bench_result_t;
+
+static bench_tree_t* g_tree;
+static _Atomic bool g_release_root;
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static rift_governance_policy_t bench_policy(rift_concurrency_mode_t mode) {
+    rift_governance_policy_t policy = {0};
+    policy.mode = mode;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+    policy.dedicated_thread = mode == CONCURRENCY_TRUE_THREAD;
+    return policy;
+}
+
+// =============================================================================
+// TREE NODES
+// =============================================================================
+
+static void record_process(bool first_level) {
+    uint32_t index = atomic_fetch_add(&g_tree->process_count, 1);
+    g_tree->processes[index] = first_level ? -getpid() : getpid();
+}
+
+static void leaf_thread(void* data) {
+    (void)data;
+    for (;;) {
+        pause();
+    }
+}
+
+static void level2_process(void* data) {
+    (void)data;
+    record_process(false);
+    rift_governance_policy_t policy = bench_policy(CONCURRENCY_TRUE_THREAD);
+    if (rift_true_spawn_batch(0, &policy, leaf_thread, NULL, BENCH_THREADS, "level2") == 0) {
+        _exit(1);
+    }
+    atomic_fetch_add(&g_tree->ready, 1 + BENCH_THREADS);
+    for (;;) {
+        pause();
+    }
+}
+
+static void level1_process(void* data) {
+    (void)data;
+    record_process(true);
+    rift_governance_policy_t policy = bench_policy(CONCURRENCY_TRUE_PROCESS);
+    if (rift_true_spawn_batch(0, &policy, level2_process, NULL, BENCH_LEVEL2, "level1") == 0) {
+        _exit(1);
+    }
+    atomic_fetch_add(&g_tree->ready, 1);
+    for (;;) {
+        pause();
+    }
+}
+
+static void root_thread(void* data) {
+    (void)data;
+    while (!atomic_load(&g_release_root)) {
+        usleep(1000);
+    }
+}
+
+// =============================================================================
+// MEASUREMENT
+// =============================================================================
+
+/**
+ * @brief Build the tree under root; returns first level-1 ID or 0
+ */
+static uint64_t build_tree(uint64_t root) {
+    atomic_store(&g_tree->ready, 0);
+    atomic_store(&g_tree->process_count, 0);
+
+    rift_governance_policy_t policy = bench_policy(CONCURRENCY_TRUE_PROCESS);
+    uint64_t first = rift_true_spawn_batch(root, &policy, level1_process, NULL, BENCH_LEVEL1,
+                                           "bench_subtree_teardown");
+    if (first == 0) {
+        return 0;
+    }
+
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (atomic_load(&g_tree->ready) < BENCH_NODES - 1) {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (now.tv_sec - start.tv_sec > BENCH_BUILD_TIMEOUT_S) {
+            fprintf(stderr, "[BENCH] Tree incomplete: %u of %d nodes\n",
+                    atomic_load(&g_tree->ready), BENCH_NODES - 1);
+            return 0;
+        }
+        usleep(10000);
+    }
+    return first;
+}
+
+/**
+ * @brief Signal every recorded process; first_level selects the first level
+ *        only or everything else
+ */
+static uint32_t signal_recorded(bool first_level) {
+    uint32_t count = atomic_load(&g_tree->process_count);
+    uint32_t signals = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        pid_t pid = g_tree->processes[i];
+        if ((pid < 0) == first_level) {
+            kill(pid < 0 ? -pid : pid, SIGTERM);
+            signals++;
+        }
+    }
+    return signals;
+}
+
+/**
+ * @brief Tear the tree down and reap it: the first level through RIFT, the
+ *        rest after it was reparented to us
+ */
+static bench_result_t teardown(uint64_t root, uint64_t first, bench_teardown_t method) {
+    bench_result_t result = {0};
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (method == TEARDOWN_PROCESS_GROUPS) {
+        rift_true_handle_parent_destruction(root);
+        result.signals = BENCH_LEVEL1;
+    } else {
+        result.signals = signal_recorded(true);
+        if (method == TEARDOWN_EVERY_PROCESS) {
+            result.signals += signal_recorded(false);
+        }
+    }
+    for (uint32_t i = 0; i < BENCH_LEVEL1; i++) {
+        rift_true_wait(first + i, 0);
+    }
+
+    if (method == TEARDOWN_TABLE_ONLY) {
+        // Orphans keep running; count them, then clean up untimed
+        uint32_t count = atomic_load(&g_tree->process_count);
+        for (uint32_t i = 0; i < count; i++) {
+            pid_t pid = g_tree->processes[i];
+            if (pid > 0 && waitpid(pid, NULL, WNOHANG) == 0) {
+                result.survivors++;
+            }
+        }
+        result.gone_ms = -1;
+        signal_recorded(false);
+        while (waitpid(-1, NULL, 0) > 0) {
+        }
+        return result;
+    }
+
+    while (waitpid(-1, NULL, 0) > 0) {
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    result.gone_ms = (double)(end.tv_sec - start.tv_sec) * 1e3 +
+                     (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+    return result;
+}
+
+int main(void) {
+    g_tree = mmap(NULL, sizeof(bench_tree_t), PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (g_tree == MAP_FAILED) {
+        return 1;
+    }
+    // Grandchildren orphaned by the teardown are reparented to us, not init
+    prctl(PR_SET_CHILD_SUBREAPER, 1);
+
+    if (rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    quiet_begin();
+    rift_governance_policy_t policy = bench_policy(CONCURRENCY_TRUE_THREAD);
+    uint64_t root = rift_true_spawn_thread(0, &policy, root_thread, NULL, "bench_root");
+
+    static const char* names[] = {
+        "process groups (RIFT)", "kill() per table child", "kill() per process"
+    };
+    bench_result_t results[3];
+    bool complete = root != 0;
+    for (uint32_t method = 0; method < 3 && complete; method++) {
+        uint64_t first = build_tree(root);
+        complete = first != 0;
+        if (complete) {
+            results[method] = teardown(root, first, (bench_teardown_t)method);
+        }
+    }
+
+    atomic_store(&g_release_root, true);
+    rift_true_wait(root, 0);
+    rift_true_concurrency_cleanup();
+    quiet_end();
+
+    if (!complete) {
+        fprintf(stderr, "[BENCH] Subtree teardown failed\n");
+        return 1;
+    }
+
+    printf("\n=== SUBTREE TEARDOWN (%d nodes: %d processes, %d threads) ===\n",
+           BENCH_NODES, BENCH_PROCESSES, BENCH_LEVEL1 * BENCH_LEVEL2 * BENCH_THREADS);
+    printf("%-26s %-10s %-11s %s\n", "METHOD", "SIGNALS", "SURVIVORS", "TREE GONE MS");
+    for (uint32_t method = 0; method < 3; method++) {
+        if (results[method].gone_ms < 0) {
+            printf("%-26s %-10u %-11u %s\n", names[method], results[method].signals,
+                   results[method].survivors, "never");
+        } else {
+            printf("%-26s %-10u %-11u %.1f\n", names[method], results[method].signals,
+                   results[method].survivors, results[method].gone_ms);
+        }
+    }
+    return 0;
+}
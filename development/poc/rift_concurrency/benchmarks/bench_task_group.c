@@ -0,0 +1,184 @@
+/**
+ * @file bench_task_group.c
+ * @brief Task Group Benchmark - Fork/Join Through Futures in Every Mode
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Splits a sum over an array into a fan-out of group tasks, collects every
+ * partial sum through its future and checks the total, in each concurrency
+ * mode: single-thread simulated, hybrid M:N, pool threads and processes.
+ * Reports the spawn-to-result cost per task. A second round cancels a group
+ * of parked tasks and checks that every future resolves. Spawn logging is
+ * sent to /dev/null while timing.
+ */
+
+#include "rift_simulated.h"
+#include "rift_simulated_hybrid.h"
+#include "rift_true_concurrency.h"
+#include "rift_group.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define BENCH_FANOUT 64
+#define BENCH_ROUNDS 20
+#define BENCH_PROCESS_ROUNDS 4
+#define BENCH_ELEMENTS (BENCH_FANOUT * 1024)
+
+static uint64_t g_values[BENCH_ELEMENTS];
+
+typedef struct {
+    uint32_t first;
+    uint32_t count;
+} bench_slice_t;
+
+static bench_slice_t g_slices[BENCH_FANOUT];
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static void sum_slice(void* data, void* result) {
+    const bench_slice_t* slice = data;
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < slice->count; i++) {
+        sum += g_values[slice->first + i];
+    }
+    *(uint64_t*)result = sum;
+}
+
+static void wait_cancelled(void* data, void* result) {
+    rift_task_group_t* group = data;
+    while (!rift_group_cancelled(group)) {
+        if (rift_simulated_current()) {
+            rift_simulated_yield();
+        } else {
+            usleep(100);
+        }
+    }
+    *(uint64_t*)result = 0;
+}
+
+/**
+ * @brief Fan out one sum per round; ns per task, -1 on a wrong total
+ */
+static double bench_fork_join(const rift_governance_policy_t* policy, uint32_t rounds,
+                              uint64_t expected) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t round = 0; round < rounds; round++) {
+        rift_task_group_t* group = RIFT_GROUP_CREATE(0, policy, uint64_t, BENCH_FANOUT);
+        rift_future_t* futures[BENCH_FANOUT];
+        for (uint32_t i = 0; i < BENCH_FANOUT; i++) {
+            futures[i] = group ? rift_group_spawn(group, sum_slice, &g_slices[i]) : NULL;
+            if (!futures[i]) {
+                rift_group_destroy(group);
+                return -1.0;
+            }
+        }
+
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < BENCH_FANOUT; i++) {
+            uint64_t partial = 0;
+            if (rift_future_get(futures[i], &partial) != RIFT_FUTURE_DONE) {
+                rift_group_destroy(group);
+                return -1.0;
+            }
+            total += partial;
+        }
+        rift_group_destroy(group);
+        if (total != expected) {
+            return -1.0;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((double)(end.tv_sec - start.tv_sec) * 1e9 + (double)(end.tv_nsec - start.tv_nsec)) /
+           ((double)rounds * BENCH_FANOUT);
+}
+
+/**
+ * @brief Cancel a group of tasks waiting for cancellation; 0 if all resolve
+ */
+static int bench_cancel(const rift_governance_policy_t* policy, uint32_t count) {
+    rift_task_group_t* group = RIFT_GROUP_CREATE(0, policy, uint64_t, count);
+    if (!group) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!rift_group_spawn(group, wait_cancelled, group)) {
+            rift_group_destroy(group);
+            return -1;
+        }
+    }
+    rift_group_cancel(group);
+    rift_group_join(group);
+    rift_group_destroy(group);
+    return 0;
+}
+
+int main(void) {
+    uint64_t expected = 0;
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) {
+        g_values[i] = (uint64_t)i * 2654435761u % 1000;
+        expected += g_values[i];
+    }
+    for (uint32_t i = 0; i < BENCH_FANOUT; i++) {
+        g_slices[i].first = i * (BENCH_ELEMENTS / BENCH_FANOUT);
+        g_slices[i].count = BENCH_ELEMENTS / BENCH_FANOUT;
+    }
+
+    if (rift_simulated_init() != 0 || rift_hybrid_init(0) != 0 ||
+        rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    static const char* names[] = { "simulated", "hybrid", "true thread", "true process" };
+    static const rift_concurrency_mode_t modes[] = {
+        CONCURRENCY_SIMULATED, CONCURRENCY_HYBRID, CONCURRENCY_TRUE_THREAD,
+        CONCURRENCY_TRUE_PROCESS
+    };
+    double per_task[4];
+    int cancel_result[4];
+
+    quiet_begin();
+    for (uint32_t m = 0; m < 4; m++) {
+        rift_governance_policy_t policy = {0};
+        policy.mode = modes[m];
+        policy.destroy_policy = DESTROY_CASCADE;
+        policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+        policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+        uint32_t rounds = modes[m] == CONCURRENCY_TRUE_PROCESS ? BENCH_PROCESS_ROUNDS : BENCH_ROUNDS;
+        per_task[m] = bench_fork_join(&policy, rounds, expected);
+        cancel_result[m] = bench_cancel(&policy, 8);
+    }
+    rift_true_concurrency_cleanup();
+    rift_simulated_cleanup();
+    quiet_end();
+
+    printf("\n=== TASK GROUP FORK/JOIN (%d tasks per group) ===\n", BENCH_FANOUT);
+    printf("%-16s %-16s %s\n", "MODE", "NS PER TASK", "CANCEL");
+    int status = 0;
+    for (uint32_t m = 0; m < 4; m++) {
+        if (per_task[m] < 0) {
+            printf("%-16s %-16s %s\n", names[m], "FAILED", cancel_result[m] ? "FAILED" : "ok");
+            status = 1;
+        } else {
+            printf("%-16s %-16.0f %s\n", names[m], per_task[m], cancel_result[m] ? "FAILED" : "ok");
+        }
+        status |= cancel_result[m] != 0;
+    }
+    return status;
+}
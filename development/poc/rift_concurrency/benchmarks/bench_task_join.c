@@ -0,0 +1,128 @@
+/**
+ * @file bench_task_join.c
+ * @brief Task Join Benchmark - Context Size, Spawn/Join and Finished Joins
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Measures what the per-task lifecycle signalling costs: the size of a true
+ * concurrency context, the round trip of spawning one task and waiting for
+ * it (pool thread and dedicated thread), and joining tasks that have
+ * already finished, which should not need the kernel at all. Spawn logging
+ * is sent to /dev/null while timing.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define BENCH_POOL_ROUNDS 20000
+#define BENCH_DEDICATED_ROUNDS 2000
+#define BENCH_FANOUT 128
+#define BENCH_FANOUT_ROUNDS 200
+
+static void bench_noop(void* data) {
+    (void)data;
+}
+
+static double elapsed_ns(const struct timespec* start, const struct timespec* end) {
+    return (double)(end->tv_sec - start->tv_sec) * 1e9 + (double)(end->tv_nsec - start->tv_nsec);
+}
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+/**
+ * @brief Spawn one task and wait for it, rounds times; ns per round trip
+ */
+static double bench_round_trip(const rift_governance_policy_t* policy, uint32_t rounds) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < rounds; i++) {
+        uint64_t id = rift_true_spawn_thread(0, policy, bench_noop, NULL, "bench_task_join");
+        if (id == 0 || rift_true_wait(id, 0) != 0) {
+            return -1.0;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return elapsed_ns(&start, &end) / rounds;
+}
+
+/**
+ * @brief Join a batch whose tasks have all finished; ns per join
+ */
+static double bench_finished_join(const rift_governance_policy_t* policy) {
+    double total = 0.0;
+    for (uint32_t round = 0; round < BENCH_FANOUT_ROUNDS; round++) {
+        uint64_t first = rift_true_spawn_batch(0, policy, bench_noop, NULL, BENCH_FANOUT,
+                                               "bench_task_join");
+        if (first == 0) {
+            return -1.0;
+        }
+        // Let the pool drain the batch so every join below finds a finished task
+        rift_true_pool_stats_t stats;
+        do {
+            sched_yield();
+            rift_true_pool_get_stats(&stats);
+        } while (stats.tasks_executed < stats.tasks_submitted);
+        usleep(100);
+
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (uint32_t i = 0; i < BENCH_FANOUT; i++) {
+            if (rift_true_wait(first + i, 0) != 0) {
+                return -1.0;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        total += elapsed_ns(&start, &end);
+    }
+    return total / (BENCH_FANOUT_ROUNDS * BENCH_FANOUT);
+}
+
+int main(void) {
+    if (rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    rift_governance_policy_t policy = {0};
+    policy.mode = CONCURRENCY_TRUE_THREAD;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = BENCH_FANOUT;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+
+    quiet_begin();
+    double pool_trip = bench_round_trip(&policy, BENCH_POOL_ROUNDS);
+    double finished_join = bench_finished_join(&policy);
+    policy.dedicated_thread = true;
+    double dedicated_trip = bench_round_trip(&policy, BENCH_DEDICATED_ROUNDS);
+    rift_true_concurrency_cleanup();
+    quiet_end();
+
+    if (pool_trip < 0 || finished_join < 0 || dedicated_trip < 0) {
+        fprintf(stderr, "[BENCH] Task join benchmark failed\n");
+        return 1;
+    }
+
+    printf("\n=== TASK JOIN ===\n");
+    printf("%-32s %zu bytes\n", "context size", sizeof(rift_true_context_t));
+    printf("%-32s %.0f ns\n", "spawn + join, pool thread", pool_trip);
+    printf("%-32s %.0f ns\n", "spawn + join, dedicated thread", dedicated_trip);
+    printf("%-32s %.0f ns\n", "join of finished task", finished_join);
+    return 0;
+}
@@ -0,0 +1,263 @@
+/**
+ * @file bench_true_scaling.c
+ * @brief True-Thread Pool Scalability Benchmark - fib, nqueens, fan-out
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Runs three fork-join workloads on the work-stealing pool with 1 to 16
+ * workers and reports wall time, speedup over one worker and steals:
+ *   fib      - binary recursion, one child spawned per level down to a cutoff
+ *   nqueens  - two levels of spawned subproblems, leaves solved serially
+ *   fan-out  - one batch of equal tasks spawned from outside the pool
+ * The first two spawn from inside pooled tasks and so exercise the local
+ * deques; fan-out exercises the injection queue. Worker counts above the
+ * online CPU count measure oversubscription. Spawn logging is sent to
+ * /dev/null while timing.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#define BENCH_FIB_N 40
+#define BENCH_FIB_CUTOFF 8
+#define BENCH_QUEENS_N 13
+#define BENCH_QUEENS_SPAWN_ROWS 2
+#define BENCH_FANOUT_TASKS 128
+#define BENCH_FANOUT_WORK 4000000
+
+static rift_governance_policy_t g_policy;
+static _Atomic uint64_t g_queens_solutions;
+static volatile uint64_t g_sink;
+
+static double elapsed_seconds(const struct timespec* start, const struct timespec* end) {
+    return (double)(end->tv_sec - start->tv_sec) +
+           (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+// =============================================================================
+// FIB
+// =============================================================================
+
+typedef struct {
+    int n;
+    int depth;
+    uint64_t result;
+} bench_fib_t;
+
+static uint64_t fib_serial(int n) {
+    return n < 2 ? (uint64_t)n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+static void fib_task(void* data) {
+    bench_fib_t* job = data;
+    if (job->depth >= BENCH_FIB_CUTOFF || job->n < 2) {
+        job->result = fib_serial(job->n);
+        return;
+    }
+
+    // Spawn fib(n-1), compute fib(n-2) inline, then join
+    bench_fib_t child = { job->n - 1, job->depth + 1, 0 };
+    bench_fib_t inline_job = { job->n - 2, job->depth + 1, 0 };
+    uint64_t child_id = rift_true_spawn_thread(0, &g_policy, fib_task, &child, "bench_fib");
+    if (child_id == 0) {
+        child.result = fib_serial(child.n);
+    }
+    fib_task(&inline_job);
+    if (child_id != 0) {
+        rift_true_wait(child_id, 0);
+    }
+    job->result = child.result + inline_job.result;
+}
+
+static uint64_t run_fib(void) {
+    bench_fib_t root = { BENCH_FIB_N, 0, 0 };
+    uint64_t id = rift_true_spawn_thread(0, &g_policy, fib_task, &root, "bench_fib");
+    rift_true_wait(id, 0);
+    return root.result;
+}
+
+// =============================================================================
+// NQUEENS
+// =============================================================================
+
+typedef struct {
+    int row;
+    uint32_t columns;
+    uint32_t diagonals;
+    uint32_t anti_diagonals;
+} bench_queens_t;
+
+static uint64_t queens_serial(int row, uint32_t columns, uint32_t diagonals,
+                              uint32_t anti_diagonals) {
+    if (row == BENCH_QUEENS_N) {
+        return 1;
+    }
+
+    uint64_t solutions = 0;
+    uint32_t free_cells = ~(columns | diagonals | anti_diagonals) & ((1u << BENCH_QUEENS_N) - 1);
+    while (free_cells) {
+        uint32_t bit = free_cells & -free_cells;
+        free_cells ^= bit;
+        solutions += queens_serial(row + 1, columns | bit, (diagonals | bit) << 1,
+                                   (anti_diagonals | bit) >> 1);
+    }
+    return solutions;
+}
+
+static void queens_task(void* data) {
+    bench_queens_t* job = data;
+    if (job->row >= BENCH_QUEENS_SPAWN_ROWS) {
+        atomic_fetch_add(&g_queens_solutions, queens_serial(job->row, job->columns,
+                                                            job->diagonals,
+                                                            job->anti_diagonals));
+        return;
+    }
+
+    bench_queens_t children[BENCH_QUEENS_N];
+    uint64_t ids[BENCH_QUEENS_N];
+    int spawned = 0;
+    uint32_t free_cells = ~(job->columns | job->diagonals | job->anti_diagonals) &
+                          ((1u << BENCH_QUEENS_N) - 1);
+    while (free_cells) {
+        uint32_t bit = free_cells & -free_cells;
+        free_cells ^= bit;
+        children[spawned] = (bench_queens_t){ job->row + 1, job->columns | bit,
+                                              (job->diagonals | bit) << 1,
+                                              (job->anti_diagonals | bit) >> 1 };
+        ids[spawned] = rift_true_spawn_thread(0, &g_policy, queens_task, &children[spawned],
+                                              "bench_nqueens");
+        if (ids[spawned] == 0) {
+            queens_task(&children[spawned]);
+            continue;
+        }
+        spawned++;
+    }
+
+    for (int i = 0; i < spawned; i++) {
+        rift_true_wait(ids[i], 0);
+    }
+}
+
+static uint64_t run_queens(void) {
+    bench_queens_t root = { 0, 0, 0, 0 };
+    atomic_store(&g_queens_solutions, 0);
+    uint64_t id = rift_true_spawn_thread(0, &g_policy, queens_task, &root, "bench_nqueens");
+    rift_true_wait(id, 0);
+    return atomic_load(&g_queens_solutions);
+}
+
+// =============================================================================
+// FAN-OUT
+// =============================================================================
+
+static void fanout_task(void* data) {
+    uint64_t state = (uint64_t)(uintptr_t)data | 1;
+    for (int i = 0; i < BENCH_FANOUT_WORK; i++) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    g_sink = state;
+}
+
+static uint64_t run_fanout(void) {
+    static void* data[BENCH_FANOUT_TASKS];
+    for (uintptr_t i = 0; i < BENCH_FANOUT_TASKS; i++) {
+        data[i] = (void*)i;
+    }
+
+    uint64_t first = rift_true_spawn_batch(0, &g_policy, fanout_task, data, BENCH_FANOUT_TASKS,
+                                           "bench_fanout");
+    if (first == 0) {
+        return 0;
+    }
+    for (uint64_t i = 0; i < BENCH_FANOUT_TASKS; i++) {
+        rift_true_wait(first + i, 0);
+    }
+    return BENCH_FANOUT_TASKS;
+}
+
+// =============================================================================
+// DRIVER
+// =============================================================================
+
+typedef struct {
+    const char* name;
+    uint64_t (*run)(void);
+    uint64_t expected;
+} bench_workload_t;
+
+int main(void) {
+    static const uint32_t worker_counts[] = {1, 2, 4, 8, 16};
+    const bench_workload_t workloads[] = {
+        { "fib", run_fib, fib_serial(BENCH_FIB_N) },
+        { "nqueens", run_queens, 73712 },
+        { "fan-out", run_fanout, BENCH_FANOUT_TASKS },
+    };
+    const size_t runs = sizeof(worker_counts) / sizeof(worker_counts[0]);
+    const size_t workload_count = sizeof(workloads) / sizeof(workloads[0]);
+    double seconds[3][sizeof(worker_counts) / sizeof(worker_counts[0])];
+    uint64_t steals[3][sizeof(worker_counts) / sizeof(worker_counts[0])];
+
+    g_policy.mode = CONCURRENCY_TRUE_THREAD;
+    g_policy.destroy_policy = DESTROY_CASCADE;
+    g_policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+
+    quiet_begin();
+    for (size_t w = 0; w < workload_count; w++) {
+        for (size_t r = 0; r < runs; r++) {
+            if (rift_true_concurrency_init() != 0 || rift_true_pool_init(worker_counts[r]) != 0) {
+                quiet_end();
+                return 1;
+            }
+
+            struct timespec start, end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            uint64_t result = workloads[w].run();
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            seconds[w][r] = elapsed_seconds(&start, &end);
+
+            rift_true_pool_stats_t stats;
+            rift_true_pool_get_stats(&stats);
+            steals[w][r] = stats.tasks_stolen;
+            rift_true_concurrency_cleanup();
+
+            if (result != workloads[w].expected) {
+                quiet_end();
+                fprintf(stderr, "[BENCH] %s produced %lu, expected %lu\n", workloads[w].name,
+                        (unsigned long)result, (unsigned long)workloads[w].expected);
+                return 1;
+            }
+        }
+    }
+    quiet_end();
+
+    printf("\n=== TRUE-THREAD POOL SCALING (%ld online CPUs) ===\n",
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-10s %-8s %-12s %-10s %s\n", "WORKLOAD", "WORKERS", "SECONDS", "SPEEDUP", "STEALS");
+    for (size_t w = 0; w < workload_count; w++) {
+        for (size_t r = 0; r < runs; r++) {
+            printf("%-10s %-8u %-12.4f %-10.2f %lu\n", workloads[w].name, worker_counts[r],
+                   seconds[w][r], seconds[w][0] / seconds[w][r], (unsigned long)steals[w][r]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file bench_watchdog.c
+ * @brief Watchdog Benchmark - Deadline Arm/Disarm Cost, Expiry Lag, Enforcement
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Measures the cost of arming and disarming one deadline, the pair every
+ * task with max_execution_time_ms pays, with 10k and with 1M other
+ * deadlines armed: on the timing wheel both must cost the same. Then
+ * measures how late a spread of deadlines fires relative to its target,
+ * and enforces real deadlines end to end: a simulated task spinning on
+ * yields is flagged, a sleeping process is terminated and a process
+ * ignoring SIGTERM is killed after the grace period. Spawn logging is sent
+ * to /dev/null while timing.
+ */
+
+#include "rift_watchdog.h"
+#include "rift_simulated.h"
+#include "rift_true_concurrency.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+
+#define BENCH_SMALL_BACKGROUND 10000
+#define BENCH_LARGE_BACKGROUND 1000000
+#define BENCH_PAIRS 1000000
+#define BENCH_LAG_TIMERS 1000
+#define BENCH_LAG_SPREAD_MS 200
+#define BENCH_DEADLINE_MS 50
+
+typedef struct {
+    rift_watchdog_timer_t timer;
+    uint64_t target_ns;
+    uint64_t fired_ns;
+} bench_lag_timer_t;
+
+static uint64_t now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static int g_saved_stdout = -1;
+
+static void quiet_begin(void) {
+    fflush(stdout);
+    g_saved_stdout = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    close(null_fd);
+}
+
+static void quiet_end(void) {
+    fflush(stdout);
+    dup2(g_saved_stdout, STDOUT_FILENO);
+    close(g_saved_stdout);
+}
+
+static uint32_t expire_ignore(rift_watchdog_timer_t* timer) {
+    (void)timer;
+    return 0;
+}
+
+static uint32_t expire_record(rift_watchdog_timer_t* timer) {
+    bench_lag_timer_t* lag = (bench_lag_timer_t*)((char*)timer -
+                                                  offsetof(bench_lag_timer_t, timer));
+    lag->fired_ns = now_ns();
+    return 0;
+}
+
+/**
+ * @brief Arm+disarm one deadline with background others armed; ns per pair
+ */
+static double bench_arm_disarm(uint32_t background) {
+    rift_watchdog_timer_t* timers = calloc(background, sizeof(rift_watchdog_timer_t));
+    if (!timers) {
+        return -1.0;
+    }
+    // Far enough out to stay armed, spread over every wheel level
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < background; i++) {
+        seed = seed * 1103515245u + 12345u;
+        rift_watchdog_arm(&timers[i], 60000 + seed % 36000000, expire_ignore);
+    }
+
+    rift_watchdog_timer_t probe = {0};
+    uint64_t start = now_ns();
+    for (uint32_t i = 0; i < BENCH_PAIRS; i++) {
+        rift_watchdog_arm(&probe, 1000 + i % 50000, expire_ignore);
+        rift_watchdog_disarm(&probe);
+    }
+    double per_pair = (double)(now_ns() - start) / BENCH_PAIRS;
+
+    for (uint32_t i = 0; i < background; i++) {
+        rift_watchdog_disarm(&timers[i]);
+    }
+    free(timers);
+    return per_pair;
+}
+
+/**
+ * @brief Fire a spread of deadlines; average and worst lateness in us
+ */
+static int bench_expiry_lag(double* average_us, double* max_us) {
+    static bench_lag_timer_t timers[BENCH_LAG_TIMERS];
+    memset(timers, 0, sizeof(timers));
+    for (uint32_t i = 0; i < BENCH_LAG_TIMERS; i++) {
+        uint32_t timeout_ms = 1 + (i * 7919u) % BENCH_LAG_SPREAD_MS;
+        timers[i].target_ns = now_ns() + (uint64_t)timeout_ms * 1000000ull;
+        rift_watchdog_arm(&timers[i].timer, timeout_ms, expire_record);
+    }
+    usleep((BENCH_LAG_SPREAD_MS + 50) * 1000);
+
+    double total = 0.0;
+    *max_us = 0.0;
+    for (uint32_t i = 0; i < BENCH_LAG_TIMERS; i++) {
+        rift_watchdog_disarm(&timers[i].timer);
+        if (timers[i].fired_ns == 0) {
+            return -1;
+        }
+        double late_us = ((double)timers[i].fired_ns - (double)timers[i].target_ns) / 1000.0;
+        total += late_us;
+        if (late_us > *max_us) {
+            *max_us = late_us;
+        }
+    }
+    *average_us = total / BENCH_LAG_TIMERS;
+    return 0;
+}
+
+static void spin_yielding(void* data) {
+    (void)data;
+    for (;;) {
+        rift_simulated_yield();
+    }
+}
+
+static void sleep_forever(void* data) {
+    (void)data;
+    for (;;) {
+        pause();
+    }
+}
+
+static void ignore_sigterm(void* data) {
+    (void)data;
+    signal(SIGTERM, SIG_IGN);
+    sleep_forever(NULL);
+}
+
+/**
+ * @brief Spawn a task that never finishes on its own; ms until it is stopped
+ */
+static double bench_enforce(rift_concurrency_mode_t mode, void (*work)(void*)) {
+    rift_governance_policy_t policy = {0};
+    policy.mode = mode;
+    policy.destroy_policy = DESTROY_GRACEFUL;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+    policy.max_execution_time_ms = BENCH_DEADLINE_MS;
+
+    uint64_t start = now_ns();
+    if (mode == CONCURRENCY_SIMULATED) {
+        if (rift_simulated_spawn(0, &policy, work, NULL, "bench_watchdog") == 0) {
+            return -1.0;
+        }
+        while (rift_simulated_schedule_cycle() > 0) {
+        }
+    } else {
+        uint64_t id = rift_true_spawn_process(0, &policy, work, NULL, "bench_watchdog");
+        if (id == 0 || rift_true_wait(id, 10000) != 0) {
+            return -1.0;
+        }
+    }
+    return (double)(now_ns() - start) / 1e6;
+}
+
+int main(void) {
+    if (rift_simulated_init() != 0 || rift_true_concurrency_init() != 0) {
+        return 1;
+    }
+
+    quiet_begin();
+    double small = bench_arm_disarm(BENCH_SMALL_BACKGROUND);
+    double large = bench_arm_disarm(BENCH_LARGE_BACKGROUND);
+    double lag_average = 0.0, lag_max = 0.0;
+    int lag_result = bench_expiry_lag(&lag_average, &lag_max);
+    double flagged = bench_enforce(CONCURRENCY_SIMULATED, spin_yielding);
+    double terminated = bench_enforce(CONCURRENCY_TRUE_PROCESS, sleep_forever);
+    double killed = bench_enforce(CONCURRENCY_TRUE_PROCESS, ignore_sigterm);
+    rift_watchdog_stats_t stats;
+    rift_watchdog_get_stats(&stats);
+    rift_true_concurrency_cleanup();
+    rift_simulated_cleanup();
+    quiet_end();
+
+    printf("\n=== WATCHDOG DEADLINES ===\n");
+    printf("%-36s %.1f ns\n", "arm+disarm, 10k others armed", small);
+    printf("%-36s %.1f ns\n", "arm+disarm, 1M others armed", large);
+    if (lag_result == 0) {
+        printf("%-36s avg %.0f us, max %.0f us\n", "expiry lag (1k deadlines)", lag_average,
+               lag_max);
+    } else {
+        printf("%-36s FAILED\n", "expiry lag (1k deadlines)");
+    }
+    printf("%-36s %.1f ms (deadline %d ms)\n", "simulated task flagged", flagged,
+           BENCH_DEADLINE_MS);
+    printf("%-36s %.1f ms\n", "process terminated (SIGTERM)", terminated);
+    printf("%-36s %.1f ms (grace %d ms)\n", "process killed (SIGTERM ignored)", killed,
+           RIFT_TRUE_GRACE_PERIOD_MS);
+    printf("%-36s %lu armed, %lu cascaded, %lu wakeups\n", "wheel",
+           (unsigned long)stats.armed, (unsigned long)stats.cascaded,
+           (unsigned long)stats.wakeups);
+
+    return small < 0 || large < 0 || lag_result != 0 || flagged < 0 || terminated < 0 ||
+           killed < 0;
+}
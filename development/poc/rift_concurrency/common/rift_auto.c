@@ -0,0 +1,449 @@
+/**
+ * @file rift_auto.c
+ * @brief RIFT Adaptive Mode Selection - Per-Site Statistics for CONCURRENCY_AUTO
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * rift_auto_spawn() picks simulated, hybrid, thread or process execution
+ * for each spawn from what earlier tasks of the same spawn location did.
+ * Every site keeps online moving averages of its tasks' run time, thread
+ * CPU time and time blocked in the kernel, plus what a spawn costs the
+ * caller in each mode. A new site runs on the true thread pool while its
+ * first tasks are measured; after that one task in RIFT_AUTO_SAMPLE_INTERVAL
+ * is, so the classification follows the workload at a bounded cost and
+ * unmeasured spawns go straight to their mode.
+ *
+ * A measured task runs through a wrapper that reads the clocks and the
+ * thread's voluntary switch count around the work function. Time between
+ * wall and CPU counts as blocked only if the thread gave up the CPU
+ * itself; preemption does not make a CPU-bound task look blocking. A
+ * simulated task that yields or parks is resumed later, possibly on
+ * another hybrid worker, so its sample says nothing about its own cost
+ * and is dropped.
+ *
+ * The site table is open-addressed on the location's hash and claimed
+ * with a compare-and-swap, so spawning takes no lock and a forked child
+ * keeps its parent's measurements. A slot whose hash matches is only the
+ * site if its stored location does too; colliding locations probe on.
+ * Averages are updated without a lock too: two samples finishing together
+ * may lose one update, which only makes the average a little slower to
+ * move.
+ */
+
+#include "rift_auto.h"
+#include "rift_simulated.h"
+#include "rift_simulated_hybrid.h"
+#include "rift_true_concurrency.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <sys/resource.h>
+
+#define AUTO_AVERAGE_SHIFT 3              // New samples weigh 1/8
+#define AUTO_READY_SPINS 1000             // Yields to wait for a claimed site's location
+
+typedef struct {
+    _Atomic uint64_t key;                 // Location hash, 0 while free
+    _Atomic bool ready;                   // location written
+    char location[128];                   // Spawn location (truncated)
+    _Atomic uint32_t site_class;          // rift_auto_class_t
+    _Atomic uint64_t spawns;              // rift_auto_spawn() calls
+    _Atomic uint64_t samples;             // Tasks measured
+    _Atomic uint64_t yielded;             // Measured tasks that yielded
+    _Atomic uint64_t avg_run_ns;          // Moving average wall time
+    _Atomic uint64_t avg_cpu_ns;          // Moving average thread CPU time
+    _Atomic uint64_t avg_blocked_ns;      // Moving average blocked time
+} rift_auto_site_t;
+
+// Wrapper argument of one measured task
+typedef struct {
+    rift_auto_site_t* site;               // Site being measured
+    void (*work_function)(void*);         // Real work function
+    void* work_data;                      // Real work data
+} rift_auto_sample_t;                     // Freed by the task; leaked if it never starts
+
+static struct {
+    rift_auto_site_t sites[RIFT_AUTO_MAX_SITES];
+    _Atomic uint32_t site_count;
+    _Atomic bool full_reported;
+    _Atomic uint64_t spawns;
+    _Atomic uint64_t mode_spawns[CONCURRENCY_AUTO];
+    _Atomic uint64_t dedicated;
+    _Atomic uint64_t samples;
+    _Atomic uint64_t reclassified;
+    _Atomic uint64_t cost_samples[CONCURRENCY_AUTO];
+    _Atomic uint64_t spawn_cost_ns[CONCURRENCY_AUTO];
+} g_auto;
+
+static const char* g_auto_class_names[] = { "MEASURING", "SHORT", "CPU_BOUND", "BLOCKING" };
+static const char* g_auto_mode_names[] = { "SIMULATED", "THREAD", "PROCESS", "HYBRID" };
+
+static uint64_t auto_clock_ns(clockid_t clock) {
+    struct timespec now;
+    clock_gettime(clock, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Fold a sample into a moving average; the first sample seeds it
+ */
+static void auto_average(_Atomic uint64_t* average, uint64_t value, bool first) {
+    if (first) {
+        atomic_store_explicit(average, value, memory_order_relaxed);
+        return;
+    }
+    int64_t current = (int64_t)atomic_load_explicit(average, memory_order_relaxed);
+    current += ((int64_t)value - current) / (1 << AUTO_AVERAGE_SHIFT);
+    atomic_store_explicit(average, (uint64_t)current, memory_order_relaxed);
+}
+
+// =============================================================================
+// SITE TABLE
+// =============================================================================
+
+static uint64_t auto_hash(const char* location) {
+    uint64_t hash = 14695981039346656037ull;
+    for (const char* c = location; *c; c++) {
+        hash = (hash ^ (uint8_t)*c) * 1099511628211ull;
+    }
+    return hash ? hash : 1;
+}
+
+/**
+ * @brief Whether a claimed site is the one of location, not another whose
+ *        hash collides; waits for the claimer to publish the location
+ */
+static bool auto_site_matches(rift_auto_site_t* site, const char* location) {
+    for (uint32_t spin = 0; !atomic_load_explicit(&site->ready, memory_order_acquire); spin++) {
+        if (spin == AUTO_READY_SPINS) {
+            return false; // Claimer lost to a fork before publishing
+        }
+        sched_yield();
+    }
+    return strncmp(site->location, location, sizeof(site->location) - 1) == 0;
+}
+
+/**
+ * @brief Find the site of a spawn location, claiming a free slot if asked
+ * @return Site, NULL if absent (or the table is full)
+ */
+static rift_auto_site_t* auto_site_find(const char* location, bool create) {
+    uint64_t key = auto_hash(location);
+    for (uint32_t probe = 0; probe < RIFT_AUTO_MAX_SITES; probe++) {
+        rift_auto_site_t* site = &g_auto.sites[(key + probe) & (RIFT_AUTO_MAX_SITES - 1)];
+        uint64_t current = atomic_load_explicit(&site->key, memory_order_acquire);
+        if (current == 0) {
+            if (!create) {
+                return NULL;
+            }
+            if (atomic_compare_exchange_strong_explicit(&site->key, &current, key,
+                                                        memory_order_acq_rel,
+                                                        memory_order_acquire)) {
+                snprintf(site->location, sizeof(site->location), "%s", location);
+                atomic_store_explicit(&site->ready, true, memory_order_release);
+                atomic_fetch_add(&g_auto.site_count, 1);
+                return site;
+            }
+            // Claimed by a concurrent spawn: current now holds its key
+        }
+        if (current == key && auto_site_matches(site, location)) {
+            return site;
+        }
+    }
+
+    if (create && !atomic_exchange(&g_auto.full_reported, true)) {
+        printf("[AUTO] Site table full - new sites run on the thread pool unmeasured\n");
+    }
+    return NULL;
+}
+
+// =============================================================================
+// CLASSIFICATION
+// =============================================================================
+
+static bool auto_requires_isolation(const rift_governance_policy_t* policy) {
+    return policy->require_isolation || policy->ipc_ring || policy->zygote_spawn;
+}
+
+/**
+ * @brief Run time below which a task is cheaper to run than to hand to a thread
+ */
+static uint64_t auto_short_threshold_ns(void) {
+    uint64_t threshold = RIFT_AUTO_SHORT_FACTOR *
+                         atomic_load_explicit(&g_auto.spawn_cost_ns[CONCURRENCY_TRUE_THREAD],
+                                              memory_order_relaxed);
+    if (threshold < RIFT_AUTO_SHORT_MIN_NS) {
+        return RIFT_AUTO_SHORT_MIN_NS;
+    }
+    return threshold > RIFT_AUTO_SHORT_MAX_NS ? RIFT_AUTO_SHORT_MAX_NS : threshold;
+}
+
+/**
+ * @brief Reclassify site from its averages; leaving SHORT takes twice the
+ *        threshold so sites near it do not flip on every sample
+ */
+static void auto_reclassify(rift_auto_site_t* site) {
+    if (atomic_load_explicit(&site->samples, memory_order_relaxed) < RIFT_AUTO_WARMUP_SAMPLES) {
+        return;
+    }
+
+    uint64_t run = atomic_load_explicit(&site->avg_run_ns, memory_order_relaxed);
+    uint64_t blocked = atomic_load_explicit(&site->avg_blocked_ns, memory_order_relaxed);
+    uint32_t current = atomic_load_explicit(&site->site_class, memory_order_relaxed);
+    uint64_t threshold = auto_short_threshold_ns();
+
+    uint32_t next;
+    if (blocked > 0 && blocked * 100 >= run * RIFT_AUTO_BLOCKING_PERCENT) {
+        next = RIFT_AUTO_BLOCKING;
+    } else if (run < threshold || (current == RIFT_AUTO_SHORT && run < 2 * threshold)) {
+        next = RIFT_AUTO_SHORT;
+    } else {
+        next = RIFT_AUTO_CPU_BOUND;
+    }
+
+    if (next != current &&
+        atomic_compare_exchange_strong_explicit(&site->site_class, &current, next,
+                                                memory_order_relaxed, memory_order_relaxed)) {
+        atomic_fetch_add_explicit(&g_auto.reclassified, 1, memory_order_relaxed);
+        printf("[AUTO] %s: %s -> %s (run %.1f us, %lu%% blocked)\n", site->location,
+               g_auto_class_names[current], g_auto_class_names[next], (double)run / 1000.0,
+               (unsigned long)(run ? blocked * 100 / run : 0));
+    }
+}
+
+/**
+ * @brief Mode for a spawn from site; sets *dedicated for long-blocking sites
+ */
+static rift_concurrency_mode_t auto_choose(const rift_governance_policy_t* policy,
+                                           rift_auto_site_t* site, bool* dedicated) {
+    if (auto_requires_isolation(policy)) {
+        return CONCURRENCY_TRUE_PROCESS;
+    }
+    if (!site) {
+        return CONCURRENCY_TRUE_THREAD;
+    }
+
+    switch (atomic_load_explicit(&site->site_class, memory_order_relaxed)) {
+    case RIFT_AUTO_SHORT:
+        if (rift_hybrid_active()) {
+            return CONCURRENCY_HYBRID;
+        }
+        // Only a task of the single-thread scheduler knows someone drives it
+        return rift_simulated_current() ? CONCURRENCY_SIMULATED : CONCURRENCY_TRUE_THREAD;
+    case RIFT_AUTO_BLOCKING:
+        // A pool worker blocked this long is one fewer core running work
+        if (atomic_load_explicit(&site->avg_run_ns, memory_order_relaxed) >=
+            RIFT_AUTO_DEDICATED_NS) {
+            *dedicated = true;
+        }
+        return CONCURRENCY_TRUE_THREAD;
+    default:
+        return CONCURRENCY_TRUE_THREAD;
+    }
+}
+
+// =============================================================================
+// MEASUREMENT
+// =============================================================================
+
+/**
+ * @brief Work function of measured tasks
+ */
+static void auto_sampled_entry(void* data) {
+    rift_auto_sample_t* sample = data;
+    rift_auto_site_t* site = sample->site;
+    rift_simulated_context_t* task = rift_simulated_current();
+    uint32_t slice = task ? task->current_slice : 0;
+
+    struct rusage usage;
+    getrusage(RUSAGE_THREAD, &usage);
+    long switches = usage.ru_nvcsw;
+    // CPU interval inside the wall one, so CPU time never exceeds run time
+    uint64_t wall_start = auto_clock_ns(CLOCK_MONOTONIC);
+    uint64_t cpu_start = auto_clock_ns(CLOCK_THREAD_CPUTIME_ID);
+
+    sample->work_function(sample->work_data);
+
+    uint64_t cpu = auto_clock_ns(CLOCK_THREAD_CPUTIME_ID) - cpu_start;
+    uint64_t wall = auto_clock_ns(CLOCK_MONOTONIC) - wall_start;
+    getrusage(RUSAGE_THREAD, &usage);
+    free(sample);
+
+    if (task && task->current_slice != slice) {
+        atomic_fetch_add_explicit(&site->yielded, 1, memory_order_relaxed);
+        return;
+    }
+
+    uint64_t blocked = usage.ru_nvcsw > switches && wall > cpu ? wall - cpu : 0;
+    bool first = atomic_fetch_add_explicit(&site->samples, 1, memory_order_relaxed) == 0;
+    auto_average(&site->avg_run_ns, wall, first);
+    auto_average(&site->avg_cpu_ns, cpu, first);
+    auto_average(&site->avg_blocked_ns, blocked, first);
+    atomic_fetch_add_explicit(&g_auto.samples, 1, memory_order_relaxed);
+    auto_reclassify(site);
+}
+
+/**
+ * @brief Whether this spawn is measured: every one while warming up, then
+ *        one in RIFT_AUTO_SAMPLE_INTERVAL
+ */
+static bool auto_should_sample(uint64_t spawn_index) {
+    return spawn_index < RIFT_AUTO_WARMUP_SAMPLES ||
+           spawn_index % RIFT_AUTO_SAMPLE_INTERVAL == 0;
+}
+
+static uint64_t auto_dispatch(uint64_t parent_id, const rift_governance_policy_t* policy,
+                              void (*work_func)(void*), void* work_data,
+                              const char* spawn_location) {
+    switch (policy->mode) {
+    case CONCURRENCY_TRUE_THREAD:
+        return rift_true_spawn_thread(parent_id, policy, work_func, work_data, spawn_location);
+    case CONCURRENCY_TRUE_PROCESS:
+        return rift_true_spawn_process(parent_id, policy, work_func, work_data, spawn_location);
+    default:
+        return rift_simulated_spawn(parent_id, policy, work_func, work_data, spawn_location);
+    }
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+/**
+ * @brief Spawn task in the mode chosen for its site, measuring a sample
+ */
+uint64_t rift_auto_spawn(uint64_t parent_id,
+                         const rift_governance_policy_t* policy,
+                         void (*work_func)(void*),
+                         void* work_data,
+                         const char* spawn_location) {
+    if (!policy || !work_func || !spawn_location) {
+        return 0;
+    }
+
+    uint64_t spawn_index = atomic_fetch_add_explicit(&g_auto.spawns, 1, memory_order_relaxed);
+    rift_auto_site_t* site = NULL;
+    if (!auto_requires_isolation(policy)) {
+        site = auto_site_find(spawn_location, true);
+    }
+    if (site) {
+        spawn_index = atomic_fetch_add_explicit(&site->spawns, 1, memory_order_relaxed);
+    }
+
+    rift_governance_policy_t chosen = *policy;
+    chosen.mode = auto_choose(policy, site, &chosen.dedicated_thread);
+
+    bool measured = auto_should_sample(spawn_index);
+    void (*entry)(void*) = work_func;
+    void* data = work_data;
+    rift_auto_sample_t* sample = NULL;
+    // Process children measure in their own copy of the table; only the spawn is timed
+    if (measured && site && chosen.mode != CONCURRENCY_TRUE_PROCESS) {
+        sample = malloc(sizeof(rift_auto_sample_t));
+        if (sample) {
+            sample->site = site;
+            sample->work_function = work_func;
+            sample->work_data = work_data;
+            entry = auto_sampled_entry;
+            data = sample;
+        }
+    }
+
+    uint64_t start = measured ? auto_clock_ns(CLOCK_MONOTONIC) : 0;
+    uint64_t rift_id = auto_dispatch(parent_id, &chosen, entry, data, spawn_location);
+    if (rift_id == 0) {
+        free(sample);
+        return 0;
+    }
+
+    // A dedicated pthread would skew the pool's spawn cost the threshold uses
+    if (measured && !chosen.dedicated_thread) {
+        uint64_t cost = auto_clock_ns(CLOCK_MONOTONIC) - start;
+        bool first = atomic_fetch_add_explicit(&g_auto.cost_samples[chosen.mode], 1,
+                                               memory_order_relaxed) == 0;
+        auto_average(&g_auto.spawn_cost_ns[chosen.mode], cost, first);
+    }
+    atomic_fetch_add_explicit(&g_auto.mode_spawns[chosen.mode], 1, memory_order_relaxed);
+    if (chosen.mode == CONCURRENCY_TRUE_THREAD && chosen.dedicated_thread) {
+        atomic_fetch_add_explicit(&g_auto.dedicated, 1, memory_order_relaxed);
+    }
+    return rift_id;
+}
+
+rift_concurrency_mode_t rift_auto_select(const rift_governance_policy_t* policy,
+                                         const char* spawn_location) {
+    if (!policy || !spawn_location) {
+        return CONCURRENCY_TRUE_THREAD;
+    }
+    bool dedicated = false;
+    return auto_choose(policy, auto_site_find(spawn_location, false), &dedicated);
+}
+
+int rift_auto_get_site(const char* spawn_location, rift_auto_site_stats_t* stats) {
+    if (!spawn_location || !stats) {
+        return -1;
+    }
+    rift_auto_site_t* site = auto_site_find(spawn_location, false);
+    if (!site) {
+        return -1;
+    }
+
+    stats->site_class = (rift_auto_class_t)atomic_load(&site->site_class);
+    stats->spawns = atomic_load(&site->spawns);
+    stats->samples = atomic_load(&site->samples);
+    stats->yielded = atomic_load(&site->yielded);
+    stats->avg_run_ns = atomic_load(&site->avg_run_ns);
+    stats->avg_cpu_ns = atomic_load(&site->avg_cpu_ns);
+    stats->avg_blocked_ns = atomic_load(&site->avg_blocked_ns);
+    return 0;
+}
+
+void rift_auto_get_stats(rift_auto_stats_t* stats) {
+    if (!stats) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->spawns = atomic_load(&g_auto.spawns);
+    for (int mode = 0; mode < CONCURRENCY_AUTO; mode++) {
+        stats->mode_spawns[mode] = atomic_load(&g_auto.mode_spawns[mode]);
+        stats->spawn_cost_ns[mode] = atomic_load(&g_auto.spawn_cost_ns[mode]);
+    }
+    stats->dedicated = atomic_load(&g_auto.dedicated);
+    stats->samples = atomic_load(&g_auto.samples);
+    stats->reclassified = atomic_load(&g_auto.reclassified);
+    stats->sites = atomic_load(&g_auto.site_count);
+}
+
+/**
+ * @brief Print spawn costs and one line per site
+ */
+void rift_auto_print_report(void) {
+    rift_auto_stats_t stats;
+    rift_auto_get_stats(&stats);
+
+    printf("\n=== RIFT AUTO MODE REPORT ===\n");
+    printf("Spawns: %lu (%lu measured, %lu reclassifications, %u sites)\n",
+           (unsigned long)stats.spawns, (unsigned long)stats.samples,
+           (unsigned long)stats.reclassified, stats.sites);
+    for (int mode = 0; mode < CONCURRENCY_AUTO; mode++) {
+        printf("  %-10s %8lu spawns, spawn cost %.1f us\n", g_auto_mode_names[mode],
+               (unsigned long)stats.mode_spawns[mode], (double)stats.spawn_cost_ns[mode] / 1000.0);
+    }
+    printf("  Dedicated threads: %lu\n", (unsigned long)stats.dedicated);
+
+    for (uint32_t i = 0; i < RIFT_AUTO_MAX_SITES; i++) {
+        rift_auto_site_t* site = &g_auto.sites[i];
+        if (!atomic_load_explicit(&site->ready, memory_order_acquire)) {
+            continue;
+        }
+        uint64_t run = atomic_load(&site->avg_run_ns);
+        printf("  %-32s %-10s spawns:%lu samples:%lu run:%.1fus cpu:%lu%% blocked:%lu%%\n",
+               site->location, g_auto_class_names[atomic_load(&site->site_class)],
+               (unsigned long)atomic_load(&site->spawns),
+               (unsigned long)atomic_load(&site->samples), (double)run / 1000.0,
+               (unsigned long)(run ? atomic_load(&site->avg_cpu_ns) * 100 / run : 0),
+               (unsigned long)(run ? atomic_load(&site->avg_blocked_ns) * 100 / run : 0));
+    }
+}
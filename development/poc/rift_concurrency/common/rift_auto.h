@@ -0,0 +1,103 @@
+/**
+ * @file rift_auto.h
+ * @brief Adaptive Mode Selection Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_AUTO_H
+#define RIFT_AUTO_H
+
+#include "rift_common.h"
+
+#define RIFT_AUTO_MAX_SITES 256
+#define RIFT_AUTO_WARMUP_SAMPLES 8        // Tasks measured before a site is classified
+#define RIFT_AUTO_SAMPLE_INTERVAL 16      // Then one task in this many is measured
+#define RIFT_AUTO_SHORT_FACTOR 4          // Short: runs under this many thread spawn costs
+#define RIFT_AUTO_SHORT_MIN_NS 2000
+#define RIFT_AUTO_SHORT_MAX_NS 200000
+#define RIFT_AUTO_BLOCKING_PERCENT 50     // Blocking: off-CPU for this share of its run
+#define RIFT_AUTO_DEDICATED_NS 1000000    // Blocking this long: own thread, not a pool worker
+
+// What a spawn site's measured tasks look like
+typedef enum {
+    RIFT_AUTO_MEASURING,                  // Fewer than RIFT_AUTO_WARMUP_SAMPLES yet
+    RIFT_AUTO_SHORT,                      // Cheaper to run than to hand to a thread
+    RIFT_AUTO_CPU_BOUND,                  // Long and on-CPU: spread over cores
+    RIFT_AUTO_BLOCKING                    // Mostly waiting in the kernel
+} rift_auto_class_t;
+
+// Online statistics of one spawn site
+typedef struct {
+    rift_auto_class_t site_class;         // Current classification
+    uint64_t spawns;                      // rift_auto_spawn() calls from the site
+    uint64_t samples;                     // Tasks measured
+    uint64_t yielded;                     // Measured tasks that yielded (not counted)
+    uint64_t avg_run_ns;                  // Moving average wall time of the work function
+    uint64_t avg_cpu_ns;                  // Moving average thread CPU time
+    uint64_t avg_blocked_ns;              // Moving average time blocked in the kernel
+} rift_auto_site_stats_t;
+
+// Aggregate selection statistics
+typedef struct {
+    uint64_t spawns;                      // rift_auto_spawn() calls
+    uint64_t mode_spawns[CONCURRENCY_AUTO]; // Spawns per chosen mode
+    uint64_t dedicated;                   // Thread spawns given their own pthread
+    uint64_t samples;                     // Tasks measured
+    uint64_t reclassified;                // Site class changes
+    uint32_t sites;                       // Spawn sites tracked
+    uint64_t spawn_cost_ns[CONCURRENCY_AUTO]; // Measured caller-side spawn cost per mode
+} rift_auto_stats_t;
+
+/**
+ * @brief Spawn task in the mode its spawn site's measurements call for
+ *
+ * Policies that require isolation (require_isolation, ipc_ring or
+ * zygote_spawn) always get a process. Otherwise sites start on the true
+ * thread pool while they are measured; short tasks then move to the hybrid
+ * pool when it is running, or to the single-thread scheduler when spawned
+ * from one of its tasks; CPU-bound tasks stay on the pool and blocking
+ * tasks get their own thread once they block for long.
+ *
+ * @param parent_id Parent RIFT ID (0 for root), from any mode
+ * @param policy Governance policy; mode is ignored
+ * @param work_func Work function to execute
+ * @param work_data Data to pass to work function
+ * @param spawn_location Source location of spawn; keys the statistics
+ * @return RIFT ID on success, 0 on failure
+ */
+uint64_t rift_auto_spawn(uint64_t parent_id,
+                         const rift_governance_policy_t* policy,
+                         void (*work_func)(void*),
+                         void* work_data,
+                         const char* spawn_location);
+
+/**
+ * @brief Mode the next spawn from a site would get, without spawning
+ * @param policy Governance policy of the spawn
+ * @param spawn_location Source location of spawn
+ * @return Concrete concurrency mode
+ */
+rift_concurrency_mode_t rift_auto_select(const rift_governance_policy_t* policy,
+                                         const char* spawn_location);
+
+/**
+ * @brief Get statistics of one spawn site
+ * @param spawn_location Source location of spawn
+ * @param stats Output statistics
+ * @return 0 on success, -1 if the site has not spawned
+ */
+int rift_auto_get_site(const char* spawn_location, rift_auto_site_stats_t* stats);
+
+/**
+ * @brief Collect aggregate selection statistics
+ * @param stats Output statistics
+ */
+void rift_auto_get_stats(rift_auto_stats_t* stats);
+
+/**
+ * @brief Print per-site classification report
+ */
+void rift_auto_print_report(void);
+
+#endif // RIFT_AUTO_H
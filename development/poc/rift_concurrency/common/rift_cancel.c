@@ -0,0 +1,466 @@
+/**
+ * @file rift_cancel.c
+ * @brief Cancellation Tokens and Cancellable Waits
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Every context embeds a token whose state word is set once the task is
+ * cancelled, so the check a task makes is one relaxed load. Tokens of live
+ * tasks form a tree mirroring the spawn hierarchy, whatever mode each task
+ * runs in, and a hash by RIFT ID finds the token a request names.
+ * Cancelling walks the subtree below a token once, applying each node's
+ * destroy_policy to its children the way teardown does, so the cost is the
+ * size of the subtree and nothing else.
+ *
+ * A cancelled task must not stay blocked in a wait it cannot see the flag
+ * from. Threads wait with futex_waitv (Linux 5.16) on their futex word and
+ * their token's state at once, and cancelling wakes the state word; where
+ * futex_waitv is missing they wait in RIFT_CANCEL_POLL_MS slices instead.
+ * Simulated tasks are woken by the interrupt hook their mode installs at
+ * attach: a cancellable park publishes a claim word, and the waker and the
+ * canceller each exchange it so exactly one of them resumes the task. Hooks
+ * are queued during the walk and run after the tree is unlocked, so a hook
+ * may take mode locks; detaching a token waits out its queued hook. This
+ * module stays free of mode code; the modes call in, never the reverse.
+ */
+
+#include "rift_cancel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <sched.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+typedef struct {
+    pthread_mutex_t tree_mutex;           // Guards links, hash and stats
+    rift_cancel_token_t* buckets[RIFT_CANCEL_HASH_BUCKETS];
+    rift_cancel_stats_t stats;
+} rift_cancel_tree_t;
+
+static rift_cancel_tree_t g_cancel = {
+    .tree_mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+// Cleared once the kernel turns futex_waitv down
+static _Atomic bool g_cancel_waitv = true;
+
+static rift_thread_context_t* cancel_context_of(rift_cancel_token_t* token) {
+    return (rift_thread_context_t*)((char*)token - offsetof(rift_thread_context_t, cancel));
+}
+
+static uint64_t cancel_token_id(rift_cancel_token_t* token) {
+    return cancel_context_of(token)->telemetry.rift_thread_id;
+}
+
+static rift_cancel_token_t** cancel_bucket(uint64_t rift_id) {
+    return &g_cancel.buckets[rift_id % RIFT_CANCEL_HASH_BUCKETS];
+}
+
+static rift_cancel_token_t* cancel_find_locked(uint64_t rift_id) {
+    if (rift_id == 0) {
+        return NULL;
+    }
+    for (rift_cancel_token_t* token = *cancel_bucket(rift_id); token; token = token->hash_next) {
+        if (cancel_token_id(token) == rift_id) {
+            return token;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Whether cancelling parent takes child down: the parent's
+ *        destroy_policy decides, and keep_alive children outlive all but
+ *        DESTROY_IMMEDIATE (the rule teardown applies per level)
+ */
+static bool cancel_reaches(rift_cancel_token_t* parent, rift_cancel_token_t* child) {
+    rift_destroy_policy_t policy = cancel_context_of(parent)->policy.destroy_policy;
+    if (policy == DESTROY_KEEP_ALIVE) {
+        return false;
+    }
+    return !cancel_context_of(child)->policy.keep_alive || policy == DESTROY_IMMEDIATE;
+}
+
+/**
+ * @brief Cancel one token: flag and futex wake; its mode hook is queued on
+ *        interrupts to run once the tree is unlocked. Caller holds the tree.
+ * @return false if it was already cancelled
+ */
+static bool cancel_one_locked(rift_cancel_token_t* token, rift_cancel_token_t** interrupts) {
+    uint32_t expected = 0;
+    if (!atomic_compare_exchange_strong(&token->state, &expected, 1)) {
+        return false;
+    }
+    cancel_context_of(token)->should_terminate = true;
+    // Threads in rift_cancel_futex_wait() sleep on the state word too
+    syscall(SYS_futex, (uint32_t*)&token->state, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+    if (token->interrupt) {
+        // A token is cancelled once, so it is on at most one list
+        atomic_store(&token->interrupting, true);
+        token->interrupt_next = *interrupts;
+        *interrupts = token;
+        g_cancel.stats.interrupted++;
+    }
+    g_cancel.stats.cancelled++;
+    return true;
+}
+
+/**
+ * @brief First child from 'from' on that cancelling parent reaches and that
+ *        is not cancelled yet; a cancelled child's subtree was walked then
+ */
+static rift_cancel_token_t* cancel_next_child(rift_cancel_token_t* parent,
+                                              rift_cancel_token_t* from) {
+    for (rift_cancel_token_t* child = from; child; child = child->next_sibling) {
+        if (!rift_cancel_requested(child) && cancel_reaches(parent, child)) {
+            return child;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Pre-order walk of the subtree below root through the parent and
+ *        sibling links, without a stack; caller holds the tree
+ */
+static uint32_t cancel_subtree_locked(rift_cancel_token_t* root,
+                                      rift_cancel_token_t** interrupts) {
+    g_cancel.stats.requests++;
+    if (!cancel_one_locked(root, interrupts)) {
+        return 0;
+    }
+    uint32_t cancelled = 1;
+    if (!root->attached) {
+        return cancelled;
+    }
+
+    rift_cancel_token_t* token = root;
+    rift_cancel_token_t* child = cancel_next_child(root, root->first_child);
+    for (;;) {
+        if (child) {
+            cancel_one_locked(child, interrupts);
+            cancelled++;
+            token = child;
+            child = cancel_next_child(token, token->first_child);
+            continue;
+        }
+        if (token == root) {
+            break;
+        }
+        child = cancel_next_child(token->parent, token->next_sibling);
+        token = token->parent;
+    }
+    return cancelled;
+}
+
+/**
+ * @brief Run the mode hooks a cancel queued, outside the tree lock; a
+ *        detaching token waits for its hook to finish
+ */
+static void cancel_run_interrupts(rift_cancel_token_t* token) {
+    while (token) {
+        rift_cancel_token_t* next = token->interrupt_next;
+        token->interrupt(token);
+        atomic_store_explicit(&token->interrupting, false, memory_order_release);
+        token = next;
+    }
+}
+
+static void cancel_link_child(rift_cancel_token_t* parent, rift_cancel_token_t* token) {
+    token->parent = parent;
+    token->prev_sibling = NULL;
+    token->next_sibling = parent->first_child;
+    if (parent->first_child) {
+        parent->first_child->prev_sibling = token;
+    }
+    parent->first_child = token;
+}
+
+// =============================================================================
+// TREE MAINTENANCE
+// =============================================================================
+
+/**
+ * @brief Link a spawned task's token under its parent's
+ */
+void rift_cancel_attach(rift_thread_context_t* context, rift_cancel_interrupt_t interrupt) {
+    rift_cancel_token_t* token = &context->cancel;
+    uint64_t parent_id = context->telemetry.parent_rift_id;
+
+    token->interrupt = interrupt;
+    token->interrupt_next = NULL;
+    atomic_store(&token->interrupting, false);
+    token->first_child = NULL;
+    token->parent = NULL;
+    token->next_sibling = NULL;
+    token->prev_sibling = NULL;
+
+    pthread_mutex_lock(&g_cancel.tree_mutex);
+    // Spawns from inside the parent skip the lookup
+    rift_thread_context_t* current = rift_current();
+    rift_cancel_token_t* parent = NULL;
+    if (current && current->cancel.attached && current->telemetry.rift_thread_id == parent_id) {
+        parent = &current->cancel;
+    } else {
+        parent = cancel_find_locked(parent_id);
+    }
+    if (parent) {
+        cancel_link_child(parent, token);
+    }
+
+    rift_cancel_token_t** bucket = cancel_bucket(context->telemetry.rift_thread_id);
+    token->hash_next = *bucket;
+    *bucket = token;
+    token->attached = true;
+    g_cancel.stats.attached++;
+
+    // Spawned under a parent that is already going away
+    if (parent && rift_cancel_requested(parent) && cancel_reaches(parent, token)) {
+        atomic_store(&token->state, 1);
+        context->should_terminate = true;
+        g_cancel.stats.cancelled++;
+    }
+    pthread_mutex_unlock(&g_cancel.tree_mutex);
+}
+
+/**
+ * @brief Unlink a finishing task's token, handing its children to its parent
+ */
+void rift_cancel_detach(rift_thread_context_t* context) {
+    rift_cancel_token_t* token = &context->cancel;
+    if (!token->attached) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_cancel.tree_mutex);
+    rift_cancel_token_t* parent = token->parent;
+    if (token->prev_sibling) {
+        token->prev_sibling->next_sibling = token->next_sibling;
+    } else if (parent) {
+        parent->first_child = token->next_sibling;
+    }
+    if (token->next_sibling) {
+        token->next_sibling->prev_sibling = token->prev_sibling;
+    }
+
+    rift_cancel_token_t* child = token->first_child;
+    while (child) {
+        rift_cancel_token_t* next = child->next_sibling;
+        if (parent) {
+            cancel_link_child(parent, child);
+        } else {
+            child->parent = NULL;
+            child->prev_sibling = NULL;
+            child->next_sibling = NULL;
+        }
+        child = next;
+    }
+
+    rift_cancel_token_t** link = cancel_bucket(context->telemetry.rift_thread_id);
+    while (*link && *link != token) {
+        link = &(*link)->hash_next;
+    }
+    if (*link) {
+        *link = token->hash_next;
+    }
+
+    token->parent = NULL;
+    token->first_child = NULL;
+    token->next_sibling = NULL;
+    token->prev_sibling = NULL;
+    token->hash_next = NULL;
+    token->attached = false;
+    g_cancel.stats.attached--;
+    pthread_mutex_unlock(&g_cancel.tree_mutex);
+
+    // Unlinked, so no new hook can be queued; one already queued may still run
+    while (atomic_load_explicit(&token->interrupting, memory_order_acquire)) {
+        sched_yield();
+    }
+}
+
+/**
+ * @brief Drop the inherited tree in a freshly forked child; its tokens
+ *        belong to the parent's tasks
+ */
+void rift_cancel_forget_parent(void) {
+    // Another thread may have held the lock across fork()
+    pthread_mutex_init(&g_cancel.tree_mutex, NULL);
+    memset(g_cancel.buckets, 0, sizeof(g_cancel.buckets));
+    memset(&g_cancel.stats, 0, sizeof(g_cancel.stats));
+}
+
+// =============================================================================
+// CANCELLATION
+// =============================================================================
+
+/**
+ * @brief Cancel a task and the descendants its destroy policies reach
+ */
+uint32_t rift_cancel_context(rift_thread_context_t* context) {
+    rift_cancel_token_t* interrupts = NULL;
+    pthread_mutex_lock(&g_cancel.tree_mutex);
+    uint32_t cancelled = cancel_subtree_locked(&context->cancel, &interrupts);
+    pthread_mutex_unlock(&g_cancel.tree_mutex);
+    cancel_run_interrupts(interrupts);
+    return cancelled;
+}
+
+/**
+ * @brief Cancel a task by RIFT ID
+ */
+int rift_cancel(uint64_t rift_id) {
+    rift_cancel_token_t* interrupts = NULL;
+    pthread_mutex_lock(&g_cancel.tree_mutex);
+    rift_cancel_token_t* token = cancel_find_locked(rift_id);
+    uint32_t cancelled = token ? cancel_subtree_locked(token, &interrupts) : 0;
+    pthread_mutex_unlock(&g_cancel.tree_mutex);
+    cancel_run_interrupts(interrupts);
+
+    if (!token) {
+        return -1;
+    }
+    printf("[CANCEL] RIFT ID %lu cancelled (%u tasks)\n", (unsigned long)rift_id, cancelled);
+    return 0;
+}
+
+// =============================================================================
+// CANCELLABLE WAITS
+// =============================================================================
+
+static bool cancel_deadline_passed(const struct timespec* deadline) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec > deadline->tv_sec ||
+           (now.tv_sec == deadline->tv_sec && now.tv_nsec >= deadline->tv_nsec);
+}
+
+/**
+ * @brief Plain futex wait on an absolute deadline
+ * @return 0 when woken or the word changed, -1 once the deadline passed
+ */
+static int cancel_futex_wait_plain(_Atomic uint32_t* word, uint32_t expected,
+                                   const struct timespec* deadline) {
+    long result = syscall(SYS_futex, (uint32_t*)word, FUTEX_WAIT_BITSET_PRIVATE, expected,
+                          deadline, NULL, FUTEX_BITSET_MATCH_ANY);
+    return result != 0 && errno == ETIMEDOUT ? -1 : 0;
+}
+
+/**
+ * @brief Wait on the word and the state together; ENOSYS if unsupported
+ * @return 0 when either was woken or changed, -1 once the deadline passed
+ */
+static int cancel_futex_waitv(_Atomic uint32_t* word, uint32_t expected,
+                              _Atomic uint32_t* state, const struct timespec* deadline) {
+#ifdef SYS_futex_waitv
+    struct futex_waitv waiters[2] = {
+        { .val = expected, .uaddr = (uintptr_t)word, .flags = FUTEX_32 | FUTEX_PRIVATE_FLAG },
+        { .val = 0, .uaddr = (uintptr_t)state, .flags = FUTEX_32 | FUTEX_PRIVATE_FLAG }
+    };
+    long result = syscall(SYS_futex_waitv, waiters, 2, 0, deadline, CLOCK_MONOTONIC);
+    if (result >= 0 || errno == EAGAIN || errno == EINTR) {
+        return 0;
+    }
+    if (errno == ETIMEDOUT) {
+        return -1;
+    }
+#else
+    (void)word;
+    (void)expected;
+    (void)state;
+    (void)deadline;
+#endif
+    errno = ENOSYS;
+    return -2;
+}
+
+/**
+ * @brief Futex wait that also returns when the calling task is cancelled
+ */
+int rift_cancel_futex_wait(_Atomic uint32_t* word, uint32_t expected,
+                           const struct timespec* deadline) {
+    rift_thread_context_t* current = rift_current();
+    if (!current) {
+        return cancel_futex_wait_plain(word, expected, deadline);
+    }
+
+    _Atomic uint32_t* state = &current->cancel.state;
+    if (atomic_load(state) != 0) {
+        return 1;
+    }
+
+    if (atomic_load_explicit(&g_cancel_waitv, memory_order_relaxed)) {
+        int result = cancel_futex_waitv(word, expected, state, deadline);
+        if (result != -2) {
+            return atomic_load(state) != 0 ? 1 : result;
+        }
+        atomic_store(&g_cancel_waitv, false);
+    }
+
+    // No futex_waitv: wake up every slice to look at the token
+    for (;;) {
+        struct timespec slice;
+        clock_gettime(CLOCK_MONOTONIC, &slice);
+        slice.tv_nsec += RIFT_CANCEL_POLL_MS * 1000000L;
+        if (slice.tv_nsec >= 1000000000L) {
+            slice.tv_sec++;
+            slice.tv_nsec -= 1000000000L;
+        }
+        bool last = deadline && (slice.tv_sec > deadline->tv_sec ||
+                                 (slice.tv_sec == deadline->tv_sec &&
+                                  slice.tv_nsec >= deadline->tv_nsec));
+        int result = cancel_futex_wait_plain(word, expected, last ? deadline : &slice);
+        if (atomic_load(state) != 0) {
+            return 1;
+        }
+        if (result == 0 || atomic_load(word) != expected) {
+            return 0;
+        }
+        if (last || (deadline && cancel_deadline_passed(deadline))) {
+            return -1;
+        }
+    }
+}
+
+/**
+ * @brief Sleep that ends early when the calling task is cancelled
+ */
+int rift_sleep_ms(uint32_t timeout_ms) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    rift_thread_context_t* current = rift_current();
+    if (!current) {
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+        }
+        return 0;
+    }
+    // The token's state word is the futex: cancelling wakes it directly
+    while (atomic_load(&current->cancel.state) == 0) {
+        if (cancel_futex_wait_plain(&current->cancel.state, 0, &deadline) != 0) {
+            return atomic_load(&current->cancel.state) != 0 ? -1 : 0;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Get cancellation counters
+ */
+void rift_cancel_get_stats(rift_cancel_stats_t* stats) {
+    pthread_mutex_lock(&g_cancel.tree_mutex);
+    *stats = g_cancel.stats;
+    pthread_mutex_unlock(&g_cancel.tree_mutex);
+    stats->futex_waitv = atomic_load(&g_cancel_waitv);
+}
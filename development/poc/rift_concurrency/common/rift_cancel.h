@@ -0,0 +1,97 @@
+/**
+ * @file rift_cancel.h
+ * @brief Cancellation Token Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_CANCEL_H
+#define RIFT_CANCEL_H
+
+#include "rift_common.h"
+
+#define RIFT_CANCEL_HASH_BUCKETS 64
+#define RIFT_CANCEL_POLL_MS 1             // Wait slice where futex_waitv is missing
+
+// Cancellation counters
+typedef struct {
+    uint64_t requests;                    // rift_cancel_context() calls
+    uint64_t cancelled;                   // Tasks cancelled, descendants included
+    uint64_t interrupted;                 // Mode hooks run to wake a blocked task
+    uint64_t attached;                    // Tokens currently in the tree
+    bool futex_waitv;                     // Blocked threads wait on their token too
+} rift_cancel_stats_t;
+
+/**
+ * @brief Whether a token has been cancelled; one relaxed load
+ * @param token Token to check
+ * @return true once cancelled
+ */
+static inline bool rift_cancel_requested(const rift_cancel_token_t* token) {
+    return atomic_load_explicit(&token->state, memory_order_relaxed) != 0;
+}
+
+/**
+ * @brief Link a spawned task's token under its parent's; the calling task's
+ *        own token is found without a lookup. A task spawned under a
+ *        cancelled parent starts cancelled.
+ * @param context Context of the new task, its RIFT ID assigned
+ * @param interrupt Mode hook waking the task out of a wait, NULL for none
+ */
+void rift_cancel_attach(rift_thread_context_t* context, rift_cancel_interrupt_t interrupt);
+
+/**
+ * @brief Unlink a finishing task's token; its children move to its parent.
+ *        Once it returns no interrupt hook runs for the token.
+ * @param context Context about to be freed (detached tokens are ignored)
+ */
+void rift_cancel_detach(rift_thread_context_t* context);
+
+/**
+ * @brief Drop the inherited cancellation tree in a freshly forked child
+ */
+void rift_cancel_forget_parent(void);
+
+/**
+ * @brief Cancel a task and every descendant its destroy policies would take
+ *        down, in O(subtree): sets should_terminate, wakes threads blocked in
+ *        cancellable futex waits and runs each task's interrupt hook
+ * @param context Context to cancel
+ * @return Number of tasks newly cancelled
+ */
+uint32_t rift_cancel_context(rift_thread_context_t* context);
+
+/**
+ * @brief Cancel a task by RIFT ID, in any mode
+ * @param rift_id RIFT ID of an attached task
+ * @return 0 on success, -1 if no such task
+ */
+int rift_cancel(uint64_t rift_id);
+
+/**
+ * @brief Futex wait that also returns when the calling task is cancelled
+ * @param word Futex word (private)
+ * @param expected Sleep only while *word equals this
+ * @param deadline Absolute CLOCK_MONOTONIC deadline, NULL to wait forever
+ * @return 0 when woken or the word changed, -1 once the deadline passed,
+ *         1 if the calling task is cancelled
+ */
+int rift_cancel_futex_wait(_Atomic uint32_t* word, uint32_t expected,
+                           const struct timespec* deadline);
+
+/**
+ * @brief Sleep that ends early when the calling thread's task is cancelled;
+ *        simulated tasks use rift_simulated_sleep_ms() to keep their
+ *        scheduler thread running
+ * @param timeout_ms Milliseconds to sleep
+ * @return 0 after the full time, -1 if cancelled
+ */
+int rift_sleep_ms(uint32_t timeout_ms);
+
+/**
+ * @brief Get cancellation counters
+ * @param stats Output statistics
+ */
+void rift_cancel_get_stats(rift_cancel_stats_t* stats);
+
+#endif // RIFT_CANCEL_H
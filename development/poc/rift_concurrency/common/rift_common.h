@@ -7,19 +7,55 @@
  *  common/
  *     rift_common.h           # Shared definitions and structures
  *     rift_telemetry.c/h      # PID/TID tracking and spawn telemetry
- *     rift_governance.c/h     # Core governance contracts
+ *     rift_deque.c/h          # Chase-Lev work-stealing deque
+ *     rift_watchdog.c/h       # Timing-wheel watchdog for execution deadlines
+ *     rift_edf.c/h            # Deadline queue and EDF admission control
+ *     rift_cancel.c/h         # Cancellation tokens and cancellable waits
+ *     rift_quota.c/h          # Hierarchical subtree quotas
+ *     rift_signal.c/h         # signalfd routing of runtime signals
+ *     rift_group.c/h          # Task groups and futures across all modes
+ *     rift_auto.c/h           # Per-spawn-site adaptive mode selection
  *  simulated/
  *     rift_simulated.c        # Single-thread cooperative multitasking
  *     rift_simulated.h        # Simulated concurrency interface
+ *     rift_simulated_hybrid.c/h # M:N work-stealing execution of simulated tasks
+ *     rift_simulated_io.c/h   # io_uring/epoll reactor for parked I/O
+ *     rift_simulated_replay.c/h # Deterministic schedule record/replay
+ *     rift_simulated_checkpoint.c/h # Fork-based checkpoint and restore
+ *     rift_simulated_chan.c/h # Channels and select between simulated tasks
  *     Makefile                # Simulated concurrency build
  *  true_concurrency/
  *     rift_true_concurrency.c # Multi-thread true concurrency
- *     rift_process_hierarchy.c # Parent-child process management
+ *     rift_true_pool.c/h      # Work-stealing worker pool for true-thread tasks
+ *     rift_true_parallel.c/h  # Parallel-for and reduce with lazy binary splitting
+ *     rift_true_placement.c/h # CPU affinity and NUMA placement
+ *     rift_true_zygote.c/h    # Prefork helper for process spawns
+ *     rift_true_ipc.c/h       # Shared-memory rings between parent and children
+ *     rift_true_reaper.c/h    # pidfd/epoll reaper for forked children
  *     rift_true_concurrency.h # True concurrency interface
  *     Makefile                # True concurrency build
  *  tests/
- *     test_simulated.c        # Simulated concurrency tests
- *     test_true_concurrency.c # True concurrency tests
+ *     rift_test.h             # Pass/fail checks shared by the test programs
+ *     test_deque.c            # Chase-Lev ordering, growth and concurrent steals
+ *     test_replay.c           # Record/replay round trip of an I/O-driven schedule
+ *     test_chan_select.c      # Channel select: ready cases, parking, close, cancel
+ *     test_lifecycle.c        # Waiters parked on the lifecycle futex word
+ *     test_cancel_tree.c      # Cancellation subtree walk under destroy policies
+ *     test_quota.c            # Subtree quota rejection at the limit
+ *     test_edf.c              # EDF queue order and admission control
+ *     test_checkpoint.c       # Snapshot and same-process rollback
+ *     test_signal.c           # Batched signalfd dispatch
+ *     test_gang.c             # Gang release together and abort
+ *     test_spawn_batch.c      # All-or-nothing spawn batches
+ *     test_deadline.c         # Deadlines cancelling parked tasks
+ *     test_backpressure.c     # Yielding caller-runs spawns
+ *     test_group.c            # Group join, cancel and futures
+ *     test_auto.c             # Auto mode switch and hysteresis
+ *     test_hybrid.c           # Hybrid spawn mode and parked shutdown
+ *     test_ipc.c              # IPC ring MPSC ordering and close wake
+ *     test_reaper.c           # Reaper exit status publication
+ *     test_parallel.c         # Parallel-for covers every index exactly once
+ *     test_teardown.c         # killpg subtree teardown leaves no stragglers
  *  Makefile.master             # Master build coordination
  */
 
@@ -34,13 +70,17 @@
 #include <stdbool.h>
 #include <pthread.h>
 #include <sys/types.h>
+#include <sched.h>
 #include <time.h>
+#include <stdatomic.h>
 
 // Maximum hierarchy constraints per RIFT governance
 #define RIFT_MAX_CHILDREN_PER_PROCESS 32
 #define RIFT_MAX_HIERARCHY_DEPTH 8
 #define RIFT_MAX_THREAD_COUNT 256
 
+typedef struct rift_quota_group rift_quota_group_t;
+
 // Telemetry and tracking structures
 typedef struct {
     pid_t process_id;               // System process ID
@@ -53,13 +93,22 @@ typedef struct {
     uint32_t hierarchy_depth;       // Depth in parent-child tree
     uint32_t child_count;           // Number of children spawned
     bool is_daemon;                 // Daemon thread flag
+    bool numa_placed;               // Placement policy was applied
+    int32_t numa_node;              // NUMA node running the task (if placed)
+    bool numa_local;                // Placed on the spawner's NUMA node
+    bool exited;                    // Process exit collected
+    int32_t exit_status;            // waitpid() status once exited
+    uint64_t deadline_ns;           // Absolute EDF deadline (CLOCK_MONOTONIC), 0 for none
+    rift_quota_group_t* subtree_quota; // Quota its descendants are charged to, NULL for none
 } rift_spawn_telemetry_t;
 
 // Governance policy structure (shared between modules)
 typedef enum {
     CONCURRENCY_SIMULATED,          // Single-thread cooperative
     CONCURRENCY_TRUE_THREAD,        // Multi-thread within process
-    CONCURRENCY_TRUE_PROCESS        // Multi-process hierarchy
+    CONCURRENCY_TRUE_PROCESS,       // Multi-process hierarchy
+    CONCURRENCY_HYBRID,             // Simulated tasks on work-stealing threads (M:N)
+    CONCURRENCY_AUTO                // Chosen per spawn site by rift_auto_spawn()
 } rift_concurrency_mode_t;
 
 typedef enum {
@@ -69,6 +118,27 @@ typedef enum {
     DESTROY_IMMEDIATE              // Immediate termination
 } rift_destroy_policy_t;
 
+typedef enum {
+    PLACEMENT_NONE,                 // Inherit the spawner's affinity
+    PLACEMENT_NUMA_NODE,            // Bind to numa_node
+    PLACEMENT_NEAR_PARENT,          // Prefer the parent's NUMA node
+    PLACEMENT_SPREAD                // Round-robin across NUMA nodes
+} rift_placement_strategy_t;
+
+typedef enum {
+    SCHEDULE_BATCH,                 // Queue order (FIFO / work-stealing)
+    SCHEDULE_EDF                    // Earliest deadline first, ahead of batch work
+} rift_schedule_class_t;
+
+typedef enum {
+    OVERFLOW_BLOCK,                 // Wait until the queue drains below the bound
+    OVERFLOW_FAIL_FAST,             // Refuse the spawn
+    OVERFLOW_CALLER_RUNS            // Run the task on the spawning thread
+} rift_overflow_policy_t;
+
+// Shared-memory IPC ring (rift_true_ipc.c)
+typedef struct rift_ipc_ring rift_ipc_ring_t;
+
 typedef struct {
     uint64_t rift_id;              // Internal RIFT identifier
     rift_concurrency_mode_t mode;  // Concurrency execution mode
@@ -79,222 +149,126 @@ typedef struct {
     uint32_t max_hierarchy_depth;  // Maximum tree depth
     bool daemon_mode;              // Daemon thread flag
     bool keep_alive;               // Survival policy flag
+    bool dedicated_thread;         // TRUE_THREAD: own pthread instead of worker pool
+    bool gang_start;               // TRUE_THREAD batch: dedicated threads released together
+    rift_placement_strategy_t placement; // TRUE_THREAD/TRUE_PROCESS NUMA placement
+    uint32_t numa_node;            // Target node for PLACEMENT_NUMA_NODE
+    cpu_set_t cpu_set;             // Allowed CPUs, empty for no restriction
+    bool zygote_spawn;             // TRUE_PROCESS: fork from the zygote helper
+    rift_ipc_ring_t* ipc_ring;     // TRUE_PROCESS: ring bound to each child, NULL for none
+    bool require_isolation;        // AUTO: always run in a separate process
+    rift_schedule_class_t schedule_class; // SIMULATED/pooled TRUE_THREAD ready-queue order
+    uint32_t deadline_ms;          // EDF: relative deadline, 0 for max_execution_time_ms
+    uint32_t expected_runtime_ms;  // EDF: runtime claimed at admission, 0 for none
+    uint32_t max_queued;           // Ready-queue bound of the runner at spawn, 0 for none
+    rift_overflow_policy_t overflow_policy; // Spawn behaviour once max_queued is reached
+    uint32_t max_subtree_tasks;    // Live descendants allowed, 0 for no quota
+    uint64_t max_subtree_memory;   // Sum of descendants' memory_claim, 0 for no quota
+    uint32_t max_subtree_cpu;      // Sum of descendants' cpu_share, 0 for no quota
+    uint64_t memory_claim;         // Bytes charged to enclosing subtree quotas
+    uint32_t cpu_share;            // Per mille of a CPU charged to enclosing subtree quotas
 } rift_governance_policy_t;
 
+typedef struct rift_cancel_token rift_cancel_token_t;
+
+/**
+ * @brief Mode hook run when a token is cancelled, to wake its task out of a
+ *        wait the mode parks in; runs after the cancellation tree is unlocked
+ */
+typedef void (*rift_cancel_interrupt_t)(rift_cancel_token_t* token);
+
+// Cancellation token embedded in every context; zeroed is valid and detached
+struct rift_cancel_token {
+    _Atomic uint32_t state;               // Nonzero once cancelled; futex word
+    bool attached;                        // Linked into the cancellation tree
+    rift_cancel_token_t* parent;          // Token of the spawning task
+    rift_cancel_token_t* first_child;
+    rift_cancel_token_t* next_sibling;
+    rift_cancel_token_t* prev_sibling;
+    rift_cancel_token_t* hash_next;       // RIFT ID lookup chain
+    rift_cancel_interrupt_t interrupt;    // Set by the mode at attach
+    rift_cancel_token_t* interrupt_next;  // Hooks a cancel runs once it unlocks
+    _Atomic bool interrupting;            // Hook pending or running; detach waits
+};
+
 // Thread context structure (shared between modules)
 typedef struct {
     rift_spawn_telemetry_t telemetry;     // Spawn tracking and telemetry
     rift_governance_policy_t policy;      // Governance and policy constraints
     struct timespec last_heartbeat;       // Last activity timestamp
     uint32_t context_switches;            // Context switch counter
-    volatile bool should_terminate;       // Termination signal
+    volatile bool should_terminate;       // Termination signal, set with cancel.state
     void* module_specific_data;           // Module-specific context
+    rift_cancel_token_t cancel;           // Cancellation token
+    rift_quota_group_t* quota;            // Subtree quota charged at spawn, NULL for none
 } rift_thread_context_t;
 
-// Memory token for resource governance
-typedef struct {
-    uint64_t token_id;             // Unique token identifier
-    uint64_t owner_rift_id;        // Owning RIFT thread ID
-    pid_t owner_process_id;        // Owning process ID
-    uint32_t access_mask;          // Permission bit mask (R/W/X)
-    char resource_name[64];        // Resource identifier
-    struct timespec acquisition_time; // When token was acquired
-    uint32_t validation_bits;      // Token state validation
-    bool is_transferable;          // Can be transferred between threads
-} rift_memory_token_t;
-
-#endif // RIFT_COMMON_H
-
-// =============================================================================
-// TELEMETRY IMPLEMENTATION - rift_telemetry.h
-// =============================================================================
-
-#ifndef RIFT_TELEMETRY_H
-#define RIFT_TELEMETRY_H
-
-#include "rift_common.h"
-
-/**
- * @brief Initialize telemetry subsystem
- * @return 0 on success, error code otherwise
- */
-int rift_telemetry_init(void);
-
-/**
- * @brief Register new thread/process spawn with telemetry
- * @param context Thread context to register
- * @param spawn_location Source location where spawn occurred
- * @return 0 on success, error code otherwise
- */
-int rift_telemetry_register_spawn(rift_thread_context_t* context, const char* spawn_location);
-
-/**
- * @brief Update heartbeat for thread/process
- * @param rift_id RIFT thread identifier
- * @return 0 on success, error code otherwise
- */
-int rift_telemetry_heartbeat(uint64_t rift_id);
-
-/**
- * @brief Get spawn telemetry for specific thread
- * @param rift_id RIFT thread identifier
- * @return Pointer to telemetry data, NULL if not found
- */
-rift_spawn_telemetry_t* rift_telemetry_get(uint64_t rift_id);
-
-/**
- * @brief Print comprehensive telemetry report
- */
-void rift_telemetry_print_report(void);
-
-/**
- * @brief Validate hierarchy constraints for new spawn
- * @param parent_rift_id Parent RIFT thread ID
- * @param proposed_policy Proposed governance policy
- * @return true if spawn allowed, false if violates constraints
- */
-bool rift_telemetry_validate_spawn(uint64_t parent_rift_id, const rift_governance_policy_t* proposed_policy);
-
-#endif // RIFT_TELEMETRY_H
-
-// =============================================================================
-// SIMULATED CONCURRENCY MODULE - rift_simulated.h
-// =============================================================================
-
-#ifndef RIFT_SIMULATED_H
-#define RIFT_SIMULATED_H
-
-#include "rift_common.h"
-
-// Simulated concurrency specific structures
-typedef struct {
-    rift_thread_context_t base_context;   // Common thread context
-    uint32_t time_slice_us;               // Time slice in microseconds
-    uint32_t current_slice;               // Current time slice counter
-    bool yield_requested;                 // Cooperative yield flag
-    void (*work_function)(void*);         // Work function pointer
-    void* work_data;                      // Work function data
-} rift_simulated_context_t;
-
-/**
- * @brief Initialize simulated concurrency subsystem
- * @return 0 on success, error code otherwise
- */
-int rift_simulated_init(void);
+// Context of the task running on this thread, NULL outside tasks. Every mode
+// sets it around a task body: simulated resumes (including hybrid workers,
+// so it follows a coroutine that migrates), true threads, pool units,
+// parallel-loop participants and forked children. Initial-exec TLS makes a
+// read a single %fs-relative load with no __tls_get_addr call; the thread
+// pointer is reloaded on every access, so inline reads stay correct in a
+// hybrid task that resumes on another worker. Defined in rift_telemetry.c.
+extern __thread rift_thread_context_t* rift_current_context
+    __attribute__((tls_model("initial-exec")));
 
 /**
- * @brief Create new simulated concurrent task
- * @param parent_id Parent RIFT thread ID (0 for root)
- * @param policy Governance policy for new task
- * @param work_func Work function to execute
- * @param work_data Data to pass to work function
- * @param spawn_location Source location of spawn
- * @return RIFT thread ID on success, 0 on failure
+ * @brief Context of the calling task
+ * @return Current context, NULL when not called from a task
  */
-uint64_t rift_simulated_spawn(uint64_t parent_id, 
-                              const rift_governance_policy_t* policy,
-                              void (*work_func)(void*), 
-                              void* work_data,
-                              const char* spawn_location);
+static inline rift_thread_context_t* rift_current(void) {
+    return rift_current_context;
+}
 
 /**
- * @brief Execute one scheduling cycle of simulated concurrency
- * @return Number of active tasks processed
+ * @brief RIFT ID of the calling task
+ * @return RIFT ID, 0 when not called from a task
  */
-int rift_simulated_schedule_cycle(void);
+static inline uint64_t rift_current_id(void) {
+    rift_thread_context_t* context = rift_current_context;
+    return context ? context->telemetry.rift_thread_id : 0;
+}
 
 /**
- * @brief Request cooperative yield from current task
+ * @brief Governance policy of the calling task
+ * @return Policy, NULL when not called from a task
  */
-void rift_simulated_yield(void);
+static inline const rift_governance_policy_t* rift_current_policy(void) {
+    rift_thread_context_t* context = rift_current_context;
+    return context ? &context->policy : NULL;
+}
 
 /**
- * @brief Terminate simulated concurrent task
- * @param rift_id RIFT thread ID to terminate
- * @return 0 on success, error code otherwise
+ * @brief Whether the calling task has been cancelled; one relaxed load
+ * @return true once termination was requested, false outside tasks
  */
-int rift_simulated_terminate(uint64_t rift_id);
+static inline bool rift_current_should_terminate(void) {
+    rift_thread_context_t* context = rift_current_context;
+    return context && atomic_load_explicit(&context->cancel.state, memory_order_relaxed) != 0;
+}
 
 /**
- * @brief Clean up simulated concurrency subsystem
+ * @brief Make context current on this thread (runtimes, around task bodies)
+ * @param context New current context, NULL for none
+ * @return Previous current context, to be restored afterwards
  */
-void rift_simulated_cleanup(void);
+static inline rift_thread_context_t* rift_current_swap(rift_thread_context_t* context) {
+    rift_thread_context_t* previous = rift_current_context;
+    rift_current_context = context;
+    return previous;
+}
 
-#endif // RIFT_SIMULATED_H
-
-// =============================================================================
-// TRUE CONCURRENCY MODULE - rift_true_concurrency.h  
-// =============================================================================
-
-#ifndef RIFT_TRUE_CONCURRENCY_H
-#define RIFT_TRUE_CONCURRENCY_H
-
-#include "rift_common.h"
-
-// True concurrency specific structures
+// Memory token for resource governance
 typedef struct {
-    rift_thread_context_t base_context;   // Common thread context
-    pthread_t pthread_handle;             // POSIX thread handle
-    pid_t child_process_id;               // Child process ID (if process mode)
-    pthread_mutex_t lifecycle_mutex;      // Thread lifecycle synchronization
-    pthread_cond_t lifecycle_condition;   // Thread lifecycle condition
-    void (*work_function)(void*);         // Work function pointer
-    void* work_data;                      // Work function data
-} rift_true_context_t;
-
-/**
- * @brief Initialize true concurrency subsystem
- * @return 0 on success, error code otherwise
- */
-int rift_true_concurrency_init(void);
-
-/**
- * @brief Spawn new thread with true concurrency
- * @param parent_id Parent RIFT thread ID
- * @param policy Governance policy for new thread
- * @param work_func Work function to execute
- * @param work_data Data to pass to work function
- * @param spawn_location Source location of spawn
- * @return RIFT thread ID on success, 0 on failure
- */
-uint64_t rift_true_spawn_thread(uint64_t parent_id,
-                                const rift_governance_policy_t* policy,
-                                void (*work_func)(void*),
-                                void* work_data,
-                                const char* spawn_location);
-
-/**
- * @brief Spawn new process with true concurrency
- * @param parent_id Parent RIFT thread ID
- * @param policy Governance policy for new process
- * @param work_func Work function to execute
- * @param work_data Data to pass to work function
- * @param spawn_location Source location of spawn
- * @return RIFT thread ID on success, 0 on failure
- */
-uint64_t rift_true_spawn_process(uint64_t parent_id,
-                                 const rift_governance_policy_t* policy,
-                                 void (*work_func)(void*),
-                                 void* work_data,
-                                 const char* spawn_location);
-
-/**
- * @brief Handle parent destruction with policy enforcement
- * @param parent_id RIFT ID of destroyed parent
- * @return 0 on success, error code otherwise
- */
-int rift_true_handle_parent_destruction(uint64_t parent_id);
-
-/**
- * @brief Terminate thread or process
- * @param rift_id RIFT thread ID to terminate
- * @return 0 on success, error code otherwise
- */
-int rift_true_terminate(uint64_t rift_id);
-
-/**
- * @brief Clean up true concurrency subsystem
- */
-void rift_true_concurrency_cleanup(void);
+    uint64_t token_id;             // Unique token identifier
+    uint64_t owner_rift_id;        // Owning RIFT thread ID
+    pid_t owner_process_id;        // Owning process ID
+    uint32_t access_mask;          // Permission bit mask (R/W/X)
+    char resource_name[64];        // Resource identifier
+    struct timespec acquisition_time; // When token was acquired
+    uint32_t validation_bits;      // Token state validation
+    bool is_transferable;          // Can be transferred between threads
+} rift_memory_token_t;
 
-#endif // RIFT_TRUE_CONCURRENCY_H
+#endif // RIFT_COMMON_H
@@ -0,0 +1,74 @@
+/**
+ * @file rift_deque.h
+ * @brief Chase-Lev Work-Stealing Deque Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_DEQUE_H
+#define RIFT_DEQUE_H
+
+#include "rift_common.h"
+#include <stdatomic.h>
+
+// Circular array backing a deque; grown arrays are retired, not freed
+typedef struct rift_deque_array {
+    int64_t capacity;                      // Slot count (power of two)
+    int64_t mask;                          // capacity - 1
+    struct rift_deque_array* retired_next; // Retired array chain
+    _Atomic(void*) slots[];                // Item storage
+} rift_deque_array_t;
+
+// Chase-Lev deque: owner pushes/pops bottom, thieves steal top
+typedef struct {
+    _Atomic int64_t top;                   // Steal end
+    char top_padding[56];                  // Keep top and bottom on separate lines
+    _Atomic int64_t bottom;                // Owner end
+    _Atomic(rift_deque_array_t*) array;    // Current backing array
+    rift_deque_array_t* retired;           // Arrays awaiting destroy
+} rift_deque_t;
+
+/**
+ * @brief Initialize deque
+ * @param deque Deque to initialize
+ * @param initial_capacity Initial slot count (rounded up to power of two)
+ * @return 0 on success, error code otherwise
+ */
+int rift_deque_init(rift_deque_t* deque, uint32_t initial_capacity);
+
+/**
+ * @brief Release deque storage (no concurrent access allowed)
+ * @param deque Deque to destroy
+ */
+void rift_deque_destroy(rift_deque_t* deque);
+
+/**
+ * @brief Push item at bottom (owner thread only)
+ * @param deque Target deque
+ * @param item Item to push
+ * @return 0 on success, error code if growth failed
+ */
+int rift_deque_push(rift_deque_t* deque, void* item);
+
+/**
+ * @brief Pop newest item from bottom (owner thread only)
+ * @param deque Target deque
+ * @return Item, NULL if empty
+ */
+void* rift_deque_pop(rift_deque_t* deque);
+
+/**
+ * @brief Steal oldest item from top (any thread)
+ * @param deque Victim deque
+ * @return Item, NULL if empty or the race was lost
+ */
+void* rift_deque_steal(rift_deque_t* deque);
+
+/**
+ * @brief Approximate queued item count
+ * @param deque Target deque
+ * @return Number of queued items
+ */
+int64_t rift_deque_size(rift_deque_t* deque);
+
+#endif // RIFT_DEQUE_H
@@ -0,0 +1,256 @@
+/**
+ * @file rift_edf.c
+ * @brief Earliest-Deadline-First Queue and Admission Control
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Tasks of the SCHEDULE_EDF class carry an absolute deadline taken from
+ * deadline_ms or, failing that, from max_execution_time_ms, so the limit
+ * the watchdog enforces is also the one the scheduler orders by. Children
+ * inherit their parent's deadline when it is earlier than their own, so
+ * batch work spawned by a deadline task runs with its urgency.
+ *
+ * Runners (the single-thread scheduler, the worker pool) keep deadline
+ * work in a binary min-heap ahead of their batch queues, and admit it
+ * through a ledger of claimed runtimes. The admission test is the
+ * processor-demand criterion of Liu & Layland, 1973: EDF meets every
+ * deadline on one processor if, for each deadline, the work due by then
+ * fits before it. On a pool the demand is divided over the workers, which
+ * is necessary but not sufficient for global EDF; it refuses what cannot
+ * fit and leaves the rest to the miss counters.
+ */
+
+#include "rift_edf.h"
+#include "rift_telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RIFT_EDF_INITIAL_CAPACITY 64
+
+static uint64_t edf_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+// =============================================================================
+// DEADLINE HEAP
+// =============================================================================
+
+static bool edf_before(const rift_edf_entry_t* a, const rift_edf_entry_t* b) {
+    if (a->deadline_ns != b->deadline_ns) {
+        return a->deadline_ns < b->deadline_ns;
+    }
+    return a->sequence < b->sequence;
+}
+
+static void edf_sift_up(rift_edf_queue_t* queue, uint32_t index) {
+    rift_edf_entry_t entry = queue->entries[index];
+    while (index > 0) {
+        uint32_t parent = (index - 1) / 2;
+        if (!edf_before(&entry, &queue->entries[parent])) {
+            break;
+        }
+        queue->entries[index] = queue->entries[parent];
+        index = parent;
+    }
+    queue->entries[index] = entry;
+}
+
+static void edf_sift_down(rift_edf_queue_t* queue, uint32_t index) {
+    rift_edf_entry_t entry = queue->entries[index];
+    for (;;) {
+        uint32_t child = 2 * index + 1;
+        if (child >= queue->count) {
+            break;
+        }
+        if (child + 1 < queue->count &&
+            edf_before(&queue->entries[child + 1], &queue->entries[child])) {
+            child++;
+        }
+        if (!edf_before(&queue->entries[child], &entry)) {
+            break;
+        }
+        queue->entries[index] = queue->entries[child];
+        index = child;
+    }
+    queue->entries[index] = entry;
+}
+
+int rift_edf_queue_push(rift_edf_queue_t* queue, void* item, uint64_t deadline_ns) {
+    if (queue->count == queue->capacity) {
+        uint32_t capacity = queue->capacity ? queue->capacity * 2 : RIFT_EDF_INITIAL_CAPACITY;
+        rift_edf_entry_t* entries = realloc(queue->entries, capacity * sizeof(*entries));
+        if (!entries) {
+            return -1;
+        }
+        queue->entries = entries;
+        queue->capacity = capacity;
+    }
+
+    uint32_t index = queue->count++;
+    queue->entries[index].deadline_ns = deadline_ns;
+    queue->entries[index].sequence = queue->next_sequence++;
+    queue->entries[index].item = item;
+    edf_sift_up(queue, index);
+    return 0;
+}
+
+void* rift_edf_queue_remove_at(rift_edf_queue_t* queue, uint32_t index) {
+    void* item = queue->entries[index].item;
+    queue->count--;
+    if (index < queue->count) {
+        // The last entry may belong above or below the hole
+        queue->entries[index] = queue->entries[queue->count];
+        edf_sift_up(queue, index);
+        edf_sift_down(queue, index);
+    }
+    return item;
+}
+
+void* rift_edf_queue_pop(rift_edf_queue_t* queue) {
+    if (queue->count == 0) {
+        return NULL;
+    }
+    return rift_edf_queue_remove_at(queue, 0);
+}
+
+bool rift_edf_queue_boost(rift_edf_queue_t* queue, void* item, uint64_t deadline_ns) {
+    for (uint32_t i = 0; i < queue->count; i++) {
+        if (queue->entries[i].item == item) {
+            if (deadline_ns < queue->entries[i].deadline_ns) {
+                queue->entries[i].deadline_ns = deadline_ns;
+                edf_sift_up(queue, i);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void rift_edf_queue_destroy(rift_edf_queue_t* queue) {
+    free(queue->entries);
+    memset(queue, 0, sizeof(*queue));
+}
+
+// =============================================================================
+// DEADLINE RESOLUTION
+// =============================================================================
+
+int rift_edf_resolve(uint64_t parent_id, const rift_governance_policy_t* policy,
+                     uint64_t* deadline_ns) {
+    *deadline_ns = 0;
+    if (policy->schedule_class == SCHEDULE_EDF) {
+        uint32_t relative_ms = policy->deadline_ms ? policy->deadline_ms
+                                                   : policy->max_execution_time_ms;
+        if (relative_ms == 0) {
+            printf("[EDF] Spawn rejected: EDF policy sets neither deadline_ms nor "
+                   "max_execution_time_ms\n");
+            return -1;
+        }
+        *deadline_ns = edf_now_ns() + (uint64_t)relative_ms * 1000000ull;
+    }
+
+    // Inherit an earlier deadline from the parent, whatever our own class
+    uint64_t inherited = parent_id != 0 ? rift_telemetry_get_deadline(parent_id) : 0;
+    if (inherited != 0 && (*deadline_ns == 0 || inherited < *deadline_ns)) {
+        *deadline_ns = inherited;
+    }
+    return 0;
+}
+
+// =============================================================================
+// ADMISSION CONTROL
+// =============================================================================
+
+void rift_edf_ledger_reset(rift_edf_ledger_t* ledger, uint32_t runners) {
+    pthread_mutex_lock(&ledger->mutex);
+    ledger->count = 0;
+    ledger->runners = runners > 0 ? runners : 1;
+    pthread_mutex_unlock(&ledger->mutex);
+}
+
+void rift_edf_ledger_forget_parent(rift_edf_ledger_t* ledger) {
+    pthread_mutex_init(&ledger->mutex, NULL);
+    ledger->count = 0;
+}
+
+/**
+ * @brief Demand test with the new claim inserted at index; caller holds
+ *        the ledger mutex
+ */
+static bool edf_feasible_locked(const rift_edf_ledger_t* ledger, uint32_t index,
+                                uint64_t deadline_ns, uint64_t runtime_ns, uint64_t now) {
+    uint64_t runners = ledger->runners > 0 ? ledger->runners : 1;
+    uint64_t demand = runtime_ns;
+    for (uint32_t i = 0; i < index; i++) {
+        demand += ledger->claims[i].runtime_ns;
+    }
+    if (now + demand / runners > deadline_ns) {
+        return false;
+    }
+
+    // Later deadlines now also have the new runtime ahead of them
+    for (uint32_t i = index; i < ledger->count; i++) {
+        demand += ledger->claims[i].runtime_ns;
+        if (now + demand / runners > ledger->claims[i].deadline_ns) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int rift_edf_admit(rift_edf_ledger_t* ledger, const void* owner, uint64_t deadline_ns,
+                   uint64_t runtime_ns) {
+    uint64_t now = edf_now_ns();
+    const char* reason = NULL;
+
+    if (deadline_ns <= now) {
+        reason = "deadline already passed";
+    } else if (runtime_ns > deadline_ns - now) {
+        reason = "runtime exceeds deadline";
+    } else if (runtime_ns > 0) {
+        pthread_mutex_lock(&ledger->mutex);
+        uint32_t index = 0;
+        while (index < ledger->count && ledger->claims[index].deadline_ns <= deadline_ns) {
+            index++;
+        }
+
+        if (ledger->count == RIFT_MAX_THREAD_COUNT) {
+            reason = "admission ledger full";
+        } else if (!edf_feasible_locked(ledger, index, deadline_ns, runtime_ns, now)) {
+            reason = "outstanding EDF work would miss a deadline";
+        } else {
+            memmove(&ledger->claims[index + 1], &ledger->claims[index],
+                    (ledger->count - index) * sizeof(rift_edf_claim_t));
+            ledger->claims[index].deadline_ns = deadline_ns;
+            ledger->claims[index].runtime_ns = runtime_ns;
+            ledger->claims[index].owner = owner;
+            ledger->count++;
+        }
+        pthread_mutex_unlock(&ledger->mutex);
+    }
+
+    if (reason) {
+        printf("[EDF] Spawn rejected: %s (runtime %.2f ms, %.2f ms to deadline)\n", reason,
+               (double)runtime_ns / 1e6,
+               deadline_ns > now ? (double)(deadline_ns - now) / 1e6 : 0.0);
+        rift_telemetry_record_deadline_rejected(deadline_ns, runtime_ns);
+        return -1;
+    }
+    return 0;
+}
+
+void rift_edf_release(rift_edf_ledger_t* ledger, const void* owner) {
+    pthread_mutex_lock(&ledger->mutex);
+    for (uint32_t i = 0; i < ledger->count; i++) {
+        if (ledger->claims[i].owner == owner) {
+            memmove(&ledger->claims[i], &ledger->claims[i + 1],
+                    (ledger->count - i - 1) * sizeof(rift_edf_claim_t));
+            ledger->count--;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&ledger->mutex);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file rift_edf.h
+ * @brief Earliest-Deadline-First Queue and Admission Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_EDF_H
+#define RIFT_EDF_H
+
+#include "rift_common.h"
+
+// Queued item and the deadline it is ordered by
+typedef struct {
+    uint64_t deadline_ns;                 // Absolute deadline (CLOCK_MONOTONIC)
+    uint64_t sequence;                    // Push order; breaks deadline ties FIFO
+    void* item;                           // Queued task
+} rift_edf_entry_t;
+
+// Binary min-heap on deadline; callers provide the locking. A zeroed queue
+// is empty and valid.
+typedef struct {
+    rift_edf_entry_t* entries;            // Heap array
+    uint32_t count;                       // Queued items
+    uint32_t capacity;                    // Allocated entries
+    uint64_t next_sequence;               // Sequence of the next push
+} rift_edf_queue_t;
+
+// Runtime claimed by one admitted task
+typedef struct {
+    uint64_t deadline_ns;                 // Absolute deadline
+    uint64_t runtime_ns;                  // Claimed runtime
+    const void* owner;                    // Admitted task
+} rift_edf_claim_t;
+
+// Outstanding claims of one runner (scheduler or pool) for admission control
+typedef struct {
+    rift_edf_claim_t claims[RIFT_MAX_THREAD_COUNT]; // Sorted by deadline
+    uint32_t count;                       // Outstanding claims
+    uint32_t runners;                     // Tasks the runner executes at once
+    pthread_mutex_t mutex;                // Guards the fields above
+} rift_edf_ledger_t;
+
+/**
+ * @brief Queue item under a deadline, growing the heap as needed
+ * @param queue Deadline queue
+ * @param item Task to queue
+ * @param deadline_ns Absolute deadline
+ * @return 0 on success, -1 if the heap could not grow
+ */
+int rift_edf_queue_push(rift_edf_queue_t* queue, void* item, uint64_t deadline_ns);
+
+/**
+ * @brief Remove the item with the earliest deadline
+ * @param queue Deadline queue
+ * @return Queued item, NULL if empty
+ */
+void* rift_edf_queue_pop(rift_edf_queue_t* queue);
+
+/**
+ * @brief Remove the entry at a heap index (for callers scanning entries)
+ * @param queue Deadline queue
+ * @param index Index into queue->entries
+ * @return Removed item
+ */
+void* rift_edf_queue_remove_at(rift_edf_queue_t* queue, uint32_t index);
+
+/**
+ * @brief Move a queued item to an earlier deadline
+ * @param queue Deadline queue
+ * @param item Queued task
+ * @param deadline_ns New deadline; ignored unless earlier
+ * @return true if the item is queued (whether or not it moved)
+ */
+bool rift_edf_queue_boost(rift_edf_queue_t* queue, void* item, uint64_t deadline_ns);
+
+/**
+ * @brief Free the heap array; the queue is empty and reusable afterwards
+ * @param queue Deadline queue
+ */
+void rift_edf_queue_destroy(rift_edf_queue_t* queue);
+
+/**
+ * @brief Resolve a spawn's absolute deadline: its own (deadline_ms, else
+ *        max_execution_time_ms) when EDF, or the parent's if earlier
+ * @param parent_id Parent RIFT ID (0 for root)
+ * @param policy Governance policy of the spawn
+ * @param deadline_ns Output deadline, 0 for a batch task of a batch parent
+ * @return 0 on success, -1 if an EDF policy gives no deadline
+ */
+int rift_edf_resolve(uint64_t parent_id, const rift_governance_policy_t* policy,
+                     uint64_t* deadline_ns);
+
+/**
+ * @brief Drop every claim and set the runner's parallelism
+ * @param ledger Admission ledger
+ * @param runners Tasks the runner executes at once
+ */
+void rift_edf_ledger_reset(rift_edf_ledger_t* ledger, uint32_t runners);
+
+/**
+ * @brief Drop the claims of a ledger inherited across fork(); its mutex
+ *        may have been held by a thread that did not survive
+ * @param ledger Admission ledger
+ */
+void rift_edf_ledger_forget_parent(rift_edf_ledger_t* ledger);
+
+/**
+ * @brief Admit a task if every outstanding deadline stays feasible
+ *
+ * Processor-demand test: for each claim due at or after the new one, the
+ * runtime claimed up to that deadline, spread over the ledger's runners,
+ * must fit before it. Tasks that claim no runtime only need a deadline
+ * still in the future. Rejections are counted in telemetry.
+ *
+ * @param ledger Admission ledger
+ * @param owner Task the claim belongs to
+ * @param deadline_ns Absolute deadline
+ * @param runtime_ns Claimed runtime (0 for none)
+ * @return 0 if admitted, -1 if infeasible
+ */
+int rift_edf_admit(rift_edf_ledger_t* ledger, const void* owner, uint64_t deadline_ns,
+                   uint64_t runtime_ns);
+
+/**
+ * @brief Release an admitted task's claim; no-op if it holds none
+ * @param ledger Admission ledger
+ * @param owner Task the claim belongs to
+ */
+void rift_edf_release(rift_edf_ledger_t* ledger, const void* owner);
+
+#endif // RIFT_EDF_H
@@ -0,0 +1,429 @@
+/**
+ * @file rift_group.c
+ * @brief RIFT Task Groups - Structured Spawn, Futures and Join
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A task group runs each spawned work function as an ordinary task of the
+ * group's policy mode (simulated, hybrid, true thread or true process) and
+ * gives back a future holding the task's state word and result slot. The
+ * group header and every future live in one MAP_SHARED arena mapped at
+ * create time, so a forked child writes its result where the parent reads
+ * it and no spawn allocates synchronisation objects.
+ *
+ * Waiting depends on the mode: simulated tasks park on the future (the
+ * completer wakes them, as channel partners do); outside a task, the
+ * single-thread scheduler is driven until the future is final and hybrid
+ * callers park on the futex. True tasks are waited for with rift_true_wait(),
+ * which helps run queued pool work on a worker thread and, once the task is
+ * gone, lets a future whose work never completed (a killed process, a task
+ * terminated before it started) be resolved as abandoned. That needs the
+ * task in our own table, so only the creating process spawns into a group;
+ * process tasks create groups of their own for further fan-out.
+ *
+ * Thread waits end early when the waiting task is cancelled, leaving the
+ * future as it is. Simulated parks on a future do not: the completer may
+ * still be walking the waiter list when the parked task would return.
+ */
+
+#include "rift_group.h"
+#include "rift_cancel.h"
+#include "rift_simulated.h"
+#include "rift_true_concurrency.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#define GROUP_CACHE_LINE 64
+
+struct rift_future_waiter {
+    rift_simulated_context_t* task;       // Parked task
+    rift_future_waiter_t* next;           // Waiter list link
+};
+
+// Waiter list head of a final future; also closes it to new waiters
+static rift_future_waiter_t g_waiters_closed;
+
+// =============================================================================
+// FUTURE STATE WORD
+// =============================================================================
+
+static uint32_t future_state(const rift_future_t* future) {
+    return atomic_load_explicit(&((rift_future_t*)future)->state, memory_order_acquire) &
+           RIFT_FUTURE_STATE_MASK;
+}
+
+static bool future_is_final(uint32_t state) {
+    return state >= RIFT_FUTURE_DONE;
+}
+
+static rift_future_t* group_future_at(rift_task_group_t* group, uint32_t index) {
+    size_t header = (sizeof(rift_task_group_t) + GROUP_CACHE_LINE - 1) & ~(size_t)(GROUP_CACHE_LINE - 1);
+    return (rift_future_t*)((uint8_t*)group + header + (size_t)index * group->future_stride);
+}
+
+/**
+ * @brief Move a future from one non-final state to another, keeping WAITERS
+ */
+static bool future_transition(rift_future_t* future, uint32_t from, uint32_t to) {
+    uint32_t word = atomic_load_explicit(&future->state, memory_order_relaxed);
+    do {
+        if ((word & RIFT_FUTURE_STATE_MASK) != from) {
+            return false;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&future->state, &word,
+                                                    (word & ~RIFT_FUTURE_STATE_MASK) | to,
+                                                    memory_order_acq_rel, memory_order_relaxed));
+    return true;
+}
+
+/**
+ * @brief Make future final and wake everyone waiting on it
+ * @return false if the future was not in state from
+ */
+static bool future_complete(rift_future_t* future, uint32_t from, uint32_t final_state) {
+    uint32_t word = atomic_load_explicit(&future->state, memory_order_relaxed);
+    do {
+        if ((word & RIFT_FUTURE_STATE_MASK) != from) {
+            return false;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&future->state, &word, final_state,
+                                                    memory_order_acq_rel, memory_order_relaxed));
+
+    if (word & RIFT_FUTURE_WAITERS) {
+        syscall(SYS_futex, (uint32_t*)&future->state, FUTEX_WAKE_PRIVATE, INT_MAX,
+                NULL, NULL, 0);
+    }
+
+    // Closing the list is the completer's last access to the arena; task
+    // waiters it collects stay parked, and their records alive, until woken
+    rift_future_waiter_t* waiters = atomic_exchange_explicit(&future->waiters, &g_waiters_closed,
+                                                            memory_order_acq_rel);
+    while (waiters && waiters != &g_waiters_closed) {
+        rift_future_waiter_t* next = waiters->next;
+        rift_simulated_wake(waiters->task);
+        waiters = next;
+    }
+    return true;
+}
+
+// =============================================================================
+// TASK ENTRY
+// =============================================================================
+
+/**
+ * @brief Work function of every group task, whatever its mode
+ */
+static void group_task_entry(void* data) {
+    rift_future_t* future = data;
+    if (!future_transition(future, RIFT_FUTURE_PENDING, RIFT_FUTURE_RUNNING)) {
+        return; // Cancelled before it started
+    }
+
+    future->work_function(future->work_data, future->result);
+    future_complete(future, RIFT_FUTURE_RUNNING, RIFT_FUTURE_DONE);
+}
+
+// =============================================================================
+// WAITING
+// =============================================================================
+
+/**
+ * @brief Park the current simulated task until the future is final
+ */
+static void group_park_task(rift_future_t* future, rift_simulated_context_t* task) {
+    rift_future_waiter_t waiter = { .task = task };
+
+    // Prepare before publishing so the completer's wake cannot be lost
+    rift_simulated_park_prepare();
+    rift_future_waiter_t* head = atomic_load_explicit(&future->waiters, memory_order_acquire);
+    do {
+        if (head == &g_waiters_closed) {
+            rift_simulated_park_cancel(); // Closed only after the state is final
+            return;
+        }
+        waiter.next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&future->waiters, &head, &waiter,
+                                                    memory_order_acq_rel, memory_order_acquire));
+    rift_simulated_park();
+}
+
+/**
+ * @brief Park the calling thread on the future's state word, until it is
+ *        final or the calling task is cancelled
+ */
+static void group_park_thread(rift_future_t* future) {
+    uint32_t word = atomic_load_explicit(&future->state, memory_order_acquire);
+    while (!future_is_final(word & RIFT_FUTURE_STATE_MASK)) {
+        if (!(word & RIFT_FUTURE_WAITERS) &&
+            !atomic_compare_exchange_strong_explicit(&future->state, &word,
+                                                     word | RIFT_FUTURE_WAITERS,
+                                                     memory_order_acq_rel, memory_order_acquire)) {
+            continue; // Changed under us: look again
+        }
+        if (rift_cancel_futex_wait(&future->state, word | RIFT_FUTURE_WAITERS, NULL) > 0) {
+            return;
+        }
+        word = atomic_load_explicit(&future->state, memory_order_acquire);
+    }
+}
+
+static void group_wait_simulated(rift_task_group_t* group, rift_future_t* future) {
+    rift_simulated_context_t* task = rift_simulated_current();
+    if (task) {
+        // Priority inheritance: a deadline task lends its deadline to the one it waits for
+        uint64_t rift_id = atomic_load_explicit(&future->rift_id, memory_order_acquire);
+        if (group->policy.mode == CONCURRENCY_SIMULATED && rift_id != 0) {
+            rift_simulated_scheduler_boost(rift_id, task->base_context.telemetry.deadline_ns);
+        }
+        group_park_task(future, task);
+    } else if (group->policy.mode == CONCURRENCY_HYBRID) {
+        group_park_thread(future);
+    } else {
+        // Nobody else drives the single-thread scheduler: run it ourselves
+        while (!future_is_final(future_state(future)) && !rift_current_should_terminate()) {
+            if (rift_simulated_schedule_cycle() == 0) {
+                sched_yield();
+            }
+        }
+    }
+}
+
+static void group_wait_true(rift_task_group_t* group, rift_future_t* future) {
+    uint64_t rift_id;
+    while ((rift_id = atomic_load_explicit(&future->rift_id, memory_order_acquire)) == 0) {
+        if (future_is_final(future_state(future))) {
+            return;
+        }
+        sched_yield(); // Spawn still in flight on another thread
+    }
+
+    // Helps run pool work on a worker; unknown ID means already finished
+    if (rift_true_wait(rift_id, 0) != 0 && rift_current_should_terminate()) {
+        return; // The waiter was cancelled, not the task
+    }
+
+    // The task is gone; work that never completed will not complete now
+    uint32_t final_state = atomic_load_explicit(&group->cancelled, memory_order_acquire)
+                           ? RIFT_FUTURE_CANCELLED : RIFT_FUTURE_ABANDONED;
+    if (!future_complete(future, RIFT_FUTURE_RUNNING, final_state)) {
+        future_complete(future, RIFT_FUTURE_PENDING, final_state);
+    }
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+/**
+ * @brief Create task group with its arena
+ */
+rift_task_group_t* rift_group_create(uint64_t parent_id,
+                                     const rift_governance_policy_t* policy,
+                                     size_t result_size,
+                                     uint32_t capacity,
+                                     const char* spawn_location) {
+    if (!policy || capacity == 0) {
+        return NULL;
+    }
+    if (policy->mode == CONCURRENCY_AUTO) {
+        // Waiting and cancelling follow the group's one mode
+        fprintf(stderr, "[GROUP] CONCURRENCY_AUTO is not supported for task groups\n");
+        return NULL;
+    }
+
+    size_t header = (sizeof(rift_task_group_t) + GROUP_CACHE_LINE - 1) & ~(size_t)(GROUP_CACHE_LINE - 1);
+    size_t stride = (sizeof(rift_future_t) + result_size + GROUP_CACHE_LINE - 1) &
+                    ~(size_t)(GROUP_CACHE_LINE - 1);
+    size_t arena_size = header + (size_t)capacity * stride;
+
+    // Shared so that process children complete their futures in place
+    rift_task_group_t* group = mmap(NULL, arena_size, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (group == MAP_FAILED) {
+        fprintf(stderr, "[GROUP] Arena mapping failed: %s\n", strerror(errno));
+        return NULL;
+    }
+
+    group->policy = *policy;
+    // Zygote children were forked before this arena existed
+    group->policy.zygote_spawn = false;
+    group->parent_id = parent_id;
+    group->owner_process_id = getpid();
+    group->result_size = result_size;
+    group->future_stride = stride;
+    group->arena_size = arena_size;
+    group->capacity = capacity;
+    atomic_init(&group->reserved, 0);
+    atomic_init(&group->cancelled, false);
+    snprintf(group->spawn_location, sizeof(group->spawn_location), "%s",
+             spawn_location ? spawn_location : "rift_group");
+    return group;
+}
+
+/**
+ * @brief Spawn task into group; the future is PENDING before the task exists
+ */
+rift_future_t* rift_group_spawn(rift_task_group_t* group,
+                                void (*work_func)(void*, void*),
+                                void* work_data) {
+    if (!group || !work_func || atomic_load(&group->cancelled) ||
+        group->owner_process_id != getpid()) {
+        return NULL;
+    }
+
+    uint32_t index = atomic_fetch_add(&group->reserved, 1);
+    if (index >= group->capacity) {
+        atomic_fetch_sub(&group->reserved, 1);
+        return NULL;
+    }
+
+    rift_future_t* future = group_future_at(group, index);
+    future->group = group;
+    future->work_function = work_func;
+    future->work_data = work_data;
+    atomic_store_explicit(&future->state, RIFT_FUTURE_PENDING, memory_order_release);
+
+    uint64_t rift_id;
+    switch (group->policy.mode) {
+    case CONCURRENCY_TRUE_THREAD:
+        rift_id = rift_true_spawn_thread(group->parent_id, &group->policy, group_task_entry,
+                                         future, group->spawn_location);
+        break;
+    case CONCURRENCY_TRUE_PROCESS:
+        rift_id = rift_true_spawn_process(group->parent_id, &group->policy, group_task_entry,
+                                          future, group->spawn_location);
+        break;
+    default:
+        rift_id = rift_simulated_spawn(group->parent_id, &group->policy, group_task_entry,
+                                       future, group->spawn_location);
+        break;
+    }
+
+    if (rift_id == 0) {
+        // The slot stays reserved; joins see it as abandoned
+        future_complete(future, RIFT_FUTURE_PENDING, RIFT_FUTURE_ABANDONED);
+        return NULL;
+    }
+    atomic_store_explicit(&future->rift_id, rift_id, memory_order_release);
+    return future;
+}
+
+/**
+ * @brief Wait for future and copy out its result
+ */
+rift_future_state_t rift_future_get(rift_future_t* future, void* result) {
+    if (!future) {
+        return RIFT_FUTURE_ABANDONED;
+    }
+
+    rift_task_group_t* group = future->group;
+    if (!future_is_final(future_state(future))) {
+        if (group->policy.mode == CONCURRENCY_TRUE_THREAD ||
+            group->policy.mode == CONCURRENCY_TRUE_PROCESS) {
+            group_wait_true(group, future);
+        } else {
+            group_wait_simulated(group, future);
+        }
+    }
+
+    uint32_t state = future_state(future);
+    if (state == RIFT_FUTURE_DONE && result && group->result_size > 0) {
+        memcpy(result, future->result, group->result_size);
+    }
+    return (rift_future_state_t)state;
+}
+
+rift_future_state_t rift_future_state(const rift_future_t* future) {
+    return (rift_future_state_t)future_state(future);
+}
+
+/**
+ * @brief Wait for every reserved future, rereading the count for nested spawns
+ */
+int rift_group_join(rift_task_group_t* group) {
+    if (!group) {
+        return -1;
+    }
+
+    int result = 0;
+    for (uint32_t i = 0; i < atomic_load(&group->reserved); i++) {
+        rift_future_t* future = group_future_at(group, i);
+        while (future_state(future) == RIFT_FUTURE_EMPTY) {
+            sched_yield(); // Reserved by a spawn still in progress
+        }
+        if (rift_future_get(future, NULL) != RIFT_FUTURE_DONE) {
+            result = -1;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Cancel every task that has not started; signal running processes
+ */
+void rift_group_cancel(rift_task_group_t* group) {
+    if (!group) {
+        return;
+    }
+    atomic_store(&group->cancelled, true);
+
+    bool true_mode = group->policy.mode == CONCURRENCY_TRUE_THREAD ||
+                     group->policy.mode == CONCURRENCY_TRUE_PROCESS;
+    uint32_t cancelled = 0;
+    uint32_t reserved = atomic_load(&group->reserved);
+    for (uint32_t i = 0; i < reserved; i++) {
+        rift_future_t* future = group_future_at(group, i);
+        uint64_t rift_id = atomic_load_explicit(&future->rift_id, memory_order_acquire);
+
+        if (future_complete(future, RIFT_FUTURE_PENDING, RIFT_FUTURE_CANCELLED)) {
+            cancelled++;
+        } else if (future_state(future) != RIFT_FUTURE_RUNNING ||
+                   group->policy.mode != CONCURRENCY_TRUE_PROCESS) {
+            // Running threads and simulated tasks stop cooperatively; a
+            // terminated simulated task would never complete its future
+            continue;
+        }
+
+        // Keep the pool from running it / signal the child
+        if (true_mode && rift_id != 0) {
+            rift_true_terminate(rift_id);
+        }
+    }
+
+    printf("[GROUP] Cancelled %s - %u of %u tasks had not started\n",
+           group->spawn_location, cancelled, reserved);
+}
+
+bool rift_group_cancelled(const rift_task_group_t* group) {
+    return group && atomic_load(&((rift_task_group_t*)group)->cancelled);
+}
+
+/**
+ * @brief Join group, then unmap its arena once every completer is done with it
+ */
+void rift_group_destroy(rift_task_group_t* group) {
+    if (!group) {
+        return;
+    }
+    rift_group_join(group);
+
+    // A completer closes the waiter list just after publishing; a process
+    // child killed in between never does, but it completes in its own copy
+    if (group->policy.mode != CONCURRENCY_TRUE_PROCESS) {
+        uint32_t reserved = atomic_load(&group->reserved);
+        for (uint32_t i = 0; i < reserved; i++) {
+            rift_future_t* future = group_future_at(group, i);
+            while (atomic_load_explicit(&future->waiters, memory_order_acquire) != &g_waiters_closed) {
+                sched_yield();
+            }
+        }
+    }
+    munmap(group, group->arena_size);
+}
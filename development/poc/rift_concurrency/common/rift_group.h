@@ -0,0 +1,135 @@
+/**
+ * @file rift_group.h
+ * @brief Task Group and Future Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_GROUP_H
+#define RIFT_GROUP_H
+
+#include "rift_common.h"
+
+// Future lifecycle; DONE, CANCELLED and ABANDONED are final
+typedef enum {
+    RIFT_FUTURE_EMPTY,                    // Slot reserved, task not yet spawned
+    RIFT_FUTURE_PENDING,                  // Spawned, work not started
+    RIFT_FUTURE_RUNNING,                  // Work function executing
+    RIFT_FUTURE_DONE,                     // Result available
+    RIFT_FUTURE_CANCELLED,                // Cancelled by rift_group_cancel()
+    RIFT_FUTURE_ABANDONED                 // Task ended without producing a result
+} rift_future_state_t;
+
+#define RIFT_FUTURE_STATE_MASK 0x7u
+#define RIFT_FUTURE_WAITERS 0x8u          // A thread may be parked on the futex
+
+// Simulated task parked on a future; lives on the waiting task's coroutine stack
+typedef struct rift_future_waiter rift_future_waiter_t;
+
+struct rift_task_group;
+
+// Completion and result slot of one task, inside its group's arena
+typedef struct rift_future {
+    _Atomic uint32_t state;               // rift_future_state_t | RIFT_FUTURE_WAITERS (futex word)
+    _Atomic uint64_t rift_id;             // Task running the work, 0 until spawned
+    _Atomic(rift_future_waiter_t*) waiters; // Parked simulated tasks
+    struct rift_task_group* group;        // Owning group
+    void (*work_function)(void*, void*);  // Work function (data, result)
+    void* work_data;                      // Work function data
+    uint8_t result[];                     // group->result_size bytes
+} rift_future_t;
+
+// Fixed-capacity set of tasks with one future each. The group and its
+// futures share one MAP_SHARED arena, so process children publish their
+// results in place and no task needs a heap-allocated sync object.
+typedef struct rift_task_group {
+    rift_governance_policy_t policy;      // Policy of every task (mode selects the backend)
+    uint64_t parent_id;                   // Parent RIFT ID of every task
+    pid_t owner_process_id;               // Creator; only it can spawn and wait
+    size_t result_size;                   // Bytes per result
+    size_t future_stride;                 // Bytes per future, cache-line rounded
+    size_t arena_size;                    // Bytes mapped
+    uint32_t capacity;                    // Futures in the arena
+    _Atomic uint32_t reserved;            // Future slots handed out
+    _Atomic bool cancelled;               // rift_group_cancel() was called
+    char spawn_location[128];             // Spawn location of every task
+} rift_task_group_t;
+
+// Typed creation helper: RIFT_GROUP_CREATE(0, &policy, uint64_t, 64)
+#define RIFT_GROUP_CREATE(parent_id, policy, type, capacity) \
+    rift_group_create((parent_id), (policy), sizeof(type), (capacity), __func__)
+
+/**
+ * @brief Create task group
+ * @param parent_id Parent RIFT ID of every task (0 for root)
+ * @param policy Governance policy of every task; mode selects simulated,
+ *        hybrid, thread or process tasks (zygote_spawn is ignored,
+ *        CONCURRENCY_AUTO is refused)
+ * @param result_size Bytes per task result (may be 0)
+ * @param capacity Maximum number of tasks
+ * @param spawn_location Source location of spawns
+ * @return Group on success, NULL on failure
+ */
+rift_task_group_t* rift_group_create(uint64_t parent_id,
+                                     const rift_governance_policy_t* policy,
+                                     size_t result_size,
+                                     uint32_t capacity,
+                                     const char* spawn_location);
+
+/**
+ * @brief Spawn task into group
+ * @param group Task group (from any task in the creating process)
+ * @param work_func Work function; writes its result through the second argument
+ * @param work_data Data to pass to work function
+ * @return Future of the task, NULL if the group is full, cancelled or owned
+ *         by another process, or the spawn failed
+ */
+rift_future_t* rift_group_spawn(rift_task_group_t* group,
+                                void (*work_func)(void*, void*),
+                                void* work_data);
+
+/**
+ * @brief Wait for a future; simulated tasks park, pool workers and the
+ *        single-thread scheduler's driver run pending work meanwhile
+ * @param future Future from rift_group_spawn()
+ * @param result Receives the result when DONE (may be NULL)
+ * @return Final state: RIFT_FUTURE_DONE, _CANCELLED or _ABANDONED; the
+ *         current state if a waiting thread's task is cancelled first
+ */
+rift_future_state_t rift_future_get(rift_future_t* future, void* result);
+
+/**
+ * @brief Get future state without waiting
+ * @param future Future from rift_group_spawn()
+ * @return Current state
+ */
+rift_future_state_t rift_future_state(const rift_future_t* future);
+
+/**
+ * @brief Wait for every task in the group, including ones spawned meanwhile
+ * @param group Task group
+ * @return 0 if every future is DONE, -1 otherwise
+ */
+int rift_group_join(rift_task_group_t* group);
+
+/**
+ * @brief Cancel group: tasks not yet started never run, process tasks are
+ *        signalled, running tasks observe rift_group_cancelled()
+ * @param group Task group
+ */
+void rift_group_cancel(rift_task_group_t* group);
+
+/**
+ * @brief Check whether the group was cancelled (from any task, any mode)
+ * @param group Task group
+ * @return true once rift_group_cancel() was called
+ */
+bool rift_group_cancelled(const rift_task_group_t* group);
+
+/**
+ * @brief Join group and release its arena; no other caller may be waiting
+ * @param group Task group
+ */
+void rift_group_destroy(rift_task_group_t* group);
+
+#endif // RIFT_GROUP_H
@@ -0,0 +1,443 @@
+/**
+ * @file rift_quota.c
+ * @brief Hierarchical Subtree Quotas
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Spawn validation bounds the children of one parent and the global task
+ * count, which still lets a deep tree fan out far past what any one subtree
+ * should hold. A task whose policy sets max_subtree_tasks, max_subtree_memory
+ * or max_subtree_cpu opens a quota group; every task spawned below it, at
+ * any depth, is charged one task plus its memory_claim and cpu_share until
+ * it finishes, and a spawn that would exceed a limit is refused. Tasks
+ * without limits of their own charge the nearest enclosing group directly,
+ * so levels without quotas cost nothing and the chain of groups is only as
+ * long as the number of quota-bearing ancestors.
+ *
+ * A group nested in another must also count against the outer one. Rather
+ * than walking the chain on every spawn, a nested group reserves room in its
+ * parent for RIFT_QUOTA_BATCH charges at a time and charges against that
+ * reservation until it runs out, so a spawn normally updates one cache line
+ * however deep it is. Reservations shrink as an ancestor nears its limit
+ * (at most 1/RIFT_QUOTA_HEADROOM_SHARE of its headroom), so close to a limit
+ * charges are exact; surplus reservation flows back as tasks finish. Groups
+ * are reference counted by their owner, their charged tasks and nested
+ * groups, since children may outlive the task that opened the quota.
+ *
+ * Memory and CPU share are admission accounting of what tasks declare, like
+ * EDF's expected runtime; nothing measures them at run time. Groups live in
+ * one address space: a forked child starts a fresh quota of its own.
+ */
+
+#include "rift_quota.h"
+#include "rift_telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define QUOTA_CACHE_LINE 64
+
+struct rift_quota_group {
+    // A charge that stays within the group touches this line only
+    _Alignas(QUOTA_CACHE_LINE) _Atomic uint64_t used[RIFT_QUOTA_RESOURCES];
+    _Atomic uint32_t refs;                // Owner, charged tasks and nested groups
+    uint64_t limit[RIFT_QUOTA_RESOURCES]; // 0 for unlimited
+    rift_quota_group_t* parent;           // Enclosing group, NULL at a root
+
+    // Changed under reserve_mutex only; charges read it to check coverage
+    _Alignas(QUOTA_CACHE_LINE) _Atomic uint64_t reserved[RIFT_QUOTA_RESOURCES];
+    _Atomic uint64_t grain[RIFT_QUOTA_RESOURCES]; // Last reservation size, kept on trim
+    pthread_mutex_t reserve_mutex;
+};
+
+// Counted on slow paths only; charges within a group stay off shared lines
+static struct {
+    _Atomic uint64_t groups;
+    _Atomic uint64_t refused;
+    _Atomic uint64_t refills;
+    _Atomic uint64_t returns;
+} g_quota_counters;
+
+static const char* const g_quota_resource_names[RIFT_QUOTA_RESOURCES] = {
+    "task", "memory", "CPU share"
+};
+
+// Limit that refused a charge, for the rejection message
+typedef struct {
+    rift_quota_resource_t resource;
+    uint64_t used;
+    uint64_t limit;
+} quota_refusal_t;
+
+static bool quota_limited(const rift_governance_policy_t* policy) {
+    return policy->max_subtree_tasks != 0 || policy->max_subtree_memory != 0 ||
+           policy->max_subtree_cpu != 0;
+}
+
+static void quota_amounts(const rift_governance_policy_t* policy, uint32_t count,
+                          uint64_t amount[RIFT_QUOTA_RESOURCES]) {
+    amount[RIFT_QUOTA_TASKS] = count;
+    amount[RIFT_QUOTA_MEMORY] = policy->memory_claim * count;
+    amount[RIFT_QUOTA_CPU] = (uint64_t)policy->cpu_share * count;
+}
+
+// =============================================================================
+// GROUP LIFETIME
+// =============================================================================
+
+static void quota_uncharge(rift_quota_group_t* group, const uint64_t amount[RIFT_QUOTA_RESOURCES]);
+
+static rift_quota_group_t* quota_group_create(const rift_governance_policy_t* policy,
+                                              rift_quota_group_t* parent) {
+    rift_quota_group_t* group = aligned_alloc(QUOTA_CACHE_LINE, sizeof(rift_quota_group_t));
+    if (!group) {
+        return NULL;
+    }
+    memset(group, 0, sizeof(*group));
+
+    for (int r = 0; r < RIFT_QUOTA_RESOURCES; r++) {
+        atomic_init(&group->used[r], 0);
+        atomic_init(&group->reserved[r], 0);
+        atomic_init(&group->grain[r], 0);
+    }
+    group->limit[RIFT_QUOTA_TASKS] = policy->max_subtree_tasks;
+    group->limit[RIFT_QUOTA_MEMORY] = policy->max_subtree_memory;
+    group->limit[RIFT_QUOTA_CPU] = policy->max_subtree_cpu;
+    atomic_init(&group->refs, 1);
+    group->parent = parent;
+    if (parent) {
+        rift_quota_group_get(parent);
+    }
+    pthread_mutex_init(&group->reserve_mutex, NULL);
+    atomic_fetch_add(&g_quota_counters.groups, 1);
+    return group;
+}
+
+void rift_quota_group_get(rift_quota_group_t* group) {
+    atomic_fetch_add(&group->refs, 1);
+}
+
+/**
+ * @brief Drop a reference; the last one hands the group's reservation back
+ *        and drops the reference it held on its parent
+ */
+static void quota_group_put(rift_quota_group_t* group) {
+    while (group && atomic_fetch_sub(&group->refs, 1) == 1) {
+        rift_quota_group_t* parent = group->parent;
+        if (parent) {
+            uint64_t reserved[RIFT_QUOTA_RESOURCES];
+            for (int r = 0; r < RIFT_QUOTA_RESOURCES; r++) {
+                reserved[r] = atomic_load(&group->reserved[r]);
+            }
+            quota_uncharge(parent, reserved);
+        }
+        pthread_mutex_destroy(&group->reserve_mutex);
+        free(group);
+        atomic_fetch_sub(&g_quota_counters.groups, 1);
+        group = parent;
+    }
+}
+
+/**
+ * @brief Group the descendants of parent_id are charged to; the calling
+ *        task's own is read from its context without a registry scan
+ * @return Group with a reference taken, NULL for none
+ */
+static rift_quota_group_t* quota_enclosing(uint64_t parent_id) {
+    if (parent_id == 0) {
+        return NULL;
+    }
+
+    rift_thread_context_t* current = rift_current();
+    if (current && current->telemetry.rift_thread_id == parent_id) {
+        rift_quota_group_t* group = current->telemetry.subtree_quota;
+        if (group) {
+            rift_quota_group_get(group);
+        }
+        return group;
+    }
+    return rift_telemetry_get_subtree_quota(parent_id);
+}
+
+// =============================================================================
+// CHARGING
+// =============================================================================
+
+static int quota_charge(rift_quota_group_t* group, const uint64_t amount[RIFT_QUOTA_RESOURCES],
+                        quota_refusal_t* refusal);
+
+/**
+ * @brief Room to reserve beyond what a charge needs: RIFT_QUOTA_BATCH
+ *        charges of its size, capped by the parent's remaining headroom
+ */
+static uint64_t quota_extra(const rift_quota_group_t* parent, int resource, uint64_t amount) {
+    uint64_t extra = amount * (RIFT_QUOTA_BATCH - 1);
+    uint64_t limit = parent->limit[resource];
+    if (limit != 0) {
+        uint64_t used = atomic_load(&parent->used[resource]);
+        uint64_t headroom = used < limit ? limit - used : 0;
+        if (extra > headroom / RIFT_QUOTA_HEADROOM_SHARE) {
+            extra = headroom / RIFT_QUOTA_HEADROOM_SHARE;
+        }
+    }
+    return extra;
+}
+
+/**
+ * @brief Extend a nested group's reservation in its parent to cover its use,
+ *        batched while the parent has headroom, exact once it is short
+ * @return 0 on success, -1 if the enclosing groups refuse
+ */
+static int quota_refill(rift_quota_group_t* group, const uint64_t amount[RIFT_QUOTA_RESOURCES],
+                        quota_refusal_t* refusal) {
+    uint64_t need[RIFT_QUOTA_RESOURCES] = {0};
+    uint64_t request[RIFT_QUOTA_RESOURCES] = {0};
+    bool short_of_room = false;
+    bool batched = false;
+
+    pthread_mutex_lock(&group->reserve_mutex);
+    for (int r = 0; r < RIFT_QUOTA_RESOURCES; r++) {
+        uint64_t used = atomic_load(&group->used[r]);
+        uint64_t reserved = atomic_load(&group->reserved[r]);
+        if (used <= reserved || amount[r] == 0) {
+            continue;
+        }
+        // Concurrent chargers cover their own share of the shortfall
+        need[r] = used - reserved < amount[r] ? used - reserved : amount[r];
+        request[r] = need[r] + quota_extra(group->parent, r, amount[r]);
+        batched |= request[r] > need[r];
+        short_of_room = true;
+    }
+
+    int result = 0;
+    if (short_of_room) {
+        const uint64_t* taken = request;
+        if (quota_charge(group->parent, request, refusal) != 0) {
+            taken = need;
+            if (!batched || quota_charge(group->parent, need, refusal) != 0) {
+                result = -1;
+            }
+        }
+        if (result == 0) {
+            for (int r = 0; r < RIFT_QUOTA_RESOURCES; r++) {
+                if (taken[r] != 0) {
+                    atomic_store(&group->reserved[r], atomic_load(&group->reserved[r]) + taken[r]);
+                    atomic_store_explicit(&group->grain[r], taken[r], memory_order_relaxed);
+                }
+            }
+            atomic_fetch_add(&g_quota_counters.refills, 1);
+        }
+    }
+    pthread_mutex_unlock(&group->reserve_mutex);
+    return result;
+}
+
+/**
+ * @brief Hand reservation beyond one grain of slack back to the parent.
+ *        A charger that read the old reservation has raised used before the
+ *        recheck below sees it (all sequentially consistent), so shrinking
+ *        is undone rather than leave a charge uncovered.
+ */
+static void quota_trim(rift_quota_group_t* group) {
+    uint64_t give[RIFT_QUOTA_RESOURCES] = {0};
+    bool giving = false;
+
+    pthread_mutex_lock(&group->reserve_mutex);
+    for (int r = 0; r < RIFT_QUOTA_RESOURCES; r++) {
+        uint64_t reserved = atomic_load(&group->reserved[r]);
+        uint64_t used = atomic_load(&group->used[r]);
+        uint64_t grain = atomic_load_explicit(&group->grain[r], memory_order_relaxed);
+        if (reserved > used && reserved - used > 2 * grain) {
+            give[r] = reserved - used - grain;
+            atomic_store(&group->reserved[r], reserved - give[r]);
+            giving = true;
+        }
+    }
+    if (giving) {
+        for (int r = 0; r < RIFT_QUOTA_RESOURCES; r++) {
+            uint64_t reserved = atomic_load(&group->reserved[r]);
+            if (give[r] != 0 && atomic_load(&group->used[r]) > reserved) {
+                atomic_store(&group->reserved[r], reserved + give[r]);
+                give[r] = 0;
+            }
+        }
+        quota_uncharge(group->parent, give);
+        atomic_fetch_add(&g_quota_counters.returns, 1);
+    }
+    pthread_mutex_unlock(&group->reserve_mutex);
+}
+
+static void quota_uncharge(rift_quota_group_t* group, const uint64_t amount[RIFT_QUOTA_RESOURCES]) {
+    bool surplus = false;
+    for (int r = 0; r < RIFT_QUOTA_RESOURCES; r++) {
+        if (amount[r] == 0) {
+            continue;
+        }
+        uint64_t used = atomic_fetch_sub(&group->used[r], amount[r]) - amount[r];
+        if (group->parent) {
+            uint64_t reserved = atomic_load(&group->reserved[r]);
+            uint64_t grain = atomic_load_explicit(&group->grain[r], memory_order_relaxed);
+            surplus |= reserved > used && reserved - used > 2 * grain;
+        }
+    }
+    if (surplus) {
+        quota_trim(group);
+    }
+}
+
+/**
+ * @brief Charge amount to group, and through its reservation to the groups
+ *        enclosing it
+ * @return 0 on success, -1 (nothing charged) if a limit would be exceeded
+ */
+static int quota_charge(rift_quota_group_t* group, const uint64_t amount[RIFT_QUOTA_RESOURCES],
+                        quota_refusal_t* refusal) {
+    bool covered = true;
+    int over = -1;
+    for (int r = 0; r < RIFT_QUOTA_RESOURCES; r++) {
+        if (amount[r] == 0) {
+            continue;
+        }
+        uint64_t used = atomic_fetch_add(&group->used[r], amount[r]) + amount[r];
+        if (over < 0 && group->limit[r] != 0 && used > group->limit[r]) {
+            over = r;
+            refusal->resource = (rift_quota_resource_t)r;
+            refusal->used = used - amount[r];
+            refusal->limit = group->limit[r];
+        }
+        if (group->parent && used > atomic_load(&group->reserved[r])) {
+            covered = false;
+        }
+    }
+
+    if (over >= 0 || (!covered && quota_refill(group, amount, refusal) != 0)) {
+        quota_uncharge(group, amount);
+        return -1;
+    }
+    return 0;
+}
+
+// =============================================================================
+// TASK ACCOUNTING
+// =============================================================================
+
+/**
+ * @brief Charge a spawned task and open its own quota if it sets limits
+ */
+int rift_quota_charge(rift_thread_context_t* context) {
+    return rift_quota_charge_batch(&context, 1);
+}
+
+/**
+ * @brief Charge a batch sharing parent and policy with one update
+ */
+int rift_quota_charge_batch(rift_thread_context_t** contexts, uint32_t count) {
+    if (!contexts || count == 0) {
+        return -1;
+    }
+
+    const rift_governance_policy_t* policy = &contexts[0]->policy;
+    uint64_t parent_id = contexts[0]->telemetry.parent_rift_id;
+
+    rift_quota_group_t* group = quota_enclosing(parent_id);
+    if (group) {
+        uint64_t amount[RIFT_QUOTA_RESOURCES];
+        quota_amounts(policy, count, amount);
+        quota_refusal_t refusal;
+        if (quota_charge(group, amount, &refusal) != 0) {
+            quota_group_put(group);
+            atomic_fetch_add(&g_quota_counters.refused, 1);
+            printf("[QUOTA] Spawn rejected: %u tasks under parent %lu exceed a subtree %s "
+                   "quota (%lu/%lu)\n", count, parent_id,
+                   g_quota_resource_names[refusal.resource], refusal.used, refusal.limit);
+            return -1;
+        }
+        // One reference per charged task
+        if (count > 1) {
+            atomic_fetch_add(&group->refs, count - 1);
+        }
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        contexts[i]->quota = group;
+        contexts[i]->telemetry.subtree_quota = group;
+    }
+    if (!quota_limited(policy)) {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        rift_quota_group_t* own = quota_group_create(policy, group);
+        if (!own) {
+            for (uint32_t j = 0; j < count; j++) {
+                rift_quota_release(contexts[j]);
+            }
+            return -1;
+        }
+        contexts[i]->telemetry.subtree_quota = own;
+    }
+    return 0;
+}
+
+/**
+ * @brief Return a finished task's charge and drop its references
+ */
+void rift_quota_release(rift_thread_context_t* context) {
+    rift_quota_group_t* group = context->quota;
+    rift_quota_group_t* own = context->telemetry.subtree_quota;
+    context->quota = NULL;
+    context->telemetry.subtree_quota = NULL;
+
+    if (own && own != group) {
+        quota_group_put(own);
+    }
+    if (group) {
+        uint64_t amount[RIFT_QUOTA_RESOURCES];
+        quota_amounts(&context->policy, 1, amount);
+        quota_uncharge(group, amount);
+        quota_group_put(group);
+    }
+}
+
+/**
+ * @brief Start over in a forked child; the inherited groups are copies whose
+ *        locks another thread may have held across fork()
+ */
+void rift_quota_rebase(rift_thread_context_t* context) {
+    context->quota = NULL;
+    context->telemetry.subtree_quota = NULL;
+    if (quota_limited(&context->policy)) {
+        context->telemetry.subtree_quota = quota_group_create(&context->policy, NULL);
+    }
+}
+
+// =============================================================================
+// REPORTING
+// =============================================================================
+
+int rift_quota_get_usage(uint64_t rift_id, rift_quota_usage_t* usage) {
+    if (!usage) {
+        return -1;
+    }
+
+    rift_quota_group_t* group = quota_enclosing(rift_id);
+    if (!group) {
+        return -1;
+    }
+    for (int r = 0; r < RIFT_QUOTA_RESOURCES; r++) {
+        usage->used[r] = atomic_load(&group->used[r]);
+        usage->limit[r] = group->limit[r];
+    }
+    quota_group_put(group);
+    return 0;
+}
+
+void rift_quota_get_stats(rift_quota_stats_t* stats) {
+    if (!stats) {
+        return;
+    }
+    stats->groups = atomic_load(&g_quota_counters.groups);
+    stats->refused = atomic_load(&g_quota_counters.refused);
+    stats->refills = atomic_load(&g_quota_counters.refills);
+    stats->returns = atomic_load(&g_quota_counters.returns);
+}
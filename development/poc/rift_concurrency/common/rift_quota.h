@@ -0,0 +1,89 @@
+/**
+ * @file rift_quota.h
+ * @brief Hierarchical Subtree Quota Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_QUOTA_H
+#define RIFT_QUOTA_H
+
+#include "rift_common.h"
+
+#define RIFT_QUOTA_BATCH 8                // Charges a nested quota reserves ahead
+#define RIFT_QUOTA_HEADROOM_SHARE 4       // Reserve at most 1/N of an ancestor's headroom
+
+typedef enum {
+    RIFT_QUOTA_TASKS,                     // Live descendants
+    RIFT_QUOTA_MEMORY,                    // Bytes of memory_claim
+    RIFT_QUOTA_CPU,                       // Per mille of cpu_share
+    RIFT_QUOTA_RESOURCES
+} rift_quota_resource_t;
+
+// Usage of the quota governing a task's descendants
+typedef struct {
+    uint64_t used[RIFT_QUOTA_RESOURCES];  // Charged, reservations of nested quotas included
+    uint64_t limit[RIFT_QUOTA_RESOURCES]; // 0 for unlimited
+} rift_quota_usage_t;
+
+// Subtree quota counters; charges that stay within a group are not counted
+typedef struct {
+    uint64_t groups;                      // Quota groups alive
+    uint64_t refused;                     // Spawns refused by a subtree quota
+    uint64_t refills;                     // Reservations taken from an enclosing group
+    uint64_t returns;                     // Reservations handed back to one
+} rift_quota_stats_t;
+
+/**
+ * @brief Charge a spawned task to the quota enclosing its parent and, if its
+ *        policy sets limits, open its own quota for its descendants. Call
+ *        before the task is registered, after its policy and parent are set.
+ * @param context Context of the new task
+ * @return 0 on success, -1 if a subtree quota refuses the task
+ */
+int rift_quota_charge(rift_thread_context_t* context);
+
+/**
+ * @brief Charge count tasks sharing a parent and policy with one update of
+ *        the enclosing quota; all of them are charged or none
+ * @param contexts Contexts of the new tasks
+ * @param count Number of contexts
+ * @return 0 on success, -1 if a subtree quota refuses the batch
+ */
+int rift_quota_charge_batch(rift_thread_context_t** contexts, uint32_t count);
+
+/**
+ * @brief Return a finished task's charge and drop its quota references;
+ *        call after the task is unregistered. Uncharged contexts are ignored.
+ * @param context Context about to be freed
+ */
+void rift_quota_release(rift_thread_context_t* context);
+
+/**
+ * @brief Replace quotas inherited across fork() with a fresh quota of the
+ *        task's own, as the parent's groups are copies in this process
+ * @param context Context of the forked child's task
+ */
+void rift_quota_rebase(rift_thread_context_t* context);
+
+/**
+ * @brief Take a reference on a quota group for a holder outside this module
+ * @param group Group to keep alive
+ */
+void rift_quota_group_get(rift_quota_group_t* group);
+
+/**
+ * @brief Get the usage of the quota governing a task's descendants
+ * @param rift_id RIFT ID of a registered task
+ * @param usage Output usage
+ * @return 0 on success, -1 if no quota encloses the task's descendants
+ */
+int rift_quota_get_usage(uint64_t rift_id, rift_quota_usage_t* usage);
+
+/**
+ * @brief Get subtree quota counters
+ * @param stats Output statistics
+ */
+void rift_quota_get_stats(rift_quota_stats_t* stats);
+
+#endif // RIFT_QUOTA_H
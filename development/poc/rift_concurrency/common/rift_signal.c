@@ -0,0 +1,254 @@
+/**
+ * @file rift_signal.c
+ * @brief Signal Routing Through signalfd
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * The runtime's signals - SIGCHLD, SIGTERM for destroy policies and SIGUSR1
+ * for report dumps - are never delivered asynchronously once routing is on.
+ * rift_signal_init() blocks them and opens a signalfd for them; every
+ * runtime thread started afterwards inherits the mask, and workers block
+ * them again on entry in case they were started first. No thread is then
+ * interrupted at an arbitrary point, so no handler code has to be
+ * async-signal-safe and no hot-path syscall fails with EINTR on their
+ * account.
+ *
+ * The signalfd is watched by the loops that already sleep in the kernel:
+ * the child reaper's epoll set and the simulated I/O reactor. Whichever
+ * wakes drains every pending record with a few reads and runs each
+ * signal's handler once per batch with the number of records, so a burst
+ * of child exits costs one handler call. Applications without either loop
+ * call rift_signal_dispatch() from their own. Unclaimed SIGUSR1 prints the
+ * telemetry report, unclaimed SIGTERM terminates the process as an
+ * unrouted one would, and unclaimed SIGCHLD is only counted: the reaper
+ * learns of exits through pidfds.
+ *
+ * A forked task child drops the routing and gets the mask it had before
+ * rift_signal_init() back, so a SIGTERM sent by a destroy policy still
+ * terminates it.
+ */
+
+#include "rift_signal.h"
+#include "rift_telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/signalfd.h>
+
+typedef struct {
+    rift_signal_handler_t handler;
+    void* data;
+} rift_signal_route_t;
+
+typedef struct {
+    pthread_mutex_t drain_mutex;          // Guards fd, routes and stats
+    int fd;
+    sigset_t routed;                      // Signals read from the signalfd
+    sigset_t unblock_in_child;            // Routed signals not blocked before init
+    rift_signal_route_t routes[RIFT_SIGNAL_ROUTED];
+    rift_signal_stats_t stats;
+} rift_signal_hub_t;
+
+static rift_signal_hub_t g_signal = {
+    .drain_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .fd = -1
+};
+
+static _Atomic bool g_signal_active = false;
+
+static const int g_signal_numbers[RIFT_SIGNAL_ROUTED] = { SIGCHLD, SIGTERM, SIGUSR1 };
+
+static int signal_index(int signal_number) {
+    for (int i = 0; i < RIFT_SIGNAL_ROUTED; i++) {
+        if (g_signal_numbers[i] == signal_number) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Nobody claimed SIGTERM: terminate the way an unrouted one would
+ */
+static void signal_terminate_default(void) {
+    sigset_t term, old_mask;
+    sigemptyset(&term);
+    sigaddset(&term, SIGTERM);
+    pthread_sigmask(SIG_UNBLOCK, &term, &old_mask);
+    raise(SIGTERM);
+    pthread_sigmask(SIG_SETMASK, &old_mask, NULL); // Only reached if SIGTERM is handled
+}
+
+/**
+ * @brief Block the routed signals and open the signalfd; call from main()
+ *        before any runtime thread exists
+ */
+int rift_signal_init(void) {
+    pthread_mutex_lock(&g_signal.drain_mutex);
+    if (atomic_load(&g_signal_active)) {
+        pthread_mutex_unlock(&g_signal.drain_mutex);
+        return 0;
+    }
+
+    sigemptyset(&g_signal.routed);
+    for (int i = 0; i < RIFT_SIGNAL_ROUTED; i++) {
+        sigaddset(&g_signal.routed, g_signal_numbers[i]);
+    }
+    sigset_t old_mask;
+    pthread_sigmask(SIG_BLOCK, &g_signal.routed, &old_mask);
+
+    g_signal.fd = signalfd(-1, &g_signal.routed, SFD_CLOEXEC | SFD_NONBLOCK);
+    if (g_signal.fd < 0) {
+        fprintf(stderr, "[SIGNAL] signalfd failed: %s\n", strerror(errno));
+        pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+        pthread_mutex_unlock(&g_signal.drain_mutex);
+        return -1;
+    }
+
+    sigemptyset(&g_signal.unblock_in_child);
+    for (int i = 0; i < RIFT_SIGNAL_ROUTED; i++) {
+        if (!sigismember(&old_mask, g_signal_numbers[i])) {
+            sigaddset(&g_signal.unblock_in_child, g_signal_numbers[i]);
+        }
+    }
+    memset(&g_signal.stats, 0, sizeof(g_signal.stats));
+    atomic_store(&g_signal_active, true);
+    pthread_mutex_unlock(&g_signal.drain_mutex);
+    printf("[SIGNAL] Routing SIGCHLD, SIGTERM and SIGUSR1 through signalfd %d\n", g_signal.fd);
+    return 0;
+}
+
+bool rift_signal_active(void) {
+    return atomic_load_explicit(&g_signal_active, memory_order_acquire);
+}
+
+int rift_signal_fd(void) {
+    return rift_signal_active() ? g_signal.fd : -1;
+}
+
+/**
+ * @brief Block the routed signals in the calling thread; no-op while
+ *        routing is off
+ */
+void rift_signal_block_thread(void) {
+    if (rift_signal_active()) {
+        pthread_sigmask(SIG_BLOCK, &g_signal.routed, NULL);
+    }
+}
+
+int rift_signal_set_handler(int signal_number, rift_signal_handler_t handler, void* data) {
+    int index = signal_index(signal_number);
+    if (index < 0) {
+        return -1;
+    }
+    pthread_mutex_lock(&g_signal.drain_mutex);
+    g_signal.routes[index] = (rift_signal_route_t){ handler, data };
+    pthread_mutex_unlock(&g_signal.drain_mutex);
+    return 0;
+}
+
+/**
+ * @brief Drain every pending record, then run each signal's handler once
+ *        with its count; handlers run outside the lock
+ */
+int rift_signal_dispatch(void) {
+    if (!rift_signal_active()) {
+        return 0;
+    }
+
+    uint32_t counts[RIFT_SIGNAL_ROUTED] = {0};
+    rift_signal_route_t routes[RIFT_SIGNAL_ROUTED];
+    struct signalfd_siginfo batch[RIFT_SIGNAL_BATCH];
+    uint32_t drained = 0;
+
+    pthread_mutex_lock(&g_signal.drain_mutex);
+    for (;;) {
+        ssize_t bytes = g_signal.fd >= 0 ? read(g_signal.fd, batch, sizeof(batch)) : -1;
+        if (bytes < (ssize_t)sizeof(batch[0])) {
+            break; // EAGAIN: drained (EINTR cannot happen, nothing is delivered)
+        }
+        uint32_t records = (uint32_t)(bytes / (ssize_t)sizeof(batch[0]));
+        for (uint32_t i = 0; i < records; i++) {
+            int index = signal_index((int)batch[i].ssi_signo);
+            if (index >= 0) {
+                counts[index]++;
+            }
+        }
+        drained += records;
+        g_signal.stats.reads++;
+    }
+    for (int i = 0; i < RIFT_SIGNAL_ROUTED; i++) {
+        g_signal.stats.received[i] += counts[i];
+        g_signal.stats.handled += counts[i] > 0;
+    }
+    if (drained > g_signal.stats.max_batch) {
+        g_signal.stats.max_batch = drained;
+    }
+    memcpy(routes, g_signal.routes, sizeof(routes));
+    pthread_mutex_unlock(&g_signal.drain_mutex);
+
+    for (int i = 0; i < RIFT_SIGNAL_ROUTED; i++) {
+        if (counts[i] == 0) {
+            continue;
+        }
+        if (routes[i].handler) {
+            routes[i].handler(g_signal_numbers[i], counts[i], routes[i].data);
+        } else if (g_signal_numbers[i] == SIGUSR1) {
+            rift_telemetry_print_report();
+        } else if (g_signal_numbers[i] == SIGTERM) {
+            signal_terminate_default();
+        }
+    }
+    return (int)drained;
+}
+
+void rift_signal_get_stats(rift_signal_stats_t* stats) {
+    pthread_mutex_lock(&g_signal.drain_mutex);
+    *stats = g_signal.stats;
+    pthread_mutex_unlock(&g_signal.drain_mutex);
+}
+
+/**
+ * @brief Drop routing inherited across fork() and restore the mask from
+ *        before rift_signal_init(); async-signal-safe
+ */
+void rift_signal_forget_parent(void) {
+    if (!atomic_load(&g_signal_active)) {
+        return;
+    }
+    // Another thread may have held the lock across fork()
+    pthread_mutex_init(&g_signal.drain_mutex, NULL);
+    close(g_signal.fd);
+    g_signal.fd = -1;
+    memset(g_signal.routes, 0, sizeof(g_signal.routes));
+    atomic_store(&g_signal_active, false);
+    sigprocmask(SIG_UNBLOCK, &g_signal.unblock_in_child, NULL);
+}
+
+/**
+ * @brief Handle what is still pending, close the signalfd and unblock the
+ *        routed signals in the calling thread; consumers must be stopped
+ */
+void rift_signal_cleanup(void) {
+    if (!rift_signal_active()) {
+        return;
+    }
+    rift_signal_dispatch();
+
+    pthread_mutex_lock(&g_signal.drain_mutex);
+    atomic_store(&g_signal_active, false);
+    close(g_signal.fd);
+    g_signal.fd = -1;
+    rift_signal_stats_t stats = g_signal.stats;
+    pthread_mutex_unlock(&g_signal.drain_mutex);
+    pthread_sigmask(SIG_UNBLOCK, &g_signal.unblock_in_child, NULL);
+
+    printf("[SIGNAL] Routing stopped - %lu SIGCHLD, %lu SIGTERM, %lu SIGUSR1 "
+           "in %lu reads, largest batch %u\n",
+           (unsigned long)stats.received[RIFT_SIGNAL_CHILD],
+           (unsigned long)stats.received[RIFT_SIGNAL_TERMINATE],
+           (unsigned long)stats.received[RIFT_SIGNAL_REPORT],
+           (unsigned long)stats.reads, stats.max_batch);
+}
@@ -0,0 +1,100 @@
+/**
+ * @file rift_signal.h
+ * @brief signalfd Signal Routing Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_SIGNAL_H
+#define RIFT_SIGNAL_H
+
+#include "rift_common.h"
+#include <signal.h>
+
+#define RIFT_SIGNAL_BATCH 16              // siginfo records drained per read()
+
+// Signals routed through the signalfd
+typedef enum {
+    RIFT_SIGNAL_CHILD,                    // SIGCHLD
+    RIFT_SIGNAL_TERMINATE,                // SIGTERM
+    RIFT_SIGNAL_REPORT,                   // SIGUSR1: dump reports
+    RIFT_SIGNAL_ROUTED
+} rift_signal_kind_t;
+
+/**
+ * @brief Handler run by a consumer thread, once per drained batch
+ * @param signal_number Signal received
+ * @param count Records of it in the batch
+ * @param data Pointer given at registration
+ */
+typedef void (*rift_signal_handler_t)(int signal_number, uint32_t count, void* data);
+
+typedef struct {
+    uint64_t received[RIFT_SIGNAL_ROUTED]; // Records read, by rift_signal_kind_t
+    uint64_t reads;                       // read() calls that returned records
+    uint64_t handled;                     // Handler runs, one per signal per batch
+    uint32_t max_batch;                   // Most records drained by one dispatch
+} rift_signal_stats_t;
+
+/**
+ * @brief Block SIGCHLD, SIGTERM and SIGUSR1 and route them through a
+ *        signalfd. Call from main() before the runtime starts any thread;
+ *        threads started earlier keep receiving them asynchronously.
+ * @return 0 on success, -1 if the signalfd could not be opened
+ */
+int rift_signal_init(void);
+
+/**
+ * @brief Check whether routing is on in this process
+ * @return true between rift_signal_init() and rift_signal_cleanup()
+ */
+bool rift_signal_active(void);
+
+/**
+ * @brief Get the signalfd for a consumer's poll or epoll set
+ * @return Descriptor, or -1 while routing is off
+ */
+int rift_signal_fd(void);
+
+/**
+ * @brief Block the routed signals in the calling thread; workers call this
+ *        on entry. No-op while routing is off.
+ */
+void rift_signal_block_thread(void);
+
+/**
+ * @brief Claim a routed signal, replacing its default action (report dump
+ *        for SIGUSR1, process termination for SIGTERM, none for SIGCHLD)
+ * @param signal_number SIGCHLD, SIGTERM or SIGUSR1
+ * @param handler Handler, or NULL to restore the default
+ * @param data Passed to the handler
+ * @return 0 on success, -1 if the signal is not routed
+ */
+int rift_signal_set_handler(int signal_number, rift_signal_handler_t handler, void* data);
+
+/**
+ * @brief Drain the signalfd and run handlers for what was pending; called
+ *        by consumers when the signalfd turns readable
+ * @return Records drained
+ */
+int rift_signal_dispatch(void);
+
+/**
+ * @brief Drop routing inherited across fork() and restore the signal mask
+ *        from before rift_signal_init(); async-signal-safe
+ */
+void rift_signal_forget_parent(void);
+
+/**
+ * @brief Get signal routing counters
+ * @param stats Output statistics
+ */
+void rift_signal_get_stats(rift_signal_stats_t* stats);
+
+/**
+ * @brief Dispatch what is pending, close the signalfd and unblock the routed
+ *        signals in the calling thread; stop the consumers first
+ */
+void rift_signal_cleanup(void);
+
+#endif // RIFT_SIGNAL_H
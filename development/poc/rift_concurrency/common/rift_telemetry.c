@@ -9,12 +9,12 @@
  */
 
 #include "rift_telemetry.h"
+#include "rift_quota.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/wait.h>
-#include <sys/syscall.h>
 #include <pthread.h>
 #include <errno.h>
 
@@ -28,6 +28,15 @@ typedef struct {
     bool registry_active[RIFT_MAX_THREAD_COUNT];
     uint32_t active_count;
     uint64_t next_rift_id;
+    uint64_t placements_local;      // Placed tasks on the spawner's NUMA node
+    uint64_t placements_remote;     // Placed tasks on another NUMA node
+    uint64_t parallel_loops;        // Parallel loops finished
+    uint64_t parallel_iterations;   // Their iterations
+    uint64_t parallel_chunks;       // Their body invocations
+    uint64_t parallel_steals;       // Their ranges run by another participant
+    rift_deadline_stats_t deadlines; // EDF deadline outcomes
+    rift_backpressure_stats_t backpressure; // Spawns that found their queue full
+    rift_gang_stats_t gangs;        // Start skew of gang_start batches
     pthread_rwlock_t registry_lock;
     pthread_mutex_t id_generation_mutex;
 } rift_telemetry_registry_t;
@@ -52,6 +61,9 @@ static pthread_mutex_t g_hierarchy_mutex = PTHREAD_MUTEX_INITIALIZER;
 static bool g_telemetry_initialized = false;
 static FILE* g_telemetry_log = NULL;
 
+__thread rift_thread_context_t* rift_current_context
+    __attribute__((tls_model("initial-exec"))) = NULL;
+
 // =============================================================================
 // TELEMETRY INITIALIZATION AND MANAGEMENT
 // =============================================================================
@@ -81,6 +93,15 @@ int rift_telemetry_init(void) {
     memset(g_telemetry_registry.registry_active, false, sizeof(g_telemetry_registry.registry_active));
     g_telemetry_registry.active_count = 0;
     g_telemetry_registry.next_rift_id = 1;
+    g_telemetry_registry.placements_local = 0;
+    g_telemetry_registry.placements_remote = 0;
+    g_telemetry_registry.parallel_loops = 0;
+    g_telemetry_registry.parallel_iterations = 0;
+    g_telemetry_registry.parallel_chunks = 0;
+    g_telemetry_registry.parallel_steals = 0;
+    memset(&g_telemetry_registry.deadlines, 0, sizeof(g_telemetry_registry.deadlines));
+    memset(&g_telemetry_registry.backpressure, 0, sizeof(g_telemetry_registry.backpressure));
+    memset(&g_telemetry_registry.gangs, 0, sizeof(g_telemetry_registry.gangs));
     
     // Initialize process hierarchy
     memset(g_process_hierarchy, 0, sizeof(g_process_hierarchy));
@@ -101,13 +122,15 @@ int rift_telemetry_init(void) {
     strncpy(main_context.telemetry.spawn_location, "main()", 
             sizeof(main_context.telemetry.spawn_location) - 1);
     
+    // Registration requires the initialized flag, so set it first
+    g_telemetry_initialized = true;
+    
     if (rift_telemetry_register_spawn(&main_context, "main()") < 0) {
         fprintf(stderr, "[TELEMETRY] Failed to register main process\n");
+        g_telemetry_initialized = false;
         return -1;
     }
     
-    g_telemetry_initialized = true;
-    
     printf("[TELEMETRY] Initialized - Main Process PID: %d, TID: %lu\n", 
            getpid(), (unsigned long)pthread_self());
     
@@ -132,10 +155,14 @@ static uint64_t generate_rift_id(void) {
 }
 
 /**
- * @brief Get current thread ID (Linux-specific)
+ * @brief Reserve contiguous RIFT ID range with a single lock acquisition
  */
-static pid_t get_thread_id(void) {
-    return syscall(SYS_gettid);
+static uint64_t reserve_rift_ids(uint32_t count) {
+    pthread_mutex_lock(&g_telemetry_registry.id_generation_mutex);
+    uint64_t first_id = g_telemetry_registry.next_rift_id;
+    g_telemetry_registry.next_rift_id += count;
+    pthread_mutex_unlock(&g_telemetry_registry.id_generation_mutex);
+    return first_id;
 }
 
 // =============================================================================
@@ -209,6 +236,65 @@ int rift_telemetry_register_spawn(rift_thread_context_t* context, const char* sp
     return 0;
 }
 
+/**
+ * @brief Register batch of spawns: one ID reservation, one registry pass
+ */
+int rift_telemetry_register_spawn_batch(rift_thread_context_t** contexts, uint32_t count,
+                                        const char* spawn_location) {
+    if (!g_telemetry_initialized || !contexts || !spawn_location || count == 0) {
+        return -1;
+    }
+    
+    uint64_t first_id = reserve_rift_ids(count);
+    pid_t process_id = getpid();
+    pthread_t thread_id = pthread_self();
+    struct timespec spawn_time;
+    clock_gettime(CLOCK_MONOTONIC, &spawn_time);
+    
+    for (uint32_t i = 0; i < count; i++) {
+        rift_spawn_telemetry_t* telemetry = &contexts[i]->telemetry;
+        telemetry->rift_thread_id = first_id + i;
+        telemetry->process_id = process_id;
+        telemetry->thread_id = thread_id;
+        telemetry->spawn_time = spawn_time;
+        strncpy(telemetry->spawn_location, spawn_location, sizeof(telemetry->spawn_location) - 1);
+        telemetry->spawn_location[sizeof(telemetry->spawn_location) - 1] = '\0';
+    }
+    
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    
+    if (g_telemetry_registry.active_count + count > RIFT_MAX_THREAD_COUNT) {
+        pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+        fprintf(stderr, "[TELEMETRY] Error: Registry cannot hold batch of %u spawns\n", count);
+        return -1;
+    }
+    
+    uint32_t registered = 0;
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT && registered < count; i++) {
+        if (!g_telemetry_registry.registry_active[i]) {
+            g_telemetry_registry.registry[i] = contexts[registered]->telemetry;
+            g_telemetry_registry.registry_active[i] = true;
+            registered++;
+        }
+    }
+    g_telemetry_registry.active_count += count;
+    
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+    
+    printf("[TELEMETRY] Registered batch - RIFT IDs: %lu-%lu, PID: %d, Location: %s\n",
+           first_id, first_id + count - 1, process_id, spawn_location);
+    
+    if (g_telemetry_log) {
+        fprintf(g_telemetry_log, "[SPAWN_BATCH] RIFT:%lu-%lu PID:%d TID:%lu Parent:%d Location:%s Time:%ld.%09ld\n",
+                first_id, first_id + count - 1, process_id, (unsigned long)thread_id,
+                contexts[0]->telemetry.parent_process_id, spawn_location,
+                spawn_time.tv_sec, spawn_time.tv_nsec);
+        fflush(g_telemetry_log);
+    }
+    
+    return 0;
+}
+
 // =============================================================================
 // PROCESS HIERARCHY MANAGEMENT
 // =============================================================================
@@ -217,7 +303,16 @@ int rift_telemetry_register_spawn(rift_thread_context_t* context, const char* sp
  * @brief Validate spawn against hierarchy constraints
  */
 bool rift_telemetry_validate_spawn(uint64_t parent_rift_id, const rift_governance_policy_t* proposed_policy) {
-    if (!g_telemetry_initialized || !proposed_policy) {
+    return rift_telemetry_validate_spawn_batch(parent_rift_id, proposed_policy, 1);
+}
+
+/**
+ * @brief Validate admission of count spawns against hierarchy constraints
+ */
+bool rift_telemetry_validate_spawn_batch(uint64_t parent_rift_id, 
+                                         const rift_governance_policy_t* proposed_policy,
+                                         uint32_t count) {
+    if (!g_telemetry_initialized || !proposed_policy || count == 0) {
         return false;
     }
     
@@ -236,9 +331,9 @@ bool rift_telemetry_validate_spawn(uint64_t parent_rift_id, const rift_governanc
     
     if (parent_node) {
         // Check child count limit (32 children per process)
-        if (parent_node->child_count >= RIFT_MAX_CHILDREN_PER_PROCESS) {
-            printf("[TELEMETRY] Spawn validation failed: Parent %lu has reached child limit (%d/%d)\n",
-                   parent_rift_id, parent_node->child_count, RIFT_MAX_CHILDREN_PER_PROCESS);
+        if (parent_node->child_count + count > RIFT_MAX_CHILDREN_PER_PROCESS) {
+            printf("[TELEMETRY] Spawn validation failed: Parent %lu cannot add %u children (%d/%d)\n",
+                   parent_rift_id, count, parent_node->child_count, RIFT_MAX_CHILDREN_PER_PROCESS);
             validation_result = false;
         }
         
@@ -248,31 +343,35 @@ bool rift_telemetry_validate_spawn(uint64_t parent_rift_id, const rift_governanc
                    proposed_policy->max_hierarchy_depth, RIFT_MAX_HIERARCHY_DEPTH);
             validation_result = false;
         }
+    } else if (parent_rift_id != 0 && count > RIFT_MAX_CHILDREN_PER_PROCESS) {
+        // First children of this parent: the whole batch must still fit
+        printf("[TELEMETRY] Spawn validation failed: Batch of %u exceeds child limit %d\n",
+               count, RIFT_MAX_CHILDREN_PER_PROCESS);
+        validation_result = false;
     }
     
     // Check global thread count limit
-    if (g_telemetry_registry.active_count >= RIFT_MAX_THREAD_COUNT) {
-        printf("[TELEMETRY] Spawn validation failed: Global thread count limit reached (%d/%d)\n",
-               g_telemetry_registry.active_count, RIFT_MAX_THREAD_COUNT);
+    if (g_telemetry_registry.active_count + count > RIFT_MAX_THREAD_COUNT) {
+        printf("[TELEMETRY] Spawn validation failed: Global thread count limit reached (%d+%u/%d)\n",
+               g_telemetry_registry.active_count, count, RIFT_MAX_THREAD_COUNT);
         validation_result = false;
     }
     
     pthread_mutex_unlock(&g_hierarchy_mutex);
     
     if (validation_result) {
-        printf("[TELEMETRY] Spawn validation passed for parent %lu\n", parent_rift_id);
+        printf("[TELEMETRY] Spawn validation passed for parent %lu (%u spawns)\n",
+               parent_rift_id, count);
     }
     
     return validation_result;
 }
 
 /**
- * @brief Add child to process hierarchy
+ * @brief Find parent hierarchy node, creating it on first child
+ *        (caller holds g_hierarchy_mutex)
  */
-int rift_telemetry_add_child(uint64_t parent_rift_id, uint64_t child_rift_id, const char* spawn_location) {
-    pthread_mutex_lock(&g_hierarchy_mutex);
-    
-    // Find or create parent node
+static rift_process_node_t* find_or_create_parent_node(uint64_t parent_rift_id) {
     rift_process_node_t* parent_node = NULL;
     for (uint32_t i = 0; i < g_process_count; i++) {
         if (g_process_hierarchy[i].rift_id == parent_rift_id) {
@@ -282,7 +381,6 @@ int rift_telemetry_add_child(uint64_t parent_rift_id, uint64_t child_rift_id, co
     }
     
     if (!parent_node && g_process_count < RIFT_MAX_THREAD_COUNT) {
-        // Create new parent node
         parent_node = &g_process_hierarchy[g_process_count++];
         parent_node->rift_id = parent_rift_id;
         parent_node->process_id = getpid();
@@ -292,6 +390,49 @@ int rift_telemetry_add_child(uint64_t parent_rift_id, uint64_t child_rift_id, co
                 sizeof(parent_node->spawn_location) - 1);
     }
     
+    return parent_node;
+}
+
+/**
+ * @brief Add contiguous range of children under one hierarchy lock
+ */
+int rift_telemetry_add_children(uint64_t parent_rift_id, uint64_t first_child_id, uint32_t count,
+                                const char* spawn_location) {
+    pthread_mutex_lock(&g_hierarchy_mutex);
+    
+    rift_process_node_t* parent_node = find_or_create_parent_node(parent_rift_id);
+    
+    int result = -1;
+    if (parent_node && parent_node->child_count + count <= RIFT_MAX_CHILDREN_PER_PROCESS) {
+        for (uint32_t i = 0; i < count; i++) {
+            parent_node->children[parent_node->child_count++] = first_child_id + i;
+        }
+        result = 0;
+        
+        printf("[TELEMETRY] Added children %lu-%lu to parent %lu (%d/%d children)\n",
+               first_child_id, first_child_id + count - 1, parent_rift_id,
+               parent_node->child_count, RIFT_MAX_CHILDREN_PER_PROCESS);
+        
+        if (g_telemetry_log) {
+            fprintf(g_telemetry_log, "[HIERARCHY] Parent:%lu Children:%lu-%lu Count:%d Location:%s\n",
+                    parent_rift_id, first_child_id, first_child_id + count - 1,
+                    parent_node->child_count, spawn_location);
+            fflush(g_telemetry_log);
+        }
+    }
+    
+    pthread_mutex_unlock(&g_hierarchy_mutex);
+    return result;
+}
+
+/**
+ * @brief Add child to process hierarchy
+ */
+int rift_telemetry_add_child(uint64_t parent_rift_id, uint64_t child_rift_id, const char* spawn_location) {
+    pthread_mutex_lock(&g_hierarchy_mutex);
+    
+    rift_process_node_t* parent_node = find_or_create_parent_node(parent_rift_id);
+    
     int result = -1;
     if (parent_node && parent_node->child_count < RIFT_MAX_CHILDREN_PER_PROCESS) {
         // Add child to parent's children array
@@ -314,6 +455,312 @@ int rift_telemetry_add_child(uint64_t parent_rift_id, uint64_t child_rift_id, co
     return result;
 }
 
+/**
+ * @brief Remove finished thread/process from registry and parent hierarchy
+ */
+int rift_telemetry_unregister(uint64_t rift_id) {
+    if (!g_telemetry_initialized) {
+        return -1;
+    }
+    
+    uint64_t parent_rift_id = 0;
+    bool found = false;
+    
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        if (g_telemetry_registry.registry_active[i] && 
+            g_telemetry_registry.registry[i].rift_thread_id == rift_id) {
+            parent_rift_id = g_telemetry_registry.registry[i].parent_rift_id;
+            g_telemetry_registry.registry_active[i] = false;
+            g_telemetry_registry.active_count--;
+            found = true;
+            break;
+        }
+    }
+    
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+    
+    if (!found) {
+        return -1;
+    }
+    
+    pthread_mutex_lock(&g_hierarchy_mutex);
+    
+    for (uint32_t i = 0; i < g_process_count; i++) {
+        rift_process_node_t* node = &g_process_hierarchy[i];
+        
+        if (node->rift_id == parent_rift_id) {
+            // Swap-remove child from parent's children array
+            for (uint32_t j = 0; j < node->child_count; j++) {
+                if (node->children[j] == rift_id) {
+                    node->children[j] = node->children[node->child_count - 1];
+                    node->child_count--;
+                    break;
+                }
+            }
+        }
+    }
+    
+    // Drop own hierarchy node once it has no surviving children
+    for (uint32_t i = 0; i < g_process_count; i++) {
+        if (g_process_hierarchy[i].rift_id == rift_id && g_process_hierarchy[i].child_count == 0) {
+            g_process_hierarchy[i] = g_process_hierarchy[g_process_count - 1];
+            g_process_count--;
+            break;
+        }
+    }
+    
+    pthread_mutex_unlock(&g_hierarchy_mutex);
+    
+    if (g_telemetry_log) {
+        struct timespec exit_time;
+        clock_gettime(CLOCK_MONOTONIC, &exit_time);
+        fprintf(g_telemetry_log, "[EXIT] RIFT:%lu Parent:%lu Time:%ld.%09ld\n",
+                rift_id, parent_rift_id, exit_time.tv_sec, exit_time.tv_nsec);
+        fflush(g_telemetry_log);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Record NUMA placement of a thread/process and count it as local or
+ *        remote to its spawner
+ */
+int rift_telemetry_record_placement(uint64_t rift_id, int32_t numa_node, bool local) {
+    if (!g_telemetry_initialized) {
+        return -1;
+    }
+    
+    bool found = false;
+    
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        if (g_telemetry_registry.registry_active[i] && 
+            g_telemetry_registry.registry[i].rift_thread_id == rift_id) {
+            rift_spawn_telemetry_t* t = &g_telemetry_registry.registry[i];
+            t->numa_placed = true;
+            t->numa_node = numa_node;
+            t->numa_local = local;
+            if (local) {
+                g_telemetry_registry.placements_local++;
+            } else {
+                g_telemetry_registry.placements_remote++;
+            }
+            found = true;
+            break;
+        }
+    }
+    
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+    
+    if (found && g_telemetry_log) {
+        fprintf(g_telemetry_log, "[PLACEMENT] RIFT:%lu Node:%d %s\n",
+                rift_id, numa_node, local ? "local" : "remote");
+        fflush(g_telemetry_log);
+    }
+    
+    return found ? 0 : -1;
+}
+
+/**
+ * @brief Record exit status of a thread/process before it is unregistered
+ */
+int rift_telemetry_record_exit(uint64_t rift_id, int status) {
+    if (!g_telemetry_initialized) {
+        return -1;
+    }
+    
+    bool found = false;
+    
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        if (g_telemetry_registry.registry_active[i] && 
+            g_telemetry_registry.registry[i].rift_thread_id == rift_id) {
+            g_telemetry_registry.registry[i].exited = true;
+            g_telemetry_registry.registry[i].exit_status = status;
+            found = true;
+            break;
+        }
+    }
+    
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+    
+    if (found && g_telemetry_log) {
+        struct timespec exit_time;
+        clock_gettime(CLOCK_MONOTONIC, &exit_time);
+        fprintf(g_telemetry_log, "[REAPED] RIFT:%lu Status:0x%x Time:%ld.%09ld\n",
+                rift_id, (unsigned)status, exit_time.tv_sec, exit_time.tv_nsec);
+        fflush(g_telemetry_log);
+    }
+    
+    return found ? 0 : -1;
+}
+
+/**
+ * @brief Record the aggregate of a finished parallel loop
+ */
+int rift_telemetry_record_parallel(uint64_t rift_id, uint64_t iterations, uint64_t chunks,
+                                   uint64_t splits, uint64_t steals) {
+    if (!g_telemetry_initialized) {
+        return -1;
+    }
+
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    g_telemetry_registry.parallel_loops++;
+    g_telemetry_registry.parallel_iterations += iterations;
+    g_telemetry_registry.parallel_chunks += chunks;
+    g_telemetry_registry.parallel_steals += steals;
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+
+    if (g_telemetry_log) {
+        fprintf(g_telemetry_log, "[PARALLEL] RIFT:%lu Iterations:%lu Chunks:%lu Splits:%lu "
+                "Steals:%lu\n", rift_id, iterations, chunks, splits, steals);
+        fflush(g_telemetry_log);
+    }
+    return 0;
+}
+
+/**
+ * @brief Record whether a finished task met the deadline it ran against
+ */
+int rift_telemetry_record_deadline(uint64_t rift_id, uint64_t deadline_ns) {
+    if (!g_telemetry_initialized) {
+        return -1;
+    }
+
+    struct timespec finish_time;
+    clock_gettime(CLOCK_MONOTONIC, &finish_time);
+    uint64_t finish_ns = (uint64_t)finish_time.tv_sec * 1000000000ull +
+                         (uint64_t)finish_time.tv_nsec;
+    bool met = finish_ns <= deadline_ns;
+
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    rift_deadline_stats_t* deadlines = &g_telemetry_registry.deadlines;
+    if (met) {
+        deadlines->met++;
+    } else {
+        deadlines->missed++;
+        if (finish_ns - deadline_ns > deadlines->worst_late_ns) {
+            deadlines->worst_late_ns = finish_ns - deadline_ns;
+        }
+    }
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+
+    if (g_telemetry_log) {
+        fprintf(g_telemetry_log, "[DEADLINE] RIFT:%lu %s Slack:%ld us\n", rift_id,
+                met ? "Met" : "Missed", ((long)deadline_ns - (long)finish_ns) / 1000);
+        fflush(g_telemetry_log);
+    }
+    return 0;
+}
+
+/**
+ * @brief Record a spawn refused by EDF admission control
+ */
+int rift_telemetry_record_deadline_rejected(uint64_t deadline_ns, uint64_t runtime_ns) {
+    if (!g_telemetry_initialized) {
+        return -1;
+    }
+
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    g_telemetry_registry.deadlines.rejected++;
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+
+    if (g_telemetry_log) {
+        fprintf(g_telemetry_log, "[DEADLINE] Rejected Deadline:%lu Runtime:%lu us\n",
+                deadline_ns, runtime_ns / 1000);
+        fflush(g_telemetry_log);
+    }
+    return 0;
+}
+
+/**
+ * @brief Record a spawn that found its runner's queue at max_queued
+ */
+int rift_telemetry_record_backpressure(rift_overflow_policy_t action, uint32_t queue_depth,
+                                       uint32_t max_queued, uint64_t blocked_ns) {
+    if (!g_telemetry_initialized) {
+        return -1;
+    }
+
+    static const char* action_names[] = { "Blocked", "Rejected", "CallerRuns" };
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    rift_backpressure_stats_t* backpressure = &g_telemetry_registry.backpressure;
+    if (action == OVERFLOW_BLOCK) {
+        backpressure->blocked++;
+        backpressure->blocked_ns += blocked_ns;
+    } else if (action == OVERFLOW_FAIL_FAST) {
+        backpressure->rejected++;
+    } else {
+        backpressure->ran_inline++;
+    }
+    if (queue_depth > backpressure->queue_depth_peak) {
+        backpressure->queue_depth_peak = queue_depth;
+    }
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+
+    if (g_telemetry_log) {
+        fprintf(g_telemetry_log, "[BACKPRESSURE] %s Depth:%u/%u Waited:%lu us\n",
+                action_names[action], queue_depth, max_queued, blocked_ns / 1000);
+        fflush(g_telemetry_log);
+    }
+    return 0;
+}
+
+/**
+ * @brief Record the start skew of a released gang
+ */
+int rift_telemetry_record_gang(uint64_t first_rift_id, uint32_t count, uint64_t skew_ns) {
+    if (!g_telemetry_initialized) {
+        return -1;
+    }
+
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    rift_gang_stats_t* gangs = &g_telemetry_registry.gangs;
+    gangs->gangs++;
+    gangs->members += count;
+    gangs->total_skew_ns += skew_ns;
+    gangs->last_skew_ns = skew_ns;
+    if (skew_ns > gangs->max_skew_ns) {
+        gangs->max_skew_ns = skew_ns;
+    }
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+
+    if (g_telemetry_log) {
+        fprintf(g_telemetry_log, "[GANG] RIFT:%lu-%lu Members:%u Skew:%lu us\n",
+                (unsigned long)first_rift_id, (unsigned long)(first_rift_id + count - 1), count,
+                (unsigned long)(skew_ns / 1000));
+        fflush(g_telemetry_log);
+    }
+    return 0;
+}
+
+/**
+ * @brief Move a registered task's deadline
+ */
+int rift_telemetry_set_deadline(uint64_t rift_id, uint64_t deadline_ns) {
+    if (!g_telemetry_initialized) {
+        return -1;
+    }
+
+    bool found = false;
+    pthread_rwlock_wrlock(&g_telemetry_registry.registry_lock);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        if (g_telemetry_registry.registry_active[i] &&
+            g_telemetry_registry.registry[i].rift_thread_id == rift_id) {
+            g_telemetry_registry.registry[i].deadline_ns = deadline_ns;
+            found = true;
+            break;
+        }
+    }
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+    return found ? 0 : -1;
+}
+
 // =============================================================================
 // TELEMETRY QUERY AND REPORTING
 // =============================================================================
@@ -341,23 +788,215 @@ rift_spawn_telemetry_t* rift_telemetry_get(uint64_t rift_id) {
     return result;
 }
 
+/**
+ * @brief Depth below parent_id; a task spawning its own children (the
+ *        common case) is answered from its context
+ */
+uint32_t rift_telemetry_child_depth(uint64_t parent_id) {
+    if (parent_id == 0) {
+        return 0;
+    }
+
+    rift_thread_context_t* current = rift_current();
+    if (current && current->telemetry.rift_thread_id == parent_id) {
+        return current->telemetry.hierarchy_depth + 1;
+    }
+    rift_spawn_telemetry_t* parent = rift_telemetry_get(parent_id);
+    return parent ? parent->hierarchy_depth + 1 : 1;
+}
+
+/**
+ * @brief Get the current deadline of a registered task, read under the lock
+ */
+uint64_t rift_telemetry_get_deadline(uint64_t rift_id) {
+    if (!g_telemetry_initialized) {
+        return 0;
+    }
+
+    uint64_t deadline_ns = 0;
+    pthread_rwlock_rdlock(&g_telemetry_registry.registry_lock);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        if (g_telemetry_registry.registry_active[i] &&
+            g_telemetry_registry.registry[i].rift_thread_id == rift_id) {
+            deadline_ns = g_telemetry_registry.registry[i].deadline_ns;
+            break;
+        }
+    }
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+    return deadline_ns;
+}
+
+/**
+ * @brief Get the subtree quota of a registered task; the reference is taken
+ *        under the lock, before the task can unregister and drop its own
+ */
+rift_quota_group_t* rift_telemetry_get_subtree_quota(uint64_t rift_id) {
+    if (!g_telemetry_initialized) {
+        return NULL;
+    }
+
+    rift_quota_group_t* group = NULL;
+    pthread_rwlock_rdlock(&g_telemetry_registry.registry_lock);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        if (g_telemetry_registry.registry_active[i] &&
+            g_telemetry_registry.registry[i].rift_thread_id == rift_id) {
+            group = g_telemetry_registry.registry[i].subtree_quota;
+            if (group) {
+                rift_quota_group_get(group);
+            }
+            break;
+        }
+    }
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+    return group;
+}
+
+/**
+ * @brief Copy active registry entries, read under the lock
+ */
+uint32_t rift_telemetry_snapshot(rift_spawn_telemetry_t* entries, uint32_t capacity) {
+    if (!g_telemetry_initialized || !entries) {
+        return 0;
+    }
+
+    uint32_t count = 0;
+    pthread_rwlock_rdlock(&g_telemetry_registry.registry_lock);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT && count < capacity; i++) {
+        if (g_telemetry_registry.registry_active[i]) {
+            entries[count++] = g_telemetry_registry.registry[i];
+        }
+    }
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+    return count;
+}
+
+/**
+ * @brief Hold the registry read lock across a snapshot fork(); writers in
+ *        other threads are kept out, so the child sees no half-written entry
+ */
+void rift_telemetry_fork_hold(void) {
+    if (g_telemetry_initialized) {
+        pthread_rwlock_rdlock(&g_telemetry_registry.registry_lock);
+    }
+}
+
+void rift_telemetry_fork_release(bool in_child) {
+    if (!g_telemetry_initialized) {
+        return;
+    }
+    if (in_child) {
+        // The lock was copied held, with the parent's waiters counted in it
+        pthread_rwlock_init(&g_telemetry_registry.registry_lock, NULL);
+        pthread_mutex_init(&g_telemetry_registry.id_generation_mutex, NULL);
+    } else {
+        pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+    }
+}
+
+/**
+ * @brief Drop the spawner's registry in a forked child, keeping the forked
+ *        task's own entry
+ */
+void rift_telemetry_forget_parent(const rift_spawn_telemetry_t* keep) {
+    if (!g_telemetry_initialized) {
+        return;
+    }
+    // Other threads may have held the locks across fork()
+    pthread_rwlock_init(&g_telemetry_registry.registry_lock, NULL);
+    pthread_mutex_init(&g_telemetry_registry.id_generation_mutex, NULL);
+    pthread_mutex_init(&g_hierarchy_mutex, NULL);
+
+    memset(g_telemetry_registry.registry_active, false,
+           sizeof(g_telemetry_registry.registry_active));
+    g_telemetry_registry.active_count = 0;
+    memset(g_process_hierarchy, 0, sizeof(g_process_hierarchy));
+    g_process_count = 0;
+
+    // Children spawned here look their parent up in this process's registry
+    if (keep) {
+        g_telemetry_registry.registry[0] = *keep;
+        g_telemetry_registry.registry[0].process_id = getpid();
+        g_telemetry_registry.registry[0].thread_id = pthread_self();
+        g_telemetry_registry.registry_active[0] = true;
+        g_telemetry_registry.active_count = 1;
+    }
+}
+
+/**
+ * @brief Get deadline met/missed/rejected counters
+ */
+void rift_telemetry_get_deadline_stats(rift_deadline_stats_t* stats) {
+    if (!stats) {
+        return;
+    }
+    if (!g_telemetry_initialized) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    pthread_rwlock_rdlock(&g_telemetry_registry.registry_lock);
+    *stats = g_telemetry_registry.deadlines;
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+}
+
+/**
+ * @brief Get counters of spawns that found their queue full
+ */
+void rift_telemetry_get_backpressure_stats(rift_backpressure_stats_t* stats) {
+    if (!stats) {
+        return;
+    }
+    if (!g_telemetry_initialized) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    pthread_rwlock_rdlock(&g_telemetry_registry.registry_lock);
+    *stats = g_telemetry_registry.backpressure;
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+}
+
+/**
+ * @brief Get start skew counters of released gangs
+ */
+void rift_telemetry_get_gang_stats(rift_gang_stats_t* stats) {
+    if (!stats) {
+        return;
+    }
+    if (!g_telemetry_initialized) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    pthread_rwlock_rdlock(&g_telemetry_registry.registry_lock);
+    *stats = g_telemetry_registry.gangs;
+    pthread_rwlock_unlock(&g_telemetry_registry.registry_lock);
+}
+
 /**
  * @brief Update heartbeat for thread/process
  */
 int rift_telemetry_heartbeat(uint64_t rift_id) {
-    rift_spawn_telemetry_t* telemetry = rift_telemetry_get(rift_id);
-    if (!telemetry) {
-        return -1;
-    }
-    
-    // Update heartbeat timestamp (this would need thread safety in production)
     struct timespec current_time;
     clock_gettime(CLOCK_MONOTONIC, &current_time);
-    
-    // For now, we just log the heartbeat
+
+    // A task beating for itself owns its context; others need the registry
+    pid_t process_id;
+    rift_thread_context_t* current = rift_current();
+    if (current && current->telemetry.rift_thread_id == rift_id) {
+        current->last_heartbeat = current_time;
+        process_id = current->telemetry.process_id;
+    } else {
+        rift_spawn_telemetry_t* telemetry = rift_telemetry_get(rift_id);
+        if (!telemetry) {
+            return -1;
+        }
+        process_id = telemetry->process_id;
+    }
+
     if (g_telemetry_log) {
         fprintf(g_telemetry_log, "[HEARTBEAT] RIFT:%lu PID:%d Time:%ld.%09ld\n",
-                rift_id, telemetry->process_id, current_time.tv_sec, current_time.tv_nsec);
+                rift_id, process_id, current_time.tv_sec, current_time.tv_nsec);
         fflush(g_telemetry_log);
     }
     
@@ -377,22 +1016,51 @@ void rift_telemetry_print_report(void) {
     printf("=== RIFT TELEMETRY REPORT ===\n");
     printf("Active Threads: %d/%d\n", g_telemetry_registry.active_count, RIFT_MAX_THREAD_COUNT);
     printf("Process Hierarchy Nodes: %d/%d\n", g_process_count, RIFT_MAX_THREAD_COUNT);
+    printf("NUMA Placements: %lu local, %lu remote (* in NODE)\n",
+           (unsigned long)g_telemetry_registry.placements_local,
+           (unsigned long)g_telemetry_registry.placements_remote);
+    printf("Parallel Loops: %lu (%lu iterations in %lu chunks, %lu stolen)\n",
+           (unsigned long)g_telemetry_registry.parallel_loops,
+           (unsigned long)g_telemetry_registry.parallel_iterations,
+           (unsigned long)g_telemetry_registry.parallel_chunks,
+           (unsigned long)g_telemetry_registry.parallel_steals);
+    printf("Deadlines: %lu met, %lu missed (worst %.2f ms late), %lu rejected at admission\n",
+           (unsigned long)g_telemetry_registry.deadlines.met,
+           (unsigned long)g_telemetry_registry.deadlines.missed,
+           (double)g_telemetry_registry.deadlines.worst_late_ns / 1e6,
+           (unsigned long)g_telemetry_registry.deadlines.rejected);
+    printf("Backpressure: %lu blocked (%.2f ms), %lu rejected, %lu run by caller, "
+           "deepest queue %u\n",
+           (unsigned long)g_telemetry_registry.backpressure.blocked,
+           (double)g_telemetry_registry.backpressure.blocked_ns / 1e6,
+           (unsigned long)g_telemetry_registry.backpressure.rejected,
+           (unsigned long)g_telemetry_registry.backpressure.ran_inline,
+           g_telemetry_registry.backpressure.queue_depth_peak);
+    rift_gang_stats_t* gangs = &g_telemetry_registry.gangs;
+    printf("Gangs: %lu released (%lu threads), start skew avg %.1f us, max %.1f us\n",
+           (unsigned long)gangs->gangs, (unsigned long)gangs->members,
+           gangs->gangs ? (double)gangs->total_skew_ns / gangs->gangs / 1e3 : 0.0,
+           (double)gangs->max_skew_ns / 1e3);
     printf("\n");
     
     pthread_rwlock_rdlock(&g_telemetry_registry.registry_lock);
     
     printf("SPAWN REGISTRY:\n");
-    printf("%-10s %-8s %-12s %-12s %-8s %-20s %s\n", 
-           "RIFT_ID", "PID", "TID", "PARENT_PID", "DEPTH", "SPAWN_TIME", "LOCATION");
-    printf("%-10s %-8s %-12s %-12s %-8s %-20s %s\n", 
-           "-------", "---", "---", "----------", "-----", "----------", "--------");
+    printf("%-10s %-8s %-12s %-12s %-8s %-8s %-20s %s\n", 
+           "RIFT_ID", "PID", "TID", "PARENT_PID", "DEPTH", "NODE", "SPAWN_TIME", "LOCATION");
+    printf("%-10s %-8s %-12s %-12s %-8s %-8s %-20s %s\n", 
+           "-------", "---", "---", "----------", "-----", "----", "----------", "--------");
     
     for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
         if (g_telemetry_registry.registry_active[i]) {
             rift_spawn_telemetry_t* t = &g_telemetry_registry.registry[i];
-            printf("%-10lu %-8d %-12lu %-12d %-8d %-20ld %s\n",
+            char node[16] = "-";
+            if (t->numa_placed) {
+                snprintf(node, sizeof(node), "%d%s", t->numa_node, t->numa_local ? "" : "*");
+            }
+            printf("%-10lu %-8d %-12lu %-12d %-8d %-8s %-20ld %s\n",
                    t->rift_thread_id, t->process_id, (unsigned long)t->thread_id,
-                   t->parent_process_id, t->hierarchy_depth, t->spawn_time.tv_sec,
+                   t->parent_process_id, t->hierarchy_depth, node, t->spawn_time.tv_sec,
                    t->spawn_location);
         }
     }
@@ -448,31 +1116,3 @@ void rift_telemetry_cleanup(void) {
     
     g_telemetry_initialized = false;
 }
-
-// =============================================================================
-// CONVENIENCE MACROS FOR SPAWN LOCATION TRACKING
-// =============================================================================
-
-/**
- * Macro to automatically capture spawn location for use in spawn calls
- */
-#define RIFT_SPAWN_LOCATION() \
-    (__FILE__ ":" #__LINE__ " in " __func__ "()")
-
-/**
- * Macro to register spawn with automatic location capture
- */
-#define RIFT_REGISTER_SPAWN(context) \
-    rift_telemetry_register_spawn(context, RIFT_SPAWN_LOCATION())
-
-/**
- * Macro to validate spawn with automatic location capture
- */
-#define RIFT_VALIDATE_SPAWN(parent_id, policy) \
-    rift_telemetry_validate_spawn(parent_id, policy)
-
-/**
- * Macro to add child with automatic location capture
- */
-#define RIFT_ADD_CHILD(parent_id, child_id) \
-    rift_telemetry_add_child(parent_id, child_id, RIFT_SPAWN_LOCATION())
@@ -0,0 +1,297 @@
+/**
+ * @file rift_telemetry.h
+ * @brief Telemetry and Process Hierarchy Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_TELEMETRY_H
+#define RIFT_TELEMETRY_H
+
+#include "rift_common.h"
+
+// Deadline outcomes of finished EDF (and deadline-inheriting) tasks
+typedef struct {
+    uint64_t met;                         // Finished by their deadline
+    uint64_t missed;                      // Finished after it
+    uint64_t rejected;                    // Refused at admission as infeasible
+    uint64_t worst_late_ns;               // Largest lateness of a missed deadline
+} rift_deadline_stats_t;
+
+// Gangs of threads released together by a gang_start batch
+typedef struct {
+    uint64_t gangs;                       // Gangs released
+    uint64_t members;                     // Threads in them
+    uint64_t total_skew_ns;               // Sum of first-start to last-start spans
+    uint64_t max_skew_ns;                 // Widest span
+    uint64_t last_skew_ns;                // Span of the most recent gang
+} rift_gang_stats_t;
+
+// Spawns that found their runner's queue at max_queued
+typedef struct {
+    uint64_t blocked;                     // Waited for room (OVERFLOW_BLOCK)
+    uint64_t rejected;                    // Refused (OVERFLOW_FAIL_FAST)
+    uint64_t ran_inline;                  // Run by the spawner (OVERFLOW_CALLER_RUNS)
+    uint64_t blocked_ns;                  // Total time spent waiting for room
+    uint32_t queue_depth_peak;            // Deepest queue a bounded spawn found
+} rift_backpressure_stats_t;
+
+/**
+ * @brief Initialize telemetry subsystem
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_init(void);
+
+/**
+ * @brief Register new thread/process spawn with telemetry
+ * @param context Thread context to register
+ * @param spawn_location Source location where spawn occurred
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_register_spawn(rift_thread_context_t* context, const char* spawn_location);
+
+/**
+ * @brief Register batch of spawns under one contiguous RIFT ID range
+ * @param contexts Thread contexts to register
+ * @param count Number of contexts
+ * @param spawn_location Source location where spawn occurred
+ * @return 0 on success, error code otherwise (nothing is registered)
+ */
+int rift_telemetry_register_spawn_batch(rift_thread_context_t** contexts, uint32_t count,
+                                        const char* spawn_location);
+
+/**
+ * @brief Update heartbeat for thread/process; a task's own heartbeat
+ *        (rift_current_id()) needs no registry lookup
+ * @param rift_id RIFT thread identifier
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_heartbeat(uint64_t rift_id);
+
+/**
+ * @brief Get spawn telemetry for specific thread
+ * @param rift_id RIFT thread identifier
+ * @return Pointer to telemetry data, NULL if not found
+ */
+rift_spawn_telemetry_t* rift_telemetry_get(uint64_t rift_id);
+
+/**
+ * @brief Print comprehensive telemetry report
+ */
+void rift_telemetry_print_report(void);
+
+/**
+ * @brief Validate hierarchy constraints for new spawn
+ * @param parent_rift_id Parent RIFT thread ID
+ * @param proposed_policy Proposed governance policy
+ * @return true if spawn allowed, false if violates constraints
+ */
+bool rift_telemetry_validate_spawn(uint64_t parent_rift_id, const rift_governance_policy_t* proposed_policy);
+
+/**
+ * @brief Validate hierarchy constraints for a batch of spawns
+ * @param parent_rift_id Parent RIFT thread ID
+ * @param proposed_policy Proposed governance policy shared by the batch
+ * @param count Number of children to admit
+ * @return true if the whole batch is allowed, false otherwise
+ */
+bool rift_telemetry_validate_spawn_batch(uint64_t parent_rift_id,
+                                         const rift_governance_policy_t* proposed_policy,
+                                         uint32_t count);
+
+/**
+ * @brief Add child to parent's process hierarchy node
+ * @param parent_rift_id Parent RIFT thread ID
+ * @param child_rift_id Child RIFT thread ID
+ * @param spawn_location Source location of spawn
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_add_child(uint64_t parent_rift_id, uint64_t child_rift_id, const char* spawn_location);
+
+/**
+ * @brief Add contiguous range of children to parent's hierarchy node
+ * @param parent_rift_id Parent RIFT thread ID
+ * @param first_child_rift_id First child RIFT thread ID of the range
+ * @param count Number of children
+ * @param spawn_location Source location of spawn
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_add_children(uint64_t parent_rift_id, uint64_t first_child_rift_id,
+                                uint32_t count, const char* spawn_location);
+
+/**
+ * @brief Record where a placed thread/process ended up
+ * @param rift_id RIFT thread identifier
+ * @param numa_node NUMA node the task runs on
+ * @param local Whether that is the spawner's NUMA node
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_record_placement(uint64_t rift_id, int32_t numa_node, bool local);
+
+/**
+ * @brief Record exit status of a collected process
+ * @param rift_id RIFT thread identifier
+ * @param status waitpid() status
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_record_exit(uint64_t rift_id, int status);
+
+/**
+ * @brief Record the aggregate of a finished parallel loop
+ * @param rift_id RIFT ID of the loop
+ * @param iterations Iterations executed
+ * @param chunks Body invocations
+ * @param splits Ranges split off for other participants
+ * @param steals Ranges taken by another participant
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_record_parallel(uint64_t rift_id, uint64_t iterations, uint64_t chunks,
+                                   uint64_t splits, uint64_t steals);
+
+/**
+ * @brief Hierarchy depth of a child of parent_id; the calling task's own
+ *        depth is read from its context without a registry scan
+ * @param parent_id Parent RIFT ID, 0 for a root spawn
+ * @return 0 for a root, 1 under an unknown parent
+ */
+uint32_t rift_telemetry_child_depth(uint64_t parent_id);
+
+/**
+ * @brief Get the current deadline of a registered task
+ * @param rift_id RIFT thread identifier
+ * @return Absolute deadline in CLOCK_MONOTONIC ns, 0 for none or unknown ID
+ */
+uint64_t rift_telemetry_get_deadline(uint64_t rift_id);
+
+/**
+ * @brief Get the subtree quota a registered task's descendants are charged to
+ * @param rift_id RIFT thread identifier
+ * @return Group with a reference taken, NULL for none or unknown ID
+ */
+rift_quota_group_t* rift_telemetry_get_subtree_quota(uint64_t rift_id);
+
+/**
+ * @brief Copy the active registry entries
+ * @param entries Output entries
+ * @param capacity Entries that fit in the output
+ * @return Number of entries copied
+ */
+uint32_t rift_telemetry_snapshot(rift_spawn_telemetry_t* entries, uint32_t capacity);
+
+/**
+ * @brief Hold the registry read lock across fork() so the child copies no
+ *        half-written entry; pair with rift_telemetry_fork_release()
+ */
+void rift_telemetry_fork_hold(void);
+
+/**
+ * @brief End a fork hold
+ * @param in_child true in the child, which reinitializes the copied locks
+ */
+void rift_telemetry_fork_release(bool in_child);
+
+/**
+ * @brief Drop the registry inherited across fork() in a process task's
+ *        child, whose entries are the spawner's tasks, keeping the task's own
+ * @param keep Telemetry of the forked task, NULL to keep nothing
+ */
+void rift_telemetry_forget_parent(const rift_spawn_telemetry_t* keep);
+
+/**
+ * @brief Move a registered task's deadline (priority inheritance)
+ * @param rift_id RIFT thread identifier
+ * @param deadline_ns New absolute deadline
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_set_deadline(uint64_t rift_id, uint64_t deadline_ns);
+
+/**
+ * @brief Record whether a finished task met its deadline
+ * @param rift_id RIFT thread identifier
+ * @param deadline_ns Deadline the task was scheduled against
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_record_deadline(uint64_t rift_id, uint64_t deadline_ns);
+
+/**
+ * @brief Record a spawn refused by EDF admission control
+ * @param deadline_ns Requested absolute deadline
+ * @param runtime_ns Claimed runtime
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_record_deadline_rejected(uint64_t deadline_ns, uint64_t runtime_ns);
+
+/**
+ * @brief Get deadline met/missed/rejected counters
+ * @param stats Output statistics
+ */
+void rift_telemetry_get_deadline_stats(rift_deadline_stats_t* stats);
+
+/**
+ * @brief Record a spawn that found its runner's queue full
+ * @param action What the spawn did (its overflow policy)
+ * @param queue_depth Queued tasks it found
+ * @param max_queued Bound it was checked against
+ * @param blocked_ns Time spent waiting for room (OVERFLOW_BLOCK)
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_record_backpressure(rift_overflow_policy_t action, uint32_t queue_depth,
+                                       uint32_t max_queued, uint64_t blocked_ns);
+
+/**
+ * @brief Get blocked/rejected/caller-runs counters of bounded spawns
+ * @param stats Output statistics
+ */
+void rift_telemetry_get_backpressure_stats(rift_backpressure_stats_t* stats);
+
+/**
+ * @brief Record the start skew of a released gang
+ * @param first_rift_id First RIFT ID of the gang's contiguous range
+ * @param count Members
+ * @param skew_ns Time from the first member starting work to the last
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_record_gang(uint64_t first_rift_id, uint32_t count, uint64_t skew_ns);
+
+/**
+ * @brief Get start skew counters of released gangs
+ * @param stats Output statistics
+ */
+void rift_telemetry_get_gang_stats(rift_gang_stats_t* stats);
+
+/**
+ * @brief Remove finished thread/process from registry and hierarchy
+ * @param rift_id RIFT thread identifier
+ * @return 0 on success, error code otherwise
+ */
+int rift_telemetry_unregister(uint64_t rift_id);
+
+// Convenience macros for spawn location tracking
+#define RIFT_STRINGIFY_VALUE(value) #value
+#define RIFT_STRINGIFY(value) RIFT_STRINGIFY_VALUE(value)
+
+/**
+ * Macro to automatically capture spawn location for use in spawn calls
+ */
+#define RIFT_SPAWN_LOCATION() \
+    (__FILE__ ":" RIFT_STRINGIFY(__LINE__))
+
+/**
+ * Macro to register spawn with automatic location capture
+ */
+#define RIFT_REGISTER_SPAWN(context) \
+    rift_telemetry_register_spawn(context, RIFT_SPAWN_LOCATION())
+
+/**
+ * Macro to validate spawn with automatic location capture
+ */
+#define RIFT_VALIDATE_SPAWN(parent_id, policy) \
+    rift_telemetry_validate_spawn(parent_id, policy)
+
+/**
+ * Macro to add child with automatic location capture
+ */
+#define RIFT_ADD_CHILD(parent_id, child_id) \
+    rift_telemetry_add_child(parent_id, child_id, RIFT_SPAWN_LOCATION())
+
+#endif // RIFT_TELEMETRY_H
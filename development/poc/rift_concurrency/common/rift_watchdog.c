@@ -0,0 +1,400 @@
+/**
+ * @file rift_watchdog.c
+ * @brief Hierarchical Timing-Wheel Watchdog for Execution Deadlines
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * One thread enforces every max_execution_time_ms deadline. Timers are
+ * embedded in the task they guard and hang off a four-level timing wheel
+ * (Varghese & Lauck, SOSP 1987) of 256 slots per level at a 1 ms tick, the
+ * layout of the classic Linux timer wheel: level 0 holds the next 256 ticks,
+ * each higher level covers 256 times the range of the one below and is
+ * cascaded down one slot at a time as the lower level wraps. Arming links
+ * the timer into one slot and disarming unlinks it, both O(1) whatever the
+ * number of armed deadlines; since almost every task finishes in time, most
+ * timers are disarmed long before they would have been cascaded.
+ *
+ * The thread sleeps until the next occupied level-0 slot or the next wrap,
+ * found through an occupancy bitmap, and not at all while the wheel is
+ * empty. Callbacks run with the wheel unlocked, since cancelling a task
+ * takes scheduler and pool locks and wakes waiters; the slot's timers are
+ * first moved to a private list that disarm can still unlink from, and
+ * disarm of the timer whose callback is in flight waits for it to return.
+ * A callback returning a delay is re-armed for its next escalation stage
+ * unless the timer was disarmed or re-armed meanwhile.
+ */
+
+#include "rift_watchdog.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+
+#define RIFT_WATCHDOG_SLOT_MASK (RIFT_WATCHDOG_SLOTS - 1)
+#define RIFT_WATCHDOG_MAX_DELTA ((1ull << (RIFT_WATCHDOG_LEVELS * RIFT_WATCHDOG_SLOT_BITS)) - 1)
+
+typedef struct {
+    pthread_mutex_t wheel_mutex;          // Guards everything below
+    pthread_cond_t wake;                  // Earlier deadline or stop
+    pthread_cond_t fired;                 // firing callback returned
+    pthread_t thread;
+    rift_watchdog_timer_t* firing;        // Timer whose callback runs unlocked
+    bool firing_disarmed;                 // Disarmed meanwhile: do not re-arm
+    rift_watchdog_timer_t slots[RIFT_WATCHDOG_LEVELS][RIFT_WATCHDOG_SLOTS]; // List heads
+    uint64_t occupied[RIFT_WATCHDOG_SLOTS / 64]; // Non-empty level-0 slots
+    uint64_t current;                     // Last processed tick
+    uint64_t next_wake;                   // Tick the thread sleeps until
+    uint64_t base_ns;                     // CLOCK_MONOTONIC at tick 0
+    pid_t owner;                          // Process running the thread
+    bool running;
+    bool stopping;
+    rift_watchdog_stats_t stats;
+} rift_watchdog_t;
+
+static rift_watchdog_t g_watchdog = {
+    .wheel_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .fired = PTHREAD_COND_INITIALIZER
+};
+
+static uint64_t watchdog_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static uint64_t watchdog_now_tick(void) {
+    return (watchdog_now_ns() - g_watchdog.base_ns) / (RIFT_WATCHDOG_TICK_MS * 1000000ull);
+}
+
+// =============================================================================
+// WHEEL
+// =============================================================================
+
+static void watchdog_link(rift_watchdog_timer_t* head, rift_watchdog_timer_t* timer) {
+    timer->next = head;
+    timer->prev = head->prev;
+    head->prev->next = timer;
+    head->prev = timer;
+}
+
+/**
+ * @brief Unlink timer; clears the level-0 bit when it emptied its slot
+ */
+static void watchdog_unlink(rift_watchdog_timer_t* timer) {
+    rift_watchdog_timer_t* next = timer->next;
+    timer->prev->next = next;
+    next->prev = timer->prev;
+    if (next == timer->prev) {
+        // Only the head is left; its address tells the slot
+        ptrdiff_t index = next - &g_watchdog.slots[0][0];
+        if (index >= 0 && index < RIFT_WATCHDOG_SLOTS) {
+            g_watchdog.occupied[index / 64] &= ~(1ull << (index % 64));
+        }
+    }
+    timer->next = timer->prev = NULL;
+}
+
+/**
+ * @brief Link timer into the level whose range covers its expiry
+ */
+static void watchdog_insert(rift_watchdog_timer_t* timer) {
+    if (timer->expires <= g_watchdog.current) {
+        timer->expires = g_watchdog.current + 1;
+    }
+    uint64_t delta = timer->expires - g_watchdog.current;
+    if (delta > RIFT_WATCHDOG_MAX_DELTA) {
+        timer->expires = g_watchdog.current + RIFT_WATCHDOG_MAX_DELTA;
+        delta = RIFT_WATCHDOG_MAX_DELTA;
+    }
+
+    uint32_t level = 0;
+    while (level < RIFT_WATCHDOG_LEVELS - 1 &&
+           delta >= (1ull << ((level + 1) * RIFT_WATCHDOG_SLOT_BITS))) {
+        level++;
+    }
+    uint32_t slot = (uint32_t)(timer->expires >> (level * RIFT_WATCHDOG_SLOT_BITS)) &
+                    RIFT_WATCHDOG_SLOT_MASK;
+    watchdog_link(&g_watchdog.slots[level][slot], timer);
+    if (level == 0) {
+        g_watchdog.occupied[slot / 64] |= 1ull << (slot % 64);
+    }
+}
+
+/**
+ * @brief Re-insert every timer of one upper-level slot a level lower
+ */
+static void watchdog_cascade(uint32_t level, uint32_t slot) {
+    rift_watchdog_timer_t* head = &g_watchdog.slots[level][slot];
+    rift_watchdog_timer_t* timer = head->next;
+    head->next = head->prev = head;
+    while (timer != head) {
+        rift_watchdog_timer_t* next = timer->next;
+        watchdog_insert(timer);
+        g_watchdog.stats.cascaded++;
+        timer = next;
+    }
+}
+
+/**
+ * @brief First tick after current that needs processing: the next occupied
+ *        level-0 slot in this rotation, else the wrap into the next one
+ */
+static uint64_t watchdog_next_event(void) {
+    uint32_t from = (uint32_t)(g_watchdog.current & RIFT_WATCHDOG_SLOT_MASK) + 1;
+    for (uint32_t word = from / 64; word < RIFT_WATCHDOG_SLOTS / 64; word++) {
+        uint64_t bits = g_watchdog.occupied[word];
+        if (word == from / 64) {
+            bits &= ~0ull << (from % 64);
+        }
+        if (bits) {
+            uint32_t slot = word * 64 + (uint32_t)__builtin_ctzll(bits);
+            return (g_watchdog.current & ~(uint64_t)RIFT_WATCHDOG_SLOT_MASK) | slot;
+        }
+    }
+    return (g_watchdog.current | RIFT_WATCHDOG_SLOT_MASK) + 1;
+}
+
+/**
+ * @brief Fire the timers of one level-0 slot; re-arm those that escalate
+ *
+ * The slot is moved to a list of its own first: timers armed while a
+ * callback runs unlocked may land in this very slot a rotation later, and
+ * the due ones stay armed there so a disarm can still unlink them.
+ */
+static void watchdog_expire_slot(uint32_t slot) {
+    rift_watchdog_timer_t* head = &g_watchdog.slots[0][slot];
+    rift_watchdog_timer_t due;
+    due.next = due.prev = &due;
+    if (head->next != head) {
+        due.next = head->next;
+        due.prev = head->prev;
+        due.next->prev = due.prev->next = &due;
+        head->next = head->prev = head;
+    }
+    g_watchdog.occupied[slot / 64] &= ~(1ull << (slot % 64));
+
+    while (due.next != &due) {
+        rift_watchdog_timer_t* timer = due.next;
+        watchdog_unlink(timer);
+        timer->armed = false;
+        g_watchdog.stats.pending--;
+        g_watchdog.stats.expired++;
+        g_watchdog.firing = timer;
+        g_watchdog.firing_disarmed = false;
+
+        pthread_mutex_unlock(&g_watchdog.wheel_mutex);
+        uint32_t delay_ms = timer->expire(timer);
+        pthread_mutex_lock(&g_watchdog.wheel_mutex);
+        g_watchdog.firing = NULL;
+        pthread_cond_broadcast(&g_watchdog.fired);
+        if (delay_ms > 0 && !g_watchdog.firing_disarmed && !timer->armed) {
+            timer->expires = g_watchdog.current + (delay_ms + RIFT_WATCHDOG_TICK_MS - 1) /
+                                                  RIFT_WATCHDOG_TICK_MS;
+            timer->armed = true;
+            g_watchdog.stats.pending++;
+            watchdog_insert(timer);
+        }
+    }
+}
+
+/**
+ * @brief Process every tick up to now, skipping straight over empty ones
+ */
+static void watchdog_advance(uint64_t now) {
+    while (g_watchdog.current < now) {
+        uint64_t tick = watchdog_next_event();
+        if (tick > now) {
+            g_watchdog.current = now; // Nothing due in between
+            break;
+        }
+        g_watchdog.current = tick;
+
+        uint32_t slot = (uint32_t)(tick & RIFT_WATCHDOG_SLOT_MASK);
+        for (uint32_t level = 1; slot == 0 && level < RIFT_WATCHDOG_LEVELS; level++) {
+            slot = (uint32_t)(tick >> (level * RIFT_WATCHDOG_SLOT_BITS)) & RIFT_WATCHDOG_SLOT_MASK;
+            watchdog_cascade(level, slot);
+        }
+        watchdog_expire_slot((uint32_t)(tick & RIFT_WATCHDOG_SLOT_MASK));
+    }
+}
+
+// =============================================================================
+// WATCHDOG THREAD
+// =============================================================================
+
+static void* watchdog_main(void* arg) {
+    (void)arg;
+    pthread_mutex_lock(&g_watchdog.wheel_mutex);
+    while (!g_watchdog.stopping) {
+        watchdog_advance(watchdog_now_tick());
+
+        if (g_watchdog.stats.pending == 0) {
+            g_watchdog.next_wake = UINT64_MAX;
+            pthread_cond_wait(&g_watchdog.wake, &g_watchdog.wheel_mutex);
+        } else {
+            g_watchdog.next_wake = watchdog_next_event();
+            uint64_t wake_ns = g_watchdog.base_ns +
+                               g_watchdog.next_wake * RIFT_WATCHDOG_TICK_MS * 1000000ull;
+            struct timespec deadline = {
+                .tv_sec = (time_t)(wake_ns / 1000000000ull),
+                .tv_nsec = (long)(wake_ns % 1000000000ull)
+            };
+            pthread_cond_timedwait(&g_watchdog.wake, &g_watchdog.wheel_mutex, &deadline);
+        }
+        g_watchdog.stats.wakeups++;
+    }
+    pthread_mutex_unlock(&g_watchdog.wheel_mutex);
+    return NULL;
+}
+
+// =============================================================================
+// LIFECYCLE
+// =============================================================================
+
+/**
+ * @brief Empty wheel and start the thread; wheel lock held
+ */
+static int watchdog_start(void) {
+    for (uint32_t level = 0; level < RIFT_WATCHDOG_LEVELS; level++) {
+        for (uint32_t slot = 0; slot < RIFT_WATCHDOG_SLOTS; slot++) {
+            rift_watchdog_timer_t* head = &g_watchdog.slots[level][slot];
+            head->next = head->prev = head;
+        }
+    }
+    memset(g_watchdog.occupied, 0, sizeof(g_watchdog.occupied));
+    memset(&g_watchdog.stats, 0, sizeof(g_watchdog.stats));
+    g_watchdog.current = 0;
+    g_watchdog.next_wake = UINT64_MAX;
+    g_watchdog.base_ns = watchdog_now_ns();
+    g_watchdog.stopping = false;
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&g_watchdog.wake, &attr);
+    pthread_condattr_destroy(&attr);
+
+    int result = pthread_create(&g_watchdog.thread, NULL, watchdog_main, NULL);
+    if (result != 0) {
+        fprintf(stderr, "[WATCHDOG] Start failed: %s\n", strerror(result));
+        pthread_cond_destroy(&g_watchdog.wake);
+        return -1;
+    }
+    g_watchdog.owner = getpid();
+    g_watchdog.running = true;
+    printf("[WATCHDOG] Started - %u-level timing wheel, %u ms tick\n",
+           RIFT_WATCHDOG_LEVELS, RIFT_WATCHDOG_TICK_MS);
+    return 0;
+}
+
+int rift_watchdog_arm(rift_watchdog_timer_t* timer, uint32_t timeout_ms,
+                      rift_watchdog_expire_t expire) {
+    pthread_mutex_lock(&g_watchdog.wheel_mutex);
+    if (!g_watchdog.running && watchdog_start() != 0) {
+        pthread_mutex_unlock(&g_watchdog.wheel_mutex);
+        return -1;
+    }
+
+    uint64_t now = watchdog_now_tick();
+    if (timer->armed) {
+        watchdog_unlink(timer);
+    } else if (g_watchdog.stats.pending++ == 0 && now > g_watchdog.current) {
+        g_watchdog.current = now; // Idle thread stopped advancing; nothing to cascade
+    }
+    // Count whole ticks after the one in progress, so a deadline is never early
+    timer->expires = (now > g_watchdog.current ? now : g_watchdog.current) + 1 +
+                     (timeout_ms + RIFT_WATCHDOG_TICK_MS - 1) / RIFT_WATCHDOG_TICK_MS;
+    timer->expire = expire;
+    timer->stage = 0;
+    timer->armed = true;
+    watchdog_insert(timer);
+    g_watchdog.stats.armed++;
+
+    if (timer->expires < g_watchdog.next_wake) {
+        g_watchdog.next_wake = timer->expires;
+        pthread_cond_signal(&g_watchdog.wake);
+    }
+    pthread_mutex_unlock(&g_watchdog.wheel_mutex);
+    return 0;
+}
+
+void rift_watchdog_disarm(rift_watchdog_timer_t* timer) {
+    if (!timer->expire) {
+        return; // Never armed: tasks without a deadline skip the lock
+    }
+    pthread_mutex_lock(&g_watchdog.wheel_mutex);
+    if (timer->armed) {
+        watchdog_unlink(timer);
+        timer->armed = false;
+        g_watchdog.stats.pending--;
+        g_watchdog.stats.disarmed++;
+    } else if (g_watchdog.firing == timer) {
+        g_watchdog.firing_disarmed = true;
+        // A callback disarming its own timer cannot wait for itself
+        while (g_watchdog.firing == timer && !pthread_equal(pthread_self(), g_watchdog.thread)) {
+            pthread_cond_wait(&g_watchdog.fired, &g_watchdog.wheel_mutex);
+        }
+    }
+    pthread_mutex_unlock(&g_watchdog.wheel_mutex);
+}
+
+void rift_watchdog_get_stats(rift_watchdog_stats_t* stats) {
+    pthread_mutex_lock(&g_watchdog.wheel_mutex);
+    *stats = g_watchdog.stats;
+    pthread_mutex_unlock(&g_watchdog.wheel_mutex);
+}
+
+/**
+ * @brief Forget a watchdog inherited across fork(); its thread did not
+ *        survive and its timers guard the parent's tasks
+ */
+void rift_watchdog_forget_parent(void) {
+    // Any parent thread, arming or the watchdog's, may have held the lock
+    // across fork()
+    pthread_mutex_init(&g_watchdog.wheel_mutex, NULL);
+    pthread_cond_init(&g_watchdog.wake, NULL);
+    pthread_cond_init(&g_watchdog.fired, NULL);
+    g_watchdog.firing = NULL;
+    if (!g_watchdog.running || g_watchdog.owner == getpid()) {
+        return;
+    }
+    g_watchdog.running = false;
+}
+
+void rift_watchdog_stop(void) {
+    pthread_mutex_lock(&g_watchdog.wheel_mutex);
+    if (!g_watchdog.running) {
+        pthread_mutex_unlock(&g_watchdog.wheel_mutex);
+        return;
+    }
+    g_watchdog.stopping = true;
+    pthread_cond_signal(&g_watchdog.wake);
+    pthread_mutex_unlock(&g_watchdog.wheel_mutex);
+    pthread_join(g_watchdog.thread, NULL);
+
+    pthread_mutex_lock(&g_watchdog.wheel_mutex);
+    for (uint32_t level = 0; level < RIFT_WATCHDOG_LEVELS; level++) {
+        for (uint32_t slot = 0; slot < RIFT_WATCHDOG_SLOTS; slot++) {
+            rift_watchdog_timer_t* head = &g_watchdog.slots[level][slot];
+            for (rift_watchdog_timer_t* timer = head->next; timer != head;) {
+                rift_watchdog_timer_t* next = timer->next;
+                timer->next = timer->prev = NULL;
+                timer->armed = false;
+                timer = next;
+            }
+            head->next = head->prev = head;
+        }
+    }
+    rift_watchdog_stats_t stats = g_watchdog.stats;
+    g_watchdog.running = false;
+    pthread_cond_destroy(&g_watchdog.wake);
+    pthread_mutex_unlock(&g_watchdog.wheel_mutex);
+
+    printf("[WATCHDOG] Stopped - %lu armed, %lu disarmed in time, %lu expiries, "
+           "%lu cascaded, %lu dropped\n",
+           (unsigned long)stats.armed, (unsigned long)stats.disarmed,
+           (unsigned long)stats.expired, (unsigned long)stats.cascaded,
+           (unsigned long)stats.pending);
+}
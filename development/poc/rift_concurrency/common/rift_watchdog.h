@@ -0,0 +1,84 @@
+/**
+ * @file rift_watchdog.h
+ * @brief Execution Deadline Watchdog Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_WATCHDOG_H
+#define RIFT_WATCHDOG_H
+
+#include "rift_common.h"
+
+#define RIFT_WATCHDOG_LEVELS 4            // Wheel levels; range 2^32 ticks
+#define RIFT_WATCHDOG_SLOT_BITS 8
+#define RIFT_WATCHDOG_SLOTS (1u << RIFT_WATCHDOG_SLOT_BITS)
+#define RIFT_WATCHDOG_TICK_MS 1
+
+typedef struct rift_watchdog_timer rift_watchdog_timer_t;
+
+/**
+ * @brief Deadline expiry callback; runs on the watchdog thread with the
+ *        wheel unlocked, so it may cancel tasks and take their locks, but
+ *        must not wait on a task whose teardown disarms this timer
+ * @param timer Expired timer; the callback advances its stage
+ * @return Milliseconds until the timer fires again, 0 when done
+ */
+typedef uint32_t (*rift_watchdog_expire_t)(rift_watchdog_timer_t* timer);
+
+// Deadline embedded in the task it guards; arming never allocates
+struct rift_watchdog_timer {
+    rift_watchdog_timer_t* next;          // Slot list links
+    rift_watchdog_timer_t* prev;
+    uint64_t expires;                     // Expiry tick
+    rift_watchdog_expire_t expire;        // Escalation callback
+    uint32_t stage;                       // Escalation stage, zeroed on arm
+    bool armed;                           // Linked into the wheel
+};
+
+typedef struct {
+    uint64_t armed;                       // Deadlines armed
+    uint64_t disarmed;                    // Disarmed before expiry
+    uint64_t expired;                     // Callback invocations
+    uint64_t cascaded;                    // Timers moved down a level
+    uint64_t wakeups;                     // Watchdog thread wakeups
+    uint64_t pending;                     // Currently armed
+} rift_watchdog_stats_t;
+
+/**
+ * @brief Arm deadline in O(1), starting the watchdog thread on first use
+ * @param timer Timer embedded in the guarded task (rearmed if armed)
+ * @param timeout_ms Milliseconds until the first expiry
+ * @param expire Escalation callback
+ * @return 0 on success, -1 if the watchdog could not be started
+ */
+int rift_watchdog_arm(rift_watchdog_timer_t* timer, uint32_t timeout_ms,
+                      rift_watchdog_expire_t expire);
+
+/**
+ * @brief Disarm deadline in O(1); once it returns the callback is not
+ *        running and will not run for this timer
+ *
+ * Waits for a callback in flight, so it must not be called holding a lock
+ * the callback takes.
+ * @param timer Armed or unarmed timer
+ */
+void rift_watchdog_disarm(rift_watchdog_timer_t* timer);
+
+/**
+ * @brief Get watchdog statistics
+ * @param stats Output statistics
+ */
+void rift_watchdog_get_stats(rift_watchdog_stats_t* stats);
+
+/**
+ * @brief Drop the inherited watchdog state in a freshly forked child
+ */
+void rift_watchdog_forget_parent(void);
+
+/**
+ * @brief Stop the watchdog thread; armed timers are dropped
+ */
+void rift_watchdog_stop(void);
+
+#endif // RIFT_WATCHDOG_H
@@ -0,0 +1,1034 @@
+/**
+ * @file rift_simulated.c
+ * @brief RIFT Simulated Concurrency - Coroutine Task Management
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Cooperative tasks implemented as ucontext coroutines with guarded stacks.
+ * A task runs on whichever scheduler thread resumes it until it yields or
+ * its work function returns, so the same task object can be driven by the
+ * single-thread scheduler or by the hybrid work-stealing pool.
+ */
+
+#include "rift_simulated.h"
+#include "rift_telemetry.h"
+#include "rift_watchdog.h"
+#include "rift_edf.h"
+#include "rift_cancel.h"
+#include "rift_quota.h"
+#include "rift_simulated_hybrid.h"
+#include "rift_simulated_io.h"
+#include "rift_simulated_replay.h"
+#include "rift_simulated_checkpoint.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <errno.h>
+
+#if defined(__SANITIZE_THREAD__)
+#define SIMULATED_TSAN 1
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define SIMULATED_TSAN 1
+#endif
+#endif
+#ifdef SIMULATED_TSAN
+#include <sanitizer/tsan_interface.h>
+#endif
+
+// =============================================================================
+// TASK REGISTRY
+// =============================================================================
+
+// Live simulated tasks indexed for termination lookup
+typedef struct {
+    rift_simulated_context_t* tasks[RIFT_MAX_THREAD_COUNT];
+    uint32_t task_count;
+    pthread_mutex_t registry_mutex;
+} rift_simulated_registry_t;
+
+static rift_simulated_registry_t g_simulated_registry = {
+    .registry_mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+static bool g_simulated_initialized = false;
+
+// Set in a forked child: the scheduler, hybrid workers and their locks stay
+// the parent's, so spawns there are refused
+static bool g_simulated_forked = false;
+
+// Per scheduler thread: task being resumed and the context to return to
+static __thread rift_simulated_context_t* t_current_task = NULL;
+static __thread ucontext_t* t_return_context = NULL;
+
+/**
+ * @brief Read current task through a call so the TLS address is recomputed
+ *        after a coroutine has migrated between scheduler threads
+ */
+static __attribute__((noinline)) rift_simulated_context_t* simulated_current_task(void) {
+    return t_current_task;
+}
+
+static __attribute__((noinline)) ucontext_t* simulated_return_context(void) {
+    return t_return_context;
+}
+
+/**
+ * @brief Tell ThreadSanitizer a task is switched in; without a fiber per
+ *        task, a task resumed on another thread (a hybrid worker, or the
+ *        caller unwinding parked tasks at cleanup) unwinds frames that
+ *        thread's shadow stack never saw
+ */
+static inline void simulated_fiber_enter(rift_simulated_context_t* task) {
+#ifdef SIMULATED_TSAN
+    if (!task->tsan_fiber) {
+        task->tsan_fiber = __tsan_create_fiber(0);
+    }
+    task->tsan_return_fiber = __tsan_get_current_fiber();
+    __tsan_switch_to_fiber(task->tsan_fiber, 0);
+#else
+    (void)task;
+#endif
+}
+
+/**
+ * @brief Tell ThreadSanitizer a task is switching back to its resumer
+ */
+static inline void simulated_fiber_leave(rift_simulated_context_t* task) {
+#ifdef SIMULATED_TSAN
+    __tsan_switch_to_fiber(task->tsan_return_fiber, 0);
+#else
+    (void)task;
+#endif
+}
+
+// =============================================================================
+// COROUTINE STACKS
+// =============================================================================
+
+// Finished tasks return their stacks here so steady-state spawns avoid the
+// mmap/mprotect/munmap round trip (the guard page split dominates spawn cost)
+#define SIMULATED_STACK_CACHE_SIZE RIFT_MAX_THREAD_COUNT
+
+static struct {
+    void* stacks[SIMULATED_STACK_CACHE_SIZE];
+    uint32_t count;
+    pthread_mutex_t cache_mutex;
+} g_stack_cache = {
+    .cache_mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+/**
+ * @brief Map count stacks of stack_size with one mmap, each with a
+ *        PROT_NONE guard page below it; stacks are released individually
+ * @return 0 on success, -1 on failure (nothing is mapped)
+ */
+static int simulated_stack_map(void** stacks, size_t stack_size, uint32_t count) {
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t stride = stack_size + page_size;
+    uint8_t* region = mmap(NULL, stride * count, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    if (region == MAP_FAILED) {
+        fprintf(stderr, "[SIMULATED] Stack allocation failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (mprotect(region + i * stride, page_size, PROT_NONE) != 0) {
+            munmap(region, stride * count);
+            return -1;
+        }
+        stacks[i] = region + i * stride + page_size;
+    }
+    return 0;
+}
+
+static void simulated_stack_unmap(void* stack_base, size_t stack_size) {
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    munmap((char*)stack_base - page_size, stack_size + page_size);
+}
+
+/**
+ * @brief Take count guarded stacks, recycled ones first
+ * @return 0 on success, -1 on failure
+ */
+static int simulated_stack_alloc(void** stacks, size_t stack_size, uint32_t count) {
+    pthread_mutex_lock(&g_stack_cache.cache_mutex);
+    uint32_t cached = count < g_stack_cache.count ? count : g_stack_cache.count;
+    g_stack_cache.count -= cached;
+    memcpy(stacks, &g_stack_cache.stacks[g_stack_cache.count], cached * sizeof(void*));
+    pthread_mutex_unlock(&g_stack_cache.cache_mutex);
+
+    if (cached < count && simulated_stack_map(stacks + cached, stack_size, count - cached) != 0) {
+        for (uint32_t i = 0; i < cached; i++) {
+            simulated_stack_unmap(stacks[i], stack_size);
+        }
+        return -1;
+    }
+    return 0;
+}
+
+static void simulated_stack_free(void* stack_base, size_t stack_size) {
+    pthread_mutex_lock(&g_stack_cache.cache_mutex);
+    if (stack_size == RIFT_SIMULATED_STACK_SIZE && g_stack_cache.count < SIMULATED_STACK_CACHE_SIZE) {
+        g_stack_cache.stacks[g_stack_cache.count++] = stack_base;
+        stack_base = NULL;
+    }
+    pthread_mutex_unlock(&g_stack_cache.cache_mutex);
+
+    if (stack_base) {
+        simulated_stack_unmap(stack_base, stack_size);
+    }
+}
+
+/**
+ * @brief Take the guarded stack at a given address, from the cache or by
+ *        mapping it there; fails if anything else occupies the range
+ * @return 0 on success, -1 if the range is unavailable
+ */
+static int simulated_stack_claim(void* stack_base, size_t stack_size) {
+    pthread_mutex_lock(&g_stack_cache.cache_mutex);
+    for (uint32_t i = 0; i < g_stack_cache.count; i++) {
+        if (g_stack_cache.stacks[i] == stack_base && stack_size == RIFT_SIMULATED_STACK_SIZE) {
+            g_stack_cache.stacks[i] = g_stack_cache.stacks[--g_stack_cache.count];
+            pthread_mutex_unlock(&g_stack_cache.cache_mutex);
+            return 0;
+        }
+    }
+    pthread_mutex_unlock(&g_stack_cache.cache_mutex);
+
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    uint8_t* guard = (uint8_t*)stack_base - page_size;
+    uint8_t* region = mmap(guard, stack_size + page_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK | MAP_FIXED_NOREPLACE, -1, 0);
+    if (region == MAP_FAILED) {
+        return -1;
+    }
+    // Kernels before 4.17 treat the address as a hint
+    if (region != guard || mprotect(region, page_size, PROT_NONE) != 0) {
+        munmap(region, stack_size + page_size);
+        return -1;
+    }
+    return 0;
+}
+
+static void simulated_stack_cache_drain(void) {
+    pthread_mutex_lock(&g_stack_cache.cache_mutex);
+    while (g_stack_cache.count > 0) {
+        simulated_stack_unmap(g_stack_cache.stacks[--g_stack_cache.count], RIFT_SIMULATED_STACK_SIZE);
+    }
+    pthread_mutex_unlock(&g_stack_cache.cache_mutex);
+}
+
+/**
+ * @brief Coroutine entry point; never returns through uc_link because the
+ *        finishing scheduler thread may differ from the starting one
+ */
+static void simulated_task_entry(void) {
+    rift_simulated_context_t* task = simulated_current_task();
+
+    task->work_function(task->work_data);
+
+    // Reload: a frame restored from a checkpoint finishes under a new context
+    task = simulated_current_task();
+    task->state = SIMULATED_TASK_FINISHED;
+    simulated_fiber_leave(task);
+    setcontext(simulated_return_context());
+}
+
+// =============================================================================
+// INITIALIZATION
+// =============================================================================
+
+static void simulated_atfork_child(void) {
+    g_simulated_forked = true;
+}
+
+bool rift_simulated_forked_child(void) {
+    return g_simulated_forked;
+}
+
+/**
+ * @brief Initialize simulated concurrency subsystem
+ */
+int rift_simulated_init(void) {
+    if (g_simulated_initialized) {
+        return 0;
+    }
+
+    static bool atfork_registered = false;
+    if (!atfork_registered && pthread_atfork(NULL, NULL, simulated_atfork_child) == 0) {
+        atfork_registered = true;
+    }
+
+    if (rift_telemetry_init() != 0) {
+        fprintf(stderr, "[SIMULATED] Telemetry initialization failed\n");
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_simulated_registry.registry_mutex);
+    memset(g_simulated_registry.tasks, 0, sizeof(g_simulated_registry.tasks));
+    g_simulated_registry.task_count = 0;
+    pthread_mutex_unlock(&g_simulated_registry.registry_mutex);
+
+    if (rift_simulated_scheduler_init() != 0) {
+        return -1;
+    }
+
+    g_simulated_initialized = true;
+    printf("[SIMULATED] Initialized - cooperative coroutine scheduler ready\n");
+    return 0;
+}
+
+// =============================================================================
+// TASK CREATION AND DESTRUCTION
+// =============================================================================
+
+static ucontext_t g_coroutine_template;
+static pthread_once_t g_coroutine_template_once = PTHREAD_ONCE_INIT;
+
+static void simulated_capture_template(void) {
+    getcontext(&g_coroutine_template);
+}
+
+/**
+ * @brief Depth of a child of parent_id, 0 when rejected by policy
+ * @return Child depth on success, -1 if the policy depth cap is exceeded
+ */
+static int simulated_child_depth(uint64_t parent_id, const rift_governance_policy_t* policy) {
+    uint32_t depth = rift_telemetry_child_depth(parent_id);
+
+    if (policy->trace_capped && depth > policy->max_hierarchy_depth) {
+        printf("[SIMULATED] Spawn rejected: depth %u exceeds policy limit %u\n",
+               depth, policy->max_hierarchy_depth);
+        return -1;
+    }
+    return (int)depth;
+}
+
+/**
+ * @brief Allocate task and coroutine on a caller-provided stack
+ */
+static rift_simulated_context_t* simulated_task_alloc(void* stack_base, uint64_t parent_id,
+                                                      uint32_t depth,
+                                                      const rift_governance_policy_t* policy,
+                                                      void (*work_func)(void*),
+                                                      void* work_data) {
+    rift_simulated_context_t* task = calloc(1, sizeof(rift_simulated_context_t));
+    if (!task) {
+        return NULL;
+    }
+
+    task->stack_size = RIFT_SIMULATED_STACK_SIZE;
+    task->stack_base = stack_base;
+
+    // Copy a captured context instead of calling getcontext() per task
+    pthread_once(&g_coroutine_template_once, simulated_capture_template);
+    task->coroutine = g_coroutine_template;
+    task->coroutine.uc_stack.ss_sp = task->stack_base;
+    task->coroutine.uc_stack.ss_size = task->stack_size;
+    task->coroutine.uc_link = NULL;
+    makecontext(&task->coroutine, simulated_task_entry, 0);
+
+    task->work_function = work_func;
+    task->work_data = work_data;
+    task->time_slice_us = RIFT_SIMULATED_TIME_SLICE_US;
+    task->state = SIMULATED_TASK_READY;
+    atomic_init(&task->park_state, RIFT_PARK_NONE);
+    atomic_flag_clear(&task->cancel_lock);
+
+    task->base_context.policy = *policy;
+    task->base_context.telemetry.parent_rift_id = parent_id;
+    task->base_context.telemetry.parent_process_id = getpid();
+    task->base_context.telemetry.hierarchy_depth = depth;
+    task->base_context.telemetry.is_daemon = policy->daemon_mode;
+    task->base_context.module_specific_data = task;
+    return task;
+}
+
+/**
+ * @brief Deadline of a new single-thread scheduler task; hybrid workers
+ *        run in queue order and take none
+ * @return 0 on success, -1 if an EDF policy gives no deadline
+ */
+static int simulated_resolve_deadline(uint64_t parent_id, const rift_governance_policy_t* policy,
+                                      uint64_t* deadline_ns) {
+    *deadline_ns = 0;
+    if (policy->mode == CONCURRENCY_HYBRID) {
+        return 0;
+    }
+    return rift_edf_resolve(parent_id, policy, deadline_ns);
+}
+
+/**
+ * @brief Watchdog callback: a task past max_execution_time_ms is asked to
+ *        stop and reaped at its next scheduling point
+ */
+static uint32_t simulated_deadline_expired(rift_watchdog_timer_t* timer) {
+    rift_simulated_context_t* task =
+        (rift_simulated_context_t*)((char*)timer - offsetof(rift_simulated_context_t, deadline));
+    rift_cancel_context(&task->base_context);
+    printf("[WATCHDOG] RIFT ID %lu exceeded %u ms\n",
+           (unsigned long)task->base_context.telemetry.rift_thread_id,
+           task->base_context.policy.max_execution_time_ms);
+    return 0;
+}
+
+/**
+ * @brief Cancellation hook: wake the task if it is parked in a cancellable
+ *        wait and the canceller wins that wait's claim
+ */
+static void simulated_cancel_interrupt(rift_cancel_token_t* token) {
+    rift_simulated_context_t* task = (rift_simulated_context_t*)((char*)token -
+        offsetof(rift_simulated_context_t, base_context.cancel));
+
+    bool claimed = false;
+    while (atomic_flag_test_and_set_explicit(&task->cancel_lock, memory_order_acquire)) {
+    }
+    if (task->cancel_claim && atomic_exchange(task->cancel_claim, 1) == 0) {
+        task->cancel_claimed = true;
+        claimed = true;
+    }
+    atomic_flag_clear_explicit(&task->cancel_lock, memory_order_release);
+
+    if (claimed) {
+        rift_simulated_wake(task);
+    }
+}
+
+/**
+ * @brief Copy registered IDs into context and insert tasks into the registry
+ */
+static void simulated_task_publish(rift_simulated_context_t** tasks, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        rift_simulated_context_t* task = tasks[i];
+        task->base_context.policy.rift_id = task->base_context.telemetry.rift_thread_id;
+        task->base_context.last_heartbeat = task->base_context.telemetry.spawn_time;
+        rift_cancel_attach(&task->base_context, simulated_cancel_interrupt);
+        if (task->base_context.policy.max_execution_time_ms > 0) {
+            rift_watchdog_arm(&task->deadline, task->base_context.policy.max_execution_time_ms,
+                              simulated_deadline_expired);
+        }
+    }
+
+    pthread_mutex_lock(&g_simulated_registry.registry_mutex);
+    uint32_t inserted = 0;
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT && inserted < count; i++) {
+        if (!g_simulated_registry.tasks[i]) {
+            g_simulated_registry.tasks[i] = tasks[inserted++];
+        }
+    }
+    g_simulated_registry.task_count += inserted;
+    pthread_mutex_unlock(&g_simulated_registry.registry_mutex);
+}
+
+/**
+ * @brief Create simulated task with governance validation and telemetry
+ */
+rift_simulated_context_t* rift_simulated_create_task(uint64_t parent_id,
+                                                     const rift_governance_policy_t* policy,
+                                                     void (*work_func)(void*),
+                                                     void* work_data,
+                                                     const char* spawn_location) {
+    if (!policy || !work_func || !spawn_location) {
+        return NULL;
+    }
+
+    if (!rift_telemetry_validate_spawn(parent_id, policy)) {
+        return NULL;
+    }
+
+    int depth = simulated_child_depth(parent_id, policy);
+    uint64_t deadline_ns;
+    if (depth < 0 || simulated_resolve_deadline(parent_id, policy, &deadline_ns) != 0) {
+        return NULL;
+    }
+
+    void* stack_base;
+    if (simulated_stack_alloc(&stack_base, RIFT_SIMULATED_STACK_SIZE, 1) != 0) {
+        return NULL;
+    }
+
+    rift_simulated_context_t* task = simulated_task_alloc(stack_base, parent_id, (uint32_t)depth,
+                                                          policy, work_func, work_data);
+    if (!task) {
+        simulated_stack_free(stack_base, RIFT_SIMULATED_STACK_SIZE);
+        return NULL;
+    }
+
+    task->base_context.telemetry.deadline_ns = deadline_ns;
+    if (deadline_ns != 0 && rift_simulated_scheduler_admit(task) != 0) {
+        simulated_stack_free(task->stack_base, task->stack_size);
+        free(task);
+        return NULL;
+    }
+
+    if (rift_quota_charge(&task->base_context) != 0 ||
+        rift_telemetry_register_spawn(&task->base_context, spawn_location) != 0) {
+        rift_quota_release(&task->base_context);
+        rift_simulated_scheduler_release(task);
+        simulated_stack_free(task->stack_base, task->stack_size);
+        free(task);
+        return NULL;
+    }
+
+    if (parent_id != 0) {
+        rift_telemetry_add_child(parent_id, task->base_context.telemetry.rift_thread_id,
+                                 spawn_location);
+    }
+
+    simulated_task_publish(&task, 1);
+    return task;
+}
+
+/**
+ * @brief Create count tasks with one admission check, one contiguous ID
+ *        reservation, one telemetry pass and at most one stack mapping
+ * @return Number of tasks created (count or 0)
+ */
+uint32_t rift_simulated_create_task_batch(uint64_t parent_id,
+                                          const rift_governance_policy_t* policy,
+                                          void (*work_func)(void*),
+                                          void** data_array,
+                                          uint32_t count,
+                                          const char* spawn_location,
+                                          rift_simulated_context_t** tasks) {
+    if (!policy || !work_func || !spawn_location || !tasks ||
+        count == 0 || count > RIFT_MAX_THREAD_COUNT) {
+        return 0;
+    }
+
+    if (!rift_telemetry_validate_spawn_batch(parent_id, policy, count)) {
+        return 0;
+    }
+
+    int depth = simulated_child_depth(parent_id, policy);
+    uint64_t deadline_ns;
+    if (depth < 0 || simulated_resolve_deadline(parent_id, policy, &deadline_ns) != 0) {
+        return 0;
+    }
+
+    void* stacks[RIFT_MAX_THREAD_COUNT];
+    if (simulated_stack_alloc(stacks, RIFT_SIMULATED_STACK_SIZE, count) != 0) {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        tasks[i] = simulated_task_alloc(stacks[i], parent_id, (uint32_t)depth, policy,
+                                        work_func, data_array ? data_array[i] : NULL);
+        if (!tasks[i]) {
+            for (uint32_t j = 0; j < count; j++) {
+                if (j < i) {
+                    free(tasks[j]);
+                }
+                simulated_stack_free(stacks[j], RIFT_SIMULATED_STACK_SIZE);
+            }
+            return 0;
+        }
+        tasks[i]->base_context.telemetry.deadline_ns = deadline_ns;
+    }
+
+    // The whole batch is admitted or none of it
+    uint32_t admitted = 0;
+    while (deadline_ns != 0 && admitted < count &&
+           rift_simulated_scheduler_admit(tasks[admitted]) == 0) {
+        admitted++;
+    }
+    bool rejected = deadline_ns != 0 && admitted < count;
+
+    rift_thread_context_t* contexts[RIFT_MAX_THREAD_COUNT];
+    for (uint32_t i = 0; i < count; i++) {
+        contexts[i] = &tasks[i]->base_context;
+    }
+
+    if (rejected || rift_quota_charge_batch(contexts, count) != 0 ||
+        rift_telemetry_register_spawn_batch(contexts, count, spawn_location) != 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            rift_quota_release(contexts[i]);
+            rift_simulated_scheduler_release(tasks[i]);
+            simulated_stack_free(tasks[i]->stack_base, tasks[i]->stack_size);
+            free(tasks[i]);
+        }
+        return 0;
+    }
+
+    if (parent_id != 0) {
+        rift_telemetry_add_children(parent_id, tasks[0]->base_context.telemetry.rift_thread_id,
+                                    count, spawn_location);
+    }
+
+    simulated_task_publish(tasks, count);
+    return count;
+}
+
+/**
+ * @brief Take the task stack at a given address out of circulation
+ */
+int rift_simulated_claim_stack(void* stack_base) {
+    return simulated_stack_claim(stack_base, RIFT_SIMULATED_STACK_SIZE);
+}
+
+void rift_simulated_release_stack(void* stack_base) {
+    simulated_stack_free(stack_base, RIFT_SIMULATED_STACK_SIZE);
+}
+
+/**
+ * @brief Move a created task onto a claimed stack and resume it from a
+ *        saved coroutine instead of its entry point
+ */
+void rift_simulated_adopt_stack(rift_simulated_context_t* task, void* stack_base,
+                                const ucontext_t* coroutine) {
+    simulated_stack_free(task->stack_base, task->stack_size);
+    task->stack_base = stack_base;
+    task->coroutine = *coroutine;
+    task->coroutine.uc_stack.ss_sp = stack_base;
+    task->coroutine.uc_stack.ss_size = task->stack_size;
+#if defined(__x86_64__)
+    // The saved FPU state pointer refers into the context it was saved in
+    task->coroutine.uc_mcontext.fpregs = &task->coroutine.__fpregs_mem;
+#endif
+}
+
+/**
+ * @brief Copy the registered tasks of one scheduler: hybrid tasks or
+ *        single-thread ones
+ */
+static uint32_t simulated_list(rift_simulated_context_t** tasks, uint32_t capacity,
+                               bool hybrid) {
+    uint32_t count = 0;
+    pthread_mutex_lock(&g_simulated_registry.registry_mutex);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT && count < capacity; i++) {
+        rift_simulated_context_t* task = g_simulated_registry.tasks[i];
+        if (task && (task->base_context.policy.mode == CONCURRENCY_HYBRID) == hybrid) {
+            tasks[count++] = task;
+        }
+    }
+    pthread_mutex_unlock(&g_simulated_registry.registry_mutex);
+    return count;
+}
+
+/**
+ * @brief Copy single-thread tasks from the registry; hybrid tasks belong to
+ *        their workers
+ */
+uint32_t rift_simulated_list_tasks(rift_simulated_context_t** tasks, uint32_t capacity) {
+    return simulated_list(tasks, capacity, false);
+}
+
+uint32_t rift_simulated_list_hybrid_tasks(rift_simulated_context_t** tasks, uint32_t capacity) {
+    return simulated_list(tasks, capacity, true);
+}
+
+/**
+ * @brief List single-thread tasks and keep the registry and run queue held
+ *        until after fork(): no listed task is freed, and no wake or spawn
+ *        from another thread changes the queue, before the child copies it
+ */
+uint32_t rift_simulated_fork_hold(rift_simulated_context_t** tasks, uint32_t capacity) {
+    pthread_mutex_lock(&g_simulated_registry.registry_mutex);
+    rift_simulated_scheduler_fork_hold();
+    uint32_t count = 0;
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT && count < capacity; i++) {
+        rift_simulated_context_t* task = g_simulated_registry.tasks[i];
+        if (task && task->base_context.policy.mode != CONCURRENCY_HYBRID) {
+            tasks[count++] = task;
+        }
+    }
+    return count;
+}
+
+void rift_simulated_fork_release(bool in_child) {
+    rift_simulated_scheduler_fork_release(in_child);
+    if (in_child) {
+        // Copied held by the forking thread, the only one the child has
+        pthread_mutex_init(&g_simulated_registry.registry_mutex, NULL);
+    } else {
+        pthread_mutex_unlock(&g_simulated_registry.registry_mutex);
+    }
+}
+
+/**
+ * @brief Release task stack, registry slot and telemetry entry
+ */
+void rift_simulated_destroy_task(rift_simulated_context_t* task) {
+    if (!task) {
+        return;
+    }
+
+    // No interrupt hook or watchdog callback may run once these return
+    rift_cancel_detach(&task->base_context);
+    rift_watchdog_disarm(&task->deadline);
+    pthread_mutex_lock(&g_simulated_registry.registry_mutex);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        if (g_simulated_registry.tasks[i] == task) {
+            g_simulated_registry.tasks[i] = NULL;
+            g_simulated_registry.task_count--;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_simulated_registry.registry_mutex);
+
+    rift_simulated_scheduler_release(task);
+    rift_telemetry_unregister(task->base_context.telemetry.rift_thread_id);
+    rift_quota_release(&task->base_context);
+
+    simulated_stack_free(task->stack_base, task->stack_size);
+#ifdef SIMULATED_TSAN
+    if (task->tsan_fiber) {
+        __tsan_destroy_fiber(task->tsan_fiber);
+    }
+#endif
+    free(task);
+}
+
+/**
+ * @brief Spawn count tasks that share a work function, one per data item
+ * @return RIFT ID of the first task; the batch holds IDs first..first+count-1
+ */
+uint64_t rift_simulated_spawn_batch(uint64_t parent_id,
+                                    const rift_governance_policy_t* policy,
+                                    void (*work_func)(void*),
+                                    void** data_array,
+                                    uint32_t count,
+                                    const char* spawn_location) {
+    if (g_simulated_forked) {
+        fprintf(stderr, "[SIMULATED] Spawn rejected: runtime belongs to the parent process\n");
+        return 0;
+    }
+    if (policy && policy->mode == CONCURRENCY_HYBRID) {
+        return rift_hybrid_spawn_batch(parent_id, policy, work_func, data_array, count,
+                                       spawn_location);
+    }
+    if (policy && policy->mode == CONCURRENCY_AUTO) {
+        fprintf(stderr, "[SIMULATED] CONCURRENCY_AUTO spawns go through rift_auto_spawn()\n");
+        return 0;
+    }
+
+    if (!policy || count == 0 || count > RIFT_MAX_THREAD_COUNT) {
+        return 0;
+    }
+
+    int throttle = rift_simulated_scheduler_throttle(policy, count);
+    if (throttle < 0) {
+        return 0;
+    }
+
+    rift_simulated_context_t* tasks[RIFT_MAX_THREAD_COUNT];
+    if (rift_simulated_create_task_batch(parent_id, policy, work_func, data_array, count,
+                                         spawn_location, tasks) != count) {
+        return 0;
+    }
+
+    uint64_t first_id = tasks[0]->base_context.telemetry.rift_thread_id;
+    for (uint32_t i = 0; i < count; i++) {
+        rift_replay_on_spawn(tasks[i]);
+    }
+    if (throttle > 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            rift_simulated_scheduler_run_inline(tasks[i]);
+        }
+        return first_id;
+    }
+    rift_simulated_scheduler_enqueue_batch(tasks, count);
+    return first_id;
+}
+
+/**
+ * @brief Create new simulated concurrent task and queue it for execution
+ */
+uint64_t rift_simulated_spawn(uint64_t parent_id,
+                              const rift_governance_policy_t* policy,
+                              void (*work_func)(void*),
+                              void* work_data,
+                              const char* spawn_location) {
+    if (g_simulated_forked) {
+        fprintf(stderr, "[SIMULATED] Spawn rejected: runtime belongs to the parent process\n");
+        return 0;
+    }
+    if (policy && policy->mode == CONCURRENCY_HYBRID) {
+        return rift_hybrid_spawn(parent_id, policy, work_func, work_data, spawn_location);
+    }
+    if (policy && policy->mode == CONCURRENCY_AUTO) {
+        fprintf(stderr, "[SIMULATED] CONCURRENCY_AUTO spawns go through rift_auto_spawn()\n");
+        return 0;
+    }
+
+    int throttle = policy ? rift_simulated_scheduler_throttle(policy, 1) : 0;
+    if (throttle < 0) {
+        return 0;
+    }
+
+    rift_simulated_context_t* task = rift_simulated_create_task(parent_id, policy, work_func,
+                                                                work_data, spawn_location);
+    if (!task) {
+        return 0;
+    }
+
+    uint64_t rift_id = task->base_context.telemetry.rift_thread_id;
+    rift_replay_on_spawn(task);
+    if (throttle > 0) {
+        rift_simulated_scheduler_run_inline(task); // May finish and free the task
+    } else {
+        rift_simulated_scheduler_enqueue(task);
+    }
+    return rift_id;
+}
+
+// =============================================================================
+// COROUTINE EXECUTION
+// =============================================================================
+
+/**
+ * @brief Run task on the calling thread until it yields or finishes; may
+ *        be nested inside another task (caller-runs spawns). A cancelled
+ *        task is reaped here unless it is returning from a cancellable wait
+ *        or withdrawing one, which it is left to unwind.
+ */
+rift_simulated_task_state_t rift_simulated_resume(rift_simulated_context_t* task) {
+    if (rift_cancel_requested(&task->base_context.cancel) && !task->cancel_claim &&
+        !task->cancel_withdrawing) {
+        task->state = SIMULATED_TASK_FINISHED;
+        return task->state;
+    }
+
+    ucontext_t scheduler_context;
+    rift_simulated_context_t* outer_task = t_current_task;
+    ucontext_t* outer_return = t_return_context;
+    t_current_task = task;
+    t_return_context = &scheduler_context;
+    rift_thread_context_t* outer_context = rift_current_swap(&task->base_context);
+
+    task->state = SIMULATED_TASK_RUNNING;
+    task->yield_requested = false;
+    clock_gettime(CLOCK_MONOTONIC, &task->base_context.last_heartbeat);
+
+    simulated_fiber_enter(task);
+    swapcontext(&scheduler_context, &task->coroutine);
+
+    t_current_task = outer_task;
+    t_return_context = outer_return;
+    rift_current_swap(outer_context);
+
+    task->base_context.context_switches++;
+    task->current_slice++;
+
+    rift_simulated_task_state_t state = task->state;
+    if (state == SIMULATED_TASK_RUNNING) {
+        state = SIMULATED_TASK_READY;
+        task->state = state;
+    } else if (state == SIMULATED_TASK_PARKED) {
+        // Hand the task to its waker; it must not be touched after this CAS
+        int expected = RIFT_PARK_PENDING;
+        if (!atomic_compare_exchange_strong(&task->park_state, &expected, RIFT_PARK_COMMITTED)) {
+            // Woken before the switch completed: reschedule like a yield
+            atomic_store(&task->park_state, RIFT_PARK_NONE);
+            state = SIMULATED_TASK_READY;
+            task->state = state;
+        }
+    }
+    return state;
+}
+
+/**
+ * @brief Request cooperative yield from current task
+ */
+void rift_simulated_yield(void) {
+    rift_simulated_context_t* task = simulated_current_task();
+    if (!task) {
+        return; // Not inside a simulated task
+    }
+
+    task->yield_requested = true;
+    simulated_fiber_leave(task);
+    swapcontext(&task->coroutine, simulated_return_context());
+}
+
+// =============================================================================
+// PARKING AND WAKEUP
+// =============================================================================
+
+/**
+ * @brief Announce that the current task is about to park; must precede
+ *        publishing the task to any waker so an early wake is not lost
+ */
+void rift_simulated_park_prepare(void) {
+    rift_simulated_context_t* task = simulated_current_task();
+    if (task) {
+        atomic_store(&task->park_state, RIFT_PARK_PENDING);
+    }
+}
+
+/**
+ * @brief Withdraw a prepared park that was never published to a waker
+ */
+void rift_simulated_park_cancel(void) {
+    rift_simulated_context_t* task = simulated_current_task();
+    if (task) {
+        atomic_store(&task->park_state, RIFT_PARK_NONE);
+    }
+}
+
+/**
+ * @brief Suspend current task until rift_simulated_wake()
+ */
+void rift_simulated_park(void) {
+    rift_simulated_context_t* task = simulated_current_task();
+    if (!task) {
+        return;
+    }
+
+    task->state = SIMULATED_TASK_PARKED;
+    simulated_fiber_leave(task);
+    swapcontext(&task->coroutine, simulated_return_context());
+}
+
+/**
+ * @brief Park in a wait cancellation may end; the claim is published to the
+ *        interrupt hook under cancel_lock, and the token is checked after
+ *        publishing so a cancel landing in between is not lost
+ */
+bool rift_simulated_park_cancellable(_Atomic int* claim) {
+    rift_simulated_context_t* task = simulated_current_task();
+    if (!task) {
+        return false;
+    }
+
+    task->cancel_claimed = false;
+    while (atomic_flag_test_and_set_explicit(&task->cancel_lock, memory_order_acquire)) {
+    }
+    task->cancel_claim = claim;
+    atomic_flag_clear_explicit(&task->cancel_lock, memory_order_release);
+
+    if (rift_cancel_requested(&task->base_context.cancel) && atomic_exchange(claim, 1) == 0) {
+        rift_simulated_park_cancel(); // Cancelled before parking: nobody will wake us
+        task->cancel_claimed = true;
+    } else {
+        rift_simulated_park();
+    }
+
+    // The task may have migrated; reload it
+    task = simulated_current_task();
+    while (atomic_flag_test_and_set_explicit(&task->cancel_lock, memory_order_acquire)) {
+    }
+    task->cancel_claim = NULL;
+    atomic_flag_clear_explicit(&task->cancel_lock, memory_order_release);
+    return task->cancel_claimed;
+}
+
+// Stack record of a cancellable sleep
+typedef struct {
+    rift_watchdog_timer_t timer;
+    rift_simulated_context_t* task;
+    _Atomic int claim;                    // Timer and canceller race for it
+} rift_simulated_sleep_t;
+
+static uint32_t simulated_sleep_expired(rift_watchdog_timer_t* timer) {
+    rift_simulated_sleep_t* sleep =
+        (rift_simulated_sleep_t*)((char*)timer - offsetof(rift_simulated_sleep_t, timer));
+    if (atomic_exchange(&sleep->claim, 1) == 0) {
+        rift_simulated_wake(sleep->task);
+    }
+    return 0;
+}
+
+/**
+ * @brief Park on a watchdog timer instead of blocking the scheduler thread
+ */
+int rift_simulated_sleep_ms(uint32_t timeout_ms) {
+    rift_simulated_context_t* task = simulated_current_task();
+    if (!task) {
+        return rift_sleep_ms(timeout_ms);
+    }
+
+    rift_simulated_sleep_t sleep = { .task = task };
+    atomic_init(&sleep.claim, 0);
+    rift_simulated_park_prepare();
+    if (rift_watchdog_arm(&sleep.timer, timeout_ms, simulated_sleep_expired) != 0) {
+        rift_simulated_park_cancel();
+        return rift_cancel_requested(&task->base_context.cancel) ? -1 : 0;
+    }
+    bool cancelled = rift_simulated_park_cancellable(&sleep.claim);
+    rift_watchdog_disarm(&sleep.timer); // Barrier against a callback in flight
+    return cancelled ? -1 : 0;
+}
+
+/**
+ * @brief Make parked task runnable on the scheduler that owns its mode
+ */
+void rift_simulated_wake(rift_simulated_context_t* task) {
+    int expected = RIFT_PARK_PENDING;
+    if (atomic_compare_exchange_strong(&task->park_state, &expected, RIFT_PARK_WOKEN)) {
+        return; // Still switching out; the resuming thread requeues it
+    }
+
+    if (expected != RIFT_PARK_COMMITTED ||
+        !atomic_compare_exchange_strong(&task->park_state, &expected, RIFT_PARK_NONE)) {
+        return; // Not parked, or another waker won
+    }
+
+    task->state = SIMULATED_TASK_READY;
+    if (task->base_context.policy.mode == CONCURRENCY_HYBRID) {
+        rift_hybrid_requeue(task);
+    } else {
+        rift_replay_on_wake(task);
+        rift_simulated_scheduler_enqueue(task);
+    }
+}
+
+/**
+ * @brief Task currently running on the calling thread, NULL outside tasks
+ */
+rift_simulated_context_t* rift_simulated_current(void) {
+    return simulated_current_task();
+}
+
+// =============================================================================
+// TERMINATION AND CLEANUP
+// =============================================================================
+
+/**
+ * @brief Terminate simulated task and its subtree; each is reaped at its
+ *        next scheduling point, or woken out of a cancellable wait to unwind
+ */
+int rift_simulated_terminate(uint64_t rift_id) {
+    bool found = false;
+
+    pthread_mutex_lock(&g_simulated_registry.registry_mutex);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        rift_simulated_context_t* task = g_simulated_registry.tasks[i];
+        if (task && task->base_context.telemetry.rift_thread_id == rift_id) {
+            found = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_simulated_registry.registry_mutex);
+
+    // By ID, outside the registry lock: the task may finish meanwhile
+    int result = found ? rift_cancel(rift_id) : -1;
+    if (result == 0) {
+        printf("[SIMULATED] Termination requested for RIFT ID %lu\n", rift_id);
+    }
+    return result;
+}
+
+/**
+ * @brief Clean up simulated concurrency subsystem
+ */
+void rift_simulated_cleanup(void) {
+    if (!g_simulated_initialized) {
+        return;
+    }
+
+    rift_checkpoint_wait();
+    rift_hybrid_cleanup();
+    rift_simulated_scheduler_cleanup();
+    rift_simulated_io_cleanup();
+    simulated_stack_cache_drain();
+    rift_watchdog_stop();
+
+    g_simulated_initialized = false;
+    printf("[SIMULATED] Cleanup complete\n");
+}
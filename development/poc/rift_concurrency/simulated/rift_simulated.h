@@ -0,0 +1,359 @@
+/**
+ * @file rift_simulated.h
+ * @brief Simulated Concurrency Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_SIMULATED_H
+#define RIFT_SIMULATED_H
+
+#include "rift_common.h"
+#include "rift_watchdog.h"
+#include <stdatomic.h>
+#include <ucontext.h>
+
+#define RIFT_SIMULATED_STACK_SIZE (64 * 1024)
+#define RIFT_SIMULATED_TIME_SLICE_US 1000
+
+// Simulated task lifecycle
+typedef enum {
+    SIMULATED_TASK_READY,                 // Runnable, waiting for a slice
+    SIMULATED_TASK_RUNNING,               // Executing on a scheduler thread
+    SIMULATED_TASK_PARKED,                // Suspended until explicitly woken
+    SIMULATED_TASK_FINISHED               // Returned or terminated
+} rift_simulated_task_state_t;
+
+// Park handshake between a parking task and its waker
+enum {
+    RIFT_PARK_NONE,                       // Not parking
+    RIFT_PARK_PENDING,                    // Published to waker, still switching out
+    RIFT_PARK_WOKEN,                      // Woken before the switch completed
+    RIFT_PARK_COMMITTED                   // Fully suspended, waker requeues
+};
+
+// Simulated concurrency specific structures
+typedef struct rift_simulated_context {
+    rift_thread_context_t base_context;   // Common thread context
+    uint32_t time_slice_us;               // Time slice in microseconds
+    uint32_t current_slice;               // Current time slice counter
+    bool yield_requested;                 // Cooperative yield flag
+    void (*work_function)(void*);         // Work function pointer
+    void* work_data;                      // Work function data
+    rift_simulated_task_state_t state;    // Scheduler lifecycle state
+    ucontext_t coroutine;                 // Saved coroutine execution state
+    void* stack_base;                     // Coroutine stack (above guard page)
+    size_t stack_size;                    // Coroutine stack size in bytes
+    _Atomic int park_state;               // RIFT_PARK_* handshake state
+    _Atomic int* cancel_claim;            // Claim word of a cancellable park, else NULL
+    bool cancel_claimed;                  // Cancellation won the claim and woke us
+    bool cancel_withdrawing;              // Withdrawing a cancelled wait; not reaped meanwhile
+    atomic_flag cancel_lock;              // Guards cancel_claim against the interrupt hook
+    uint32_t spawn_ordinal;               // Spawn sequence number for record/replay
+    rift_watchdog_timer_t deadline;       // max_execution_time_ms watchdog
+    void* tsan_fiber;                     // ThreadSanitizer builds: the task's fiber
+    void* tsan_return_fiber;              // ThreadSanitizer builds: fiber that resumed it
+    struct rift_simulated_context* next;  // Run queue linkage
+} rift_simulated_context_t;
+
+/**
+ * @brief Initialize simulated concurrency subsystem
+ * @return 0 on success, error code otherwise
+ */
+int rift_simulated_init(void);
+
+/**
+ * @brief Whether this process was forked from the one that initialized the
+ *        runtime. Its scheduler, hybrid workers and their locks were left in
+ *        the parent, so a forked task may not use the simulated or hybrid
+ *        modes: their spawns fail there.
+ * @return true in a forked child
+ */
+bool rift_simulated_forked_child(void);
+
+/**
+ * @brief Create new simulated concurrent task
+ * @param parent_id Parent RIFT thread ID (0 for root)
+ * @param policy Governance policy for new task
+ * @param work_func Work function to execute
+ * @param work_data Data to pass to work function
+ * @param spawn_location Source location of spawn
+ * @return RIFT thread ID on success, 0 on failure (CONCURRENCY_AUTO policies
+ *         are refused; they spawn through rift_auto_spawn())
+ */
+uint64_t rift_simulated_spawn(uint64_t parent_id, 
+                              const rift_governance_policy_t* policy,
+                              void (*work_func)(void*), 
+                              void* work_data,
+                              const char* spawn_location);
+
+/**
+ * @brief Spawn batch of simulated tasks sharing one work function
+ * @param parent_id Parent RIFT thread ID (0 for root)
+ * @param policy Governance policy for every task
+ * @param work_func Work function to execute
+ * @param data_array Per-task work data (NULL passes NULL to every task)
+ * @param count Number of tasks
+ * @param spawn_location Source location of spawn
+ * @return First RIFT thread ID of a contiguous range, 0 on failure (or for
+ *         CONCURRENCY_AUTO)
+ */
+uint64_t rift_simulated_spawn_batch(uint64_t parent_id,
+                                    const rift_governance_policy_t* policy,
+                                    void (*work_func)(void*),
+                                    void** data_array,
+                                    uint32_t count,
+                                    const char* spawn_location);
+
+/**
+ * @brief Execute one scheduling cycle of simulated concurrency
+ * @return Number of active tasks processed
+ */
+int rift_simulated_schedule_cycle(void);
+
+/**
+ * @brief Request cooperative yield from current task
+ */
+void rift_simulated_yield(void);
+
+/**
+ * @brief Terminate simulated concurrent task
+ * @param rift_id RIFT thread ID to terminate
+ * @return 0 on success, error code otherwise
+ */
+int rift_simulated_terminate(uint64_t rift_id);
+
+/**
+ * @brief Clean up simulated concurrency subsystem
+ */
+void rift_simulated_cleanup(void);
+
+/**
+ * @brief Create validated, registered task without queueing it
+ * @param parent_id Parent RIFT thread ID (0 for root)
+ * @param policy Governance policy for new task
+ * @param work_func Work function to execute
+ * @param work_data Data to pass to work function
+ * @param spawn_location Source location of spawn
+ * @return Task context on success, NULL on failure
+ */
+rift_simulated_context_t* rift_simulated_create_task(uint64_t parent_id,
+                                                     const rift_governance_policy_t* policy,
+                                                     void (*work_func)(void*),
+                                                     void* work_data,
+                                                     const char* spawn_location);
+
+/**
+ * @brief Create validated, registered batch of tasks without queueing them
+ * @param parent_id Parent RIFT thread ID (0 for root)
+ * @param policy Governance policy for every task
+ * @param work_func Work function to execute
+ * @param data_array Per-task work data (may be NULL)
+ * @param count Number of tasks
+ * @param spawn_location Source location of spawn
+ * @param tasks Receives count task contexts in RIFT ID order
+ * @return count on success, 0 on failure (nothing is created)
+ */
+uint32_t rift_simulated_create_task_batch(uint64_t parent_id,
+                                          const rift_governance_policy_t* policy,
+                                          void (*work_func)(void*),
+                                          void** data_array,
+                                          uint32_t count,
+                                          const char* spawn_location,
+                                          rift_simulated_context_t** tasks);
+
+/**
+ * @brief Release task stack and telemetry entry
+ * @param task Finished or abandoned task
+ */
+void rift_simulated_destroy_task(rift_simulated_context_t* task);
+
+/**
+ * @brief Copy the live single-thread scheduler tasks (hybrid tasks excluded)
+ * @param tasks Output task pointers
+ * @param capacity Pointers that fit in the output
+ * @return Number of tasks copied
+ */
+uint32_t rift_simulated_list_tasks(rift_simulated_context_t** tasks, uint32_t capacity);
+
+/**
+ * @brief Copy the live hybrid pool tasks, queued, running or parked
+ * @param tasks Output task pointers
+ * @param capacity Pointers that fit in the output
+ * @return Number of tasks copied
+ */
+uint32_t rift_simulated_list_hybrid_tasks(rift_simulated_context_t** tasks, uint32_t capacity);
+
+/**
+ * @brief Copy the live single-thread scheduler tasks and hold the registry
+ *        and run queue across fork(); pair with rift_simulated_fork_release()
+ * @param tasks Output task pointers
+ * @param capacity Pointers that fit in the output
+ * @return Number of tasks copied
+ */
+uint32_t rift_simulated_fork_hold(rift_simulated_context_t** tasks, uint32_t capacity);
+
+/**
+ * @brief End a fork hold
+ * @param in_child true in the child, which reinitializes the copied locks
+ */
+void rift_simulated_fork_release(bool in_child);
+
+/**
+ * @brief Take the guarded task stack at stack_base out of the stack cache,
+ *        or map one there, so no new task is given it
+ * @param stack_base Stack address (above its guard page)
+ * @return 0 on success, -1 if something else occupies the range
+ */
+int rift_simulated_claim_stack(void* stack_base);
+
+/**
+ * @brief Return a claimed stack that was not adopted
+ * @param stack_base Claimed stack
+ */
+void rift_simulated_release_stack(void* stack_base);
+
+/**
+ * @brief Move a created, never-run task onto a claimed stack and make it
+ *        resume from coroutine instead of its entry point
+ * @param task Task from rift_simulated_create_task(), not yet queued
+ * @param stack_base Claimed stack the coroutine was saved on
+ * @param coroutine Saved execution state
+ */
+void rift_simulated_adopt_stack(rift_simulated_context_t* task, void* stack_base,
+                                const ucontext_t* coroutine);
+
+/**
+ * @brief Run task on the calling thread until it yields or finishes
+ * @param task Task to resume
+ * @return Task state after the slice
+ */
+rift_simulated_task_state_t rift_simulated_resume(rift_simulated_context_t* task);
+
+/**
+ * @brief Get task running on the calling thread
+ * @return Current task, NULL outside simulated tasks
+ */
+rift_simulated_context_t* rift_simulated_current(void);
+
+/**
+ * @brief Mark current task as parking; call before publishing it to a waker
+ */
+void rift_simulated_park_prepare(void);
+
+/**
+ * @brief Withdraw a prepared park that was never published
+ */
+void rift_simulated_park_cancel(void);
+
+/**
+ * @brief Suspend current task until rift_simulated_wake()
+ */
+void rift_simulated_park(void);
+
+/**
+ * @brief Park after rift_simulated_park_prepare() in a wait that
+ *        cancellation may end: wakers and the canceller each exchange
+ *        *claim to 1 and only the one that found it 0 wakes the task
+ * @param claim Claim word published with the wait, initially 0
+ * @return true if cancellation claimed the wait (the caller withdraws it),
+ *         false if a waker did
+ */
+bool rift_simulated_park_cancellable(_Atomic int* claim);
+
+/**
+ * @brief Park the current task for timeout_ms on a watchdog timer; ends
+ *        early when the task is cancelled
+ * @param timeout_ms Milliseconds to sleep
+ * @return 0 after the full time, -1 if cancelled
+ */
+int rift_simulated_sleep_ms(uint32_t timeout_ms);
+
+/**
+ * @brief Requeue parked task on the scheduler owning its mode
+ * @param task Parked task (safe to call before it finishes switching out)
+ */
+void rift_simulated_wake(rift_simulated_context_t* task);
+
+/**
+ * @brief Initialize single-thread run queue
+ * @return 0 on success, error code otherwise
+ */
+int rift_simulated_scheduler_init(void);
+
+/**
+ * @brief Append task to the single-thread run queue
+ * @param task Ready task
+ */
+void rift_simulated_scheduler_enqueue(rift_simulated_context_t* task);
+
+/**
+ * @brief Append tasks to the run queue in order under one lock
+ * @param tasks Ready tasks
+ * @param count Number of tasks
+ */
+void rift_simulated_scheduler_enqueue_batch(rift_simulated_context_t** tasks, uint32_t count);
+
+/**
+ * @brief Apply policy's max_queued to the run queue before count tasks are
+ *        created; OVERFLOW_BLOCK yields from a task and otherwise runs
+ *        scheduling cycles until there is room
+ * @param policy Spawn policy
+ * @param count Tasks about to be queued
+ * @return 0 to queue them, 1 to run them on the caller, -1 if refused
+ */
+int rift_simulated_scheduler_throttle(const rift_governance_policy_t* policy, uint32_t count);
+
+/**
+ * @brief Run a new task's first slice on the calling thread instead of
+ *        queueing it (OVERFLOW_CALLER_RUNS); it is queued if it yields
+ * @param task Created task, not queued
+ */
+void rift_simulated_scheduler_run_inline(rift_simulated_context_t* task);
+
+/**
+ * @brief Admit task with a deadline against the single-thread scheduler's
+ *        outstanding EDF claims
+ * @param task Task with telemetry.deadline_ns set
+ * @return 0 if admitted, -1 if its deadline is infeasible
+ */
+int rift_simulated_scheduler_admit(rift_simulated_context_t* task);
+
+/**
+ * @brief Release task's admission claim (task teardown)
+ * @param task Admitted or unadmitted task
+ */
+void rift_simulated_scheduler_release(rift_simulated_context_t* task);
+
+/**
+ * @brief Priority inheritance: run a queued task no later than a waiter's
+ *        deadline, moving it ahead of batch work if needed
+ * @param rift_id RIFT ID of the task waited for
+ * @param deadline_ns Waiter's deadline
+ * @return true if the task was queued
+ */
+bool rift_simulated_scheduler_boost(uint64_t rift_id, uint64_t deadline_ns);
+
+/**
+ * @brief Get number of tasks in the run queue
+ * @return Runnable task count
+ */
+uint32_t rift_simulated_runnable_count(void);
+
+/**
+ * @brief Hold the run queue lock across fork() (rift_simulated_fork_hold())
+ */
+void rift_simulated_scheduler_fork_hold(void);
+
+/**
+ * @brief End a run queue fork hold
+ * @param in_child true in the child, which reinitializes the copied lock
+ */
+void rift_simulated_scheduler_fork_release(bool in_child);
+
+/**
+ * @brief Destroy queued tasks and stop the run queue
+ */
+void rift_simulated_scheduler_cleanup(void);
+
+#endif // RIFT_SIMULATED_H
@@ -0,0 +1,455 @@
+/**
+ * @file rift_simulated_chan.c
+ * @brief RIFT Simulated Concurrency - Channels and Select
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Bounded channels of fixed-size elements between simulated tasks, in either
+ * scheduling mode. A task that cannot complete a send or receive parks with
+ * a waiter record on its own coroutine stack; the partner that completes the
+ * operation copies the element directly to or from that record and wakes it,
+ * so a rendezvous with an already waiting partner neither allocates nor
+ * touches the ring buffer.
+ *
+ * Select enqueues one waiter per case sharing a claim word. The first partner
+ * to claim it completes that case; stale waiters on the other channels are
+ * skipped by partners and removed by the selecting task when it resumes.
+ * Channels are locked in address order whenever more than one is held.
+ *
+ * Parks are cancellable: the canceller races partners for the same claim
+ * word, and a task it wins withdraws its waiters and returns cancelled.
+ */
+
+#include "rift_simulated_chan.h"
+#include "rift_simulated.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Completion shared by every waiter of one blocking operation
+typedef struct {
+    _Atomic int fired;                    // Set by the partner that claims it
+    int32_t case_index;                   // Case completed by that partner
+    rift_chan_status_t status;            // Result for the woken task
+} rift_chan_completion_t;
+
+struct rift_chan_waiter {
+    rift_simulated_context_t* task;       // Parked task
+    void* elem;                           // Send source or receive destination
+    rift_chan_completion_t* completion;   // Claim word and result
+    int32_t case_index;                   // Select case this waiter belongs to
+    rift_chan_waiter_t* next;             // Queue link, then wake-list link
+};
+
+// Victim order for select fairness; migration between threads is harmless
+static __thread uint64_t t_chan_rng = 0x9E3779B97F4A7C15ULL;
+
+// =============================================================================
+// WAIT QUEUES
+// =============================================================================
+
+static void chan_enqueue(rift_chan_waiter_t** head, rift_chan_waiter_t** tail,
+                         rift_chan_waiter_t* waiter) {
+    waiter->next = NULL;
+    if (*tail) {
+        (*tail)->next = waiter;
+    } else {
+        *head = waiter;
+    }
+    *tail = waiter;
+}
+
+static void chan_remove(rift_chan_waiter_t** head, rift_chan_waiter_t** tail,
+                        rift_chan_waiter_t* waiter) {
+    rift_chan_waiter_t* previous = NULL;
+    for (rift_chan_waiter_t* cursor = *head; cursor; previous = cursor, cursor = cursor->next) {
+        if (cursor != waiter) {
+            continue;
+        }
+        if (previous) {
+            previous->next = cursor->next;
+        } else {
+            *head = cursor->next;
+        }
+        if (*tail == cursor) {
+            *tail = previous;
+        }
+        return;
+    }
+}
+
+/**
+ * @brief Pop first waiter whose operation is still unclaimed and claim it;
+ *        waiters of selects completed elsewhere are discarded
+ */
+static rift_chan_waiter_t* chan_claim(rift_chan_waiter_t** head, rift_chan_waiter_t** tail) {
+    while (*head) {
+        rift_chan_waiter_t* waiter = *head;
+        *head = waiter->next;
+        if (!*head) {
+            *tail = NULL;
+        }
+
+        if (atomic_exchange(&waiter->completion->fired, 1) == 0) {
+            return waiter;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Record result for a claimed waiter; returns its task for waking
+ *        (the waiter must not be touched once the task is woken)
+ */
+static rift_simulated_context_t* chan_complete(rift_chan_waiter_t* waiter, rift_chan_status_t status) {
+    waiter->completion->case_index = waiter->case_index;
+    waiter->completion->status = status;
+    return waiter->task;
+}
+
+static void chan_wake(rift_simulated_context_t* task) {
+    if (task) {
+        rift_simulated_wake(task);
+    }
+}
+
+// =============================================================================
+// LOCKED OPERATIONS
+// =============================================================================
+
+static uint8_t* chan_slot(rift_chan_t* chan, uint32_t offset) {
+    uint32_t index = chan->head + offset;
+    if (index >= chan->capacity) {
+        index -= chan->capacity; // offset < capacity, so one wrap suffices
+    }
+    return chan->buffer + index * chan->elem_size;
+}
+
+/**
+ * @brief Send while holding chan_mutex; hands off to a parked receiver first
+ */
+static rift_chan_status_t chan_send_locked(rift_chan_t* chan, const void* elem,
+                                           rift_simulated_context_t** wake) {
+    if (chan->closed) {
+        return RIFT_CHAN_CLOSED;
+    }
+
+    rift_chan_waiter_t* receiver = chan_claim(&chan->recv_head, &chan->recv_tail);
+    if (receiver) {
+        memcpy(receiver->elem, elem, chan->elem_size);
+        *wake = chan_complete(receiver, RIFT_CHAN_OK);
+        return RIFT_CHAN_OK;
+    }
+
+    if (chan->count < chan->capacity) {
+        memcpy(chan_slot(chan, chan->count), elem, chan->elem_size);
+        chan->count++;
+        return RIFT_CHAN_OK;
+    }
+
+    return RIFT_CHAN_WOULD_BLOCK;
+}
+
+/**
+ * @brief Receive while holding chan_mutex; refills the buffer from a parked
+ *        sender so FIFO order is preserved
+ */
+static rift_chan_status_t chan_recv_locked(rift_chan_t* chan, void* elem,
+                                           rift_simulated_context_t** wake) {
+    if (chan->count > 0) {
+        memcpy(elem, chan_slot(chan, 0), chan->elem_size);
+        if (++chan->head == chan->capacity) {
+            chan->head = 0;
+        }
+        chan->count--;
+
+        rift_chan_waiter_t* sender = chan_claim(&chan->send_head, &chan->send_tail);
+        if (sender) {
+            memcpy(chan_slot(chan, chan->count), sender->elem, chan->elem_size);
+            chan->count++;
+            *wake = chan_complete(sender, RIFT_CHAN_OK);
+        }
+        return RIFT_CHAN_OK;
+    }
+
+    rift_chan_waiter_t* sender = chan_claim(&chan->send_head, &chan->send_tail);
+    if (sender) {
+        memcpy(elem, sender->elem, chan->elem_size);
+        *wake = chan_complete(sender, RIFT_CHAN_OK);
+        return RIFT_CHAN_OK;
+    }
+
+    if (chan->closed) {
+        memset(elem, 0, chan->elem_size);
+        return RIFT_CHAN_CLOSED;
+    }
+
+    return RIFT_CHAN_WOULD_BLOCK;
+}
+
+static rift_chan_status_t chan_op_locked(rift_chan_case_t* chan_case,
+                                         rift_simulated_context_t** wake) {
+    if (chan_case->op == RIFT_CHAN_SEND) {
+        return chan_send_locked(chan_case->chan, chan_case->elem, wake);
+    }
+    return chan_recv_locked(chan_case->chan, chan_case->elem, wake);
+}
+
+/**
+ * @brief Single-channel operation, parking the current task if needed
+ */
+static rift_chan_status_t chan_transfer(rift_chan_t* chan, rift_chan_op_t op, void* elem,
+                                        bool block) {
+    if (!chan || !elem) {
+        return RIFT_CHAN_CLOSED;
+    }
+
+    rift_chan_case_t chan_case = { .chan = chan, .op = op, .elem = elem };
+    rift_simulated_context_t* wake = NULL;
+
+    pthread_mutex_lock(&chan->chan_mutex);
+    rift_chan_status_t status = chan_op_locked(&chan_case, &wake);
+    if (status != RIFT_CHAN_WOULD_BLOCK || !block) {
+        pthread_mutex_unlock(&chan->chan_mutex);
+        chan_wake(wake);
+        return status;
+    }
+
+    rift_simulated_context_t* task = rift_simulated_current();
+    if (!task) {
+        pthread_mutex_unlock(&chan->chan_mutex);
+        return RIFT_CHAN_WOULD_BLOCK;
+    }
+
+    rift_chan_completion_t completion = { .status = RIFT_CHAN_CLOSED };
+    rift_chan_waiter_t waiter = { .task = task, .elem = elem, .completion = &completion };
+    if (op == RIFT_CHAN_SEND) {
+        chan_enqueue(&chan->send_head, &chan->send_tail, &waiter);
+    } else {
+        chan_enqueue(&chan->recv_head, &chan->recv_tail, &waiter);
+    }
+
+    // Prepare before unlocking so a partner's wake cannot be lost
+    rift_simulated_park_prepare();
+    pthread_mutex_unlock(&chan->chan_mutex);
+    if (rift_simulated_park_cancellable(&completion.fired)) {
+        // No partner claimed the waiter; it is still queued
+        pthread_mutex_lock(&chan->chan_mutex);
+        if (op == RIFT_CHAN_SEND) {
+            chan_remove(&chan->send_head, &chan->send_tail, &waiter);
+        } else {
+            chan_remove(&chan->recv_head, &chan->recv_tail, &waiter);
+        }
+        pthread_mutex_unlock(&chan->chan_mutex);
+        return RIFT_CHAN_CANCELLED;
+    }
+
+    return completion.status;
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+/**
+ * @brief Create bounded channel
+ */
+rift_chan_t* rift_chan_create(size_t elem_size, uint32_t capacity) {
+    if (elem_size == 0) {
+        return NULL;
+    }
+
+    rift_chan_t* chan = calloc(1, sizeof(rift_chan_t));
+    if (!chan) {
+        return NULL;
+    }
+
+    if (capacity > 0) {
+        chan->buffer = malloc(elem_size * capacity);
+        if (!chan->buffer) {
+            free(chan);
+            return NULL;
+        }
+    }
+
+    chan->elem_size = elem_size;
+    chan->capacity = capacity;
+    pthread_mutex_init(&chan->chan_mutex, NULL);
+    return chan;
+}
+
+/**
+ * @brief Destroy channel
+ */
+void rift_chan_destroy(rift_chan_t* chan) {
+    if (!chan) {
+        return;
+    }
+
+    if (chan->send_head || chan->recv_head) {
+        fprintf(stderr, "[CHAN] Destroying channel with parked tasks\n");
+    }
+
+    pthread_mutex_destroy(&chan->chan_mutex);
+    free(chan->buffer);
+    free(chan);
+}
+
+rift_chan_status_t rift_chan_send(rift_chan_t* chan, const void* elem) {
+    return chan_transfer(chan, RIFT_CHAN_SEND, (void*)elem, true);
+}
+
+rift_chan_status_t rift_chan_recv(rift_chan_t* chan, void* elem) {
+    return chan_transfer(chan, RIFT_CHAN_RECV, elem, true);
+}
+
+rift_chan_status_t rift_chan_try_send(rift_chan_t* chan, const void* elem) {
+    return chan_transfer(chan, RIFT_CHAN_SEND, (void*)elem, false);
+}
+
+rift_chan_status_t rift_chan_try_recv(rift_chan_t* chan, void* elem) {
+    return chan_transfer(chan, RIFT_CHAN_RECV, elem, false);
+}
+
+/**
+ * @brief Close channel; parked receivers get RIFT_CHAN_CLOSED and a zeroed
+ *        element, parked senders get RIFT_CHAN_CLOSED
+ */
+void rift_chan_close(rift_chan_t* chan) {
+    if (!chan) {
+        return;
+    }
+
+    rift_chan_waiter_t* released = NULL;
+    rift_chan_waiter_t* waiter;
+
+    pthread_mutex_lock(&chan->chan_mutex);
+    chan->closed = true;
+    while ((waiter = chan_claim(&chan->recv_head, &chan->recv_tail)) != NULL) {
+        memset(waiter->elem, 0, chan->elem_size);
+        chan_complete(waiter, RIFT_CHAN_CLOSED);
+        waiter->next = released;
+        released = waiter;
+    }
+    while ((waiter = chan_claim(&chan->send_head, &chan->send_tail)) != NULL) {
+        chan_complete(waiter, RIFT_CHAN_CLOSED);
+        waiter->next = released;
+        released = waiter;
+    }
+    pthread_mutex_unlock(&chan->chan_mutex);
+
+    while (released) {
+        rift_chan_waiter_t* next = released->next;
+        rift_simulated_wake(released->task);
+        released = next;
+    }
+}
+
+/**
+ * @brief Lock distinct channels of cases in address order
+ * @return Number of channels locked
+ */
+static uint32_t chan_lock_all(rift_chan_case_t* cases, uint32_t count, rift_chan_t** locked) {
+    uint32_t locked_count = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        rift_chan_t* chan = cases[i].chan;
+        uint32_t position = 0;
+        while (position < locked_count && locked[position] < chan) {
+            position++;
+        }
+        if (position < locked_count && locked[position] == chan) {
+            continue;
+        }
+        memmove(&locked[position + 1], &locked[position],
+                (locked_count - position) * sizeof(rift_chan_t*));
+        locked[position] = chan;
+        locked_count++;
+    }
+
+    for (uint32_t i = 0; i < locked_count; i++) {
+        pthread_mutex_lock(&locked[i]->chan_mutex);
+    }
+    return locked_count;
+}
+
+static void chan_unlock_all(rift_chan_t** locked, uint32_t locked_count) {
+    for (uint32_t i = locked_count; i > 0; i--) {
+        pthread_mutex_unlock(&locked[i - 1]->chan_mutex);
+    }
+}
+
+/**
+ * @brief Complete one ready case, starting at a random case for fairness
+ */
+int rift_chan_select(rift_chan_case_t* cases, uint32_t count, bool block) {
+    if (!cases || count == 0 || count > RIFT_CHAN_SELECT_MAX_CASES) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!cases[i].chan || !cases[i].elem) {
+            return -1;
+        }
+    }
+
+    rift_chan_t* locked[RIFT_CHAN_SELECT_MAX_CASES];
+    uint32_t locked_count = chan_lock_all(cases, count, locked);
+
+    t_chan_rng ^= t_chan_rng << 13;
+    t_chan_rng ^= t_chan_rng >> 7;
+    t_chan_rng ^= t_chan_rng << 17;
+    uint32_t start = (uint32_t)(t_chan_rng % count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t index = (start + i) % count;
+        rift_simulated_context_t* wake = NULL;
+        rift_chan_status_t status = chan_op_locked(&cases[index], &wake);
+        if (status != RIFT_CHAN_WOULD_BLOCK) {
+            chan_unlock_all(locked, locked_count);
+            chan_wake(wake);
+            cases[index].status = status;
+            return (int)index;
+        }
+    }
+
+    rift_simulated_context_t* task = rift_simulated_current();
+    if (!block || !task) {
+        chan_unlock_all(locked, locked_count);
+        return -1;
+    }
+
+    rift_chan_completion_t completion = { .case_index = -1, .status = RIFT_CHAN_CLOSED };
+    rift_chan_waiter_t waiters[RIFT_CHAN_SELECT_MAX_CASES];
+    for (uint32_t i = 0; i < count; i++) {
+        rift_chan_t* chan = cases[i].chan;
+        waiters[i] = (rift_chan_waiter_t){ .task = task, .elem = cases[i].elem,
+                                           .completion = &completion, .case_index = (int32_t)i };
+        if (cases[i].op == RIFT_CHAN_SEND) {
+            chan_enqueue(&chan->send_head, &chan->send_tail, &waiters[i]);
+        } else {
+            chan_enqueue(&chan->recv_head, &chan->recv_tail, &waiters[i]);
+        }
+    }
+
+    rift_simulated_park_prepare();
+    chan_unlock_all(locked, locked_count);
+    bool cancelled = rift_simulated_park_cancellable(&completion.fired);
+
+    // Withdraw the waiters that lost; partners may still hold pointers to
+    // them until they release the channel lock
+    locked_count = chan_lock_all(cases, count, locked);
+    for (uint32_t i = 0; i < count; i++) {
+        rift_chan_t* chan = cases[i].chan;
+        if (cases[i].op == RIFT_CHAN_SEND) {
+            chan_remove(&chan->send_head, &chan->send_tail, &waiters[i]);
+        } else {
+            chan_remove(&chan->recv_head, &chan->recv_tail, &waiters[i]);
+        }
+    }
+    chan_unlock_all(locked, locked_count);
+
+    if (cancelled) {
+        return -1;
+    }
+    cases[completion.case_index].status = completion.status;
+    return completion.case_index;
+}
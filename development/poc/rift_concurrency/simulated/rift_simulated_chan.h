@@ -0,0 +1,117 @@
+/**
+ * @file rift_simulated_chan.h
+ * @brief Simulated Channel Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_SIMULATED_CHAN_H
+#define RIFT_SIMULATED_CHAN_H
+
+#include "rift_common.h"
+
+#define RIFT_CHAN_SELECT_MAX_CASES 16
+
+// Channel operation results
+typedef enum {
+    RIFT_CHAN_OK = 0,              // Value transferred
+    RIFT_CHAN_CLOSED = -1,         // Channel closed (recv: and drained)
+    RIFT_CHAN_WOULD_BLOCK = -2,    // Not ready and caller cannot park
+    RIFT_CHAN_CANCELLED = -3       // Calling task cancelled while it waited
+} rift_chan_status_t;
+
+typedef enum {
+    RIFT_CHAN_SEND,
+    RIFT_CHAN_RECV
+} rift_chan_op_t;
+
+// Parked sender or receiver; lives on the waiting task's coroutine stack
+typedef struct rift_chan_waiter rift_chan_waiter_t;
+
+// Bounded channel of fixed-size elements (capacity 0 is a rendezvous)
+typedef struct {
+    size_t elem_size;                     // Bytes per element
+    uint32_t capacity;                    // Buffered elements
+    uint32_t head;                        // Next element to receive
+    uint32_t count;                       // Buffered element count
+    uint8_t* buffer;                      // capacity * elem_size ring
+    bool closed;                          // No further sends accepted
+    rift_chan_waiter_t* send_head;        // Parked senders (FIFO)
+    rift_chan_waiter_t* send_tail;
+    rift_chan_waiter_t* recv_head;        // Parked receivers (FIFO)
+    rift_chan_waiter_t* recv_tail;
+    pthread_mutex_t chan_mutex;           // Guards all fields above
+} rift_chan_t;
+
+// One arm of rift_chan_select()
+typedef struct {
+    rift_chan_t* chan;                    // Channel to operate on
+    rift_chan_op_t op;                    // Send or receive
+    void* elem;                           // Send source or receive destination
+    rift_chan_status_t status;            // Result of the completed arm
+} rift_chan_case_t;
+
+// Typed creation helper: RIFT_CHAN_CREATE(int, 16)
+#define RIFT_CHAN_CREATE(type, capacity) rift_chan_create(sizeof(type), (capacity))
+
+/**
+ * @brief Create bounded channel
+ * @param elem_size Bytes per element
+ * @param capacity Buffered elements (0 for unbuffered rendezvous)
+ * @return Channel on success, NULL on failure
+ */
+rift_chan_t* rift_chan_create(size_t elem_size, uint32_t capacity);
+
+/**
+ * @brief Destroy channel; no task may be parked on it
+ * @param chan Channel to destroy
+ */
+void rift_chan_destroy(rift_chan_t* chan);
+
+/**
+ * @brief Send element, parking the calling task while the channel is full
+ * @param chan Channel
+ * @param elem Element to copy in
+ * @return RIFT_CHAN_OK, RIFT_CHAN_CLOSED, RIFT_CHAN_CANCELLED, or
+ *         RIFT_CHAN_WOULD_BLOCK outside a task
+ */
+rift_chan_status_t rift_chan_send(rift_chan_t* chan, const void* elem);
+
+/**
+ * @brief Receive element, parking the calling task while the channel is empty
+ * @param chan Channel
+ * @param elem Destination (zeroed when closed)
+ * @return RIFT_CHAN_OK, RIFT_CHAN_CLOSED, RIFT_CHAN_CANCELLED, or
+ *         RIFT_CHAN_WOULD_BLOCK outside a task
+ */
+rift_chan_status_t rift_chan_recv(rift_chan_t* chan, void* elem);
+
+/**
+ * @brief Send without parking
+ * @return RIFT_CHAN_OK, RIFT_CHAN_CLOSED or RIFT_CHAN_WOULD_BLOCK
+ */
+rift_chan_status_t rift_chan_try_send(rift_chan_t* chan, const void* elem);
+
+/**
+ * @brief Receive without parking
+ * @return RIFT_CHAN_OK, RIFT_CHAN_CLOSED or RIFT_CHAN_WOULD_BLOCK
+ */
+rift_chan_status_t rift_chan_try_recv(rift_chan_t* chan, void* elem);
+
+/**
+ * @brief Close channel and release every parked sender and receiver
+ * @param chan Channel
+ */
+void rift_chan_close(rift_chan_t* chan);
+
+/**
+ * @brief Complete exactly one ready case, parking until one is ready
+ * @param cases Cases to wait on (status of the chosen case is set)
+ * @param count Number of cases (at most RIFT_CHAN_SELECT_MAX_CASES)
+ * @param block false to return immediately when no case is ready
+ * @return Index of completed case, -1 if none completed (or the task was
+ *         cancelled while parked)
+ */
+int rift_chan_select(rift_chan_case_t* cases, uint32_t count, bool block);
+
+#endif // RIFT_SIMULATED_CHAN_H
@@ -0,0 +1,509 @@
+/**
+ * @file rift_simulated_checkpoint.c
+ * @brief RIFT Simulated Concurrency - Fork-Based Checkpoint and Restore
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A checkpoint forks the process and lets the child write the snapshot
+ * while the parent carries on: fork() gives the child a copy-on-write image
+ * frozen at that instant, so the caller pauses only for the fork itself.
+ * The telemetry registry lock, the simulated task registry and the run
+ * queue are held from listing the tasks until the fork, so the child copies
+ * no half-written entry and every listed task is still allocated, whatever
+ * other threads wake, spawn or finish meanwhile. The child writes path.tmp, syncs it and renames it
+ * over path, so a crash mid-write leaves the previous snapshot intact.
+ *
+ * A snapshot holds a header, the telemetry registry (each entry carries its
+ * parent, which is the hierarchy), and one record per single-thread
+ * scheduler task: policy, entry point and data, scheduler state, whether
+ * its cancellation token was cancelled, and for a task that has run, its
+ * saved coroutine and the used top of its stack. Hybrid tasks run on their
+ * workers and are not captured, as in record/replay.
+ *
+ * Restore rebuilds the single-thread scheduler in snapshot order, so a
+ * parent is created before its children: each task is created again under
+ * its restored parent (or at the root when its parent was not a restored
+ * task) and queued. A task that had not run starts from its entry point; a
+ * task that had yielded gets its stack back at the same address and resumes
+ * where it left off. Parked tasks are skipped, since whatever would wake
+ * them is not part of the snapshot. Restored tasks get new RIFT IDs;
+ * rift_checkpoint_restored_id() maps the recorded ones.
+ *
+ * Restore is a rollback of the process that took the snapshot, hence
+ * rift_checkpoint_rollback(). Saved stack frames hold return addresses,
+ * frame pointers and pointers into the heap, none of which can be told
+ * apart from plain data to be rebased, and the heap itself is not in the
+ * snapshot. A snapshot from another process
+ * is rejected up front, as is one from an earlier image of this process
+ * (the PID survives exec(), the load address does not).
+ */
+
+#include "rift_simulated_checkpoint.h"
+#include "rift_telemetry.h"
+#include "rift_cancel.h"
+#include "rift_simulated.h"
+#include "rift_simulated_replay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <limits.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#define CHECKPOINT_MAGIC "RIFTCKP1"
+#define CHECKPOINT_MAGIC_LENGTH 8
+#define CHECKPOINT_RED_ZONE 128           // Below the saved stack pointer (x86-64 ABI)
+
+typedef struct {
+    char magic[CHECKPOINT_MAGIC_LENGTH];
+    uint32_t header_size;                 // Layout check: sizes of the records below
+    uint32_t entry_size;
+    uint32_t task_size;
+    uint32_t registry_count;              // Telemetry entries that follow
+    uint32_t task_count;                  // Task records that follow them
+    pid_t process_id;                     // Process that was snapshotted
+    uint64_t image_anchor;                // Address of rift_checkpoint_save() in it
+    struct timespec taken;                // CLOCK_REALTIME at the fork
+} checkpoint_header_t;
+
+typedef struct {
+    uint64_t rift_id;
+    uint64_t parent_rift_id;
+    rift_governance_policy_t policy;
+    void (*work_function)(void*);
+    void* work_data;
+    rift_simulated_task_state_t state;
+    uint32_t context_switches;
+    uint32_t current_slice;
+    bool cancelled;                       // Token state at the snapshot
+    void* stack_base;
+    size_t stack_size;
+    size_t stack_saved;                   // Top bytes of stack that follow, 0 if never run
+    ucontext_t coroutine;
+    char spawn_location[128];
+} checkpoint_task_t;
+
+// =============================================================================
+// CHECKPOINT STATE
+// =============================================================================
+
+static struct {
+    pid_t writer;                         // Snapshot writer in flight, 0 for none
+    char path[PATH_MAX];                  // Its output, for the size once written
+    uint32_t tasks;                       // Its task count
+    uint64_t restored_from[RIFT_MAX_THREAD_COUNT];
+    uint64_t restored_to[RIFT_MAX_THREAD_COUNT];
+    uint32_t restored_count;
+    rift_checkpoint_stats_t stats;
+    pthread_mutex_t checkpoint_mutex;
+} g_checkpoint = {
+    .checkpoint_mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+static uint64_t checkpoint_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Bytes at the top of a suspended task's stack that hold its frames;
+ *        the whole stack where the saved stack pointer cannot be read
+ */
+static size_t checkpoint_stack_used(const rift_simulated_context_t* task) {
+    uintptr_t sp = 0;
+#if defined(__x86_64__)
+    sp = (uintptr_t)task->coroutine.uc_mcontext.gregs[REG_RSP];
+#elif defined(__aarch64__)
+    sp = (uintptr_t)task->coroutine.uc_mcontext.sp;
+#endif
+    uintptr_t base = (uintptr_t)task->stack_base;
+    uintptr_t top = base + task->stack_size;
+    if (sp < base + CHECKPOINT_RED_ZONE || sp > top) {
+        return task->stack_size;
+    }
+    return top - (sp - CHECKPOINT_RED_ZONE);
+}
+
+// =============================================================================
+// SNAPSHOT WRITER (forked child)
+// =============================================================================
+
+static void checkpoint_task_record(const rift_simulated_context_t* task,
+                                   checkpoint_task_t* record) {
+    memset(record, 0, sizeof(*record));
+    record->rift_id = task->base_context.telemetry.rift_thread_id;
+    record->parent_rift_id = task->base_context.telemetry.parent_rift_id;
+    record->policy = task->base_context.policy;
+    record->work_function = task->work_function;
+    record->work_data = task->work_data;
+    record->state = task->state;
+    record->context_switches = task->base_context.context_switches;
+    record->current_slice = task->current_slice;
+    record->cancelled = rift_cancel_requested(&task->base_context.cancel);
+    record->stack_base = task->stack_base;
+    record->stack_size = task->stack_size;
+    if (task->base_context.context_switches > 0) {
+        record->stack_saved = checkpoint_stack_used(task);
+        record->coroutine = task->coroutine;
+    }
+    memcpy(record->spawn_location, task->base_context.telemetry.spawn_location,
+           sizeof(record->spawn_location));
+}
+
+static int compare_tasks(const void* a, const void* b) {
+    uint64_t x = (*(rift_simulated_context_t* const*)a)->base_context.telemetry.rift_thread_id;
+    uint64_t y = (*(rift_simulated_context_t* const*)b)->base_context.telemetry.rift_thread_id;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Write the snapshot; runs in the forked child, where only this
+ *        thread exists and memory is frozen at the fork
+ * @return 0 on success, -1 on failure
+ */
+static int checkpoint_write(const char* path, rift_simulated_context_t** tasks, uint32_t count,
+                            const struct timespec* taken) {
+    static rift_spawn_telemetry_t entries[RIFT_MAX_THREAD_COUNT];
+    uint32_t registry_count = rift_telemetry_snapshot(entries, RIFT_MAX_THREAD_COUNT);
+
+    char temp_path[PATH_MAX + 8];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+    FILE* file = fopen(temp_path, "wb");
+    if (!file) {
+        fprintf(stderr, "[CHECKPOINT] Cannot open %s: %s\n", temp_path, strerror(errno));
+        return -1;
+    }
+
+    // Spawn order puts every parent before its children
+    qsort(tasks, count, sizeof(tasks[0]), compare_tasks);
+
+    checkpoint_header_t header = {0};
+    memcpy(header.magic, CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_LENGTH);
+    header.header_size = sizeof(checkpoint_header_t);
+    header.entry_size = sizeof(rift_spawn_telemetry_t);
+    header.task_size = sizeof(checkpoint_task_t);
+    header.registry_count = registry_count;
+    header.task_count = count;
+    header.process_id = getppid();
+    header.image_anchor = (uint64_t)(uintptr_t)rift_checkpoint_save;
+    header.taken = *taken;
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(entries, sizeof(entries[0]), registry_count, file) == registry_count;
+    for (uint32_t i = 0; ok && i < count; i++) {
+        checkpoint_task_t record;
+        checkpoint_task_record(tasks[i], &record);
+        const uint8_t* stack_top = (const uint8_t*)record.stack_base + record.stack_size;
+        ok = fwrite(&record, sizeof(record), 1, file) == 1 &&
+             fwrite(stack_top - record.stack_saved, 1, record.stack_saved, file) ==
+                 record.stack_saved;
+    }
+
+    ok = fflush(file) == 0 && fsync(fileno(file)) == 0 && ok;
+    ok = fclose(file) == 0 && ok;
+    if (!ok || rename(temp_path, path) != 0) {
+        fprintf(stderr, "[CHECKPOINT] Writing %s failed: %s\n", path, strerror(errno));
+        unlink(temp_path);
+        return -1;
+    }
+    return 0;
+}
+
+// =============================================================================
+// CHECKPOINT
+// =============================================================================
+
+/**
+ * @brief Collect a finished writer; with block false, only if it has exited
+ * @return 0 if it wrote the snapshot, -1 if it failed, 1 if still running
+ */
+static int checkpoint_collect(bool block) {
+    int status;
+    pid_t result;
+    do {
+        result = waitpid(g_checkpoint.writer, &status, block ? 0 : WNOHANG);
+    } while (result < 0 && errno == EINTR);
+    if (result == 0) {
+        return 1;
+    }
+
+    g_checkpoint.writer = 0;
+    if (result < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        g_checkpoint.stats.failures++;
+        return -1;
+    }
+
+    struct stat info;
+    g_checkpoint.stats.last_bytes =
+        stat(g_checkpoint.path, &info) == 0 ? (uint64_t)info.st_size : 0;
+    g_checkpoint.stats.last_tasks = g_checkpoint.tasks;
+    return 0;
+}
+
+/**
+ * @brief Fork a snapshot writer; the parent returns once the fork does
+ */
+int rift_checkpoint_save(const char* path) {
+    if (!path || strlen(path) >= PATH_MAX || rift_simulated_current()) {
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_checkpoint.checkpoint_mutex);
+    if (g_checkpoint.writer != 0 && checkpoint_collect(false) > 0) {
+        g_checkpoint.stats.failures++;
+        pthread_mutex_unlock(&g_checkpoint.checkpoint_mutex);
+        fprintf(stderr, "[CHECKPOINT] Previous snapshot still being written\n");
+        return -1;
+    }
+
+    static rift_simulated_context_t* tasks[RIFT_MAX_THREAD_COUNT];
+    uint64_t start = checkpoint_now_ns();
+    // Listed under the locks the fork is taken under, so the child gets them as listed
+    uint32_t count = rift_simulated_fork_hold(tasks, RIFT_MAX_THREAD_COUNT);
+    struct timespec taken;
+    clock_gettime(CLOCK_REALTIME, &taken);
+
+    rift_telemetry_fork_hold();
+    pid_t pid = fork();
+    if (pid == 0) {
+        rift_telemetry_fork_release(true);
+        rift_simulated_fork_release(true);
+        _exit(checkpoint_write(path, tasks, count, &taken) == 0 ? 0 : 1);
+    }
+    rift_telemetry_fork_release(false);
+    rift_simulated_fork_release(false);
+    uint64_t pause_ns = checkpoint_now_ns() - start;
+
+    if (pid < 0) {
+        g_checkpoint.stats.failures++;
+        pthread_mutex_unlock(&g_checkpoint.checkpoint_mutex);
+        fprintf(stderr, "[CHECKPOINT] fork failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    g_checkpoint.writer = pid;
+    snprintf(g_checkpoint.path, sizeof(g_checkpoint.path), "%s", path);
+    g_checkpoint.tasks = count;
+    g_checkpoint.stats.checkpoints++;
+    g_checkpoint.stats.last_pause_ns = pause_ns;
+    if (pause_ns > g_checkpoint.stats.max_pause_ns) {
+        g_checkpoint.stats.max_pause_ns = pause_ns;
+    }
+    pthread_mutex_unlock(&g_checkpoint.checkpoint_mutex);
+
+    printf("[CHECKPOINT] Snapshot of %u tasks forked to writer %d (paused %.1f us)\n",
+           count, pid, (double)pause_ns / 1e3);
+    return 0;
+}
+
+/**
+ * @brief Wait for the writer of the last snapshot
+ */
+int rift_checkpoint_wait(void) {
+    pthread_mutex_lock(&g_checkpoint.checkpoint_mutex);
+    int result = g_checkpoint.writer != 0 ? checkpoint_collect(true) : -1;
+    pthread_mutex_unlock(&g_checkpoint.checkpoint_mutex);
+    return result;
+}
+
+// =============================================================================
+// RESTORE
+// =============================================================================
+
+static uint64_t checkpoint_map_id(uint64_t snapshot_id) {
+    for (uint32_t i = 0; i < g_checkpoint.restored_count; i++) {
+        if (g_checkpoint.restored_from[i] == snapshot_id) {
+            return g_checkpoint.restored_to[i];
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Read and check the header; the snapshot must come from this
+ *        process, running the image it runs now
+ * @return 0 on success, -1 on failure
+ */
+static int checkpoint_read_header(FILE* file, const char* path, checkpoint_header_t* header) {
+    if (fread(header, sizeof(*header), 1, file) != 1 ||
+        memcmp(header->magic, CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_LENGTH) != 0) {
+        fprintf(stderr, "[CHECKPOINT] %s is not a RIFT checkpoint\n", path);
+        return -1;
+    }
+    if (header->header_size != sizeof(checkpoint_header_t) ||
+        header->entry_size != sizeof(rift_spawn_telemetry_t) ||
+        header->task_size != sizeof(checkpoint_task_t) ||
+        header->registry_count > RIFT_MAX_THREAD_COUNT ||
+        header->task_count > RIFT_MAX_THREAD_COUNT) {
+        fprintf(stderr, "[CHECKPOINT] %s was written by an incompatible build\n", path);
+        return -1;
+    }
+    if (header->process_id != getpid() ||
+        header->image_anchor != (uint64_t)(uintptr_t)rift_checkpoint_save) {
+        fprintf(stderr, "[CHECKPOINT] %s was taken by another process (PID %d); "
+                "only a rollback of the same process can be restored\n",
+                path, header->process_id);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Read a task record and the stack that follows it
+ * @return 0 on success, -1 on a short or malformed record
+ */
+static int checkpoint_read_task(FILE* file, checkpoint_task_t* record, uint8_t* saved) {
+    if (fread(record, sizeof(*record), 1, file) != 1 ||
+        record->stack_size != RIFT_SIMULATED_STACK_SIZE ||
+        record->stack_saved > record->stack_size) {
+        return -1;
+    }
+    return fread(saved, 1, record->stack_saved, file) == record->stack_saved ? 0 : -1;
+}
+
+/**
+ * @brief Whether a recorded task can be restored: parked tasks wait on
+ *        state the snapshot does not hold
+ */
+static bool checkpoint_runnable(const checkpoint_task_t* record) {
+    return record->state == SIMULATED_TASK_READY;
+}
+
+/**
+ * @brief Create one recorded task under its restored parent and queue it
+ * @param saved Top of its stack as saved; its stack range is already claimed
+ * @return true if restored and the stack adopted, false if it could not be
+ *         created (the stack stays claimed)
+ */
+static bool checkpoint_recreate(const checkpoint_task_t* record, const uint8_t* saved) {
+    rift_governance_policy_t policy = record->policy;
+    policy.rift_id = 0;
+    policy.ipc_ring = NULL;
+    uint64_t parent_id = checkpoint_map_id(record->parent_rift_id);
+    rift_simulated_context_t* task = rift_simulated_create_task(parent_id, &policy,
+                                                                record->work_function,
+                                                                record->work_data,
+                                                                record->spawn_location);
+    if (!task) {
+        return false;
+    }
+
+    if (record->stack_saved > 0) {
+        rift_simulated_adopt_stack(task, record->stack_base, &record->coroutine);
+        uint8_t* stack_top = (uint8_t*)task->stack_base + task->stack_size;
+        memcpy(stack_top - record->stack_saved, saved, record->stack_saved);
+        task->base_context.context_switches = record->context_switches;
+        task->current_slice = record->current_slice;
+        g_checkpoint.stats.restored_resumed++;
+    } else {
+        g_checkpoint.stats.restored_fresh++;
+    }
+
+    uint32_t slot = g_checkpoint.restored_count++;
+    g_checkpoint.restored_from[slot] = record->rift_id;
+    g_checkpoint.restored_to[slot] = task->base_context.telemetry.rift_thread_id;
+
+    if (record->cancelled) {
+        rift_cancel_context(&task->base_context);
+    }
+    rift_replay_on_spawn(task);
+    rift_simulated_scheduler_enqueue(task);
+    return true;
+}
+
+/**
+ * @brief Roll the single-thread scheduler back to a snapshot of this same
+ *        process, refusing any other. The stacks of resumed tasks are claimed
+ *        in a first pass, before any task is created, so no new task is
+ *        handed a stack another one must get back.
+ */
+int rift_checkpoint_rollback(const char* path) {
+    rift_simulated_context_t* live[1];
+    if (!path || rift_simulated_current() || rift_simulated_list_tasks(live, 1) != 0) {
+        return -1;
+    }
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "[CHECKPOINT] Cannot open %s for restore\n", path);
+        return -1;
+    }
+
+    checkpoint_header_t header;
+    if (checkpoint_read_header(file, path, &header) != 0 ||
+        fseek(file, (long)header.registry_count * (long)sizeof(rift_spawn_telemetry_t),
+              SEEK_CUR) != 0) {
+        fclose(file);
+        return -1;
+    }
+    long tasks_offset = ftell(file);
+
+    static uint8_t saved[RIFT_SIMULATED_STACK_SIZE];
+    void* claimed[RIFT_MAX_THREAD_COUNT] = {NULL};
+    checkpoint_task_t record;
+    uint32_t complete = 0;
+    while (complete < header.task_count && checkpoint_read_task(file, &record, saved) == 0) {
+        if (checkpoint_runnable(&record) && record.stack_saved > 0) {
+            if (rift_simulated_claim_stack(record.stack_base) == 0) {
+                claimed[complete] = record.stack_base;
+            } else {
+                fprintf(stderr, "[CHECKPOINT] Stack of RIFT ID %lu is not free at %p\n",
+                        (unsigned long)record.rift_id, record.stack_base);
+            }
+        }
+        complete++;
+    }
+    if (complete < header.task_count) {
+        fprintf(stderr, "[CHECKPOINT] %s is truncated after %u tasks\n", path, complete);
+    }
+
+    pthread_mutex_lock(&g_checkpoint.checkpoint_mutex);
+    g_checkpoint.restored_count = 0;
+    int restored = 0;
+    uint32_t reread = 0;
+    bool rewound = fseek(file, tasks_offset, SEEK_SET) == 0;
+    for (; rewound && reread < complete && checkpoint_read_task(file, &record, saved) == 0;
+         reread++) {
+        // Matches the first pass unless the file changed in between
+        void* expected = record.stack_saved > 0 ? record.stack_base : NULL;
+        bool placeable = claimed[reread] == expected;
+        if (checkpoint_runnable(&record) && placeable && checkpoint_recreate(&record, saved)) {
+            claimed[reread] = NULL; // Adopted
+            restored++;
+        } else {
+            g_checkpoint.stats.restore_skipped++;
+        }
+    }
+    g_checkpoint.stats.restore_skipped += complete - reread;
+    // Stacks claimed for tasks that were skipped, failed or not read again
+    for (uint32_t i = 0; i < complete; i++) {
+        if (claimed[i]) {
+            rift_simulated_release_stack(claimed[i]);
+        }
+    }
+    pthread_mutex_unlock(&g_checkpoint.checkpoint_mutex);
+    fclose(file);
+
+    printf("[CHECKPOINT] Restored %d of %u tasks from %s (snapshot of PID %d)\n",
+           restored, header.task_count, path, header.process_id);
+    return restored;
+}
+
+uint64_t rift_checkpoint_restored_id(uint64_t snapshot_id) {
+    pthread_mutex_lock(&g_checkpoint.checkpoint_mutex);
+    uint64_t rift_id = checkpoint_map_id(snapshot_id);
+    pthread_mutex_unlock(&g_checkpoint.checkpoint_mutex);
+    return rift_id;
+}
+
+void rift_checkpoint_get_stats(rift_checkpoint_stats_t* stats) {
+    if (!stats) {
+        return;
+    }
+    pthread_mutex_lock(&g_checkpoint.checkpoint_mutex);
+    *stats = g_checkpoint.stats;
+    pthread_mutex_unlock(&g_checkpoint.checkpoint_mutex);
+}
@@ -0,0 +1,71 @@
+/**
+ * @file rift_simulated_checkpoint.h
+ * @brief Simulated Checkpoint Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_SIMULATED_CHECKPOINT_H
+#define RIFT_SIMULATED_CHECKPOINT_H
+
+#include "rift_common.h"
+
+// Checkpoint and restore statistics
+typedef struct {
+    uint64_t checkpoints;          // Snapshots forked
+    uint64_t failures;             // Snapshots refused, or whose writer failed
+    uint64_t last_pause_ns;        // Caller pause of the last snapshot (the fork)
+    uint64_t max_pause_ns;         // Longest caller pause
+    uint64_t last_bytes;           // Size of the last snapshot written
+    uint32_t last_tasks;           // Tasks in the last snapshot
+    uint64_t restored_resumed;     // Tasks restored mid-execution
+    uint64_t restored_fresh;       // Tasks restored that had not started
+    uint64_t restore_skipped;      // Parked tasks, or stacks that could not be placed
+} rift_checkpoint_stats_t;
+
+/**
+ * @brief Fork a copy-on-write snapshot of the process whose child writes the
+ *        registry and the single-thread scheduler's tasks to path, for a
+ *        later rift_checkpoint_rollback() of this process; call outside
+ *        tasks, from the thread driving the scheduler
+ * @param path Output file, replaced atomically once fully written
+ * @return 0 once the writer is forked, -1 on failure or while a previous
+ *         writer is still running
+ */
+int rift_checkpoint_save(const char* path);
+
+/**
+ * @brief Wait for the last snapshot's writer
+ * @return 0 if it was written, -1 if it failed or none was taken
+ */
+int rift_checkpoint_wait(void);
+
+/**
+ * @brief Roll the single-thread scheduler back to a snapshot taken earlier
+ *        by this same process; needs no live single-thread tasks
+ *
+ * Same process only: saved stacks hold return addresses and pointers into
+ * a heap that is not in the snapshot, so a snapshot cannot be restored in
+ * another process, after a restart, or after exec(). Such snapshots are
+ * refused.
+ *
+ * @param path Snapshot written by rift_checkpoint_save() in this process
+ * @return Number of tasks restored and queued, -1 on failure or for a
+ *         snapshot taken by another process or program image
+ */
+int rift_checkpoint_rollback(const char* path);
+
+/**
+ * @brief Map a RIFT ID from the last rolled-back snapshot to its new task
+ * @param snapshot_id RIFT ID recorded in the snapshot
+ * @return RIFT ID of the restored task, 0 if it was not restored
+ */
+uint64_t rift_checkpoint_restored_id(uint64_t snapshot_id);
+
+/**
+ * @brief Get checkpoint statistics
+ * @param stats Output statistics
+ */
+void rift_checkpoint_get_stats(rift_checkpoint_stats_t* stats);
+
+#endif // RIFT_SIMULATED_CHECKPOINT_H
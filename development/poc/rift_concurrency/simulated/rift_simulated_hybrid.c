@@ -0,0 +1,773 @@
+/**
+ * @file rift_simulated_hybrid.c
+ * @brief RIFT Hybrid M:N Concurrency - Simulated Tasks on a Work-Stealing Pool
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Runs simulated (coroutine) tasks on N worker threads. Each worker owns a
+ * Chase-Lev deque; spawns from inside a task and yielded tasks go to the
+ * local deque, spawns from outside the pool go to a shared injection queue,
+ * and idle workers steal from randomly chosen victims.
+ *
+ * Workers consume their own deque from the top (FIFO) so a yielding task is
+ * queued behind its siblings instead of being resumed immediately.
+ *
+ * A policy's max_queued bounds the ready tasks across all queues at spawn.
+ * At the bound a spawning task yields until workers make room and any
+ * other thread sleeps; fail-fast spawns are refused and caller-runs spawns
+ * take their first slice on the spawning thread, joining the queues if
+ * they yield.
+ *
+ * Cleanup destroys queued tasks without running them. Tasks parked on a
+ * channel, timer or I/O are cancelled instead and resumed on the cleaning
+ * thread until their cancellable wait returns and they finish.
+ */
+
+#include "rift_simulated_hybrid.h"
+#include "rift_telemetry.h"
+#include "rift_deque.h"
+#include "rift_signal.h"
+#include "rift_cancel.h"
+#include "rift_simulated.h"
+#include "rift_simulated_io.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sched.h>
+
+// =============================================================================
+// POOL STATE
+// =============================================================================
+
+typedef struct {
+    rift_deque_t deque;                 // Local work-stealing deque
+    pthread_t thread;                   // Worker thread handle
+    uint32_t index;                     // Worker index within pool
+    uint64_t rng_state;                 // Victim selection PRNG state
+    uint32_t poll_tick;                 // Slices since last reactor poll
+    _Atomic uint64_t slices_executed;   // Coroutine resumptions
+    _Atomic uint64_t tasks_completed;   // Tasks finished on this worker
+    _Atomic uint64_t steals;            // Successful steals from peers
+} rift_hybrid_worker_t;
+
+typedef struct {
+    rift_hybrid_worker_t* workers;
+    uint32_t worker_count;
+
+    // Injection queue for spawns from non-worker threads
+    rift_simulated_context_t* inject_head;
+    rift_simulated_context_t* inject_tail;
+    pthread_mutex_t inject_mutex;
+    _Atomic int64_t inject_pending;
+    _Atomic uint64_t injected;
+
+    // Queued task count across all deques and injection queue
+    _Atomic int64_t queued;
+    _Atomic int64_t queued_peak;
+    _Atomic int64_t live_tasks;
+
+    // Idle parking, drain notification and spawns blocked at max_queued
+    pthread_mutex_t idle_mutex;
+    pthread_cond_t idle_condition;
+    pthread_cond_t drained_condition;
+    pthread_cond_t space_condition;
+    _Atomic uint32_t idle_workers;
+    _Atomic uint32_t blocked_spawners;
+
+    _Atomic bool shutdown;
+    bool initialized;
+} rift_hybrid_pool_t;
+
+static rift_hybrid_pool_t g_hybrid_pool = {
+    .inject_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .idle_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .idle_condition = PTHREAD_COND_INITIALIZER,
+    .drained_condition = PTHREAD_COND_INITIALIZER,
+    .space_condition = PTHREAD_COND_INITIALIZER
+};
+
+static __thread rift_hybrid_worker_t* t_hybrid_worker = NULL;
+
+/**
+ * @brief Worker owning the calling thread; read through a call because a
+ *        coroutine may have migrated since it last looked
+ */
+static __attribute__((noinline)) rift_hybrid_worker_t* hybrid_current_worker(void) {
+    return t_hybrid_worker;
+}
+
+// =============================================================================
+// QUEUEING AND WAKEUP
+// =============================================================================
+
+/**
+ * @brief Account for newly queued tasks and track the peak depth
+ */
+static void hybrid_count_queued(uint32_t count) {
+    int64_t depth = atomic_fetch_add(&g_hybrid_pool.queued, count) + count;
+    int64_t peak = atomic_load_explicit(&g_hybrid_pool.queued_peak, memory_order_relaxed);
+    while (depth > peak &&
+           !atomic_compare_exchange_weak_explicit(&g_hybrid_pool.queued_peak, &peak, depth,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief Wake spawners blocked at max_queued after a task left the queue
+ */
+static void hybrid_notify_space(void) {
+    if (atomic_load(&g_hybrid_pool.blocked_spawners) == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_hybrid_pool.idle_mutex);
+    pthread_cond_broadcast(&g_hybrid_pool.space_condition);
+    pthread_mutex_unlock(&g_hybrid_pool.idle_mutex);
+}
+
+/**
+ * @brief Wake one parked worker if any are idle
+ */
+static void hybrid_notify(void) {
+    if (atomic_load(&g_hybrid_pool.idle_workers) == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_hybrid_pool.idle_mutex);
+    pthread_cond_signal(&g_hybrid_pool.idle_condition);
+    pthread_mutex_unlock(&g_hybrid_pool.idle_mutex);
+}
+
+static void hybrid_inject(rift_simulated_context_t* task) {
+    task->next = NULL;
+
+    pthread_mutex_lock(&g_hybrid_pool.inject_mutex);
+    if (g_hybrid_pool.inject_tail) {
+        g_hybrid_pool.inject_tail->next = task;
+    } else {
+        g_hybrid_pool.inject_head = task;
+    }
+    g_hybrid_pool.inject_tail = task;
+    atomic_fetch_add(&g_hybrid_pool.inject_pending, 1);
+    pthread_mutex_unlock(&g_hybrid_pool.inject_mutex);
+
+    atomic_fetch_add_explicit(&g_hybrid_pool.injected, 1, memory_order_relaxed);
+}
+
+/**
+ * @brief Splice a pre-linked chain onto the injection queue
+ */
+static void hybrid_inject_chain(rift_simulated_context_t* head, rift_simulated_context_t* tail,
+                                uint32_t count) {
+    tail->next = NULL;
+
+    pthread_mutex_lock(&g_hybrid_pool.inject_mutex);
+    if (g_hybrid_pool.inject_tail) {
+        g_hybrid_pool.inject_tail->next = head;
+    } else {
+        g_hybrid_pool.inject_head = head;
+    }
+    g_hybrid_pool.inject_tail = tail;
+    atomic_fetch_add(&g_hybrid_pool.inject_pending, count);
+    pthread_mutex_unlock(&g_hybrid_pool.inject_mutex);
+
+    atomic_fetch_add_explicit(&g_hybrid_pool.injected, count, memory_order_relaxed);
+}
+
+static rift_simulated_context_t* hybrid_inject_pop(void) {
+    if (atomic_load(&g_hybrid_pool.inject_pending) <= 0) {
+        return NULL; // Fast path: skip the lock when nothing is injected
+    }
+
+    pthread_mutex_lock(&g_hybrid_pool.inject_mutex);
+    rift_simulated_context_t* task = g_hybrid_pool.inject_head;
+    if (task) {
+        g_hybrid_pool.inject_head = task->next;
+        if (!g_hybrid_pool.inject_head) {
+            g_hybrid_pool.inject_tail = NULL;
+        }
+        task->next = NULL;
+        atomic_fetch_sub(&g_hybrid_pool.inject_pending, 1);
+    }
+    pthread_mutex_unlock(&g_hybrid_pool.inject_mutex);
+    return task;
+}
+
+/**
+ * @brief Queue task locally when called from a worker, else inject
+ */
+static void hybrid_submit(rift_simulated_context_t* task) {
+    rift_hybrid_worker_t* worker = hybrid_current_worker();
+
+    hybrid_count_queued(1);
+    if (!worker || rift_deque_push(&worker->deque, task) != 0) {
+        hybrid_inject(task);
+    }
+    hybrid_notify();
+}
+
+/**
+ * @brief Queue a batch with one counter update; wakes as many idle workers
+ *        as there are tasks
+ */
+static void hybrid_submit_batch(rift_simulated_context_t** tasks, uint32_t count) {
+    rift_hybrid_worker_t* worker = hybrid_current_worker();
+
+    hybrid_count_queued(count);
+    uint32_t pushed = 0;
+    if (worker) {
+        while (pushed < count && rift_deque_push(&worker->deque, tasks[pushed]) == 0) {
+            pushed++;
+        }
+    }
+
+    if (pushed < count) {
+        for (uint32_t i = pushed; i + 1 < count; i++) {
+            tasks[i]->next = tasks[i + 1];
+        }
+        hybrid_inject_chain(tasks[pushed], tasks[count - 1], count - pushed);
+    }
+
+    uint32_t idle = atomic_load(&g_hybrid_pool.idle_workers);
+    if (idle > 0) {
+        pthread_mutex_lock(&g_hybrid_pool.idle_mutex);
+        if (count >= idle) {
+            pthread_cond_broadcast(&g_hybrid_pool.idle_condition);
+        } else {
+            for (uint32_t i = 0; i < count; i++) {
+                pthread_cond_signal(&g_hybrid_pool.idle_condition);
+            }
+        }
+        pthread_mutex_unlock(&g_hybrid_pool.idle_mutex);
+    }
+}
+
+static uint64_t hybrid_next_random(rift_hybrid_worker_t* worker) {
+    // xorshift64 - cheap victim selection, quality is irrelevant here
+    uint64_t x = worker->rng_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    worker->rng_state = x;
+    return x;
+}
+
+/**
+ * @brief Try every peer once, starting at a random victim
+ */
+static rift_simulated_context_t* hybrid_steal(rift_hybrid_worker_t* self) {
+    uint32_t count = g_hybrid_pool.worker_count;
+    if (count < 2) {
+        return NULL;
+    }
+
+    uint32_t start = (uint32_t)(hybrid_next_random(self) % count);
+    for (uint32_t i = 0; i < count; i++) {
+        rift_hybrid_worker_t* victim = &g_hybrid_pool.workers[(start + i) % count];
+        if (victim == self) {
+            continue;
+        }
+
+        rift_simulated_context_t* task = rift_deque_steal(&victim->deque);
+        if (task) {
+            atomic_fetch_add_explicit(&self->steals, 1, memory_order_relaxed);
+            return task;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Park until work is queued or the pool shuts down
+ */
+static void hybrid_park(void) {
+    pthread_mutex_lock(&g_hybrid_pool.idle_mutex);
+    atomic_fetch_add(&g_hybrid_pool.idle_workers, 1);
+
+    // Recheck after advertising idleness so a concurrent submit cannot be lost
+    if (atomic_load(&g_hybrid_pool.queued) <= 0 && !atomic_load(&g_hybrid_pool.shutdown)) {
+        pthread_cond_wait(&g_hybrid_pool.idle_condition, &g_hybrid_pool.idle_mutex);
+    }
+
+    atomic_fetch_sub(&g_hybrid_pool.idle_workers, 1);
+    pthread_mutex_unlock(&g_hybrid_pool.idle_mutex);
+}
+
+// =============================================================================
+// WORKER EXECUTION
+// =============================================================================
+
+static void hybrid_task_finished(rift_hybrid_worker_t* worker, rift_simulated_context_t* task) {
+    rift_simulated_destroy_task(task);
+    if (worker) {
+        atomic_fetch_add_explicit(&worker->tasks_completed, 1, memory_order_relaxed);
+    }
+
+    if (atomic_fetch_sub(&g_hybrid_pool.live_tasks, 1) == 1) {
+        pthread_mutex_lock(&g_hybrid_pool.idle_mutex);
+        pthread_cond_broadcast(&g_hybrid_pool.drained_condition);
+        pthread_mutex_unlock(&g_hybrid_pool.idle_mutex);
+    }
+}
+
+static void* hybrid_worker_main(void* arg) {
+    rift_hybrid_worker_t* worker = (rift_hybrid_worker_t*)arg;
+    t_hybrid_worker = worker;
+    rift_signal_block_thread();
+
+    while (!atomic_load_explicit(&g_hybrid_pool.shutdown, memory_order_acquire)) {
+        rift_simulated_context_t* task = rift_deque_steal(&worker->deque);
+        if (!task) {
+            task = hybrid_inject_pop();
+        }
+        if (!task) {
+            task = hybrid_steal(worker);
+        }
+        if (!task) {
+            // Idle worker with outstanding I/O becomes the reactor poller;
+            // a worker that loses the poller race parks as usual
+            if (rift_simulated_io_pending() > 0 &&
+                rift_simulated_io_poll(RIFT_SIMULATED_IO_IDLE_TIMEOUT_MS) >= 0) {
+                continue;
+            }
+            sched_yield();
+            if (atomic_load(&g_hybrid_pool.queued) <= 0) {
+                hybrid_park();
+            }
+            continue;
+        }
+
+        atomic_fetch_sub(&g_hybrid_pool.queued, 1);
+        hybrid_notify_space();
+
+        // Harvest completions periodically so busy workers do not starve I/O
+        if ((++worker->poll_tick % RIFT_HYBRID_IO_POLL_INTERVAL) == 0 &&
+            rift_simulated_io_pending() > 0) {
+            rift_simulated_io_poll(0);
+        }
+
+        rift_simulated_task_state_t state = rift_simulated_resume(task);
+        atomic_fetch_add_explicit(&worker->slices_executed, 1, memory_order_relaxed);
+
+        if (state == SIMULATED_TASK_READY) {
+            // Yielded: back on the local deque where idle peers can steal it
+            hybrid_submit(task);
+        } else if (state == SIMULATED_TASK_FINISHED) {
+            hybrid_task_finished(worker, task);
+        }
+    }
+
+    t_hybrid_worker = NULL;
+    return NULL;
+}
+
+// =============================================================================
+// BACKPRESSURE
+// =============================================================================
+
+static uint64_t hybrid_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Whether count more tasks fit under the bound; a batch larger than
+ *        the bound is let in once nothing is queued
+ */
+static bool hybrid_has_room(uint32_t count, uint32_t max_queued) {
+    int64_t depth = atomic_load(&g_hybrid_pool.queued);
+    return depth <= 0 || depth + count <= max_queued;
+}
+
+/**
+ * @brief Hold a spawn at the pool's bound according to its policy
+ * @return 0 to queue, 1 to run on the caller, -1 if refused
+ */
+static int hybrid_throttle(const rift_governance_policy_t* policy, uint32_t count) {
+    if (!policy || policy->max_queued == 0 || hybrid_has_room(count, policy->max_queued)) {
+        return 0;
+    }
+
+    int64_t queued = atomic_load(&g_hybrid_pool.queued);
+    uint32_t depth = queued > 0 ? (uint32_t)queued : 0;
+    if (policy->overflow_policy == OVERFLOW_FAIL_FAST) {
+        printf("[HYBRID] Spawn rejected: ready queue full (%u/%u)\n", depth,
+               policy->max_queued);
+        rift_telemetry_record_backpressure(OVERFLOW_FAIL_FAST, depth, policy->max_queued, 0);
+        return -1;
+    }
+    if (policy->overflow_policy == OVERFLOW_CALLER_RUNS) {
+        rift_telemetry_record_backpressure(OVERFLOW_CALLER_RUNS, depth, policy->max_queued, 0);
+        return 1;
+    }
+
+    uint64_t start = hybrid_now_ns();
+    if (rift_simulated_current()) {
+        // A task gives its worker back to the queue it is waiting on
+        while (!hybrid_has_room(count, policy->max_queued)) {
+            rift_simulated_yield();
+        }
+    } else {
+        pthread_mutex_lock(&g_hybrid_pool.idle_mutex);
+        atomic_fetch_add(&g_hybrid_pool.blocked_spawners, 1);
+        while (!hybrid_has_room(count, policy->max_queued) &&
+               !atomic_load(&g_hybrid_pool.shutdown)) {
+            pthread_cond_wait(&g_hybrid_pool.space_condition, &g_hybrid_pool.idle_mutex);
+        }
+        atomic_fetch_sub(&g_hybrid_pool.blocked_spawners, 1);
+        pthread_mutex_unlock(&g_hybrid_pool.idle_mutex);
+    }
+    rift_telemetry_record_backpressure(OVERFLOW_BLOCK, depth, policy->max_queued,
+                                       hybrid_now_ns() - start);
+    return 0;
+}
+
+/**
+ * @brief Run a new task's first slice on the spawning thread; a yielding
+ *        task is submitted like any other rather than resumed in a loop
+ *        that starves the work it may be waiting on, and a parking task is
+ *        requeued by its waker as usual
+ */
+static void hybrid_run_inline(rift_simulated_context_t* task) {
+    rift_hybrid_worker_t* worker = hybrid_current_worker();
+    rift_simulated_task_state_t state = rift_simulated_resume(task);
+    if (worker) {
+        atomic_fetch_add_explicit(&worker->slices_executed, 1, memory_order_relaxed);
+    }
+
+    if (state == SIMULATED_TASK_READY) {
+        hybrid_submit(task);
+    } else if (state == SIMULATED_TASK_FINISHED) {
+        hybrid_task_finished(worker, task);
+    }
+}
+
+// =============================================================================
+// PUBLIC INTERFACE
+// =============================================================================
+
+/**
+ * @brief Start hybrid pool with worker_count threads (0 selects online CPUs)
+ */
+int rift_hybrid_init(uint32_t worker_count) {
+    if (g_hybrid_pool.initialized) {
+        return 0;
+    }
+
+    if (rift_simulated_init() != 0) {
+        return -1;
+    }
+
+    if (worker_count == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        worker_count = cpus > 0 ? (uint32_t)cpus : 1;
+    }
+    if (worker_count > RIFT_HYBRID_MAX_WORKERS) {
+        worker_count = RIFT_HYBRID_MAX_WORKERS;
+    }
+
+    g_hybrid_pool.workers = calloc(worker_count, sizeof(rift_hybrid_worker_t));
+    if (!g_hybrid_pool.workers) {
+        return -1;
+    }
+
+    g_hybrid_pool.worker_count = worker_count;
+    g_hybrid_pool.inject_head = NULL;
+    g_hybrid_pool.inject_tail = NULL;
+    atomic_store(&g_hybrid_pool.inject_pending, 0);
+    atomic_store(&g_hybrid_pool.injected, 0);
+    atomic_store(&g_hybrid_pool.queued, 0);
+    atomic_store(&g_hybrid_pool.queued_peak, 0);
+    atomic_store(&g_hybrid_pool.live_tasks, 0);
+    atomic_store(&g_hybrid_pool.idle_workers, 0);
+    atomic_store(&g_hybrid_pool.blocked_spawners, 0);
+    atomic_store(&g_hybrid_pool.shutdown, false);
+
+    for (uint32_t i = 0; i < worker_count; i++) {
+        rift_hybrid_worker_t* worker = &g_hybrid_pool.workers[i];
+        worker->index = i;
+        worker->rng_state = 0x9E3779B97F4A7C15ULL * (i + 1);
+        if (rift_deque_init(&worker->deque, 64) != 0) {
+            // Not initialized yet, so rift_hybrid_cleanup() would skip this
+            for (uint32_t j = 0; j < i; j++) {
+                rift_deque_destroy(&g_hybrid_pool.workers[j].deque);
+            }
+            free(g_hybrid_pool.workers);
+            g_hybrid_pool.workers = NULL;
+            g_hybrid_pool.worker_count = 0;
+            return -1;
+        }
+    }
+
+    g_hybrid_pool.initialized = true;
+
+    for (uint32_t i = 0; i < worker_count; i++) {
+        if (pthread_create(&g_hybrid_pool.workers[i].thread, NULL,
+                           hybrid_worker_main, &g_hybrid_pool.workers[i]) != 0) {
+            fprintf(stderr, "[HYBRID] Failed to start worker %u\n", i);
+            for (uint32_t j = i; j < worker_count; j++) {
+                rift_deque_destroy(&g_hybrid_pool.workers[j].deque);
+            }
+            g_hybrid_pool.worker_count = i;
+            rift_hybrid_cleanup();
+            return -1;
+        }
+    }
+
+    printf("[HYBRID] Initialized - %u work-stealing workers\n", worker_count);
+    return 0;
+}
+
+/**
+ * @brief Spawn simulated task onto the hybrid pool
+ */
+uint64_t rift_hybrid_spawn(uint64_t parent_id,
+                           const rift_governance_policy_t* policy,
+                           void (*work_func)(void*),
+                           void* work_data,
+                           const char* spawn_location) {
+    if (!g_hybrid_pool.initialized) {
+        fprintf(stderr, "[HYBRID] Spawn rejected: pool not initialized\n");
+        return 0;
+    }
+    if (rift_simulated_forked_child()) {
+        fprintf(stderr, "[HYBRID] Spawn rejected: pool belongs to the parent process\n");
+        return 0;
+    }
+
+    if (!policy) {
+        return 0;
+    }
+
+    int throttle = hybrid_throttle(policy, 1);
+    if (throttle < 0) {
+        return 0;
+    }
+
+    // Deadline resolution and admission at create depend on the mode
+    rift_governance_policy_t hybrid_policy = *policy;
+    hybrid_policy.mode = CONCURRENCY_HYBRID;
+    rift_simulated_context_t* task = rift_simulated_create_task(parent_id, &hybrid_policy,
+                                                                work_func, work_data,
+                                                                spawn_location);
+    if (!task) {
+        return 0;
+    }
+
+    uint64_t rift_id = task->base_context.telemetry.rift_thread_id;
+
+    atomic_fetch_add(&g_hybrid_pool.live_tasks, 1);
+    if (throttle > 0) {
+        hybrid_run_inline(task); // May finish and free the task
+    } else {
+        hybrid_submit(task);
+    }
+    return rift_id;
+}
+
+/**
+ * @brief Spawn count hybrid tasks with one validation and telemetry pass
+ * @return RIFT ID of the first task; the batch holds IDs first..first+count-1
+ */
+uint64_t rift_hybrid_spawn_batch(uint64_t parent_id,
+                                 const rift_governance_policy_t* policy,
+                                 void (*work_func)(void*),
+                                 void** data_array,
+                                 uint32_t count,
+                                 const char* spawn_location) {
+    if (!g_hybrid_pool.initialized) {
+        fprintf(stderr, "[HYBRID] Spawn rejected: pool not initialized\n");
+        return 0;
+    }
+    if (rift_simulated_forked_child()) {
+        fprintf(stderr, "[HYBRID] Spawn rejected: pool belongs to the parent process\n");
+        return 0;
+    }
+
+    if (!policy || count == 0 || count > RIFT_MAX_THREAD_COUNT) {
+        return 0;
+    }
+
+    int throttle = hybrid_throttle(policy, count);
+    if (throttle < 0) {
+        return 0;
+    }
+
+    rift_governance_policy_t hybrid_policy = *policy;
+    hybrid_policy.mode = CONCURRENCY_HYBRID;
+    rift_simulated_context_t* tasks[RIFT_MAX_THREAD_COUNT];
+    if (rift_simulated_create_task_batch(parent_id, &hybrid_policy, work_func, data_array, count,
+                                         spawn_location, tasks) != count) {
+        return 0;
+    }
+
+    uint64_t first_id = tasks[0]->base_context.telemetry.rift_thread_id;
+
+    atomic_fetch_add(&g_hybrid_pool.live_tasks, count);
+    if (throttle > 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            hybrid_run_inline(tasks[i]);
+        }
+        return first_id;
+    }
+    hybrid_submit_batch(tasks, count);
+    return first_id;
+}
+
+/**
+ * @brief Requeue woken task; lands on the caller's deque when it is a worker
+ */
+void rift_hybrid_requeue(rift_simulated_context_t* task) {
+    hybrid_submit(task);
+}
+
+/**
+ * @brief Block until every hybrid task has finished
+ */
+void rift_hybrid_wait(void) {
+    if (!g_hybrid_pool.initialized) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_hybrid_pool.idle_mutex);
+    while (atomic_load(&g_hybrid_pool.live_tasks) > 0) {
+        pthread_cond_wait(&g_hybrid_pool.drained_condition, &g_hybrid_pool.idle_mutex);
+    }
+    pthread_mutex_unlock(&g_hybrid_pool.idle_mutex);
+}
+
+bool rift_hybrid_active(void) {
+    return g_hybrid_pool.initialized;
+}
+
+/**
+ * @brief Collect aggregate pool statistics
+ */
+void rift_hybrid_get_stats(rift_hybrid_stats_t* stats) {
+    if (!stats) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->worker_count = g_hybrid_pool.worker_count;
+    stats->tasks_injected = atomic_load_explicit(&g_hybrid_pool.injected, memory_order_relaxed);
+    stats->tasks_live = (uint64_t)atomic_load(&g_hybrid_pool.live_tasks);
+    int64_t depth = atomic_load(&g_hybrid_pool.queued);
+    stats->queue_depth = depth > 0 ? (uint32_t)depth : 0;
+    stats->queue_depth_peak = (uint32_t)atomic_load(&g_hybrid_pool.queued_peak);
+
+    for (uint32_t i = 0; i < g_hybrid_pool.worker_count; i++) {
+        rift_hybrid_worker_t* worker = &g_hybrid_pool.workers[i];
+        stats->slices_executed += atomic_load_explicit(&worker->slices_executed,
+                                                       memory_order_relaxed);
+        stats->tasks_completed += atomic_load_explicit(&worker->tasks_completed,
+                                                       memory_order_relaxed);
+        stats->steals += atomic_load_explicit(&worker->steals, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Print per-worker execution report
+ */
+void rift_hybrid_print_report(void) {
+    if (!g_hybrid_pool.initialized) {
+        printf("[HYBRID] Not initialized\n");
+        return;
+    }
+
+    printf("\n=== RIFT HYBRID POOL REPORT ===\n");
+    printf("%-8s %-12s %-12s %-10s %s\n", "WORKER", "SLICES", "COMPLETED", "STEALS", "QUEUED");
+    printf("%-8s %-12s %-12s %-10s %s\n", "------", "------", "---------", "------", "------");
+
+    for (uint32_t i = 0; i < g_hybrid_pool.worker_count; i++) {
+        rift_hybrid_worker_t* worker = &g_hybrid_pool.workers[i];
+        printf("%-8u %-12lu %-12lu %-10lu %ld\n", i,
+               (unsigned long)atomic_load(&worker->slices_executed),
+               (unsigned long)atomic_load(&worker->tasks_completed),
+               (unsigned long)atomic_load(&worker->steals),
+               (long)rift_deque_size(&worker->deque));
+    }
+
+    printf("Injected: %lu  Live: %ld  Peak queue: %ld\n",
+           (unsigned long)atomic_load(&g_hybrid_pool.injected),
+           (long)atomic_load(&g_hybrid_pool.live_tasks),
+           (long)atomic_load(&g_hybrid_pool.queued_peak));
+    printf("=== END HYBRID POOL REPORT ===\n\n");
+}
+
+/**
+ * @brief Cancel the tasks still parked once the workers have stopped and
+ *        run them on the calling thread until they finish; their waiter
+ *        records live on their own stacks, so freeing them parked would
+ *        leave those dangling in channels, timers and the reactor
+ */
+static void hybrid_unwind_parked(void) {
+    rift_simulated_context_t* parked[RIFT_MAX_THREAD_COUNT];
+    uint32_t count = rift_simulated_list_hybrid_tasks(parked, RIFT_MAX_THREAD_COUNT);
+    for (uint32_t i = 0; i < count; i++) {
+        rift_cancel_context(&parked[i]->base_context); // Woken tasks are injected
+    }
+
+    rift_simulated_context_t* task;
+    for (uint32_t slice = 0; slice < RIFT_HYBRID_UNWIND_SLICES &&
+                             (task = hybrid_inject_pop()) != NULL; slice++) {
+        atomic_fetch_sub(&g_hybrid_pool.queued, 1);
+        rift_simulated_task_state_t state = rift_simulated_resume(task);
+        if (state == SIMULATED_TASK_READY) {
+            hybrid_submit(task);
+        } else if (state == SIMULATED_TASK_FINISHED) {
+            hybrid_task_finished(NULL, task);
+        }
+    }
+    while ((task = hybrid_inject_pop()) != NULL) {
+        rift_simulated_destroy_task(task);
+    }
+
+    uint32_t leaked = rift_simulated_list_hybrid_tasks(parked, RIFT_MAX_THREAD_COUNT);
+    if (leaked > 0) {
+        fprintf(stderr, "[HYBRID] %u tasks still parked at shutdown were not freed\n", leaked);
+    }
+}
+
+/**
+ * @brief Stop workers, destroy any tasks still queued and unwind parked ones
+ */
+void rift_hybrid_cleanup(void) {
+    if (!g_hybrid_pool.initialized) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_hybrid_pool.idle_mutex);
+    atomic_store_explicit(&g_hybrid_pool.shutdown, true, memory_order_release);
+    pthread_cond_broadcast(&g_hybrid_pool.idle_condition);
+    pthread_cond_broadcast(&g_hybrid_pool.space_condition);
+    pthread_mutex_unlock(&g_hybrid_pool.idle_mutex);
+
+    for (uint32_t i = 0; i < g_hybrid_pool.worker_count; i++) {
+        pthread_join(g_hybrid_pool.workers[i].thread, NULL);
+    }
+
+    for (uint32_t i = 0; i < g_hybrid_pool.worker_count; i++) {
+        rift_hybrid_worker_t* worker = &g_hybrid_pool.workers[i];
+        rift_simulated_context_t* task;
+        while ((task = rift_deque_steal(&worker->deque)) != NULL) {
+            rift_simulated_destroy_task(task);
+        }
+        rift_deque_destroy(&worker->deque);
+    }
+
+    rift_simulated_context_t* task;
+    while ((task = hybrid_inject_pop()) != NULL) {
+        rift_simulated_destroy_task(task);
+    }
+    hybrid_unwind_parked();
+
+    free(g_hybrid_pool.workers);
+    g_hybrid_pool.workers = NULL;
+    g_hybrid_pool.worker_count = 0;
+    g_hybrid_pool.initialized = false;
+
+    printf("[HYBRID] Pool stopped\n");
+}
@@ -0,0 +1,104 @@
+/**
+ * @file rift_simulated_hybrid.h
+ * @brief Hybrid M:N Concurrency Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_SIMULATED_HYBRID_H
+#define RIFT_SIMULATED_HYBRID_H
+
+#include "rift_common.h"
+#include "rift_simulated.h"
+
+#define RIFT_HYBRID_MAX_WORKERS 64
+#define RIFT_HYBRID_IO_POLL_INTERVAL 64
+#define RIFT_HYBRID_UNWIND_SLICES 4096    // Slices cleanup gives cancelled parked tasks
+
+// Aggregate hybrid pool statistics
+typedef struct {
+    uint32_t worker_count;                // Worker threads in pool
+    uint64_t slices_executed;             // Coroutine resumptions
+    uint64_t tasks_completed;             // Finished tasks
+    uint64_t tasks_injected;              // Spawns from outside the pool
+    uint64_t tasks_live;                  // Spawned but not finished
+    uint64_t steals;                      // Successful steals
+    uint32_t queue_depth;                 // Ready tasks queued
+    uint32_t queue_depth_peak;            // Highest queue depth observed
+} rift_hybrid_stats_t;
+
+/**
+ * @brief Start hybrid work-stealing pool
+ * @param worker_count Worker threads (0 for online CPU count)
+ * @return 0 on success, error code otherwise
+ */
+int rift_hybrid_init(uint32_t worker_count);
+
+/**
+ * @brief Spawn simulated task onto the hybrid pool
+ * @param parent_id Parent RIFT thread ID (0 for root)
+ * @param policy Governance policy for new task
+ * @param work_func Work function to execute
+ * @param work_data Data to pass to work function
+ * @param spawn_location Source location of spawn
+ * @return RIFT thread ID on success, 0 on failure
+ */
+uint64_t rift_hybrid_spawn(uint64_t parent_id,
+                           const rift_governance_policy_t* policy,
+                           void (*work_func)(void*),
+                           void* work_data,
+                           const char* spawn_location);
+
+/**
+ * @brief Spawn batch of simulated tasks onto the hybrid pool
+ * @param parent_id Parent RIFT thread ID (0 for root)
+ * @param policy Governance policy for every task
+ * @param work_func Work function to execute
+ * @param data_array Per-task work data (may be NULL)
+ * @param count Number of tasks
+ * @param spawn_location Source location of spawn
+ * @return First RIFT thread ID of a contiguous range, 0 on failure
+ */
+uint64_t rift_hybrid_spawn_batch(uint64_t parent_id,
+                                 const rift_governance_policy_t* policy,
+                                 void (*work_func)(void*),
+                                 void** data_array,
+                                 uint32_t count,
+                                 const char* spawn_location);
+
+/**
+ * @brief Requeue woken hybrid task
+ * @param task Task made runnable by rift_simulated_wake()
+ */
+void rift_hybrid_requeue(rift_simulated_context_t* task);
+
+/**
+ * @brief Block until all hybrid tasks have finished
+ */
+void rift_hybrid_wait(void);
+
+/**
+ * @brief Check whether the hybrid pool is running
+ * @return true between rift_hybrid_init() and rift_hybrid_cleanup()
+ */
+bool rift_hybrid_active(void);
+
+/**
+ * @brief Collect aggregate pool statistics
+ * @param stats Output statistics
+ */
+void rift_hybrid_get_stats(rift_hybrid_stats_t* stats);
+
+/**
+ * @brief Print per-worker execution report
+ */
+void rift_hybrid_print_report(void);
+
+/**
+ * @brief Stop pool and destroy queued tasks; tasks parked in cancellable
+ *        waits are cancelled and run on the caller until they finish, and
+ *        any left parked are reported, not freed
+ */
+void rift_hybrid_cleanup(void);
+
+#endif // RIFT_SIMULATED_HYBRID_H
@@ -0,0 +1,684 @@
+/**
+ * @file rift_simulated_io.c
+ * @brief RIFT Simulated Concurrency - I/O Reactor
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Lets simulated tasks perform socket and pipe I/O without blocking their
+ * scheduler thread. An operation is submitted to io_uring (or, where io_uring
+ * is unavailable, armed as a one-shot epoll readiness wait), the task parks,
+ * and the scheduler cycle harvests completions and wakes the waiting tasks.
+ *
+ * The request record lives on the parked task's coroutine stack, so no
+ * allocation happens per operation. In epoll mode at most one task may wait
+ * on a given descriptor at a time.
+ *
+ * Waits are cancellable. The harvester and the canceller race for a claim
+ * word in the request; when cancellation wins, the task withdraws the
+ * operation before its stack frame may go: io_uring operations are cancelled
+ * with IORING_OP_ASYNC_CANCEL and their CQE awaited, since it still names
+ * the request, and epoll waits are deleted from the interest list and any
+ * harvest already holding the event is waited out.
+ *
+ * With signal routing on (rift_signal.c) the reactor also watches the
+ * signalfd - a one-shot poll re-armed after each completion under
+ * io_uring, a level-triggered member of the interest list under epoll -
+ * and dispatches routed signals from whichever thread harvests.
+ */
+
+#include "rift_simulated_io.h"
+#include "rift_cancel.h"
+#include "rift_signal.h"
+#include "rift_simulated.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+// =============================================================================
+// REACTOR STATE
+// =============================================================================
+
+// Landing of an io_uring CQE for a request cancellation withdrew
+enum {
+    RIFT_IO_LANDING_NONE,
+    RIFT_IO_LANDING_PARKED,           // Task parked for the CQE
+    RIFT_IO_LANDING_DONE              // CQE harvested
+};
+
+// In-flight operation, allocated on the parked task's stack
+typedef struct {
+    rift_simulated_context_t* task;   // Task to wake on completion
+    int32_t result;                   // io_uring res or epoll event mask
+    _Atomic int claim;                // Harvester and canceller race for it
+    _Atomic int landing;              // RIFT_IO_LANDING_* once withdrawn
+} rift_io_request_t;
+
+typedef struct {
+    int ring_fd;
+    void* sq_ring;
+    size_t sq_ring_size;
+    void* cq_ring;
+    size_t cq_ring_size;
+    struct io_uring_sqe* sqes;
+    size_t sqes_size;
+
+    _Atomic uint32_t* sq_head;
+    _Atomic uint32_t* sq_tail;
+    uint32_t* sq_array;
+    uint32_t sq_mask;
+    uint32_t sq_entries;
+
+    _Atomic uint32_t* cq_head;
+    _Atomic uint32_t* cq_tail;
+    struct io_uring_cqe* cqes;
+    uint32_t cq_mask;
+} rift_io_uring_t;
+
+typedef struct {
+    rift_io_backend_t backend;
+    rift_io_uring_t uring;
+    int epoll_fd;
+    _Atomic uint32_t pending;
+    _Atomic uint32_t harvest_epoch;   // Odd while epoll events are being handled
+    _Atomic bool signal_armed;        // io_uring poll on the signalfd in flight
+    pthread_mutex_t submit_mutex;     // Serializes SQ tail updates
+    pthread_mutex_t poll_mutex;       // Single completion harvester
+} rift_io_reactor_t;
+
+static rift_io_reactor_t g_io_reactor = {
+    .backend = RIFT_IO_BACKEND_NONE,
+    .epoll_fd = -1,
+    .submit_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .poll_mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+// user_data / epoll data of the signalfd watch; names no request
+#define RIFT_IO_SIGNAL_TAG ((void*)&g_io_reactor)
+
+// =============================================================================
+// IO_URING BACKEND
+// =============================================================================
+
+static void io_uring_unmap(rift_io_uring_t* ring) {
+    if (ring->sqes) {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ring && ring->cq_ring != ring->sq_ring) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring) {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+    if (ring->ring_fd >= 0) {
+        close(ring->ring_fd);
+    }
+    memset(ring, 0, sizeof(*ring));
+    ring->ring_fd = -1;
+}
+
+/**
+ * @brief Create and map submission/completion rings (no liburing dependency)
+ */
+static int io_uring_setup_rings(rift_io_uring_t* ring, uint32_t entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    memset(ring, 0, sizeof(*ring));
+
+    ring->ring_fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->ring_fd < 0) {
+        ring->ring_fd = -1;
+        return -1;
+    }
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        if (ring->cq_ring_size > ring->sq_ring_size) {
+            ring->sq_ring_size = ring->cq_ring_size;
+        }
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        ring->sq_ring = NULL;
+        io_uring_unmap(ring);
+        return -1;
+    }
+
+    if (single_mmap) {
+        ring->cq_ring = ring->sq_ring;
+    } else {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            ring->cq_ring = NULL;
+            io_uring_unmap(ring);
+            return -1;
+        }
+    }
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring->ring_fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        io_uring_unmap(ring);
+        return -1;
+    }
+
+    char* sq = (char*)ring->sq_ring;
+    ring->sq_head = (_Atomic uint32_t*)(sq + params.sq_off.head);
+    ring->sq_tail = (_Atomic uint32_t*)(sq + params.sq_off.tail);
+    ring->sq_array = (uint32_t*)(sq + params.sq_off.array);
+    ring->sq_mask = *(uint32_t*)(sq + params.sq_off.ring_mask);
+    ring->sq_entries = params.sq_entries;
+
+    char* cq = (char*)ring->cq_ring;
+    ring->cq_head = (_Atomic uint32_t*)(cq + params.cq_off.head);
+    ring->cq_tail = (_Atomic uint32_t*)(cq + params.cq_off.tail);
+    ring->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+    ring->cq_mask = *(uint32_t*)(cq + params.cq_off.ring_mask);
+    return 0;
+}
+
+/**
+ * @brief Queue one SQE and submit it immediately
+ * @return 0 on success, negative errno on failure
+ */
+static int io_uring_submit_sqe(const struct io_uring_sqe* template_sqe) {
+    rift_io_uring_t* ring = &g_io_reactor.uring;
+
+    pthread_mutex_lock(&g_io_reactor.submit_mutex);
+
+    uint32_t tail = atomic_load_explicit(ring->sq_tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(ring->sq_head, memory_order_acquire);
+    if (tail - head >= ring->sq_entries) {
+        pthread_mutex_unlock(&g_io_reactor.submit_mutex);
+        return -EBUSY;
+    }
+
+    uint32_t index = tail & ring->sq_mask;
+    ring->sqes[index] = *template_sqe;
+    ring->sq_array[index] = index;
+    atomic_store_explicit(ring->sq_tail, tail + 1, memory_order_release);
+
+    int result = (int)syscall(__NR_io_uring_enter, ring->ring_fd, 1, 0, 0, NULL, 0);
+
+    pthread_mutex_unlock(&g_io_reactor.submit_mutex);
+    return result < 0 ? -errno : 0;
+}
+
+/**
+ * @brief Arm a one-shot poll on the signalfd unless one is in flight
+ */
+static void io_uring_arm_signal(void) {
+    int signal_fd = rift_signal_fd();
+    if (signal_fd < 0 || atomic_load(&g_io_reactor.signal_armed) ||
+        atomic_exchange(&g_io_reactor.signal_armed, true)) {
+        return;
+    }
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_POLL_ADD;
+    sqe.fd = signal_fd;
+    sqe.poll_events = POLLIN;
+    sqe.user_data = (uint64_t)(uintptr_t)RIFT_IO_SIGNAL_TAG;
+    if (io_uring_submit_sqe(&sqe) != 0) {
+        atomic_store(&g_io_reactor.signal_armed, false); // Retried on the next poll
+    }
+}
+
+static int io_uring_harvest(void) {
+    rift_io_uring_t* ring = &g_io_reactor.uring;
+    int woken = 0;
+    bool signalled = false;
+
+    uint32_t head = atomic_load_explicit(ring->cq_head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(ring->cq_tail, memory_order_acquire);
+
+    while (head != tail) {
+        struct io_uring_cqe* cqe = &ring->cqes[head & ring->cq_mask];
+        rift_io_request_t* request = (rift_io_request_t*)(uintptr_t)cqe->user_data;
+        int32_t res = cqe->res;
+
+        head++;
+        atomic_store_explicit(ring->cq_head, head, memory_order_release);
+
+        if (!request) {
+            continue; // Completion of an IORING_OP_ASYNC_CANCEL
+        }
+        if ((void*)request == RIFT_IO_SIGNAL_TAG) {
+            atomic_store(&g_io_reactor.signal_armed, false);
+            signalled = true;
+            continue;
+        }
+        rift_simulated_context_t* task = request->task;
+        request->result = res;
+        atomic_fetch_sub(&g_io_reactor.pending, 1);
+        if (atomic_exchange(&request->claim, 1) == 0) {
+            rift_simulated_wake(task);
+            woken++;
+        } else if (atomic_exchange(&request->landing, RIFT_IO_LANDING_DONE) ==
+                   RIFT_IO_LANDING_PARKED) {
+            rift_simulated_wake(task); // Withdrawn by cancellation and waiting for this
+            woken++;
+        }
+    }
+    if (signalled) {
+        io_uring_arm_signal(); // Before draining, so nothing arriving meanwhile is missed
+        rift_signal_dispatch();
+    }
+    return woken;
+}
+
+/**
+ * @brief Cancellation won the claim of an operation still in flight: cancel
+ *        it in the kernel and park until its CQE has been harvested
+ * @return The operation's result if it completed anyway, else -ECANCELED
+ */
+static int32_t io_uring_withdraw(rift_io_request_t* request) {
+    rift_simulated_context_t* task = request->task;
+    task->cancel_withdrawing = true;
+
+    struct io_uring_sqe cancel;
+    memset(&cancel, 0, sizeof(cancel));
+    cancel.opcode = IORING_OP_ASYNC_CANCEL;
+    cancel.addr = (uint64_t)(uintptr_t)request;
+    cancel.user_data = 0;
+    while (io_uring_submit_sqe(&cancel) == -EBUSY) {
+        rift_simulated_yield();
+    }
+
+    rift_simulated_park_prepare();
+    if (atomic_exchange(&request->landing, RIFT_IO_LANDING_PARKED) == RIFT_IO_LANDING_DONE) {
+        rift_simulated_park_cancel();
+    } else {
+        rift_simulated_park();
+    }
+
+    task->cancel_withdrawing = false;
+    return request->result >= 0 ? request->result : -ECANCELED;
+}
+
+/**
+ * @brief Submit SQE on behalf of current task and park until its CQE
+ * @return CQE result (negative errno on failure)
+ */
+static int32_t io_uring_execute(struct io_uring_sqe* sqe) {
+    rift_io_request_t request = { .task = rift_simulated_current(), .result = 0 };
+    if (rift_cancel_requested(&request.task->base_context.cancel)) {
+        return -ECANCELED;
+    }
+    atomic_init(&request.claim, 0);
+    atomic_init(&request.landing, RIFT_IO_LANDING_NONE);
+    sqe->user_data = (uint64_t)(uintptr_t)&request;
+
+    atomic_fetch_add(&g_io_reactor.pending, 1);
+    rift_simulated_park_prepare();
+
+    int submitted = io_uring_submit_sqe(sqe);
+    if (submitted < 0) {
+        rift_simulated_park_cancel();
+        atomic_fetch_sub(&g_io_reactor.pending, 1);
+        return submitted;
+    }
+
+    if (rift_simulated_park_cancellable(&request.claim)) {
+        return io_uring_withdraw(&request);
+    }
+    return request.result;
+}
+
+// =============================================================================
+// EPOLL BACKEND
+// =============================================================================
+
+/**
+ * @brief Park current task until fd reports any of events
+ * @return 0 when ready, -1 with errno set on failure
+ */
+static int epoll_wait_ready(int fd, uint32_t events) {
+    rift_io_request_t request = { .task = rift_simulated_current(), .result = 0 };
+    if (rift_cancel_requested(&request.task->base_context.cancel)) {
+        errno = ECANCELED;
+        return -1;
+    }
+    atomic_init(&request.claim, 0);
+    struct epoll_event event;
+    event.events = events | EPOLLONESHOT;
+    event.data.ptr = &request;
+
+    atomic_fetch_add(&g_io_reactor.pending, 1);
+    rift_simulated_park_prepare();
+
+    int armed = epoll_ctl(g_io_reactor.epoll_fd, EPOLL_CTL_MOD, fd, &event);
+    if (armed != 0 && errno == ENOENT) {
+        armed = epoll_ctl(g_io_reactor.epoll_fd, EPOLL_CTL_ADD, fd, &event);
+    }
+    if (armed != 0) {
+        int saved_errno = errno;
+        rift_simulated_park_cancel();
+        atomic_fetch_sub(&g_io_reactor.pending, 1);
+        errno = saved_errno;
+        return -1;
+    }
+
+    if (!rift_simulated_park_cancellable(&request.claim)) {
+        return 0;
+    }
+
+    // Withdraw: no later harvest can report the fd, and one already holding
+    // its event must finish with the request before this frame goes
+    rift_simulated_context_t* task = request.task;
+    task->cancel_withdrawing = true;
+    epoll_ctl(g_io_reactor.epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+    uint32_t epoch = atomic_load(&g_io_reactor.harvest_epoch);
+    while ((epoch & 1) && atomic_load(&g_io_reactor.harvest_epoch) == epoch) {
+        rift_simulated_yield();
+    }
+    task->cancel_withdrawing = false;
+
+    atomic_fetch_sub(&g_io_reactor.pending, 1);
+    errno = ECANCELED;
+    return -1;
+}
+
+static int epoll_harvest(int timeout_ms) {
+    struct epoll_event events[64];
+    atomic_fetch_add(&g_io_reactor.harvest_epoch, 1);
+    int count = epoll_wait(g_io_reactor.epoll_fd, events, 64, timeout_ms);
+
+    int woken = 0;
+    for (int i = 0; i < count; i++) {
+        rift_io_request_t* request = (rift_io_request_t*)events[i].data.ptr;
+        if ((void*)request == RIFT_IO_SIGNAL_TAG) {
+            rift_signal_dispatch();
+            continue;
+        }
+        if (atomic_exchange(&request->claim, 1) != 0) {
+            continue; // Withdrawn by cancellation
+        }
+        rift_simulated_context_t* task = request->task;
+        request->result = (int32_t)events[i].events;
+        atomic_fetch_sub(&g_io_reactor.pending, 1);
+        rift_simulated_wake(task);
+        woken++;
+    }
+    atomic_fetch_add(&g_io_reactor.harvest_epoch, 1);
+    return woken; // EINTR counts as nothing ready
+}
+
+// =============================================================================
+// REACTOR LIFECYCLE
+// =============================================================================
+
+/**
+ * @brief Start I/O reactor, preferring io_uring
+ */
+int rift_simulated_io_init(rift_io_backend_t backend, uint32_t queue_depth) {
+    if (g_io_reactor.backend != RIFT_IO_BACKEND_NONE) {
+        return 0;
+    }
+
+    if (queue_depth == 0) {
+        queue_depth = RIFT_SIMULATED_IO_QUEUE_DEPTH;
+    }
+    atomic_store(&g_io_reactor.pending, 0);
+
+    if (backend == RIFT_IO_BACKEND_AUTO || backend == RIFT_IO_BACKEND_IO_URING) {
+        if (io_uring_setup_rings(&g_io_reactor.uring, queue_depth) == 0) {
+            g_io_reactor.backend = RIFT_IO_BACKEND_IO_URING;
+            atomic_store(&g_io_reactor.signal_armed, false);
+            io_uring_arm_signal();
+            printf("[SIMULATED_IO] Reactor started - io_uring, %u entries\n",
+                   g_io_reactor.uring.sq_entries);
+            return 0;
+        }
+        if (backend == RIFT_IO_BACKEND_IO_URING) {
+            fprintf(stderr, "[SIMULATED_IO] io_uring unavailable: %s\n", strerror(errno));
+            return -1;
+        }
+    }
+
+    g_io_reactor.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (g_io_reactor.epoll_fd < 0) {
+        fprintf(stderr, "[SIMULATED_IO] epoll_create1 failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    int signal_fd = rift_signal_fd();
+    struct epoll_event routed = { .events = EPOLLIN, .data.ptr = RIFT_IO_SIGNAL_TAG };
+    if (signal_fd >= 0 &&
+        epoll_ctl(g_io_reactor.epoll_fd, EPOLL_CTL_ADD, signal_fd, &routed) != 0) {
+        fprintf(stderr, "[SIMULATED_IO] Cannot watch signalfd: %s\n", strerror(errno));
+    }
+
+    g_io_reactor.backend = RIFT_IO_BACKEND_EPOLL;
+    printf("[SIMULATED_IO] Reactor started - epoll fallback\n");
+    return 0;
+}
+
+/**
+ * @brief Harvest completions; only one thread polls at a time
+ */
+int rift_simulated_io_poll(int timeout_ms) {
+    if (g_io_reactor.backend == RIFT_IO_BACKEND_NONE) {
+        return -1;
+    }
+
+    if (pthread_mutex_trylock(&g_io_reactor.poll_mutex) != 0) {
+        return -1;
+    }
+
+    int woken;
+    if (g_io_reactor.backend == RIFT_IO_BACKEND_IO_URING) {
+        io_uring_arm_signal();
+        woken = io_uring_harvest();
+        if (woken == 0 && timeout_ms != 0) {
+            struct pollfd pfd = { .fd = g_io_reactor.uring.ring_fd, .events = POLLIN };
+            if (poll(&pfd, 1, timeout_ms) > 0) {
+                woken = io_uring_harvest();
+            }
+        }
+    } else {
+        woken = epoll_harvest(timeout_ms);
+    }
+
+    pthread_mutex_unlock(&g_io_reactor.poll_mutex);
+    return woken;
+}
+
+uint32_t rift_simulated_io_pending(void) {
+    return atomic_load_explicit(&g_io_reactor.pending, memory_order_relaxed);
+}
+
+rift_io_backend_t rift_simulated_io_backend(void) {
+    return g_io_reactor.backend;
+}
+
+/**
+ * @brief Stop reactor and release kernel resources
+ */
+void rift_simulated_io_cleanup(void) {
+    if (g_io_reactor.backend == RIFT_IO_BACKEND_NONE) {
+        return;
+    }
+
+    if (atomic_load(&g_io_reactor.pending) > 0) {
+        fprintf(stderr, "[SIMULATED_IO] Warning: %u operations still in flight\n",
+                atomic_load(&g_io_reactor.pending));
+    }
+
+    if (g_io_reactor.backend == RIFT_IO_BACKEND_IO_URING) {
+        io_uring_unmap(&g_io_reactor.uring);
+    } else {
+        close(g_io_reactor.epoll_fd);
+        g_io_reactor.epoll_fd = -1;
+    }
+
+    g_io_reactor.backend = RIFT_IO_BACKEND_NONE;
+    printf("[SIMULATED_IO] Reactor stopped\n");
+}
+
+// =============================================================================
+// TASK-FACING I/O OPERATIONS
+// =============================================================================
+
+/**
+ * @brief Reactor usable from the calling context; outside a simulated task
+ *        or without a reactor the operations fall back to blocking syscalls
+ */
+static bool io_reactor_usable(void) {
+    return g_io_reactor.backend != RIFT_IO_BACKEND_NONE && rift_simulated_current() != NULL;
+}
+
+static ssize_t io_uring_result(int32_t result) {
+    if (result < 0) {
+        errno = -result;
+        return -1;
+    }
+    return result;
+}
+
+ssize_t rift_simulated_read(int fd, void* buf, size_t count) {
+    if (!io_reactor_usable()) {
+        return read(fd, buf, count);
+    }
+
+    if (g_io_reactor.backend == RIFT_IO_BACKEND_IO_URING) {
+        struct io_uring_sqe sqe;
+        memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = fd;
+        sqe.addr = (uint64_t)(uintptr_t)buf;
+        sqe.len = (uint32_t)count;
+        sqe.off = (uint64_t)-1; // Current file position
+        return io_uring_result(io_uring_execute(&sqe));
+    }
+
+    // Sockets: optimistic non-blocking attempt before arming readiness
+    ssize_t result = recv(fd, buf, count, MSG_DONTWAIT);
+    if (result >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOTSOCK)) {
+        return result;
+    }
+
+    for (;;) {
+        if (epoll_wait_ready(fd, EPOLLIN | EPOLLRDHUP) != 0) {
+            return -1;
+        }
+        result = read(fd, buf, count);
+        if (result >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            return result;
+        }
+    }
+}
+
+ssize_t rift_simulated_write(int fd, const void* buf, size_t count) {
+    if (!io_reactor_usable()) {
+        return write(fd, buf, count);
+    }
+
+    if (g_io_reactor.backend == RIFT_IO_BACKEND_IO_URING) {
+        struct io_uring_sqe sqe;
+        memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_WRITE;
+        sqe.fd = fd;
+        sqe.addr = (uint64_t)(uintptr_t)buf;
+        sqe.len = (uint32_t)count;
+        sqe.off = (uint64_t)-1;
+        return io_uring_result(io_uring_execute(&sqe));
+    }
+
+    ssize_t result = send(fd, buf, count, MSG_DONTWAIT);
+    if (result >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != ENOTSOCK)) {
+        return result;
+    }
+
+    for (;;) {
+        if (epoll_wait_ready(fd, EPOLLOUT) != 0) {
+            return -1;
+        }
+        result = write(fd, buf, count);
+        if (result >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            return result;
+        }
+    }
+}
+
+int rift_simulated_accept(int fd, struct sockaddr* addr, socklen_t* addrlen) {
+    if (!io_reactor_usable()) {
+        return accept(fd, addr, addrlen);
+    }
+
+    if (g_io_reactor.backend == RIFT_IO_BACKEND_IO_URING) {
+        struct io_uring_sqe sqe;
+        memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_ACCEPT;
+        sqe.fd = fd;
+        sqe.addr = (uint64_t)(uintptr_t)addr;
+        sqe.addr2 = (uint64_t)(uintptr_t)addrlen;
+        return (int)io_uring_result(io_uring_execute(&sqe));
+    }
+
+    for (;;) {
+        if (epoll_wait_ready(fd, EPOLLIN) != 0) {
+            return -1;
+        }
+        int result = accept(fd, addr, addrlen);
+        if (result >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            return result;
+        }
+    }
+}
+
+int rift_simulated_connect(int fd, const struct sockaddr* addr, socklen_t addrlen) {
+    if (!io_reactor_usable()) {
+        return connect(fd, addr, addrlen);
+    }
+
+    if (g_io_reactor.backend == RIFT_IO_BACKEND_IO_URING) {
+        struct io_uring_sqe sqe;
+        memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_CONNECT;
+        sqe.fd = fd;
+        sqe.addr = (uint64_t)(uintptr_t)addr;
+        sqe.off = addrlen;
+        return (int)io_uring_result(io_uring_execute(&sqe));
+    }
+
+    // Connect non-blocking for the duration of the call, then restore flags
+    int flags = fcntl(fd, F_GETFL);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+        return -1;
+    }
+
+    int result = connect(fd, addr, addrlen);
+    if (result != 0 && errno == EINPROGRESS) {
+        result = epoll_wait_ready(fd, EPOLLOUT);
+        if (result == 0) {
+            int socket_error = 0;
+            socklen_t length = sizeof(socket_error);
+            getsockopt(fd, SOL_SOCKET, SO_ERROR, &socket_error, &length);
+            if (socket_error != 0) {
+                errno = socket_error;
+                result = -1;
+            }
+        }
+    }
+
+    int saved_errno = errno;
+    fcntl(fd, F_SETFL, flags);
+    errno = saved_errno;
+    return result;
+}
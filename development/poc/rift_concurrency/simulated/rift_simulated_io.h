@@ -0,0 +1,83 @@
+/**
+ * @file rift_simulated_io.h
+ * @brief Simulated I/O Reactor Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_SIMULATED_IO_H
+#define RIFT_SIMULATED_IO_H
+
+#include "rift_common.h"
+#include <sys/socket.h>
+
+#define RIFT_SIMULATED_IO_QUEUE_DEPTH 256
+#define RIFT_SIMULATED_IO_IDLE_TIMEOUT_MS 10
+
+// Reactor backend selection
+typedef enum {
+    RIFT_IO_BACKEND_AUTO,          // io_uring when available, else epoll
+    RIFT_IO_BACKEND_IO_URING,      // Completion-based submission rings
+    RIFT_IO_BACKEND_EPOLL,         // Readiness-based fallback
+    RIFT_IO_BACKEND_NONE           // Reactor not running
+} rift_io_backend_t;
+
+/**
+ * @brief Start I/O reactor for simulated tasks
+ * @param backend Preferred backend (AUTO falls back to epoll)
+ * @param queue_depth Submission queue depth (0 for default)
+ * @return 0 on success, error code otherwise
+ */
+int rift_simulated_io_init(rift_io_backend_t backend, uint32_t queue_depth);
+
+/**
+ * @brief Harvest completions and wake their tasks
+ * @param timeout_ms Maximum wait when nothing is ready (0 for non-blocking)
+ * @return Tasks woken, -1 if another thread is polling or reactor is down
+ */
+int rift_simulated_io_poll(int timeout_ms);
+
+/**
+ * @brief Get number of tasks parked on I/O
+ * @return Outstanding operation count
+ */
+uint32_t rift_simulated_io_pending(void);
+
+/**
+ * @brief Get active reactor backend
+ * @return Backend in use, RIFT_IO_BACKEND_NONE if not initialized
+ */
+rift_io_backend_t rift_simulated_io_backend(void);
+
+/**
+ * @brief Read from descriptor, parking the current task until complete.
+ *        Like every operation below, fails with ECANCELED once the task is
+ *        cancelled, waking it if it is parked.
+ * @return Bytes read, -1 with errno set on failure (read(2) semantics)
+ */
+ssize_t rift_simulated_read(int fd, void* buf, size_t count);
+
+/**
+ * @brief Write to descriptor, parking the current task until complete
+ * @return Bytes written, -1 with errno set on failure (write(2) semantics)
+ */
+ssize_t rift_simulated_write(int fd, const void* buf, size_t count);
+
+/**
+ * @brief Accept connection, parking the current task until one arrives
+ * @return Connected descriptor, -1 with errno set on failure
+ */
+int rift_simulated_accept(int fd, struct sockaddr* addr, socklen_t* addrlen);
+
+/**
+ * @brief Connect socket, parking the current task until established
+ * @return 0 on success, -1 with errno set on failure
+ */
+int rift_simulated_connect(int fd, const struct sockaddr* addr, socklen_t addrlen);
+
+/**
+ * @brief Stop reactor; parked tasks must have completed
+ */
+void rift_simulated_io_cleanup(void);
+
+#endif // RIFT_SIMULATED_IO_H
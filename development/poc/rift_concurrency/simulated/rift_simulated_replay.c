@@ -0,0 +1,411 @@
+/**
+ * @file rift_simulated_replay.c
+ * @brief RIFT Simulated Concurrency - Deterministic Schedule Record/Replay
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Records the scheduling decisions of the single-thread simulated scheduler
+ * as a varint stream and replays them to force the same interleaving.
+ *
+ * Each record is one LEB128 varint holding (payload << 3) | tag:
+ *   SLICE  payload = zigzag(ordinal - previous slice ordinal)
+ *   SPAWN  payload = spawning task ordinal + 1, 0 outside tasks
+ *   WAKE   payload = woken task ordinal
+ *   CYCLE  payload = 0, marks the end of rift_simulated_schedule_cycle()
+ * Tasks are identified by spawn ordinal rather than RIFT ID. A round-robin
+ * slice costs one byte. Wake records are informational: replay re-derives
+ * wakeups from real completions and waits for a recorded task to become
+ * runnable. Hybrid-mode tasks are not recorded.
+ *
+ * Spawns and wakes arrive from any thread: the watchdog, I/O pollers,
+ * channel partners and cancellers. One lock serialises the stream, and a
+ * recorded spawn takes its ordinal under it, so records appear in ordinal
+ * order; with replay off, hooks see the mode through a relaxed load and an
+ * ordinal is a single atomic increment.
+ */
+
+#include "rift_simulated_replay.h"
+#include "rift_simulated.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#define REPLAY_MAGIC "RIFTRPL1"
+#define REPLAY_MAGIC_LENGTH 8
+#define REPLAY_BUFFER_SIZE (64 * 1024)
+
+enum {
+    REPLAY_TAG_SLICE = 0,
+    REPLAY_TAG_SPAWN = 1,
+    REPLAY_TAG_WAKE = 2,
+    REPLAY_TAG_CYCLE = 3
+};
+
+// =============================================================================
+// RECORDER STATE
+// =============================================================================
+
+typedef struct {
+    pthread_mutex_t replay_mutex;         // Guards the stream, buffer and stats
+    _Atomic rift_replay_mode_t mode;      // Changed under replay_mutex
+    _Atomic uint32_t next_ordinal;
+    uint32_t last_slice_ordinal;
+
+    // Recording: buffered writes
+    FILE* record_file;
+    uint8_t buffer[REPLAY_BUFFER_SIZE];
+    size_t buffer_used;
+
+    // Replay: whole stream held in memory
+    uint8_t* stream;
+    size_t stream_size;
+    size_t stream_offset;
+
+    rift_replay_stats_t stats;
+} rift_replay_state_t;
+
+static rift_replay_state_t g_replay = {
+    .replay_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .mode = RIFT_REPLAY_OFF
+};
+
+static bool replay_active(rift_replay_mode_t mode) {
+    return atomic_load_explicit(&g_replay.mode, memory_order_relaxed) == mode;
+}
+
+// =============================================================================
+// VARINT ENCODING
+// =============================================================================
+
+static void replay_flush(void) {
+    if (g_replay.buffer_used > 0 && g_replay.record_file) {
+        fwrite(g_replay.buffer, 1, g_replay.buffer_used, g_replay.record_file);
+        g_replay.stats.bytes += g_replay.buffer_used;
+    }
+    g_replay.buffer_used = 0;
+}
+
+static void replay_emit(uint32_t tag, uint64_t payload) {
+    if (g_replay.buffer_used + 10 > REPLAY_BUFFER_SIZE) {
+        replay_flush();
+    }
+
+    uint64_t value = (payload << 3) | tag;
+    uint8_t* out = g_replay.buffer + g_replay.buffer_used;
+    do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        *out++ = value ? (byte | 0x80) : byte;
+    } while (value);
+
+    g_replay.buffer_used = (size_t)(out - g_replay.buffer);
+    g_replay.stats.events++;
+}
+
+/**
+ * @brief Decode next record; skips informational wake records
+ * @return false at end of stream
+ */
+static bool replay_next(uint32_t* tag, uint64_t* payload, size_t* record_offset) {
+    for (;;) {
+        uint64_t value = 0;
+        uint32_t shift = 0;
+        size_t start = g_replay.stream_offset;
+
+        for (;;) {
+            if (g_replay.stream_offset >= g_replay.stream_size || shift > 63) {
+                return false;
+            }
+            uint8_t byte = g_replay.stream[g_replay.stream_offset++];
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            shift += 7;
+            if (!(byte & 0x80)) {
+                break;
+            }
+        }
+
+        g_replay.stats.events++;
+        if ((value & 0x7) == REPLAY_TAG_WAKE) {
+            continue;
+        }
+
+        *tag = (uint32_t)(value & 0x7);
+        *payload = value >> 3;
+        *record_offset = start;
+        return true;
+    }
+}
+
+static uint64_t zigzag_encode(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t zigzag_decode(uint64_t value) {
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+/**
+ * @brief Abandon replay and continue with live scheduling; lock held
+ */
+static void replay_diverge(const char* reason, size_t offset) {
+    g_replay.stats.divergences++;
+    fprintf(stderr, "[REPLAY] Divergence at byte %zu: %s - continuing live\n", offset, reason);
+    g_replay.mode = RIFT_REPLAY_OFF;
+}
+
+static bool replay_task_recorded(const rift_simulated_context_t* task) {
+    return task->base_context.policy.mode != CONCURRENCY_HYBRID;
+}
+
+// =============================================================================
+// SESSION CONTROL
+// =============================================================================
+
+/**
+ * @brief Start recording scheduling decisions to path
+ */
+int rift_replay_start_recording(const char* path) {
+    pthread_mutex_lock(&g_replay.replay_mutex);
+    if (!path || g_replay.mode != RIFT_REPLAY_OFF) {
+        pthread_mutex_unlock(&g_replay.replay_mutex);
+        return -1;
+    }
+
+    g_replay.record_file = fopen(path, "wb");
+    if (!g_replay.record_file) {
+        pthread_mutex_unlock(&g_replay.replay_mutex);
+        fprintf(stderr, "[REPLAY] Cannot open %s for recording\n", path);
+        return -1;
+    }
+
+    fwrite(REPLAY_MAGIC, 1, REPLAY_MAGIC_LENGTH, g_replay.record_file);
+    memset(&g_replay.stats, 0, sizeof(g_replay.stats));
+    g_replay.stats.bytes = REPLAY_MAGIC_LENGTH;
+    g_replay.buffer_used = 0;
+    g_replay.next_ordinal = 0;
+    g_replay.last_slice_ordinal = 0;
+    g_replay.mode = RIFT_REPLAY_RECORD;
+    pthread_mutex_unlock(&g_replay.replay_mutex);
+
+    printf("[REPLAY] Recording schedule to %s\n", path);
+    return 0;
+}
+
+/**
+ * @brief Load recorded stream and force its interleaving
+ */
+int rift_replay_start_replay(const char* path) {
+    pthread_mutex_lock(&g_replay.replay_mutex);
+    if (!path || g_replay.mode != RIFT_REPLAY_OFF) {
+        pthread_mutex_unlock(&g_replay.replay_mutex);
+        return -1;
+    }
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        pthread_mutex_unlock(&g_replay.replay_mutex);
+        fprintf(stderr, "[REPLAY] Cannot open %s for replay\n", path);
+        return -1;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char magic[REPLAY_MAGIC_LENGTH];
+    if (size < REPLAY_MAGIC_LENGTH ||
+        fread(magic, 1, REPLAY_MAGIC_LENGTH, file) != REPLAY_MAGIC_LENGTH ||
+        memcmp(magic, REPLAY_MAGIC, REPLAY_MAGIC_LENGTH) != 0) {
+        pthread_mutex_unlock(&g_replay.replay_mutex);
+        fprintf(stderr, "[REPLAY] %s is not a RIFT schedule recording\n", path);
+        fclose(file);
+        return -1;
+    }
+
+    g_replay.stream_size = (size_t)size - REPLAY_MAGIC_LENGTH;
+    g_replay.stream = malloc(g_replay.stream_size ? g_replay.stream_size : 1);
+    if (!g_replay.stream ||
+        fread(g_replay.stream, 1, g_replay.stream_size, file) != g_replay.stream_size) {
+        free(g_replay.stream);
+        g_replay.stream = NULL;
+        pthread_mutex_unlock(&g_replay.replay_mutex);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+
+    memset(&g_replay.stats, 0, sizeof(g_replay.stats));
+    g_replay.stats.bytes = (uint64_t)size;
+    g_replay.stream_offset = 0;
+    g_replay.next_ordinal = 0;
+    g_replay.last_slice_ordinal = 0;
+    g_replay.mode = RIFT_REPLAY_REPLAY;
+    pthread_mutex_unlock(&g_replay.replay_mutex);
+
+    printf("[REPLAY] Replaying schedule from %s (%ld bytes)\n", path, size);
+    return 0;
+}
+
+/**
+ * @brief End recording or replay session
+ */
+void rift_replay_stop(void) {
+    pthread_mutex_lock(&g_replay.replay_mutex);
+    if (g_replay.record_file) {
+        replay_flush();
+        fclose(g_replay.record_file);
+        g_replay.record_file = NULL;
+    }
+
+    free(g_replay.stream);
+    g_replay.stream = NULL;
+    g_replay.stream_size = 0;
+
+    if (g_replay.stats.events > 0) {
+        printf("[REPLAY] Session ended - %lu events, %lu bytes, %lu divergences\n",
+               (unsigned long)g_replay.stats.events, (unsigned long)g_replay.stats.bytes,
+               (unsigned long)g_replay.stats.divergences);
+    }
+    g_replay.mode = RIFT_REPLAY_OFF;
+    pthread_mutex_unlock(&g_replay.replay_mutex);
+}
+
+rift_replay_mode_t rift_replay_mode(void) {
+    return atomic_load_explicit(&g_replay.mode, memory_order_relaxed);
+}
+
+void rift_replay_get_stats(rift_replay_stats_t* stats) {
+    if (stats) {
+        pthread_mutex_lock(&g_replay.replay_mutex);
+        *stats = g_replay.stats;
+        pthread_mutex_unlock(&g_replay.replay_mutex);
+    }
+}
+
+// =============================================================================
+// SCHEDULER HOOKS
+// =============================================================================
+
+/**
+ * @brief Assign spawn ordinal; record or verify spawn order
+ */
+void rift_replay_on_spawn(rift_simulated_context_t* task) {
+    if (replay_active(RIFT_REPLAY_OFF) || !replay_task_recorded(task)) {
+        task->spawn_ordinal = atomic_fetch_add_explicit(&g_replay.next_ordinal, 1,
+                                                        memory_order_relaxed);
+        return;
+    }
+
+    rift_simulated_context_t* spawner = rift_simulated_current();
+    uint64_t spawner_ordinal = spawner ? (uint64_t)spawner->spawn_ordinal + 1 : 0;
+
+    pthread_mutex_lock(&g_replay.replay_mutex);
+    task->spawn_ordinal = atomic_fetch_add_explicit(&g_replay.next_ordinal, 1,
+                                                    memory_order_relaxed);
+    if (g_replay.mode == RIFT_REPLAY_RECORD) {
+        replay_emit(REPLAY_TAG_SPAWN, spawner_ordinal);
+    } else if (g_replay.mode == RIFT_REPLAY_REPLAY) {
+        uint32_t tag;
+        uint64_t payload;
+        size_t offset;
+        if (!replay_next(&tag, &payload, &offset) || tag != REPLAY_TAG_SPAWN ||
+            payload != spawner_ordinal) {
+            replay_diverge("spawn order differs from recording", g_replay.stream_offset);
+        }
+    }
+    pthread_mutex_unlock(&g_replay.replay_mutex);
+}
+
+/**
+ * @brief Record that task is about to receive a time slice
+ */
+void rift_replay_on_slice(rift_simulated_context_t* task) {
+    if (!replay_active(RIFT_REPLAY_RECORD) || !replay_task_recorded(task)) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_replay.replay_mutex);
+    if (g_replay.mode == RIFT_REPLAY_RECORD) {
+        int64_t delta = (int64_t)task->spawn_ordinal - (int64_t)g_replay.last_slice_ordinal;
+        g_replay.last_slice_ordinal = task->spawn_ordinal;
+        replay_emit(REPLAY_TAG_SLICE, zigzag_encode(delta));
+    }
+    pthread_mutex_unlock(&g_replay.replay_mutex);
+}
+
+/**
+ * @brief Record wakeup of a parked task
+ */
+void rift_replay_on_wake(rift_simulated_context_t* task) {
+    if (!replay_active(RIFT_REPLAY_RECORD) || !replay_task_recorded(task)) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_replay.replay_mutex);
+    if (g_replay.mode == RIFT_REPLAY_RECORD) {
+        replay_emit(REPLAY_TAG_WAKE, task->spawn_ordinal);
+    }
+    pthread_mutex_unlock(&g_replay.replay_mutex);
+}
+
+/**
+ * @brief Record end of scheduling cycle
+ */
+void rift_replay_on_cycle_end(void) {
+    if (!replay_active(RIFT_REPLAY_RECORD)) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_replay.replay_mutex);
+    if (g_replay.mode == RIFT_REPLAY_RECORD) {
+        replay_emit(REPLAY_TAG_CYCLE, 0);
+    }
+    pthread_mutex_unlock(&g_replay.replay_mutex);
+}
+
+/**
+ * @brief Fetch next replay decision
+ * @param ordinal Spawn ordinal of the task to run next
+ * @return 1 for a slice, 0 at cycle end, -1 when replay has ended or diverged
+ */
+int rift_replay_next_decision(uint32_t* ordinal) {
+    if (!replay_active(RIFT_REPLAY_REPLAY)) {
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_replay.replay_mutex);
+    uint32_t tag;
+    uint64_t payload;
+    size_t offset;
+    int decision = -1;
+    if (g_replay.mode != RIFT_REPLAY_REPLAY) {
+        // Diverged on another thread's spawn
+    } else if (!replay_next(&tag, &payload, &offset)) {
+        printf("[REPLAY] Recording exhausted - continuing live\n");
+        g_replay.mode = RIFT_REPLAY_OFF;
+    } else if (tag == REPLAY_TAG_CYCLE) {
+        decision = 0;
+    } else if (tag != REPLAY_TAG_SLICE) {
+        replay_diverge("expected slice decision", offset);
+    } else {
+        int64_t ordinal_value = (int64_t)g_replay.last_slice_ordinal + zigzag_decode(payload);
+        g_replay.last_slice_ordinal = (uint32_t)ordinal_value;
+        g_replay.stats.slices_replayed++;
+        *ordinal = (uint32_t)ordinal_value;
+        decision = 1;
+    }
+    pthread_mutex_unlock(&g_replay.replay_mutex);
+    return decision;
+}
+
+/**
+ * @brief Report that the recorded task could not be made runnable
+ */
+void rift_replay_abort(const char* reason) {
+    pthread_mutex_lock(&g_replay.replay_mutex);
+    if (g_replay.mode == RIFT_REPLAY_REPLAY) {
+        replay_diverge(reason, g_replay.stream_offset);
+    }
+    pthread_mutex_unlock(&g_replay.replay_mutex);
+}
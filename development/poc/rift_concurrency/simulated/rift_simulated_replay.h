@@ -0,0 +1,69 @@
+/**
+ * @file rift_simulated_replay.h
+ * @brief Simulated Schedule Record/Replay Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_SIMULATED_REPLAY_H
+#define RIFT_SIMULATED_REPLAY_H
+
+#include "rift_common.h"
+#include "rift_simulated.h"
+
+#define RIFT_REPLAY_WAIT_LIMIT_MS 5000
+
+typedef enum {
+    RIFT_REPLAY_OFF,               // Live scheduling, nothing recorded
+    RIFT_REPLAY_RECORD,            // Live scheduling, decisions logged
+    RIFT_REPLAY_REPLAY             // Decisions taken from a recording
+} rift_replay_mode_t;
+
+// Record/replay session statistics
+typedef struct {
+    uint64_t events;               // Records written or consumed
+    uint64_t bytes;                // Stream size including header
+    uint64_t slices_replayed;      // Forced scheduling decisions
+    uint64_t divergences;          // Replay mismatches (replay then stops)
+} rift_replay_stats_t;
+
+/**
+ * @brief Start recording single-thread scheduling decisions
+ * @param path Output file
+ * @return 0 on success, error code otherwise
+ */
+int rift_replay_start_recording(const char* path);
+
+/**
+ * @brief Start forcing the interleaving stored in a recording
+ * @param path Recording produced by rift_replay_start_recording()
+ * @return 0 on success, error code otherwise
+ */
+int rift_replay_start_replay(const char* path);
+
+/**
+ * @brief Flush and end the current session
+ */
+void rift_replay_stop(void);
+
+/**
+ * @brief Get current record/replay mode
+ * @return Active mode
+ */
+rift_replay_mode_t rift_replay_mode(void);
+
+/**
+ * @brief Get session statistics
+ * @param stats Output statistics
+ */
+void rift_replay_get_stats(rift_replay_stats_t* stats);
+
+// Scheduler hooks (simulated module internal)
+void rift_replay_on_spawn(rift_simulated_context_t* task);
+void rift_replay_on_slice(rift_simulated_context_t* task);
+void rift_replay_on_wake(rift_simulated_context_t* task);
+void rift_replay_on_cycle_end(void);
+int rift_replay_next_decision(uint32_t* ordinal);
+void rift_replay_abort(const char* reason);
+
+#endif // RIFT_SIMULATED_REPLAY_H
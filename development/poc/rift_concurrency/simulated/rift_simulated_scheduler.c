@@ -0,0 +1,452 @@
+/**
+ * @file rift_simulated_scheduler.c
+ * @brief RIFT Simulated Concurrency - Single-Thread Round-Robin Scheduler
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * FIFO run queue driven by rift_simulated_schedule_cycle(). Each cycle gives
+ * every task that was runnable at the start of the cycle one time slice.
+ * Tasks with a deadline (SCHEDULE_EDF, or inherited from a parent or a
+ * waiter) wait in a deadline heap that is always served before the FIFO,
+ * earliest deadline first; they are admitted against the claims of the
+ * deadline tasks already queued (rift_edf.c).
+ *
+ * Spawns whose policy sets max_queued find the run queue bounded: at the
+ * bound they wait for it to drain, are refused, or take their first slice
+ * on the spawning thread, per overflow_policy; a caller-run task that
+ * yields joins the queue, so the bound can be passed by one task per
+ * spawner.
+ */
+
+#include "rift_simulated.h"
+#include "rift_telemetry.h"
+#include "rift_edf.h"
+#include "rift_simulated_io.h"
+#include "rift_simulated_replay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// =============================================================================
+// RUN QUEUE
+// =============================================================================
+
+typedef struct {
+    rift_simulated_context_t* head;
+    rift_simulated_context_t* tail;
+    rift_edf_queue_t deadline_queue;      // Tasks with a deadline, served first
+    uint32_t length;                      // Tasks in both queues
+    uint64_t cycles_executed;
+    pthread_mutex_t queue_mutex;
+    rift_edf_ledger_t ledger;             // EDF admission claims (one runner)
+} rift_simulated_run_queue_t;
+
+static rift_simulated_run_queue_t g_run_queue = {
+    .queue_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .ledger = { .runners = 1, .mutex = PTHREAD_MUTEX_INITIALIZER }
+};
+
+static rift_simulated_context_t* run_queue_pop(void) {
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+    rift_simulated_context_t* task = rift_edf_queue_pop(&g_run_queue.deadline_queue);
+    if (task) {
+        g_run_queue.length--;
+    } else if ((task = g_run_queue.head) != NULL) {
+        g_run_queue.head = task->next;
+        if (!g_run_queue.head) {
+            g_run_queue.tail = NULL;
+        }
+        g_run_queue.length--;
+        task->next = NULL;
+    }
+    pthread_mutex_unlock(&g_run_queue.queue_mutex);
+    return task;
+}
+
+/**
+ * @brief Remove queued task by spawn ordinal
+ */
+static rift_simulated_context_t* run_queue_take(uint32_t ordinal) {
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+    rift_edf_queue_t* deadline_queue = &g_run_queue.deadline_queue;
+    for (uint32_t i = 0; i < deadline_queue->count; i++) {
+        rift_simulated_context_t* task = deadline_queue->entries[i].item;
+        if (task->spawn_ordinal == ordinal) {
+            rift_edf_queue_remove_at(deadline_queue, i);
+            g_run_queue.length--;
+            pthread_mutex_unlock(&g_run_queue.queue_mutex);
+            return task;
+        }
+    }
+
+    rift_simulated_context_t* previous = NULL;
+    rift_simulated_context_t* task = g_run_queue.head;
+    while (task && task->spawn_ordinal != ordinal) {
+        previous = task;
+        task = task->next;
+    }
+
+    if (task) {
+        if (previous) {
+            previous->next = task->next;
+        } else {
+            g_run_queue.head = task->next;
+        }
+        if (g_run_queue.tail == task) {
+            g_run_queue.tail = previous;
+        }
+        g_run_queue.length--;
+        task->next = NULL;
+    }
+    pthread_mutex_unlock(&g_run_queue.queue_mutex);
+    return task;
+}
+
+/**
+ * @brief Queue task by deadline if it has one, else at the FIFO tail;
+ *        caller holds queue_mutex
+ */
+static void run_queue_append_locked(rift_simulated_context_t* task) {
+    task->next = NULL;
+    uint64_t deadline_ns = task->base_context.telemetry.deadline_ns;
+    // Falls back to FIFO order if the heap cannot grow
+    if (deadline_ns == 0 ||
+        rift_edf_queue_push(&g_run_queue.deadline_queue, task, deadline_ns) != 0) {
+        if (g_run_queue.tail) {
+            g_run_queue.tail->next = task;
+        } else {
+            g_run_queue.head = task;
+        }
+        g_run_queue.tail = task;
+    }
+    g_run_queue.length++;
+}
+
+/**
+ * @brief Append task to the tail of the run queue (or its deadline heap)
+ */
+void rift_simulated_scheduler_enqueue(rift_simulated_context_t* task) {
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+    run_queue_append_locked(task);
+    pthread_mutex_unlock(&g_run_queue.queue_mutex);
+}
+
+/**
+ * @brief Append tasks in order with a single lock acquisition
+ */
+void rift_simulated_scheduler_enqueue_batch(rift_simulated_context_t** tasks, uint32_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+    for (uint32_t i = 0; i < count; i++) {
+        run_queue_append_locked(tasks[i]);
+    }
+    pthread_mutex_unlock(&g_run_queue.queue_mutex);
+}
+
+// =============================================================================
+// DEADLINES
+// =============================================================================
+
+/**
+ * @brief Admit task against the outstanding claims of queued deadline tasks
+ */
+int rift_simulated_scheduler_admit(rift_simulated_context_t* task) {
+    return rift_edf_admit(&g_run_queue.ledger, task, task->base_context.telemetry.deadline_ns,
+                          (uint64_t)task->base_context.policy.expected_runtime_ms * 1000000ull);
+}
+
+void rift_simulated_scheduler_release(rift_simulated_context_t* task) {
+    if (task->base_context.telemetry.deadline_ns != 0 &&
+        task->base_context.policy.expected_runtime_ms != 0) {
+        rift_edf_release(&g_run_queue.ledger, task);
+    }
+}
+
+/**
+ * @brief Lend a waiter's deadline to the queued task it waits for; a FIFO
+ *        task moves into the deadline heap
+ */
+bool rift_simulated_scheduler_boost(uint64_t rift_id, uint64_t deadline_ns) {
+    if (deadline_ns == 0) {
+        return false;
+    }
+
+    bool queued = false;
+    bool moved = false;
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+    rift_edf_queue_t* deadline_queue = &g_run_queue.deadline_queue;
+    for (uint32_t i = 0; i < deadline_queue->count && !queued; i++) {
+        rift_simulated_context_t* task = deadline_queue->entries[i].item;
+        if (task->base_context.telemetry.rift_thread_id == rift_id) {
+            queued = true;
+            // Queued tasks are not running, so their deadline can change here
+            if (deadline_ns < task->base_context.telemetry.deadline_ns) {
+                rift_edf_queue_boost(deadline_queue, task, deadline_ns);
+                task->base_context.telemetry.deadline_ns = deadline_ns;
+                moved = true;
+            }
+        }
+    }
+
+    rift_simulated_context_t* previous = NULL;
+    rift_simulated_context_t* task = queued ? NULL : g_run_queue.head;
+    while (task && task->base_context.telemetry.rift_thread_id != rift_id) {
+        previous = task;
+        task = task->next;
+    }
+    if (task) {
+        queued = true;
+        if (rift_edf_queue_push(deadline_queue, task, deadline_ns) == 0) {
+            if (previous) {
+                previous->next = task->next;
+            } else {
+                g_run_queue.head = task->next;
+            }
+            if (g_run_queue.tail == task) {
+                g_run_queue.tail = previous;
+            }
+            task->next = NULL;
+            task->base_context.telemetry.deadline_ns = deadline_ns;
+            moved = true;
+        }
+    }
+    pthread_mutex_unlock(&g_run_queue.queue_mutex);
+
+    if (moved) {
+        rift_telemetry_set_deadline(rift_id, deadline_ns);
+    }
+    return queued;
+}
+
+// =============================================================================
+// SCHEDULER LIFECYCLE
+// =============================================================================
+
+/**
+ * @brief Reset run queue state
+ */
+int rift_simulated_scheduler_init(void) {
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+    g_run_queue.head = NULL;
+    g_run_queue.tail = NULL;
+    rift_edf_queue_destroy(&g_run_queue.deadline_queue);
+    g_run_queue.length = 0;
+    g_run_queue.cycles_executed = 0;
+    pthread_mutex_unlock(&g_run_queue.queue_mutex);
+    rift_edf_ledger_reset(&g_run_queue.ledger, 1);
+    return 0;
+}
+
+static void scheduler_after_slice(rift_simulated_context_t* task, rift_simulated_task_state_t state) {
+    if (state == SIMULATED_TASK_READY) {
+        rift_simulated_scheduler_enqueue(task);
+    } else if (state == SIMULATED_TASK_FINISHED) {
+        if (task->base_context.telemetry.deadline_ns != 0) {
+            rift_telemetry_record_deadline(task->base_context.telemetry.rift_thread_id,
+                                           task->base_context.telemetry.deadline_ns);
+        }
+        rift_simulated_destroy_task(task);
+    }
+    // Parked tasks are owned by their waker until rift_simulated_wake()
+}
+
+/**
+ * @brief Wait for recorded task to become runnable, driving the reactor;
+ *        without I/O pending it may still be woken from another thread,
+ *        by the watchdog or a channel partner
+ */
+static rift_simulated_context_t* scheduler_replay_wait(uint32_t ordinal) {
+    uint32_t waited_ms = 0;
+    for (;;) {
+        rift_simulated_context_t* task = run_queue_take(ordinal);
+        if (task || waited_ms >= RIFT_REPLAY_WAIT_LIMIT_MS) {
+            return task;
+        }
+        if (rift_simulated_io_pending() > 0) {
+            rift_simulated_io_poll(RIFT_SIMULATED_IO_IDLE_TIMEOUT_MS);
+            waited_ms += RIFT_SIMULATED_IO_IDLE_TIMEOUT_MS;
+        } else {
+            struct timespec pause = { .tv_sec = 0, .tv_nsec = 1000000 };
+            nanosleep(&pause, NULL);
+            waited_ms++;
+        }
+    }
+}
+
+/**
+ * @brief Run one recorded cycle
+ * @return Slices executed, -1 if replay ended before the cycle started
+ */
+static int scheduler_replay_cycle(void) {
+    int processed = 0;
+    uint32_t ordinal;
+    int decision;
+
+    while ((decision = rift_replay_next_decision(&ordinal)) == 1) {
+        rift_simulated_context_t* task = scheduler_replay_wait(ordinal);
+        if (!task) {
+            rift_replay_abort("recorded task is not runnable");
+            break;
+        }
+
+        scheduler_after_slice(task, rift_simulated_resume(task));
+        processed++;
+    }
+
+    return (decision < 0 && processed == 0) ? -1 : processed;
+}
+
+/**
+ * @brief Execute one scheduling cycle of simulated concurrency
+ */
+int rift_simulated_schedule_cycle(void) {
+    // Resume I/O waiters first; block briefly only when nothing else can run
+    if (rift_simulated_io_pending() > 0) {
+        int timeout_ms = rift_simulated_runnable_count() > 0 ? 0 : RIFT_SIMULATED_IO_IDLE_TIMEOUT_MS;
+        rift_simulated_io_poll(timeout_ms);
+    }
+
+    if (rift_replay_mode() == RIFT_REPLAY_REPLAY) {
+        int replayed = scheduler_replay_cycle();
+        if (replayed >= 0) {
+            g_run_queue.cycles_executed++;
+            return replayed;
+        }
+    }
+
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+    uint32_t runnable = g_run_queue.length;
+    g_run_queue.cycles_executed++;
+    pthread_mutex_unlock(&g_run_queue.queue_mutex);
+
+    int processed = 0;
+    for (uint32_t i = 0; i < runnable; i++) {
+        rift_simulated_context_t* task = run_queue_pop();
+        if (!task) {
+            break;
+        }
+
+        rift_replay_on_slice(task);
+        scheduler_after_slice(task, rift_simulated_resume(task));
+        processed++;
+    }
+
+    rift_replay_on_cycle_end();
+    return processed;
+}
+
+/**
+ * @brief Number of tasks waiting in the run queue
+ */
+uint32_t rift_simulated_runnable_count(void) {
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+    uint32_t length = g_run_queue.length;
+    pthread_mutex_unlock(&g_run_queue.queue_mutex);
+    return length;
+}
+
+// =============================================================================
+// BACKPRESSURE
+// =============================================================================
+
+static uint64_t scheduler_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Whether count more tasks fit under the bound; a batch larger than
+ *        the bound is let in once the queue is empty
+ */
+static bool scheduler_has_room(uint32_t depth, uint32_t count, uint32_t max_queued) {
+    return depth == 0 || depth + count <= max_queued;
+}
+
+/**
+ * @brief Hold a spawn at the run queue's bound according to its policy
+ */
+int rift_simulated_scheduler_throttle(const rift_governance_policy_t* policy, uint32_t count) {
+    if (policy->max_queued == 0) {
+        return 0;
+    }
+
+    uint32_t depth = rift_simulated_runnable_count();
+    if (scheduler_has_room(depth, count, policy->max_queued)) {
+        return 0;
+    }
+
+    rift_overflow_policy_t action = policy->overflow_policy;
+    // A task run outside the queue would be missing from the recording
+    if (action == OVERFLOW_CALLER_RUNS && rift_replay_mode() != RIFT_REPLAY_OFF) {
+        action = OVERFLOW_BLOCK;
+    }
+    if (action == OVERFLOW_FAIL_FAST) {
+        printf("[SIMULATED] Spawn rejected: run queue full (%u/%u)\n", depth,
+               policy->max_queued);
+        rift_telemetry_record_backpressure(action, depth, policy->max_queued, 0);
+        return -1;
+    }
+    if (action == OVERFLOW_CALLER_RUNS) {
+        rift_telemetry_record_backpressure(action, depth, policy->max_queued, 0);
+        return 1;
+    }
+
+    // Nothing else drives this scheduler: a task lets it run, anyone else runs it
+    uint64_t start = scheduler_now_ns();
+    uint32_t current = depth;
+    while (!scheduler_has_room(current, count, policy->max_queued)) {
+        if (rift_simulated_current()) {
+            rift_simulated_yield();
+        } else if (rift_simulated_schedule_cycle() == 0) {
+            sched_yield();
+        }
+        current = rift_simulated_runnable_count();
+    }
+    rift_telemetry_record_backpressure(OVERFLOW_BLOCK, depth, policy->max_queued,
+                                       scheduler_now_ns() - start);
+    return 0;
+}
+
+/**
+ * @brief Run task's first slice on the spawning thread; a task that yields
+ *        then joins the queue, since what it yields for may be queued work
+ *        that nothing would run while the caller kept resuming it
+ */
+void rift_simulated_scheduler_run_inline(rift_simulated_context_t* task) {
+    scheduler_after_slice(task, rift_simulated_resume(task));
+}
+
+/**
+ * @brief Hold the run queue lock so a fork copies no queue mid-update
+ */
+void rift_simulated_scheduler_fork_hold(void) {
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+}
+
+void rift_simulated_scheduler_fork_release(bool in_child) {
+    if (in_child) {
+        pthread_mutex_init(&g_run_queue.queue_mutex, NULL);
+    } else {
+        pthread_mutex_unlock(&g_run_queue.queue_mutex);
+    }
+}
+
+/**
+ * @brief Destroy all queued tasks without running them
+ */
+void rift_simulated_scheduler_cleanup(void) {
+    rift_simulated_context_t* task;
+    while ((task = run_queue_pop()) != NULL) {
+        rift_simulated_destroy_task(task);
+    }
+    pthread_mutex_lock(&g_run_queue.queue_mutex);
+    rift_edf_queue_destroy(&g_run_queue.deadline_queue);
+    pthread_mutex_unlock(&g_run_queue.queue_mutex);
+
+    printf("[SIMULATED] Scheduler stopped after %lu cycles\n",
+           (unsigned long)g_run_queue.cycles_executed);
+}
@@ -0,0 +1,42 @@
+/**
+ * @file rift_test.h
+ * @brief Minimal Pass/Fail Checks for the RIFT Test Programs
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Each test is a program run by the Makefile with stdout discarded: a
+ * failed check names itself on stderr and exits 1, and main() returning 0
+ * means every check passed.
+ */
+
+#ifndef RIFT_TEST_H
+#define RIFT_TEST_H
+
+#include "rift_common.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RIFT_TEST_CHECK(condition)                                                  \
+    do {                                                                            \
+        if (!(condition)) {                                                         \
+            fprintf(stderr, "[TEST] %s:%d: check failed: %s\n", __FILE__, __LINE__, \
+                    #condition);                                                    \
+            exit(1);                                                                \
+        }                                                                           \
+    } while (0)
+
+/**
+ * @brief Policy with the limits every test starts from
+ * @param mode Concurrency mode of the spawns
+ * @return Policy with cascade destruction and the default limits
+ */
+static inline rift_governance_policy_t rift_test_policy(rift_concurrency_mode_t mode) {
+    rift_governance_policy_t policy = {0};
+    policy.mode = mode;
+    policy.destroy_policy = DESTROY_CASCADE;
+    policy.max_children = RIFT_MAX_CHILDREN_PER_PROCESS;
+    policy.max_hierarchy_depth = RIFT_MAX_HIERARCHY_DEPTH;
+    return policy;
+}
+
+#endif // RIFT_TEST_H
@@ -0,0 +1,172 @@
+/**
+ * @file test_auto.c
+ * @brief Adaptive Mode Tests - Site Classification, Mode Switch and Hysteresis
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A simulated task spawns from one site while the work its tasks do is
+ * varied. Empty tasks classify the site SHORT, and later spawns from the
+ * task then stay on its scheduler while a plain thread would still get the
+ * thread pool. Tasks running one and a half times the short threshold
+ * raise the site's average above the threshold but keep it SHORT, since
+ * leaving takes twice the threshold; millisecond tasks move it to CPU_BOUND
+ * on the pool, and empty tasks bring it back. Sampled run times are wall
+ * times, so a preempted sample may still reclassify the site; the
+ * hysteresis phase is retried a few times before the test fails.
+ * Fixed-mode spawns refuse CONCURRENCY_AUTO policies.
+ */
+
+#include "rift_auto.h"
+#include "rift_simulated.h"
+#include "rift_true_concurrency.h"
+#include "rift_test.h"
+#include <unistd.h>
+
+#define TEST_SITE "test_auto.c:site"
+#define TEST_MAX_SPAWNS 400               // Bound on spawns waiting for a class change
+#define TEST_HYSTERESIS_SAMPLES 24        // Enough to pull the average past the threshold
+#define TEST_HYSTERESIS_ATTEMPTS 3        // A preempted sample can push a site out of SHORT
+#define TEST_LONG_NS 1000000
+#define TEST_TIMEOUT_S 30
+
+static _Atomic uint64_t g_work_ns;
+static _Atomic uint32_t g_done;
+static uint32_t g_spawned;
+static _Atomic bool g_driver_done;
+
+static uint64_t test_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static void test_work(void* data) {
+    (void)data;
+    uint64_t work_ns = atomic_load(&g_work_ns);
+    if (work_ns > 0) {
+        uint64_t start = test_now_ns();
+        while (test_now_ns() - start < work_ns) {
+        }
+    }
+    atomic_fetch_add(&g_done, 1);
+}
+
+static rift_auto_class_t test_site_class(void) {
+    rift_auto_site_stats_t stats;
+    RIFT_TEST_CHECK(rift_auto_get_site(TEST_SITE, &stats) == 0);
+    return stats.site_class;
+}
+
+/**
+ * @brief Spawn one task from the site and yield until it has run, on
+ *        whichever scheduler it went to
+ */
+static void test_spawn_one(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_AUTO);
+    RIFT_TEST_CHECK(rift_auto_spawn(0, &policy, test_work, NULL, TEST_SITE));
+    g_spawned++;
+    while (atomic_load(&g_done) < g_spawned) {
+        rift_simulated_yield();
+    }
+}
+
+static void test_spawn_until(rift_auto_class_t site_class) {
+    for (int i = 0; i < TEST_MAX_SPAWNS && (i == 0 || test_site_class() != site_class); i++) {
+        test_spawn_one();
+    }
+    RIFT_TEST_CHECK(test_site_class() == site_class);
+}
+
+/**
+ * @brief Short threshold as rift_auto_reclassify() computes it
+ */
+static uint64_t test_short_threshold_ns(void) {
+    rift_auto_stats_t stats;
+    rift_auto_get_stats(&stats);
+    uint64_t threshold = RIFT_AUTO_SHORT_FACTOR * stats.spawn_cost_ns[CONCURRENCY_TRUE_THREAD];
+    if (threshold < RIFT_AUTO_SHORT_MIN_NS) {
+        return RIFT_AUTO_SHORT_MIN_NS;
+    }
+    return threshold > RIFT_AUTO_SHORT_MAX_NS ? RIFT_AUTO_SHORT_MAX_NS : threshold;
+}
+
+/**
+ * @brief From SHORT, run tasks between one and two thresholds long
+ * @return Whether the site stayed SHORT with its average above the threshold
+ */
+static bool test_holds_short(void) {
+    atomic_store(&g_work_ns, 0);
+    test_spawn_until(RIFT_AUTO_SHORT);
+
+    // Short spawns stay on this scheduler, so the thread spawn cost holds still
+    uint64_t threshold = test_short_threshold_ns();
+    atomic_store(&g_work_ns, threshold * 3 / 2);
+    rift_auto_stats_t before;
+    rift_auto_get_stats(&before);
+    for (int i = 0; i < TEST_HYSTERESIS_SAMPLES * RIFT_AUTO_SAMPLE_INTERVAL; i++) {
+        test_spawn_one();
+    }
+    rift_auto_stats_t after;
+    rift_auto_get_stats(&after);
+    rift_auto_site_stats_t site;
+    RIFT_TEST_CHECK(rift_auto_get_site(TEST_SITE, &site) == 0);
+    RIFT_TEST_CHECK(after.samples >= before.samples + TEST_HYSTERESIS_SAMPLES);
+    return after.reclassified == before.reclassified && site.site_class == RIFT_AUTO_SHORT &&
+           site.avg_run_ns > threshold && site.avg_run_ns < 2 * threshold;
+}
+
+static void test_driver(void* data) {
+    (void)data;
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_AUTO);
+
+    atomic_store(&g_work_ns, 0);
+    test_spawn_until(RIFT_AUTO_SHORT);
+    RIFT_TEST_CHECK(rift_auto_select(&policy, TEST_SITE) == CONCURRENCY_SIMULATED);
+
+    bool held = false;
+    for (int attempt = 0; attempt < TEST_HYSTERESIS_ATTEMPTS && !held; attempt++) {
+        held = test_holds_short();
+    }
+    RIFT_TEST_CHECK(held);
+
+    atomic_store(&g_work_ns, TEST_LONG_NS);
+    test_spawn_until(RIFT_AUTO_CPU_BOUND);
+    RIFT_TEST_CHECK(rift_auto_select(&policy, TEST_SITE) == CONCURRENCY_TRUE_THREAD);
+
+    atomic_store(&g_work_ns, 0);
+    test_spawn_until(RIFT_AUTO_SHORT);
+    RIFT_TEST_CHECK(rift_auto_select(&policy, TEST_SITE) == CONCURRENCY_SIMULATED);
+    atomic_store(&g_driver_done, true);
+}
+
+static void test_fixed_modes_refuse_auto(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_AUTO);
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_work, NULL, "refused") == 0);
+    RIFT_TEST_CHECK(rift_simulated_spawn_batch(0, &policy, test_work, NULL, 2, "refused") == 0);
+    RIFT_TEST_CHECK(rift_true_spawn_thread(0, &policy, test_work, NULL, "refused") == 0);
+    RIFT_TEST_CHECK(rift_true_spawn_process(0, &policy, test_work, NULL, "refused") == 0);
+    RIFT_TEST_CHECK(rift_true_spawn_batch(0, &policy, test_work, NULL, 2, "refused") == 0);
+    RIFT_TEST_CHECK(atomic_load(&g_done) == 0);
+}
+
+int main(void) {
+    alarm(TEST_TIMEOUT_S);
+    RIFT_TEST_CHECK(rift_simulated_init() == 0);
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+    test_fixed_modes_refuse_auto();
+
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_driver, NULL, "auto_driver"));
+    while (!atomic_load(&g_driver_done)) {
+        rift_simulated_schedule_cycle();
+    }
+
+    // Outside a scheduler task a short site has nobody to run it inline
+    rift_governance_policy_t auto_policy = rift_test_policy(CONCURRENCY_AUTO);
+    RIFT_TEST_CHECK(rift_auto_select(&auto_policy, TEST_SITE) == CONCURRENCY_TRUE_THREAD);
+
+    rift_true_concurrency_cleanup();
+    rift_simulated_cleanup();
+    printf("[TEST] Auto mode: mode switch and SHORT hysteresis passed\n");
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file test_backpressure.c
+ * @brief Backpressure Tests - Caller-Runs Spawns That Yield
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A caller-runs spawn at the run queue's bound takes its first slice on the
+ * spawning thread. Here that task yields until tasks already queued have
+ * run, from the main thread and from inside a running task; it has to join
+ * the queue rather than be resumed in a loop that never lets them run. An
+ * alarm turns such a hang into a failure.
+ */
+
+#include "rift_simulated.h"
+#include "rift_telemetry.h"
+#include "rift_test.h"
+#include <unistd.h>
+
+#define TEST_MAX_QUEUED 2
+#define TEST_TIMEOUT_S 10
+
+static _Atomic int g_setters;
+static _Atomic int g_waiters;
+static _Atomic int g_inline_slices;
+
+static rift_governance_policy_t test_bounded_policy(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    policy.max_queued = TEST_MAX_QUEUED;
+    policy.overflow_policy = OVERFLOW_CALLER_RUNS;
+    return policy;
+}
+
+static void test_setter(void* data) {
+    (void)data;
+    atomic_fetch_add(&g_setters, 1);
+}
+
+// Waits on the queued setters, which only run once it stops hogging its thread
+static void test_waiter(void* data) {
+    int setters = (int)(intptr_t)data;
+    atomic_fetch_add(&g_inline_slices, 1);
+    while (atomic_load(&g_setters) < setters) {
+        rift_simulated_yield();
+    }
+    atomic_fetch_add(&g_waiters, 1);
+}
+
+static void test_spawn_setters(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    for (int i = 0; i < TEST_MAX_QUEUED; i++) {
+        RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_setter, NULL, "setter"));
+    }
+}
+
+static void test_spawning_task(void* data) {
+    (void)data;
+    rift_governance_policy_t policy = test_bounded_policy();
+    int setters = atomic_load(&g_setters) + TEST_MAX_QUEUED;
+    RIFT_TEST_CHECK(rift_simulated_spawn(rift_current_id(), &policy, test_waiter,
+                                         (void*)(intptr_t)setters, "task_waiter"));
+}
+
+static void test_drive(void) {
+    while (rift_simulated_runnable_count() > 0) {
+        rift_simulated_schedule_cycle();
+    }
+}
+
+/**
+ * @brief The spawning thread is not a task: the waiter's first slice runs
+ *        inside rift_simulated_spawn()
+ */
+static void test_from_thread(void) {
+    test_spawn_setters();
+    rift_governance_policy_t policy = test_bounded_policy();
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_waiter,
+                                         (void*)(intptr_t)TEST_MAX_QUEUED, "thread_waiter"));
+    RIFT_TEST_CHECK(atomic_load(&g_inline_slices) == 1 && atomic_load(&g_waiters) == 0);
+    RIFT_TEST_CHECK(rift_simulated_runnable_count() == TEST_MAX_QUEUED + 1);
+    test_drive();
+    RIFT_TEST_CHECK(atomic_load(&g_waiters) == 1);
+}
+
+/**
+ * @brief A task queued ahead of the setters spawns the waiter mid-slice
+ */
+static void test_from_task(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_spawning_task, NULL, "spawner"));
+    test_spawn_setters();
+    test_drive();
+    RIFT_TEST_CHECK(atomic_load(&g_inline_slices) == 2 && atomic_load(&g_waiters) == 2);
+}
+
+int main(void) {
+    alarm(TEST_TIMEOUT_S);
+    RIFT_TEST_CHECK(rift_simulated_init() == 0);
+
+    rift_backpressure_stats_t before;
+    rift_telemetry_get_backpressure_stats(&before);
+    test_from_thread();
+    test_from_task();
+    rift_backpressure_stats_t after;
+    rift_telemetry_get_backpressure_stats(&after);
+    RIFT_TEST_CHECK(after.ran_inline - before.ran_inline == 2);
+    RIFT_TEST_CHECK(after.queue_depth_peak == TEST_MAX_QUEUED);
+
+    rift_simulated_cleanup();
+    printf("[TEST] Backpressure: yielding caller-runs spawns join the queue passed\n");
+    return 0;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file test_cancel_tree.c
+ * @brief Cancellation Tree Tests - Subtree Walk and Destroy Policies
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Builds token trees from bare contexts, with no runtime mode involved, and
+ * checks that cancelling a task reaches exactly the descendants its destroy
+ * policies take down: every child below a cascading parent except keep_alive
+ * ones, none below a keep-alive parent, keep_alive children too below an
+ * immediate one. Also covers interrupt hooks running once per cancelled
+ * token, a child attached under a cancelled parent, detach handing children
+ * up, a chain too deep for a recursive walk, and a thread blocked in a
+ * cancellable futex wait.
+ */
+
+#include "rift_cancel.h"
+#include "rift_test.h"
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#define TEST_CHAIN_DEPTH 100000
+#define TEST_BASE_ID 1000
+
+typedef enum {
+    NODE_ROOT, NODE_A, NODE_A1, NODE_A1X, NODE_A2, NODE_A2X, NODE_B, NODE_B1,
+    NODE_C, NODE_C1, NODE_C1X, NODE_D, NODE_OTHER, NODE_OTHER_CHILD, NODE_COUNT
+} test_node_t;
+
+typedef struct {
+    test_node_t parent;
+    rift_destroy_policy_t destroy_policy;
+    bool keep_alive;
+    bool reached;                         // Cancelled along with NODE_ROOT
+} test_node_spec_t;
+
+// Parents come before their children; NODE_COUNT marks a root
+static const test_node_spec_t g_spec[NODE_COUNT] = {
+    [NODE_ROOT]        = { NODE_COUNT, DESTROY_CASCADE,    false, true  },
+    [NODE_A]           = { NODE_ROOT,  DESTROY_CASCADE,    false, true  },
+    [NODE_A1]          = { NODE_A,     DESTROY_CASCADE,    false, true  },
+    [NODE_A1X]         = { NODE_A1,    DESTROY_CASCADE,    false, true  },
+    [NODE_A2]          = { NODE_A,     DESTROY_CASCADE,    true,  false },
+    [NODE_A2X]         = { NODE_A2,    DESTROY_CASCADE,    false, false },
+    [NODE_B]           = { NODE_ROOT,  DESTROY_KEEP_ALIVE, false, true  },
+    [NODE_B1]          = { NODE_B,     DESTROY_CASCADE,    false, false },
+    [NODE_C]           = { NODE_ROOT,  DESTROY_IMMEDIATE,  false, true  },
+    [NODE_C1]          = { NODE_C,     DESTROY_CASCADE,    true,  true  },
+    [NODE_C1X]         = { NODE_C1,    DESTROY_CASCADE,    false, true  },
+    [NODE_D]           = { NODE_ROOT,  DESTROY_CASCADE,    true,  false },
+    [NODE_OTHER]       = { NODE_COUNT, DESTROY_CASCADE,    false, false },
+    [NODE_OTHER_CHILD] = { NODE_OTHER, DESTROY_CASCADE,    false, false },
+};
+
+static rift_thread_context_t g_nodes[NODE_COUNT];
+static _Atomic uint32_t g_interrupts[NODE_COUNT];
+
+static void test_interrupt(rift_cancel_token_t* token) {
+    for (int i = 0; i < NODE_COUNT; i++) {
+        if (&g_nodes[i].cancel == token) {
+            atomic_fetch_add(&g_interrupts[i], 1);
+        }
+    }
+}
+
+static void test_attach(rift_thread_context_t* context, uint64_t rift_id, uint64_t parent_id,
+                        rift_destroy_policy_t destroy_policy, bool keep_alive) {
+    memset(context, 0, sizeof(*context));
+    context->telemetry.rift_thread_id = rift_id;
+    context->telemetry.parent_rift_id = parent_id;
+    context->policy.destroy_policy = destroy_policy;
+    context->policy.keep_alive = keep_alive;
+    rift_cancel_attach(context, test_interrupt);
+}
+
+static uint64_t test_node_id(test_node_t node) {
+    return node == NODE_COUNT ? 0 : TEST_BASE_ID + (uint64_t)node;
+}
+
+static void test_policy_walk(void) {
+    for (int i = 0; i < NODE_COUNT; i++) {
+        test_attach(&g_nodes[i], test_node_id(i), test_node_id(g_spec[i].parent),
+                    g_spec[i].destroy_policy, g_spec[i].keep_alive);
+    }
+    rift_cancel_stats_t stats;
+    rift_cancel_get_stats(&stats);
+    RIFT_TEST_CHECK(stats.attached == NODE_COUNT);
+
+    uint32_t expected = 0;
+    for (int i = 0; i < NODE_COUNT; i++) {
+        expected += g_spec[i].reached;
+    }
+    RIFT_TEST_CHECK(rift_cancel_context(&g_nodes[NODE_ROOT]) == expected);
+    for (int i = 0; i < NODE_COUNT; i++) {
+        RIFT_TEST_CHECK(rift_cancel_requested(&g_nodes[i].cancel) == g_spec[i].reached);
+        RIFT_TEST_CHECK(g_nodes[i].should_terminate == g_spec[i].reached);
+        RIFT_TEST_CHECK(atomic_load(&g_interrupts[i]) == (uint32_t)g_spec[i].reached);
+    }
+
+    // Cancelled tokens are not walked twice
+    RIFT_TEST_CHECK(rift_cancel_context(&g_nodes[NODE_ROOT]) == 0);
+    RIFT_TEST_CHECK(rift_cancel(test_node_id(NODE_A2)) == 0);
+    RIFT_TEST_CHECK(rift_cancel_requested(&g_nodes[NODE_A2X].cancel));
+    RIFT_TEST_CHECK(!rift_cancel_requested(&g_nodes[NODE_OTHER].cancel));
+    RIFT_TEST_CHECK(atomic_load(&g_interrupts[NODE_A1]) == 1);
+    RIFT_TEST_CHECK(rift_cancel(UINT64_MAX) == -1);
+
+    // Spawned under a cancelled parent: only where its policy reaches
+    rift_thread_context_t late_cascade;
+    rift_thread_context_t late_kept;
+    test_attach(&late_cascade, TEST_BASE_ID + 100, test_node_id(NODE_A), DESTROY_CASCADE, false);
+    test_attach(&late_kept, TEST_BASE_ID + 101, test_node_id(NODE_B), DESTROY_CASCADE, false);
+    RIFT_TEST_CHECK(rift_cancel_requested(&late_cascade.cancel));
+    RIFT_TEST_CHECK(!rift_cancel_requested(&late_kept.cancel));
+    rift_cancel_detach(&late_cascade);
+    rift_cancel_detach(&late_kept);
+
+    // Detaching a task hands its children to its parent
+    rift_cancel_detach(&g_nodes[NODE_OTHER]);
+    RIFT_TEST_CHECK(g_nodes[NODE_OTHER_CHILD].cancel.parent == NULL);
+    for (int i = NODE_COUNT - 1; i >= 0; i--) {
+        rift_cancel_detach(&g_nodes[i]);
+    }
+    rift_cancel_get_stats(&stats);
+    RIFT_TEST_CHECK(stats.attached == 0);
+}
+
+/**
+ * @brief A chain deeper than any call stack would allow a recursive walk
+ */
+static void test_deep_chain(void) {
+    rift_thread_context_t* chain = calloc(TEST_CHAIN_DEPTH, sizeof(*chain));
+    RIFT_TEST_CHECK(chain != NULL);
+    for (uint64_t i = 0; i < TEST_CHAIN_DEPTH; i++) {
+        uint64_t id = TEST_BASE_ID * 10 + i;
+        test_attach(&chain[i], id, i == 0 ? 0 : id - 1, DESTROY_CASCADE, false);
+        chain[i].cancel.interrupt = NULL;
+    }
+    RIFT_TEST_CHECK(rift_cancel_context(&chain[1]) == TEST_CHAIN_DEPTH - 1);
+    RIFT_TEST_CHECK(!rift_cancel_requested(&chain[0].cancel));
+    RIFT_TEST_CHECK(rift_cancel_requested(&chain[TEST_CHAIN_DEPTH - 1].cancel));
+    for (uint64_t i = TEST_CHAIN_DEPTH; i > 0; i--) {
+        rift_cancel_detach(&chain[i - 1]);
+    }
+    free(chain);
+}
+
+static rift_thread_context_t g_blocked;
+static _Atomic uint32_t g_never_set;
+static _Atomic int g_wait_result = 99;
+
+static void* test_blocked_thread(void* arg) {
+    (void)arg;
+    rift_current_context = &g_blocked;
+    atomic_store(&g_wait_result, rift_cancel_futex_wait(&g_never_set, 0, NULL));
+    rift_current_context = NULL;
+    return NULL;
+}
+
+/**
+ * @brief Cancelling wakes a thread from a futex wait on an unrelated word
+ */
+static void test_blocked_wait(void) {
+    test_attach(&g_blocked, TEST_BASE_ID * 1000, 0, DESTROY_CASCADE, false);
+    g_blocked.cancel.interrupt = NULL;
+    pthread_t thread;
+    RIFT_TEST_CHECK(pthread_create(&thread, NULL, test_blocked_thread, NULL) == 0);
+    usleep(20000);
+    RIFT_TEST_CHECK(atomic_load(&g_wait_result) == 99);
+    RIFT_TEST_CHECK(rift_cancel(TEST_BASE_ID * 1000) == 0);
+    pthread_join(thread, NULL);
+    RIFT_TEST_CHECK(atomic_load(&g_wait_result) == 1);
+    rift_cancel_detach(&g_blocked);
+}
+
+int main(void) {
+    test_policy_walk();
+    test_deep_chain();
+    test_blocked_wait();
+    printf("[TEST] Cancellation tree: policy walk, deep chain and blocked wait passed\n");
+    return 0;
+}
@@ -0,0 +1,225 @@
+/**
+ * @file test_chan_select.c
+ * @brief Channel Select Tests - Ready Cases, Parking, Close and Cancel
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Outside a task a non-blocking select completes only a ready case. Inside
+ * tasks, a select over two receive cases drains both channels until each
+ * reports closed, a select mixing a send and a receive case completes
+ * whichever counterpart arrives, and a task parked in select returns -1
+ * when cancelled. The two-channel drain is repeated with hybrid-mode tasks
+ * on worker threads.
+ */
+
+#include "rift_simulated.h"
+#include "rift_simulated_chan.h"
+#include "rift_simulated_hybrid.h"
+#include "rift_cancel.h"
+#include "rift_test.h"
+
+#define TEST_VALUES 5000
+#define TEST_SUM ((long)TEST_VALUES * (TEST_VALUES - 1) / 2)
+
+static rift_chan_t* g_left;
+static rift_chan_t* g_right;
+static _Atomic long g_total;
+static _Atomic int g_select_result;
+
+static void test_drive(void) {
+    while (rift_simulated_runnable_count() > 0) {
+        rift_simulated_schedule_cycle();
+    }
+}
+
+static void test_ready_cases(void) {
+    rift_chan_t* empty = RIFT_CHAN_CREATE(long, 1);
+    rift_chan_t* full = RIFT_CHAN_CREATE(long, 1);
+    long value = 42;
+    long received = 0;
+    RIFT_TEST_CHECK(rift_chan_try_send(full, &value) == RIFT_CHAN_OK);
+
+    // Nothing to receive on empty, no room to send on full
+    rift_chan_case_t blocked[2] = {
+        { empty, RIFT_CHAN_RECV, &received, RIFT_CHAN_OK },
+        { full, RIFT_CHAN_SEND, &value, RIFT_CHAN_OK }
+    };
+    RIFT_TEST_CHECK(rift_chan_select(blocked, 2, false) == -1);
+
+    // Only the receive from full is ready
+    rift_chan_case_t ready[2] = {
+        { empty, RIFT_CHAN_RECV, &received, RIFT_CHAN_OK },
+        { full, RIFT_CHAN_RECV, &received, RIFT_CHAN_OK }
+    };
+    RIFT_TEST_CHECK(rift_chan_select(ready, 2, false) == 1);
+    RIFT_TEST_CHECK(ready[1].status == RIFT_CHAN_OK && received == 42);
+
+    // A closed channel is always ready
+    rift_chan_close(empty);
+    RIFT_TEST_CHECK(rift_chan_select(ready, 2, false) == 0);
+    RIFT_TEST_CHECK(ready[0].status == RIFT_CHAN_CLOSED && received == 0);
+
+    rift_chan_destroy(empty);
+    rift_chan_destroy(full);
+}
+
+static void test_sender(void* data) {
+    rift_chan_t* chan = data;
+    for (long i = 0; i < TEST_VALUES; i++) {
+        RIFT_TEST_CHECK(rift_chan_send(chan, &i) == RIFT_CHAN_OK);
+    }
+    rift_chan_close(chan);
+}
+
+static void test_select_drain(void* data) {
+    (void)data;
+    long left = 0;
+    long right = 0;
+    long sum = 0;
+    bool left_open = true;
+    bool right_open = true;
+    while (left_open || right_open) {
+        rift_chan_case_t cases[2];
+        rift_chan_t* chans[2];
+        uint32_t count = 0;
+        if (left_open) {
+            chans[count] = g_left;
+            cases[count++] = (rift_chan_case_t){ g_left, RIFT_CHAN_RECV, &left, RIFT_CHAN_OK };
+        }
+        if (right_open) {
+            chans[count] = g_right;
+            cases[count++] = (rift_chan_case_t){ g_right, RIFT_CHAN_RECV, &right, RIFT_CHAN_OK };
+        }
+        int chosen = rift_chan_select(cases, count, true);
+        RIFT_TEST_CHECK(chosen >= 0 && (uint32_t)chosen < count);
+        if (cases[chosen].status == RIFT_CHAN_CLOSED) {
+            if (chans[chosen] == g_left) {
+                left_open = false;
+            } else {
+                right_open = false;
+            }
+            continue;
+        }
+        RIFT_TEST_CHECK(cases[chosen].status == RIFT_CHAN_OK);
+        sum += chans[chosen] == g_left ? left : right;
+    }
+    atomic_fetch_add(&g_total, sum);
+}
+
+/**
+ * @brief Drain an unbuffered and a buffered channel through one select
+ */
+static void test_drain(rift_concurrency_mode_t mode) {
+    g_left = RIFT_CHAN_CREATE(long, 0);
+    g_right = RIFT_CHAN_CREATE(long, 4);
+    atomic_store(&g_total, 0);
+
+    rift_governance_policy_t policy = rift_test_policy(mode);
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_select_drain, NULL, "select_drain"));
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_sender, g_left, "select_left"));
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_sender, g_right, "select_right"));
+    if (mode == CONCURRENCY_HYBRID) {
+        rift_hybrid_wait();
+    } else {
+        test_drive();
+    }
+    RIFT_TEST_CHECK(atomic_load(&g_total) == 2 * TEST_SUM);
+
+    rift_chan_destroy(g_left);
+    rift_chan_destroy(g_right);
+}
+
+static void test_select_mixed(void* data) {
+    (void)data;
+    long out = 7;
+    long in = 0;
+    rift_chan_case_t cases[2] = {
+        { g_left, RIFT_CHAN_SEND, &out, RIFT_CHAN_OK },
+        { g_right, RIFT_CHAN_RECV, &in, RIFT_CHAN_OK }
+    };
+    int chosen = rift_chan_select(cases, 2, true);
+    RIFT_TEST_CHECK(chosen == 1 && cases[1].status == RIFT_CHAN_OK && in == 9);
+    chosen = rift_chan_select(cases, 1, true);
+    RIFT_TEST_CHECK(chosen == 0 && cases[0].status == RIFT_CHAN_OK);
+    atomic_store(&g_select_result, 1);
+}
+
+static void test_mixed_counterpart(void* data) {
+    (void)data;
+    long value = 9;
+    RIFT_TEST_CHECK(rift_chan_send(g_right, &value) == RIFT_CHAN_OK);
+    RIFT_TEST_CHECK(rift_chan_recv(g_left, &value) == RIFT_CHAN_OK && value == 7);
+}
+
+/**
+ * @brief A parked select completes the case whose counterpart arrives first
+ */
+static void test_mixed(void) {
+    g_left = RIFT_CHAN_CREATE(long, 0);
+    g_right = RIFT_CHAN_CREATE(long, 0);
+    atomic_store(&g_select_result, 0);
+
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_select_mixed, NULL, "select_mixed"));
+    rift_simulated_schedule_cycle(); // Parks on both cases
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_mixed_counterpart, NULL,
+                                         "select_counterpart"));
+    test_drive();
+    RIFT_TEST_CHECK(atomic_load(&g_select_result) == 1);
+
+    rift_chan_destroy(g_left);
+    rift_chan_destroy(g_right);
+}
+
+static void test_select_parked(void* data) {
+    (void)data;
+    long value;
+    rift_chan_case_t cases[2] = {
+        { g_left, RIFT_CHAN_RECV, &value, RIFT_CHAN_OK },
+        { g_right, RIFT_CHAN_RECV, &value, RIFT_CHAN_OK }
+    };
+    atomic_store(&g_select_result, rift_chan_select(cases, 2, true));
+}
+
+/**
+ * @brief Cancelling a task parked in select wakes it with no case taken
+ */
+static void test_cancel(void) {
+    g_left = RIFT_CHAN_CREATE(long, 0);
+    g_right = RIFT_CHAN_CREATE(long, 0);
+    atomic_store(&g_select_result, 2);
+
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    uint64_t id = rift_simulated_spawn(0, &policy, test_select_parked, NULL, "select_parked");
+    RIFT_TEST_CHECK(id != 0);
+    rift_simulated_schedule_cycle();
+    RIFT_TEST_CHECK(rift_simulated_runnable_count() == 0);
+    RIFT_TEST_CHECK(atomic_load(&g_select_result) == 2);
+
+    RIFT_TEST_CHECK(rift_cancel(id) == 0);
+    test_drive();
+    RIFT_TEST_CHECK(atomic_load(&g_select_result) == -1);
+
+    // Nobody is left parked on either channel
+    long value = 1;
+    RIFT_TEST_CHECK(rift_chan_try_send(g_left, &value) == RIFT_CHAN_WOULD_BLOCK);
+    RIFT_TEST_CHECK(rift_chan_try_send(g_right, &value) == RIFT_CHAN_WOULD_BLOCK);
+    rift_chan_destroy(g_left);
+    rift_chan_destroy(g_right);
+}
+
+int main(void) {
+    RIFT_TEST_CHECK(rift_simulated_init() == 0);
+    test_ready_cases();
+    test_drain(CONCURRENCY_SIMULATED);
+    test_mixed();
+    test_cancel();
+
+    RIFT_TEST_CHECK(rift_hybrid_init(4) == 0);
+    test_drain(CONCURRENCY_HYBRID);
+    rift_hybrid_cleanup();
+
+    rift_simulated_cleanup();
+    printf("[TEST] Channel select: ready cases, drain, mixed, cancel and hybrid passed\n");
+    return 0;
+}
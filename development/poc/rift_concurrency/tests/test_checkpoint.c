@@ -0,0 +1,202 @@
+/**
+ * @file test_checkpoint.c
+ * @brief Checkpoint Tests - Save and Same-Process Rollback
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Snapshots a scheduler holding mid-loop workers, a child spawned by one of
+ * them, a task parked on a channel and one terminated before it ever ran,
+ * runs everything to completion, then rolls back: each task that had
+ * yielded resumes from its saved stack without re-entering its function and
+ * finishes with the same results, the never-run task comes back fresh, the
+ * parked one is skipped, and the child's parent is mapped to the restored
+ * task. A restore is refused while tasks are alive and in a forked child.
+ */
+
+#include "rift_simulated.h"
+#include "rift_simulated_chan.h"
+#include "rift_simulated_checkpoint.h"
+#include "rift_telemetry.h"
+#include "rift_test.h"
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define TEST_WORKERS 4
+#define TEST_STEPS 10
+#define TEST_CHILD TEST_WORKERS
+#define TEST_PARKED (TEST_WORKERS + 1)
+#define TEST_SLOTS (TEST_WORKERS + 2)
+#define TEST_SNAPSHOT "/tmp/rift_test_checkpoint.ckp"
+#define TEST_SECOND_SNAPSHOT "/tmp/rift_test_checkpoint_live.ckp"
+
+static int g_starts[TEST_SLOTS];
+static int g_progress[TEST_SLOTS];
+static int g_sums[TEST_SLOTS];
+static uint64_t g_child;
+static uint64_t g_workers[TEST_WORKERS];
+static rift_chan_t* g_chan;
+
+static void test_drive(void) {
+    while (rift_simulated_runnable_count() > 0) {
+        rift_simulated_schedule_cycle();
+    }
+}
+
+static rift_governance_policy_t test_checkpoint_policy(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    policy.destroy_policy = DESTROY_KEEP_ALIVE;
+    return policy;
+}
+
+// The running sum lives on the task's stack, so a resumed task only gets it
+// right if the stack came back as saved
+static void test_child(void* data) {
+    int slot = (int)(uintptr_t)data;
+    g_starts[slot]++;
+    int sum = 0;
+    for (int i = 0; i < TEST_STEPS; i++) {
+        sum += i;
+        g_progress[slot] = i + 1;
+        rift_simulated_yield();
+    }
+    g_sums[slot] = sum;
+}
+
+static void test_worker(void* data) {
+    int slot = (int)(uintptr_t)data;
+    g_starts[slot]++;
+    int sum = 0;
+    for (int i = 0; i < TEST_STEPS; i++) {
+        sum += i * (slot + 1);
+        g_progress[slot] = i + 1;
+        if (slot == 0 && i == 1) {
+            rift_governance_policy_t policy = test_checkpoint_policy();
+            g_child = rift_simulated_spawn(rift_current_id(), &policy, test_child,
+                                           (void*)(uintptr_t)TEST_CHILD, "checkpoint_child");
+            RIFT_TEST_CHECK(g_child != 0);
+        }
+        rift_simulated_yield();
+    }
+    g_sums[slot] = sum;
+}
+
+static void test_parked(void* data) {
+    (void)data;
+    g_starts[TEST_PARKED]++;
+    int value;
+    rift_chan_recv(g_chan, &value);
+    g_progress[TEST_PARKED] = value;
+}
+
+static void test_expect_done(void) {
+    for (int slot = 0; slot < TEST_WORKERS; slot++) {
+        int sum = 0;
+        for (int i = 0; i < TEST_STEPS; i++) {
+            sum += i * (slot + 1);
+        }
+        RIFT_TEST_CHECK(g_progress[slot] == TEST_STEPS && g_sums[slot] == sum);
+    }
+    RIFT_TEST_CHECK(g_progress[TEST_CHILD] == TEST_STEPS && g_sums[TEST_CHILD] == 45);
+}
+
+/**
+ * @brief Start the workers and the parked task and run them a few cycles in
+ */
+static void test_setup(void) {
+    memset(g_starts, 0, sizeof(g_starts));
+    memset(g_progress, 0, sizeof(g_progress));
+    memset(g_sums, 0, sizeof(g_sums));
+    g_chan = RIFT_CHAN_CREATE(int, 0);
+
+    rift_governance_policy_t policy = test_checkpoint_policy();
+    for (int slot = 0; slot < TEST_WORKERS; slot++) {
+        g_workers[slot] = rift_simulated_spawn(0, &policy, test_worker, (void*)(uintptr_t)slot,
+                                               "checkpoint_worker");
+        RIFT_TEST_CHECK(g_workers[slot] != 0);
+    }
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_parked, NULL, "checkpoint_parked"));
+    for (int cycle = 0; cycle < 3; cycle++) {
+        rift_simulated_schedule_cycle();
+    }
+    RIFT_TEST_CHECK(g_progress[0] == 3 && g_starts[TEST_CHILD] == 1);
+}
+
+static void test_round_trip(void) {
+    test_setup();
+    rift_governance_policy_t policy = test_checkpoint_policy();
+    uint64_t never_run = rift_simulated_spawn(0, &policy, test_worker,
+                                              (void*)(uintptr_t)(TEST_WORKERS - 1),
+                                              "checkpoint_never_run");
+    RIFT_TEST_CHECK(never_run != 0);
+    RIFT_TEST_CHECK(rift_simulated_terminate(never_run) == 0);
+
+    rift_checkpoint_stats_t before;
+    rift_checkpoint_get_stats(&before);
+    RIFT_TEST_CHECK(rift_checkpoint_save(TEST_SNAPSHOT) == 0);
+    RIFT_TEST_CHECK(rift_checkpoint_wait() == 0);
+    rift_checkpoint_stats_t saved;
+    rift_checkpoint_get_stats(&saved);
+    RIFT_TEST_CHECK(saved.checkpoints == before.checkpoints + 1);
+    RIFT_TEST_CHECK(saved.last_tasks == TEST_WORKERS + 3 && saved.last_bytes > 0);
+
+    int value = 7;
+    RIFT_TEST_CHECK(rift_chan_send(g_chan, &value) == 0);
+    test_drive();
+    test_expect_done();
+    RIFT_TEST_CHECK(g_progress[TEST_PARKED] == 7);
+    int starts_before[TEST_SLOTS];
+    memcpy(starts_before, g_starts, sizeof(g_starts));
+
+    // Forget the results so the rollback has to produce them again
+    memset(g_progress, 0, sizeof(g_progress));
+    memset(g_sums, 0, sizeof(g_sums));
+    RIFT_TEST_CHECK(rift_checkpoint_rollback(TEST_SNAPSHOT) == TEST_WORKERS + 2);
+    rift_checkpoint_stats_t restored;
+    rift_checkpoint_get_stats(&restored);
+    RIFT_TEST_CHECK(restored.restored_resumed - saved.restored_resumed == TEST_WORKERS + 1);
+    RIFT_TEST_CHECK(restored.restored_fresh - saved.restored_fresh == 1);
+    RIFT_TEST_CHECK(restored.restore_skipped - saved.restore_skipped == 1);
+
+    uint64_t first = rift_checkpoint_restored_id(g_workers[0]);
+    RIFT_TEST_CHECK(first != 0 && first != g_workers[0]);
+    uint64_t child = rift_checkpoint_restored_id(g_child);
+    RIFT_TEST_CHECK(child != 0 && rift_telemetry_get(child)->parent_rift_id == first);
+    test_drive();
+    test_expect_done();
+    RIFT_TEST_CHECK(memcmp(starts_before, g_starts, sizeof(g_starts)) == 0);
+    rift_chan_destroy(g_chan);
+    unlink(TEST_SNAPSHOT);
+}
+
+/**
+ * @brief Live tasks block a rollback; a forked child may not restore at all
+ */
+static void test_refused(void) {
+    test_setup();
+    RIFT_TEST_CHECK(rift_checkpoint_save(TEST_SECOND_SNAPSHOT) == 0);
+    RIFT_TEST_CHECK(rift_checkpoint_wait() == 0);
+    RIFT_TEST_CHECK(rift_checkpoint_rollback(TEST_SECOND_SNAPSHOT) == -1);
+    rift_chan_close(g_chan);
+    test_drive();
+    rift_chan_destroy(g_chan);
+
+    pid_t pid = fork();
+    RIFT_TEST_CHECK(pid >= 0);
+    if (pid == 0) {
+        _exit(rift_checkpoint_rollback(TEST_SECOND_SNAPSHOT) == -1 ? 0 : 1);
+    }
+    int status;
+    RIFT_TEST_CHECK(waitpid(pid, &status, 0) == pid);
+    RIFT_TEST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    unlink(TEST_SECOND_SNAPSHOT);
+}
+
+int main(void) {
+    RIFT_TEST_CHECK(rift_simulated_init() == 0);
+    test_round_trip();
+    test_refused();
+    rift_simulated_cleanup();
+    printf("[TEST] Checkpoint: save, rollback and refused restores passed\n");
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file test_deadline.c
+ * @brief Execution Deadline Tests - Cancelling Parked Tasks
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A task past max_execution_time_ms is cancelled from the watchdog thread
+ * while it is parked: a simulated task blocked on an empty channel and one
+ * in a long watchdog sleep, and a dedicated thread in a cancellable sleep.
+ * Each returns cancelled well before its wait would have ended on its own,
+ * and tasks finishing within their deadline are left alone.
+ */
+
+#include "rift_simulated.h"
+#include "rift_simulated_chan.h"
+#include "rift_true_concurrency.h"
+#include "rift_cancel.h"
+#include "rift_watchdog.h"
+#include "rift_test.h"
+#include <unistd.h>
+
+#define TEST_DEADLINE_MS 20
+#define TEST_PARK_MS 10000
+#define TEST_LIMIT_MS 2000
+#define TEST_ROUNDS 5
+
+static rift_chan_t* g_chan;
+static _Atomic int g_recv_status = -1;
+static _Atomic int g_sleep_status = 1;
+static _Atomic int g_thread_status = 1;
+static _Atomic int g_in_time;
+
+static uint64_t test_now_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+}
+
+static rift_governance_policy_t test_deadline_policy(rift_concurrency_mode_t mode) {
+    rift_governance_policy_t policy = rift_test_policy(mode);
+    policy.max_execution_time_ms = TEST_DEADLINE_MS;
+    return policy;
+}
+
+static void test_parked_recv(void* data) {
+    (void)data;
+    int value;
+    atomic_store(&g_recv_status, (int)rift_chan_recv(g_chan, &value));
+}
+
+static void test_parked_sleep(void* data) {
+    (void)data;
+    atomic_store(&g_sleep_status, rift_simulated_sleep_ms(TEST_PARK_MS));
+}
+
+static void test_in_time(void* data) {
+    (void)data;
+    if (!rift_cancel_requested(&rift_current()->cancel)) {
+        atomic_fetch_add(&g_in_time, 1);
+    }
+}
+
+static void test_thread_sleep(void* data) {
+    (void)data;
+    atomic_store(&g_thread_status, rift_sleep_ms(TEST_PARK_MS));
+}
+
+static void test_simulated(void) {
+    RIFT_TEST_CHECK(rift_simulated_init() == 0);
+    g_chan = RIFT_CHAN_CREATE(int, 0);
+
+    rift_governance_policy_t policy = test_deadline_policy(CONCURRENCY_SIMULATED);
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_parked_recv, NULL, "parked_recv"));
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_parked_sleep, NULL, "parked_sleep"));
+    for (int i = 0; i < TEST_ROUNDS; i++) {
+        RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_in_time, NULL, "in_time"));
+    }
+
+    // Both parked tasks leave the run queue; only the watchdog brings them back
+    uint64_t start = test_now_ms();
+    while (atomic_load(&g_recv_status) == -1 || atomic_load(&g_sleep_status) == 1) {
+        RIFT_TEST_CHECK(test_now_ms() - start < TEST_LIMIT_MS);
+        rift_simulated_schedule_cycle();
+        usleep(1000);
+    }
+    RIFT_TEST_CHECK(atomic_load(&g_recv_status) == RIFT_CHAN_CANCELLED);
+    RIFT_TEST_CHECK(atomic_load(&g_sleep_status) == -1);
+    RIFT_TEST_CHECK(atomic_load(&g_in_time) == TEST_ROUNDS);
+
+    rift_chan_destroy(g_chan);
+    rift_simulated_cleanup();
+}
+
+static void test_thread(void) {
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+    rift_governance_policy_t policy = test_deadline_policy(CONCURRENCY_TRUE_THREAD);
+    policy.dedicated_thread = true;
+
+    uint64_t start = test_now_ms();
+    uint64_t rift_id = rift_true_spawn_thread(0, &policy, test_thread_sleep, NULL,
+                                              "parked_thread");
+    RIFT_TEST_CHECK(rift_id != 0);
+    RIFT_TEST_CHECK(rift_true_wait(rift_id, TEST_LIMIT_MS) == 0);
+    RIFT_TEST_CHECK(test_now_ms() - start < TEST_LIMIT_MS);
+    RIFT_TEST_CHECK(atomic_load(&g_thread_status) == -1);
+
+    rift_watchdog_stats_t stats;
+    rift_watchdog_get_stats(&stats);
+    RIFT_TEST_CHECK(stats.expired >= 1);
+    rift_true_concurrency_cleanup();
+}
+
+int main(void) {
+    test_simulated();
+    test_thread();
+    printf("[TEST] Deadline: parked tasks cancelled by the watchdog passed\n");
+    return 0;
+}
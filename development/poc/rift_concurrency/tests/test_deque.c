@@ -0,0 +1,140 @@
+/**
+ * @file test_deque.c
+ * @brief Chase-Lev Deque Tests - Ordering, Growth and Concurrent Steals
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Single-threaded: the owner end is LIFO, the steal end FIFO, and a deque
+ * started at two slots grows past them without losing or reordering an
+ * item. Concurrent: the owner pushes and pops while thieves steal from a
+ * deque small enough to grow under them, and every item must be taken
+ * exactly once.
+ */
+
+#include "rift_deque.h"
+#include "rift_test.h"
+#include <pthread.h>
+
+#define TEST_ITEMS 4096
+#define TEST_STEAL_ITEMS 200000
+#define TEST_THIEVES 3
+
+// Items are 1-based indexes, so none is NULL
+#define TEST_ITEM(index) ((void*)(uintptr_t)((index) + 1))
+#define TEST_INDEX(item) ((uintptr_t)(item) - 1)
+
+static rift_deque_t g_deque;
+static _Atomic uint8_t g_taken[TEST_STEAL_ITEMS];
+static _Atomic bool g_owner_done;
+static _Atomic uint64_t g_stolen;
+
+static void test_take(void* item) {
+    RIFT_TEST_CHECK(item != NULL);
+    uintptr_t index = TEST_INDEX(item);
+    RIFT_TEST_CHECK(index < TEST_STEAL_ITEMS);
+    RIFT_TEST_CHECK(atomic_fetch_add(&g_taken[index], 1) == 0);
+}
+
+static void test_order_and_growth(void) {
+    rift_deque_t deque;
+    RIFT_TEST_CHECK(rift_deque_init(&deque, 2) == 0);
+    RIFT_TEST_CHECK(rift_deque_pop(&deque) == NULL);
+    RIFT_TEST_CHECK(rift_deque_steal(&deque) == NULL);
+
+    for (uintptr_t i = 0; i < TEST_ITEMS; i++) {
+        RIFT_TEST_CHECK(rift_deque_push(&deque, TEST_ITEM(i)) == 0);
+    }
+    RIFT_TEST_CHECK(rift_deque_size(&deque) == TEST_ITEMS);
+
+    // Thieves take the oldest half in push order, the owner the rest newest first
+    for (uintptr_t i = 0; i < TEST_ITEMS / 2; i++) {
+        RIFT_TEST_CHECK(rift_deque_steal(&deque) == TEST_ITEM(i));
+    }
+    for (uintptr_t i = TEST_ITEMS; i > TEST_ITEMS / 2; i--) {
+        RIFT_TEST_CHECK(rift_deque_pop(&deque) == TEST_ITEM(i - 1));
+    }
+    RIFT_TEST_CHECK(rift_deque_size(&deque) == 0);
+    RIFT_TEST_CHECK(rift_deque_pop(&deque) == NULL);
+
+    // Wrapping around the grown array keeps the order
+    for (int round = 0; round < 3; round++) {
+        for (uintptr_t i = 0; i < TEST_ITEMS; i++) {
+            RIFT_TEST_CHECK(rift_deque_push(&deque, TEST_ITEM(i)) == 0);
+            if (i % 2 == 1) {
+                RIFT_TEST_CHECK(rift_deque_steal(&deque) == TEST_ITEM(i / 2));
+            }
+        }
+        for (uintptr_t i = TEST_ITEMS / 2; i < TEST_ITEMS; i++) {
+            RIFT_TEST_CHECK(rift_deque_steal(&deque) == TEST_ITEM(i));
+        }
+        RIFT_TEST_CHECK(rift_deque_steal(&deque) == NULL);
+    }
+    rift_deque_destroy(&deque);
+}
+
+static void* test_thief(void* arg) {
+    (void)arg;
+    uint64_t stolen = 0;
+    for (;;) {
+        bool owner_done = atomic_load(&g_owner_done);
+        void* item = rift_deque_steal(&g_deque);
+        if (item) {
+            test_take(item);
+            stolen++;
+        } else if (owner_done && rift_deque_size(&g_deque) <= 0) {
+            break;
+        }
+    }
+    atomic_fetch_add(&g_stolen, stolen);
+    return NULL;
+}
+
+static void test_concurrent_steal(void) {
+    RIFT_TEST_CHECK(rift_deque_init(&g_deque, 2) == 0);
+    atomic_store(&g_owner_done, false);
+
+    pthread_t thieves[TEST_THIEVES];
+    for (int i = 0; i < TEST_THIEVES; i++) {
+        RIFT_TEST_CHECK(pthread_create(&thieves[i], NULL, test_thief, NULL) == 0);
+    }
+
+    // Bursts of pushes grow the array while thieves are reading it
+    uint64_t popped = 0;
+    uintptr_t next = 0;
+    while (next < TEST_STEAL_ITEMS) {
+        uintptr_t burst = 1 + next % 97;
+        for (uintptr_t i = 0; i < burst && next < TEST_STEAL_ITEMS; i++) {
+            RIFT_TEST_CHECK(rift_deque_push(&g_deque, TEST_ITEM(next)) == 0);
+            next++;
+        }
+        for (uintptr_t i = 0; i < burst / 3; i++) {
+            void* item = rift_deque_pop(&g_deque);
+            if (item) {
+                test_take(item);
+                popped++;
+            }
+        }
+    }
+    void* item;
+    while ((item = rift_deque_pop(&g_deque)) != NULL) {
+        test_take(item);
+        popped++;
+    }
+    atomic_store(&g_owner_done, true);
+    for (int i = 0; i < TEST_THIEVES; i++) {
+        pthread_join(thieves[i], NULL);
+    }
+
+    RIFT_TEST_CHECK(popped + atomic_load(&g_stolen) == TEST_STEAL_ITEMS);
+    for (uintptr_t i = 0; i < TEST_STEAL_ITEMS; i++) {
+        RIFT_TEST_CHECK(atomic_load(&g_taken[i]) == 1);
+    }
+    rift_deque_destroy(&g_deque);
+}
+
+int main(void) {
+    test_order_and_growth();
+    test_concurrent_steal();
+    printf("[TEST] Chase-Lev deque: order, growth and concurrent steals passed\n");
+    return 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file test_edf.c
+ * @brief EDF Tests - Admission Control and Deadline Queue Order
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Admission: claims are accepted while every outstanding deadline stays
+ * feasible and refused as soon as one would not be, whether the newcomer or
+ * an already admitted task would miss; releasing a claim makes room again,
+ * and a ledger with two runners spreads demand over both without letting a
+ * single task run faster than its own deadline allows. Rejections reach the
+ * telemetry counter. Queue: pops come out by deadline, ties in push order,
+ * and boosting moves an item earlier only. Deadlines are seconds apart so
+ * scheduling noise cannot flip a verdict.
+ */
+
+#include "rift_edf.h"
+#include "rift_telemetry.h"
+#include "rift_test.h"
+
+#define TEST_MS 1000000ull
+#define TEST_QUEUE_ITEMS 1000
+#define TEST_QUEUE_DEADLINES 7
+
+static uint64_t test_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static rift_edf_ledger_t g_ledger = { .mutex = PTHREAD_MUTEX_INITIALIZER };
+static int g_owners[16];
+
+static void test_admission(void) {
+    rift_deadline_stats_t before;
+    rift_telemetry_get_deadline_stats(&before);
+    uint32_t rejected = 0;
+
+    rift_edf_ledger_reset(&g_ledger, 1);
+    uint64_t now = test_now_ns();
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[0], now + 1000 * TEST_MS,
+                                   400 * TEST_MS) == 0);
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[1], now + 2000 * TEST_MS,
+                                   800 * TEST_MS) == 0);
+    // Fits between them: 900 ms due by 1.5 s, 1.7 s by 2 s
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[2], now + 1500 * TEST_MS,
+                                   500 * TEST_MS) == 0);
+    RIFT_TEST_CHECK(g_ledger.count == 3);
+
+    // The newcomer would miss: 3.2 s due by 3 s
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[3], now + 3000 * TEST_MS,
+                                   1500 * TEST_MS) == -1);
+    rejected++;
+    // Feasible alone, but the task due at 1 s would then miss
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[4], now + 900 * TEST_MS,
+                                   650 * TEST_MS) == -1);
+    rejected++;
+    RIFT_TEST_CHECK(g_ledger.count == 3);
+
+    // Releasing the middle claim makes room: 2.7 s due by 3 s
+    rift_edf_release(&g_ledger, &g_owners[2]);
+    rift_edf_release(&g_ledger, &g_owners[2]);
+    RIFT_TEST_CHECK(g_ledger.count == 2);
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[3], now + 3000 * TEST_MS,
+                                   1500 * TEST_MS) == 0);
+
+    // Two runners share the demand, but one task still runs on one
+    rift_edf_ledger_reset(&g_ledger, 2);
+    now = test_now_ns();
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[5], now + 1000 * TEST_MS,
+                                   1800 * TEST_MS) == -1);
+    rejected++;
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[6], now + 1000 * TEST_MS,
+                                   900 * TEST_MS) == 0);
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[7], now + 1000 * TEST_MS,
+                                   900 * TEST_MS) == 0);
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[8], now + 1000 * TEST_MS,
+                                   900 * TEST_MS) == -1);
+    rejected++;
+
+    // No runtime claimed: only the deadline itself is checked
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[9], now - TEST_MS, 0) == -1);
+    rejected++;
+    RIFT_TEST_CHECK(rift_edf_admit(&g_ledger, &g_owners[10], now + 10 * TEST_MS, 0) == 0);
+    RIFT_TEST_CHECK(g_ledger.count == 2);
+
+    rift_deadline_stats_t after;
+    rift_telemetry_get_deadline_stats(&after);
+    RIFT_TEST_CHECK(after.rejected - before.rejected == rejected);
+    rift_edf_ledger_reset(&g_ledger, 1);
+}
+
+static void test_queue_order(void) {
+    rift_edf_queue_t queue = {0};
+    static uintptr_t pushed_deadline[TEST_QUEUE_ITEMS + 1];
+    uint32_t state = 12345;
+    for (uintptr_t i = 1; i <= TEST_QUEUE_ITEMS; i++) {
+        state = state * 1103515245u + 12345u;
+        pushed_deadline[i] = 1 + (state >> 16) % TEST_QUEUE_DEADLINES;
+        RIFT_TEST_CHECK(rift_edf_queue_push(&queue, (void*)i, pushed_deadline[i]) == 0);
+    }
+    RIFT_TEST_CHECK(queue.count == TEST_QUEUE_ITEMS);
+
+    uintptr_t last_deadline = 0;
+    uintptr_t last_item = 0;
+    for (uint32_t i = 0; i < TEST_QUEUE_ITEMS; i++) {
+        uintptr_t item = (uintptr_t)rift_edf_queue_pop(&queue);
+        RIFT_TEST_CHECK(item >= 1 && item <= TEST_QUEUE_ITEMS);
+        uintptr_t deadline = pushed_deadline[item];
+        RIFT_TEST_CHECK(deadline >= last_deadline);
+        RIFT_TEST_CHECK(deadline > last_deadline || item > last_item); // Ties FIFO
+        last_deadline = deadline;
+        last_item = item;
+    }
+    RIFT_TEST_CHECK(rift_edf_queue_pop(&queue) == NULL);
+    rift_edf_queue_destroy(&queue);
+}
+
+static void test_queue_boost(void) {
+    rift_edf_queue_t queue = {0};
+    RIFT_TEST_CHECK(rift_edf_queue_push(&queue, (void*)1, 300) == 0);
+    RIFT_TEST_CHECK(rift_edf_queue_push(&queue, (void*)2, 200) == 0);
+    RIFT_TEST_CHECK(rift_edf_queue_push(&queue, (void*)3, 100) == 0);
+
+    RIFT_TEST_CHECK(rift_edf_queue_boost(&queue, (void*)1, 50));
+    RIFT_TEST_CHECK(rift_edf_queue_boost(&queue, (void*)3, 500)); // Later: stays put
+    RIFT_TEST_CHECK(!rift_edf_queue_boost(&queue, (void*)4, 10));
+
+    RIFT_TEST_CHECK(queue.entries[0].item == (void*)1);
+    RIFT_TEST_CHECK(rift_edf_queue_remove_at(&queue, 0) == (void*)1);
+    RIFT_TEST_CHECK(rift_edf_queue_pop(&queue) == (void*)3);
+    RIFT_TEST_CHECK(rift_edf_queue_pop(&queue) == (void*)2);
+    RIFT_TEST_CHECK(rift_edf_queue_pop(&queue) == NULL);
+    rift_edf_queue_destroy(&queue);
+}
+
+int main(void) {
+    RIFT_TEST_CHECK(rift_telemetry_init() == 0);
+    test_admission();
+    test_queue_order();
+    test_queue_boost();
+    printf("[TEST] EDF: admission control and deadline queue order passed\n");
+    return 0;
+}
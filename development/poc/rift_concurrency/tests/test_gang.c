@@ -0,0 +1,137 @@
+/**
+ * @file test_gang.c
+ * @brief Gang Start Tests - Release Together and Abort
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A gang_start batch creates every member thread before any of them runs
+ * its work, and telemetry records one gang per batch. When a member's
+ * thread cannot be created the batch fails: the members already started
+ * are released as aborted and finish without running their work, and the
+ * next gang is unaffected. Thread creation is wrapped here so that one
+ * creation can be made to fail on demand.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_telemetry.h"
+#include "rift_test.h"
+#include <dlfcn.h>
+#include <errno.h>
+#include <pthread.h>
+
+#define TEST_MEMBERS 8
+#define TEST_ROUNDS 10
+#define TEST_FAILING_MEMBER 3
+#define TEST_WAIT_MS 5000
+
+typedef int (*test_create_t)(pthread_t*, const pthread_attr_t*, void* (*)(void*), void*);
+
+static _Atomic bool g_counting;
+static _Atomic int g_created;
+static _Atomic int g_fail_at = -1;
+static _Atomic int g_ran;
+static _Atomic int g_early;
+
+// Counts the threads the runtime creates and fails the g_fail_at-th one
+int pthread_create(pthread_t* thread, const pthread_attr_t* attr,
+                   void* (*start)(void*), void* arg) {
+    static test_create_t next;
+    if (!next) {
+        next = (test_create_t)dlsym(RTLD_NEXT, "pthread_create");
+    }
+    if (atomic_load(&g_counting)) {
+        if (atomic_load(&g_created) == atomic_load(&g_fail_at)) {
+            return EAGAIN;
+        }
+        atomic_fetch_add(&g_created, 1);
+    }
+    return next(thread, attr, start, arg);
+}
+
+static void test_member(void* data) {
+    (void)data;
+    if (atomic_load(&g_created) != TEST_MEMBERS) {
+        atomic_fetch_add(&g_early, 1);
+    }
+    atomic_fetch_add(&g_ran, 1);
+}
+
+static rift_governance_policy_t test_gang_policy(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_TRUE_THREAD);
+    policy.gang_start = true;
+    return policy;
+}
+
+static uint64_t test_spawn_gang(int fail_at) {
+    atomic_store(&g_created, 0);
+    atomic_store(&g_ran, 0);
+    atomic_store(&g_fail_at, fail_at);
+    atomic_store(&g_counting, true);
+    rift_governance_policy_t policy = test_gang_policy();
+    uint64_t first = rift_true_spawn_batch(0, &policy, test_member, NULL, TEST_MEMBERS,
+                                           "gang_member");
+    atomic_store(&g_counting, false);
+    return first;
+}
+
+static uint64_t test_released(void) {
+    rift_gang_stats_t before;
+    rift_telemetry_get_gang_stats(&before);
+    uint64_t first = 0;
+    for (int round = 0; round < TEST_ROUNDS; round++) {
+        first = test_spawn_gang(-1);
+        RIFT_TEST_CHECK(first != 0);
+        for (int i = 0; i < TEST_MEMBERS; i++) {
+            RIFT_TEST_CHECK(rift_true_wait(first + (uint64_t)i, TEST_WAIT_MS) == 0);
+        }
+        RIFT_TEST_CHECK(atomic_load(&g_ran) == TEST_MEMBERS);
+    }
+    RIFT_TEST_CHECK(atomic_load(&g_early) == 0);
+
+    rift_gang_stats_t after;
+    rift_telemetry_get_gang_stats(&after);
+    RIFT_TEST_CHECK(after.gangs - before.gangs == TEST_ROUNDS);
+    RIFT_TEST_CHECK(after.members - before.members == TEST_ROUNDS * TEST_MEMBERS);
+    return first;
+}
+
+/**
+ * @brief The member after the last good one cannot be created
+ * @param last_first First ID of the previous gang; IDs are handed out in order
+ */
+static void test_aborted(uint64_t last_first) {
+    rift_gang_stats_t before;
+    rift_telemetry_get_gang_stats(&before);
+    RIFT_TEST_CHECK(test_spawn_gang(TEST_FAILING_MEMBER) == 0);
+    RIFT_TEST_CHECK(atomic_load(&g_created) == TEST_FAILING_MEMBER);
+
+    // Terminating the started members may reap the finished ones, and their
+    // telemetry with them, before they are waited for
+    uint64_t first = last_first + TEST_MEMBERS;
+    for (int i = 0; i < TEST_FAILING_MEMBER; i++) {
+        uint64_t rift_id = first + (uint64_t)i;
+        RIFT_TEST_CHECK(rift_true_wait(rift_id, TEST_WAIT_MS) == 0 || !rift_telemetry_get(rift_id));
+    }
+    RIFT_TEST_CHECK(rift_true_wait(first + TEST_FAILING_MEMBER, 0) == -1);
+    RIFT_TEST_CHECK(atomic_load(&g_ran) == 0);
+
+    rift_gang_stats_t after;
+    rift_telemetry_get_gang_stats(&after);
+    RIFT_TEST_CHECK(after.gangs == before.gangs && after.members == before.members);
+}
+
+int main(void) {
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+
+    uint64_t last_first = test_released();
+    test_aborted(last_first);
+    test_released();
+
+    rift_governance_policy_t policy = test_gang_policy();
+    policy.mode = CONCURRENCY_TRUE_PROCESS;
+    RIFT_TEST_CHECK(rift_true_spawn_batch(0, &policy, test_member, NULL, 2, "gang_process") == 0);
+
+    rift_true_concurrency_cleanup();
+    printf("[TEST] Gang start: release together and abort passed\n");
+    return 0;
+}
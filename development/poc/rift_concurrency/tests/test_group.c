@@ -0,0 +1,154 @@
+/**
+ * @file test_group.c
+ * @brief Task Group Tests - Join, First-Error Cancel and Shared Results
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Groups of simulated tasks, threads and forked processes each join with
+ * every future DONE and its result in place; process children write theirs
+ * into the group's shared arena. A simulated task parks on the futures of
+ * the children it spawned and is woken by each completion. When one task
+ * fails and cancels its group, tasks that had not started end CANCELLED
+ * without running, the join reports the failure, and the group takes no
+ * further spawns. CONCURRENCY_AUTO groups are refused.
+ */
+
+#include "rift_group.h"
+#include "rift_simulated.h"
+#include "rift_true_concurrency.h"
+#include "rift_test.h"
+#include <string.h>
+
+#define TEST_TASKS 8
+#define TEST_FAILING_TASK 2
+
+static rift_task_group_t* g_group;
+static rift_future_t* g_futures[TEST_TASKS];
+static _Atomic int g_ran;
+static uint64_t g_gathered;
+
+static void test_square(void* data, void* result) {
+    uint64_t index = (uint64_t)(uintptr_t)data;
+    atomic_fetch_add(&g_ran, 1);
+    *(uint64_t*)result = index * index;
+}
+
+static uint64_t test_expected_sum(void) {
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < TEST_TASKS; i++) {
+        sum += i * i;
+    }
+    return sum;
+}
+
+/**
+ * @brief Every future ends DONE with its result, whatever the mode
+ */
+static void test_join(rift_concurrency_mode_t mode) {
+    rift_governance_policy_t policy = rift_test_policy(mode);
+    rift_task_group_t* group = RIFT_GROUP_CREATE(0, &policy, uint64_t, TEST_TASKS);
+    RIFT_TEST_CHECK(group != NULL);
+    rift_future_t* futures[TEST_TASKS];
+    for (uint32_t i = 0; i < TEST_TASKS; i++) {
+        futures[i] = rift_group_spawn(group, test_square, (void*)(uintptr_t)i);
+        RIFT_TEST_CHECK(futures[i] != NULL);
+    }
+    RIFT_TEST_CHECK(rift_group_spawn(group, test_square, NULL) == NULL); // Full
+
+    RIFT_TEST_CHECK(rift_group_join(group) == 0);
+    for (uint64_t i = 0; i < TEST_TASKS; i++) {
+        uint64_t result = 0;
+        RIFT_TEST_CHECK(rift_future_get(futures[i], &result) == RIFT_FUTURE_DONE);
+        RIFT_TEST_CHECK(result == i * i);
+    }
+    rift_group_destroy(group);
+}
+
+// Spawns its own group and parks on each future in turn
+static void test_gatherer(void* data) {
+    (void)data;
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    rift_task_group_t* group = RIFT_GROUP_CREATE(rift_current_id(), &policy, uint64_t,
+                                                 TEST_TASKS);
+    RIFT_TEST_CHECK(group != NULL);
+    rift_future_t* futures[TEST_TASKS];
+    for (uint32_t i = 0; i < TEST_TASKS; i++) {
+        futures[i] = rift_group_spawn(group, test_square, (void*)(uintptr_t)i);
+        RIFT_TEST_CHECK(futures[i] != NULL);
+    }
+    for (uint32_t i = 0; i < TEST_TASKS; i++) {
+        uint64_t result = 0;
+        RIFT_TEST_CHECK(rift_future_get(futures[i], &result) == RIFT_FUTURE_DONE);
+        g_gathered += result;
+    }
+    rift_group_destroy(group);
+}
+
+static void test_task_waits(void) {
+    g_gathered = 0;
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_gatherer, NULL, "gatherer"));
+    while (rift_simulated_runnable_count() > 0) {
+        rift_simulated_schedule_cycle();
+    }
+    RIFT_TEST_CHECK(g_gathered == test_expected_sum());
+}
+
+// The failing task cancels its group, as a first-error policy would
+static void test_maybe_fail(void* data, void* result) {
+    uint32_t index = (uint32_t)(uintptr_t)data;
+    atomic_fetch_add(&g_ran, 1);
+    *(uint32_t*)result = index + 1;
+    if (index == TEST_FAILING_TASK) {
+        rift_group_cancel(g_group);
+        RIFT_TEST_CHECK(rift_group_cancelled(g_group));
+    }
+}
+
+/**
+ * @brief Simulated tasks run in spawn order, so exactly the ones after the
+ *        failing task are still pending when it cancels
+ */
+static void test_first_error(void) {
+    atomic_store(&g_ran, 0);
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    g_group = RIFT_GROUP_CREATE(0, &policy, uint32_t, TEST_TASKS);
+    RIFT_TEST_CHECK(g_group != NULL);
+    for (uint32_t i = 0; i < TEST_TASKS; i++) {
+        g_futures[i] = rift_group_spawn(g_group, test_maybe_fail, (void*)(uintptr_t)i);
+        RIFT_TEST_CHECK(g_futures[i] != NULL);
+    }
+
+    RIFT_TEST_CHECK(rift_group_join(g_group) == -1);
+    RIFT_TEST_CHECK(atomic_load(&g_ran) == TEST_FAILING_TASK + 1);
+    for (uint32_t i = 0; i < TEST_TASKS; i++) {
+        uint32_t result = 0;
+        rift_future_state_t state = rift_future_get(g_futures[i], &result);
+        if (i <= TEST_FAILING_TASK) {
+            RIFT_TEST_CHECK(state == RIFT_FUTURE_DONE && result == i + 1);
+        } else {
+            RIFT_TEST_CHECK(state == RIFT_FUTURE_CANCELLED && result == 0);
+        }
+    }
+    RIFT_TEST_CHECK(rift_group_spawn(g_group, test_maybe_fail, NULL) == NULL);
+    rift_group_destroy(g_group);
+}
+
+int main(void) {
+    RIFT_TEST_CHECK(rift_simulated_init() == 0);
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_AUTO);
+    RIFT_TEST_CHECK(RIFT_GROUP_CREATE(0, &policy, uint64_t, TEST_TASKS) == NULL);
+
+    test_join(CONCURRENCY_SIMULATED);
+    test_join(CONCURRENCY_TRUE_THREAD);
+    test_join(CONCURRENCY_TRUE_PROCESS);
+    test_task_waits();
+    test_first_error();
+
+    rift_true_concurrency_cleanup();
+    rift_simulated_cleanup();
+    printf("[TEST] Task groups: join, task waits and first-error cancel passed\n");
+    return 0;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file test_hybrid.c
+ * @brief Hybrid Pool Tests - Spawn Mode and Shutdown With Parked Tasks
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A policy handed straight to the hybrid spawns is treated as a hybrid one
+ * from the start: an EDF policy without a deadline, which the single-thread
+ * scheduler would refuse, spawns tasks that run in hybrid mode. Shutting
+ * the pool down with tasks parked on an empty channel and in a long sleep
+ * cancels both; each returns from its wait and finishes, and no hybrid
+ * task is left registered.
+ */
+
+#include "rift_simulated.h"
+#include "rift_simulated_chan.h"
+#include "rift_simulated_hybrid.h"
+#include "rift_test.h"
+#include <unistd.h>
+
+#define TEST_WORKERS 2
+#define TEST_BATCH 4
+#define TEST_PARK_MS 10000
+#define TEST_SETTLE_US 20000
+#define TEST_TIMEOUT_S 5
+
+static rift_chan_t* g_chan;
+static _Atomic int g_hybrid_runs;
+static _Atomic int g_parking;
+static _Atomic int g_recv_status = -1;
+static _Atomic int g_sleep_status = 1;
+
+static void test_mode(void* data) {
+    (void)data;
+    if (rift_simulated_current()->base_context.policy.mode == CONCURRENCY_HYBRID) {
+        atomic_fetch_add(&g_hybrid_runs, 1);
+    }
+}
+
+static void test_parked_recv(void* data) {
+    (void)data;
+    int value;
+    atomic_fetch_add(&g_parking, 1);
+    atomic_store(&g_recv_status, (int)rift_chan_recv(g_chan, &value));
+}
+
+static void test_parked_sleep(void* data) {
+    (void)data;
+    atomic_fetch_add(&g_parking, 1);
+    atomic_store(&g_sleep_status, rift_simulated_sleep_ms(TEST_PARK_MS));
+}
+
+/**
+ * @brief The mode is set before deadline resolution, which skips hybrid tasks
+ */
+static void test_spawn_mode(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    policy.schedule_class = SCHEDULE_EDF;
+    RIFT_TEST_CHECK(rift_simulated_spawn(0, &policy, test_mode, NULL, "edf_simulated") == 0);
+
+    RIFT_TEST_CHECK(rift_hybrid_spawn(0, &policy, test_mode, NULL, "edf_hybrid"));
+    RIFT_TEST_CHECK(rift_hybrid_spawn_batch(0, &policy, test_mode, NULL, TEST_BATCH,
+                                            "edf_hybrid_batch"));
+    rift_hybrid_wait();
+    RIFT_TEST_CHECK(atomic_load(&g_hybrid_runs) == TEST_BATCH + 1);
+}
+
+static void test_cleanup_parked(void) {
+    g_chan = RIFT_CHAN_CREATE(int, 0);
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_HYBRID);
+    RIFT_TEST_CHECK(rift_hybrid_spawn(0, &policy, test_parked_recv, NULL, "parked_recv"));
+    RIFT_TEST_CHECK(rift_hybrid_spawn(0, &policy, test_parked_sleep, NULL, "parked_sleep"));
+    while (atomic_load(&g_parking) < 2) {
+        usleep(1000);
+    }
+    usleep(TEST_SETTLE_US);
+
+    rift_simulated_context_t* tasks[RIFT_MAX_THREAD_COUNT];
+    RIFT_TEST_CHECK(rift_simulated_list_hybrid_tasks(tasks, RIFT_MAX_THREAD_COUNT) == 2);
+    rift_hybrid_cleanup();
+    RIFT_TEST_CHECK(atomic_load(&g_recv_status) == RIFT_CHAN_CANCELLED);
+    RIFT_TEST_CHECK(atomic_load(&g_sleep_status) == -1);
+    RIFT_TEST_CHECK(rift_simulated_list_hybrid_tasks(tasks, RIFT_MAX_THREAD_COUNT) == 0);
+    rift_chan_destroy(g_chan);
+}
+
+int main(void) {
+    alarm(TEST_TIMEOUT_S);
+    RIFT_TEST_CHECK(rift_simulated_init() == 0);
+    RIFT_TEST_CHECK(rift_hybrid_init(TEST_WORKERS) == 0);
+
+    test_spawn_mode();
+    test_cleanup_parked();
+
+    rift_simulated_cleanup();
+    printf("[TEST] Hybrid: spawn mode and shutdown with parked tasks passed\n");
+    return 0;
+}
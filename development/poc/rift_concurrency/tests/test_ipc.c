@@ -0,0 +1,192 @@
+/**
+ * @file test_ipc.c
+ * @brief IPC Ring Tests - MPSC Ordering and Close Wake
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A batch of processes bound to one small MPSC ring each send a numbered
+ * run of messages of varying length, so records wrap the ring and the
+ * producers wait for space. The parent receives until the ring closes
+ * behind the last producer: every message arrives intact, each producer's
+ * messages in the order it sent them. A consumer parked on an empty ring
+ * and a producer parked on a full one both return RIFT_IPC_CLOSED when
+ * the ring is closed, and the records committed before the close can still
+ * be received.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_ipc.h"
+#include "rift_telemetry.h"
+#include "rift_test.h"
+#include <pthread.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TEST_PRODUCERS 4
+#define TEST_MESSAGES 2000                // Per producer
+#define TEST_RING_BYTES 4096
+#define TEST_MAX_PAYLOAD 200
+#define TEST_WAIT_MS 5000
+#define TEST_TIMEOUT_S 20
+
+typedef struct {
+    uint32_t producer;
+    uint32_t sequence;
+    uint8_t payload[TEST_MAX_PAYLOAD];
+} test_message_t;
+
+static uint32_t g_producer_index[TEST_PRODUCERS];
+static rift_ipc_ring_t* g_ring;
+static _Atomic int g_status = 1;
+
+static uint32_t test_payload_length(uint32_t producer, uint32_t sequence) {
+    return (producer * 31 + sequence * 7) % TEST_MAX_PAYLOAD;
+}
+
+static uint8_t test_payload_byte(uint32_t producer, uint32_t sequence, uint32_t i) {
+    return (uint8_t)(producer + sequence + i);
+}
+
+// Runs in the child
+static void test_producer(void* data) {
+    uint32_t producer = *(const uint32_t*)data;
+    rift_ipc_ring_t* ring = rift_ipc_parent_ring();
+    RIFT_TEST_CHECK(ring != NULL);
+    test_message_t message;
+    for (uint32_t sequence = 0; sequence < TEST_MESSAGES; sequence++) {
+        uint32_t length = test_payload_length(producer, sequence);
+        message.producer = producer;
+        message.sequence = sequence;
+        for (uint32_t i = 0; i < length; i++) {
+            message.payload[i] = test_payload_byte(producer, sequence, i);
+        }
+        uint32_t size = (uint32_t)offsetof(test_message_t, payload) + length;
+        RIFT_TEST_CHECK(rift_ipc_send(ring, &message, size) == RIFT_IPC_OK);
+    }
+}
+
+static void test_mpsc_order(void) {
+    rift_ipc_ring_t* ring = rift_ipc_create(RIFT_IPC_MPSC, TEST_RING_BYTES);
+    RIFT_TEST_CHECK(ring != NULL);
+    void* data[TEST_PRODUCERS];
+    for (uint32_t i = 0; i < TEST_PRODUCERS; i++) {
+        g_producer_index[i] = i;
+        data[i] = &g_producer_index[i];
+    }
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_TRUE_PROCESS);
+    policy.ipc_ring = ring;
+    uint64_t first = rift_true_spawn_batch(0, &policy, test_producer, data, TEST_PRODUCERS,
+                                           "ipc_producer");
+    RIFT_TEST_CHECK(first != 0);
+
+    uint32_t next[TEST_PRODUCERS] = {0};
+    test_message_t message;
+    uint32_t length;
+    int status;
+    while ((status = rift_ipc_recv(ring, &message, sizeof(message), &length)) == RIFT_IPC_OK) {
+        RIFT_TEST_CHECK(message.producer < TEST_PRODUCERS);
+        uint32_t producer = message.producer;
+        RIFT_TEST_CHECK(message.sequence == next[producer]);
+        uint32_t payload = test_payload_length(producer, message.sequence);
+        RIFT_TEST_CHECK(length == (uint32_t)offsetof(test_message_t, payload) + payload);
+        for (uint32_t i = 0; i < payload; i++) {
+            RIFT_TEST_CHECK(message.payload[i] ==
+                            test_payload_byte(producer, message.sequence, i));
+        }
+        next[producer]++;
+    }
+    RIFT_TEST_CHECK(status == RIFT_IPC_CLOSED);
+    for (uint32_t i = 0; i < TEST_PRODUCERS; i++) {
+        RIFT_TEST_CHECK(next[i] == TEST_MESSAGES);
+        uint64_t rift_id = first + i;
+        RIFT_TEST_CHECK(rift_true_wait(rift_id, TEST_WAIT_MS) == 0 || !rift_telemetry_get(rift_id));
+    }
+
+    rift_ipc_stats_t stats;
+    rift_ipc_get_stats(ring, &stats);
+    RIFT_TEST_CHECK(stats.closed && stats.producers == 0);
+    RIFT_TEST_CHECK(stats.bytes_consumed == stats.bytes_reserved);
+    rift_ipc_destroy(ring);
+}
+
+static void* test_blocked_recv(void* arg) {
+    (void)arg;
+    uint64_t value;
+    uint32_t length;
+    atomic_store(&g_status, rift_ipc_recv(g_ring, &value, sizeof(value), &length));
+    return NULL;
+}
+
+static void* test_blocked_send(void* arg) {
+    (void)arg;
+    uint64_t value = 0;
+    atomic_store(&g_status, rift_ipc_send(g_ring, &value, sizeof(value)));
+    return NULL;
+}
+
+static uint64_t test_waits(bool producer) {
+    rift_ipc_stats_t stats;
+    rift_ipc_get_stats(g_ring, &stats);
+    return producer ? stats.producer_waits : stats.consumer_waits;
+}
+
+/**
+ * @brief Park a thread on the ring, then close the ring under it
+ * @return Status the parked call returned
+ */
+static int test_close_wakes(void* (*blocked)(void*), bool producer) {
+    atomic_store(&g_status, 1);
+    uint64_t waits = test_waits(producer);
+    pthread_t thread;
+    RIFT_TEST_CHECK(pthread_create(&thread, NULL, blocked, NULL) == 0);
+    while (test_waits(producer) == waits) {
+        usleep(1000);
+    }
+    usleep(10000);
+    RIFT_TEST_CHECK(atomic_load(&g_status) == 1);
+    rift_ipc_close(g_ring);
+    RIFT_TEST_CHECK(pthread_join(thread, NULL) == 0);
+    return atomic_load(&g_status);
+}
+
+static void test_close(void) {
+    uint64_t value = 0;
+    uint32_t length;
+
+    g_ring = rift_ipc_create(RIFT_IPC_MPSC, TEST_RING_BYTES);
+    RIFT_TEST_CHECK(g_ring != NULL);
+    RIFT_TEST_CHECK(rift_ipc_try_recv(g_ring, &value, sizeof(value), &length) ==
+                    RIFT_IPC_WOULD_BLOCK);
+    RIFT_TEST_CHECK(test_close_wakes(test_blocked_recv, false) == RIFT_IPC_CLOSED);
+    rift_ipc_destroy(g_ring);
+
+    // A full ring: the parked producer gets CLOSED, committed records still drain
+    g_ring = rift_ipc_create(RIFT_IPC_MPSC, TEST_RING_BYTES);
+    RIFT_TEST_CHECK(g_ring != NULL);
+    uint64_t sent = 0;
+    while (rift_ipc_try_send(g_ring, &sent, sizeof(sent)) == RIFT_IPC_OK) {
+        sent++;
+    }
+    RIFT_TEST_CHECK(sent > 0);
+    RIFT_TEST_CHECK(test_close_wakes(test_blocked_send, true) == RIFT_IPC_CLOSED);
+    RIFT_TEST_CHECK(rift_ipc_try_send(g_ring, &value, sizeof(value)) == RIFT_IPC_CLOSED);
+    for (uint64_t i = 0; i < sent; i++) {
+        RIFT_TEST_CHECK(rift_ipc_recv(g_ring, &value, sizeof(value), &length) == RIFT_IPC_OK);
+        RIFT_TEST_CHECK(value == i && length == sizeof(value));
+    }
+    RIFT_TEST_CHECK(rift_ipc_recv(g_ring, &value, sizeof(value), &length) == RIFT_IPC_CLOSED);
+    rift_ipc_destroy(g_ring);
+}
+
+int main(void) {
+    alarm(TEST_TIMEOUT_S);
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+
+    test_mpsc_order();
+    test_close();
+
+    rift_true_concurrency_cleanup();
+    printf("[TEST] IPC ring: MPSC ordering and close wake passed\n");
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file test_lifecycle.c
+ * @brief Lifecycle Word Tests - Waiters Parked on the Futex
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Several threads wait on one task while it is held back: a timed wait
+ * must expire on time with the task still running, and once the task is
+ * let go every untimed waiter must return success. Run for a dedicated
+ * thread, a pooled thread (with a parent waiting on a worker, which helps
+ * instead of parking) and a process whose exit the reaper publishes.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_pool.h"
+#include "rift_test.h"
+#include <unistd.h>
+#include <pthread.h>
+
+#define TEST_WAITERS 4
+#define TEST_TIMEOUT_MS 30
+#define TEST_RELEASE_LIMIT_NS 2000000000ull
+
+static int g_gate[2];
+static uint64_t g_task_id;
+static _Atomic int g_finished_waits;
+
+static uint64_t test_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+// Held back until the test writes to the gate; works across fork()
+static void test_gated(void* data) {
+    (void)data;
+    char byte;
+    RIFT_TEST_CHECK(read(g_gate[0], &byte, 1) == 1);
+}
+
+static void* test_waiter(void* arg) {
+    (void)arg;
+    RIFT_TEST_CHECK(rift_true_wait(g_task_id, 0) == 0);
+    atomic_fetch_add(&g_finished_waits, 1);
+    return NULL;
+}
+
+static void test_pooled_parent(void* data) {
+    (void)data;
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_TRUE_THREAD);
+    uint64_t child = rift_true_spawn_thread(rift_current_id(), &policy, test_gated, NULL,
+                                            "lifecycle_child");
+    RIFT_TEST_CHECK(child != 0);
+    RIFT_TEST_CHECK(rift_true_wait(child, 0) == 0);
+}
+
+/**
+ * @brief Park waiters on a gated task, time one out, then release them all
+ */
+static void test_waiters(rift_concurrency_mode_t mode, bool dedicated, void (*work)(void*)) {
+    RIFT_TEST_CHECK(pipe(g_gate) == 0);
+    atomic_store(&g_finished_waits, 0);
+
+    rift_governance_policy_t policy = rift_test_policy(mode);
+    policy.dedicated_thread = dedicated;
+    g_task_id = mode == CONCURRENCY_TRUE_PROCESS ?
+        rift_true_spawn_process(0, &policy, work, NULL, "lifecycle_gated") :
+        rift_true_spawn_thread(0, &policy, work, NULL, "lifecycle_gated");
+    RIFT_TEST_CHECK(g_task_id != 0);
+
+    pthread_t waiters[TEST_WAITERS];
+    for (int i = 0; i < TEST_WAITERS; i++) {
+        RIFT_TEST_CHECK(pthread_create(&waiters[i], NULL, test_waiter, NULL) == 0);
+    }
+
+    uint64_t start = test_now_ns();
+    RIFT_TEST_CHECK(rift_true_wait(g_task_id, TEST_TIMEOUT_MS) == -1);
+    RIFT_TEST_CHECK(test_now_ns() - start >= TEST_TIMEOUT_MS * 1000000ull);
+    RIFT_TEST_CHECK(atomic_load(&g_finished_waits) == 0);
+
+    RIFT_TEST_CHECK(write(g_gate[1], "x", 1) == 1);
+    uint64_t released = test_now_ns();
+    for (int i = 0; i < TEST_WAITERS; i++) {
+        pthread_join(waiters[i], NULL);
+    }
+    RIFT_TEST_CHECK(atomic_load(&g_finished_waits) == TEST_WAITERS);
+    RIFT_TEST_CHECK(test_now_ns() - released < TEST_RELEASE_LIMIT_NS);
+
+    close(g_gate[0]);
+    close(g_gate[1]);
+}
+
+int main(void) {
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+    RIFT_TEST_CHECK(rift_true_pool_init(2) == 0);
+
+    test_waiters(CONCURRENCY_TRUE_THREAD, true, test_gated);
+    test_waiters(CONCURRENCY_TRUE_THREAD, false, test_gated);
+    test_waiters(CONCURRENCY_TRUE_THREAD, false, test_pooled_parent);
+    test_waiters(CONCURRENCY_TRUE_PROCESS, false, test_gated);
+
+    RIFT_TEST_CHECK(rift_true_wait(UINT64_MAX, 0) == -1);
+    rift_true_concurrency_cleanup();
+    printf("[TEST] Lifecycle: timed, untimed and helping waits passed\n");
+    return 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file test_parallel.c
+ * @brief Parallel Loop Tests - Every Index Exactly Once
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Loops over a range that starts below zero mark every index they are
+ * handed, on the worker pool with a fixed grain and a picked one, and on
+ * the caller alone in simulated mode. The pool has a fixed number of
+ * workers, so the range is split between participants whatever the CPU
+ * count. Every index of the range is marked exactly once, none outside it
+ * is, and each chunk handed to the body is non-empty and no longer than the
+ * grain. A reduction over the same range sums it exactly, and an empty
+ * range runs no body at all.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_parallel.h"
+#include "rift_true_pool.h"
+#include "rift_test.h"
+#include <unistd.h>
+
+#define TEST_BEGIN (-37)
+#define TEST_END 100003
+#define TEST_COUNT (TEST_END - TEST_BEGIN)
+#define TEST_GRAIN 7
+#define TEST_WORKERS 4                    // Fixed, so ranges are split on one CPU too
+#define TEST_TIMEOUT_S 20
+
+typedef struct {
+    int64_t grain;                        // Longest chunk expected, 0 for any
+    _Atomic uint32_t* marks;              // One per index of the range
+    _Atomic uint64_t chunks;
+    _Atomic bool bad_chunk;
+} test_loop_t;
+
+static void test_mark(int64_t begin, int64_t end, void* data) {
+    test_loop_t* loop = data;
+    if (begin >= end || begin < TEST_BEGIN || end > TEST_END ||
+        (loop->grain > 0 && end - begin > loop->grain)) {
+        atomic_store(&loop->bad_chunk, true);
+        return;
+    }
+    for (int64_t i = begin; i < end; i++) {
+        atomic_fetch_add_explicit(&loop->marks[i - TEST_BEGIN], 1, memory_order_relaxed);
+    }
+    atomic_fetch_add(&loop->chunks, 1);
+}
+
+static void test_sum(int64_t begin, int64_t end, void* data, void* accumulator) {
+    (void)data;
+    for (int64_t i = begin; i < end; i++) {
+        *(int64_t*)accumulator += i;
+    }
+}
+
+static void test_join(void* accumulator, const void* partial, void* data) {
+    (void)data;
+    *(int64_t*)accumulator += *(const int64_t*)partial;
+}
+
+static void test_exactly_once(rift_concurrency_mode_t mode, int64_t grain) {
+    static _Atomic uint32_t marks[TEST_COUNT];
+    for (int64_t i = 0; i < TEST_COUNT; i++) {
+        atomic_store(&marks[i], 0);
+    }
+    test_loop_t loop = {.grain = grain, .marks = marks};
+    rift_parallel_stats_t before;
+    rift_parallel_get_stats(&before);
+
+    rift_governance_policy_t policy = rift_test_policy(mode);
+    rift_range_t range = {TEST_BEGIN, TEST_END};
+    RIFT_TEST_CHECK(RIFT_PARALLEL_FOR(0, &policy, range, grain, test_mark, &loop) == 0);
+    RIFT_TEST_CHECK(!atomic_load(&loop.bad_chunk));
+    for (int64_t i = 0; i < TEST_COUNT; i++) {
+        RIFT_TEST_CHECK(atomic_load(&marks[i]) == 1);
+    }
+
+    rift_parallel_stats_t after;
+    rift_parallel_get_stats(&after);
+    RIFT_TEST_CHECK(after.loops - before.loops == 1);
+    RIFT_TEST_CHECK(after.iterations - before.iterations == TEST_COUNT);
+    RIFT_TEST_CHECK(after.chunks - before.chunks == atomic_load(&loop.chunks));
+    RIFT_TEST_CHECK(mode == CONCURRENCY_SIMULATED || after.splits > before.splits);
+}
+
+static void test_reduce(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_TRUE_THREAD);
+    rift_range_t range = {TEST_BEGIN, TEST_END};
+    int64_t identity = 0;
+    int64_t sum = -1;
+    RIFT_TEST_CHECK(RIFT_PARALLEL_REDUCE(0, &policy, range, TEST_GRAIN, test_sum, test_join,
+                                         &identity, sizeof(sum), NULL, &sum) == 0);
+    RIFT_TEST_CHECK(sum == (int64_t)TEST_COUNT * (TEST_BEGIN + TEST_END - 1) / 2);
+}
+
+static void test_empty(void) {
+    test_loop_t loop = {0};
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_TRUE_THREAD);
+    rift_range_t range = {TEST_END, TEST_END};
+    RIFT_TEST_CHECK(RIFT_PARALLEL_FOR(0, &policy, range, 0, test_mark, &loop) == 0);
+    RIFT_TEST_CHECK(atomic_load(&loop.chunks) == 0 && !atomic_load(&loop.bad_chunk));
+}
+
+int main(void) {
+    alarm(TEST_TIMEOUT_S);
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+    RIFT_TEST_CHECK(rift_true_pool_init(TEST_WORKERS) == 0);
+
+    test_exactly_once(CONCURRENCY_TRUE_THREAD, TEST_GRAIN);
+    test_exactly_once(CONCURRENCY_TRUE_THREAD, 0);
+    test_exactly_once(CONCURRENCY_SIMULATED, TEST_GRAIN);
+    test_reduce();
+    test_empty();
+
+    rift_true_concurrency_cleanup();
+    printf("[TEST] Parallel for: every index exactly once passed\n");
+    return 0;
+}
@@ -0,0 +1,197 @@
+/**
+ * @file test_quota.c
+ * @brief Subtree Quota Tests - Rejection at the Limit
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A runaway fan-out below a task with max_subtree_tasks is cut off at
+ * exactly the limit, however deep the spawns come from. A nested quota's
+ * reservation in its ancestor never lets the subtree past the ancestor's
+ * limit. Memory claims and CPU shares are refused once their sums would
+ * exceed the limit, and a batch is charged whole or refused whole. Every
+ * group is gone once its tasks have finished.
+ */
+
+#include "rift_simulated.h"
+#include "rift_simulated_chan.h"
+#include "rift_quota.h"
+#include "rift_test.h"
+
+#define TEST_RUNAWAY_LIMIT 40
+#define TEST_RUNAWAY_DEPTH 7
+#define TEST_RUNAWAY_FANOUT 4
+
+static rift_chan_t* g_gate;
+static _Atomic int g_spawned;
+static _Atomic int g_refused;
+
+static void test_drive(void) {
+    while (rift_simulated_runnable_count() > 0) {
+        rift_simulated_schedule_cycle();
+    }
+}
+
+// Every task stays alive, and charged, until the gate closes
+static void test_hold(void) {
+    int value;
+    rift_chan_recv(g_gate, &value);
+}
+
+static void test_holder(void* data) {
+    (void)data;
+    test_hold();
+}
+
+static void test_release_all(void) {
+    rift_chan_close(g_gate);
+    test_drive();
+    rift_chan_destroy(g_gate);
+    g_gate = RIFT_CHAN_CREATE(int, 0);
+
+    rift_quota_stats_t stats;
+    rift_quota_get_stats(&stats);
+    RIFT_TEST_CHECK(stats.groups == 0);
+}
+
+static void test_runaway(void* data) {
+    uintptr_t depth = (uintptr_t)data;
+    if (depth < TEST_RUNAWAY_DEPTH) {
+        rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+        for (int i = 0; i < TEST_RUNAWAY_FANOUT; i++) {
+            if (rift_simulated_spawn(rift_current_id(), &policy, test_runaway,
+                                     (void*)(depth + 1), "quota_runaway")) {
+                atomic_fetch_add(&g_spawned, 1);
+            } else {
+                atomic_fetch_add(&g_refused, 1);
+            }
+        }
+    }
+    test_hold();
+}
+
+static void test_fanout(void) {
+    rift_quota_stats_t before;
+    rift_quota_get_stats(&before);
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    policy.max_subtree_tasks = TEST_RUNAWAY_LIMIT;
+    uint64_t root = rift_simulated_spawn(0, &policy, test_runaway, (void*)0, "quota_root");
+    RIFT_TEST_CHECK(root != 0);
+    test_drive();
+
+    rift_quota_usage_t usage;
+    RIFT_TEST_CHECK(rift_quota_get_usage(root, &usage) == 0);
+    RIFT_TEST_CHECK(usage.limit[RIFT_QUOTA_TASKS] == TEST_RUNAWAY_LIMIT);
+    RIFT_TEST_CHECK(usage.used[RIFT_QUOTA_TASKS] == TEST_RUNAWAY_LIMIT);
+    RIFT_TEST_CHECK(atomic_load(&g_spawned) == TEST_RUNAWAY_LIMIT);
+    RIFT_TEST_CHECK(atomic_load(&g_refused) > 0);
+
+    rift_quota_stats_t after;
+    rift_quota_get_stats(&after);
+    RIFT_TEST_CHECK(after.groups == before.groups + 1);
+    RIFT_TEST_CHECK(after.refused - before.refused == (uint64_t)atomic_load(&g_refused));
+
+    test_release_all();
+    RIFT_TEST_CHECK(rift_quota_get_usage(root, &usage) == -1);
+}
+
+static _Atomic int g_nested_spawned;
+static uint64_t g_nested_id;
+
+static void test_nested_parent(void* data) {
+    uint32_t children = (uint32_t)(uintptr_t)data;
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    for (uint32_t i = 0; i < children; i++) {
+        if (rift_simulated_spawn(rift_current_id(), &policy, test_holder, NULL, "quota_leaf")) {
+            atomic_fetch_add(&g_nested_spawned, 1);
+        }
+    }
+    test_hold();
+}
+
+static void test_outer_parent(void* data) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    policy.max_subtree_tasks = 100;   // Looser than the outer quota
+    g_nested_id = rift_simulated_spawn(rift_current_id(), &policy, test_nested_parent, data,
+                                       "quota_nested");
+    RIFT_TEST_CHECK(g_nested_id != 0);
+    test_hold();
+}
+
+/**
+ * @brief Outer limit 20: the nested parent and 19 of its 30 children fit
+ */
+static void test_nested(void) {
+    atomic_store(&g_nested_spawned, 0);
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    policy.max_subtree_tasks = 20;
+    uint64_t root = rift_simulated_spawn(0, &policy, test_outer_parent, (void*)30,
+                                         "quota_outer");
+    RIFT_TEST_CHECK(root != 0);
+    test_drive();
+
+    rift_quota_usage_t outer;
+    rift_quota_usage_t inner;
+    RIFT_TEST_CHECK(rift_quota_get_usage(root, &outer) == 0);
+    RIFT_TEST_CHECK(rift_quota_get_usage(g_nested_id, &inner) == 0);
+    RIFT_TEST_CHECK(atomic_load(&g_nested_spawned) == 19);
+    RIFT_TEST_CHECK(outer.used[RIFT_QUOTA_TASKS] == 20);
+    RIFT_TEST_CHECK(inner.used[RIFT_QUOTA_TASKS] == 19);
+    test_release_all();
+}
+
+/**
+ * @brief Declared memory and CPU, charged from outside the quota's owner
+ */
+static void test_claims(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_SIMULATED);
+    policy.max_subtree_memory = 1000;
+    policy.max_subtree_cpu = 500;
+    uint64_t root = rift_simulated_spawn(0, &policy, test_holder, NULL, "quota_claims");
+    RIFT_TEST_CHECK(root != 0);
+    test_drive();
+
+    rift_governance_policy_t child = rift_test_policy(CONCURRENCY_SIMULATED);
+    child.memory_claim = 300;
+    int accepted = 0;
+    for (int i = 0; i < 5; i++) {
+        accepted += rift_simulated_spawn(root, &child, test_holder, NULL, "quota_memory") != 0;
+    }
+    RIFT_TEST_CHECK(accepted == 3);
+
+    child.memory_claim = 0;
+    child.cpu_share = 200;
+    accepted = 0;
+    for (int i = 0; i < 5; i++) {
+        accepted += rift_simulated_spawn(root, &child, test_holder, NULL, "quota_cpu") != 0;
+    }
+    RIFT_TEST_CHECK(accepted == 2);
+
+    // 100 per mille left: four more do not fit together, two do
+    child.cpu_share = 50;
+    void* data[4] = { NULL };
+    RIFT_TEST_CHECK(rift_simulated_spawn_batch(root, &child, test_holder, data, 4,
+                                               "quota_batch") == 0);
+    RIFT_TEST_CHECK(rift_simulated_spawn_batch(root, &child, test_holder, data, 2,
+                                               "quota_batch") != 0);
+
+    rift_quota_usage_t usage;
+    RIFT_TEST_CHECK(rift_quota_get_usage(root, &usage) == 0);
+    RIFT_TEST_CHECK(usage.used[RIFT_QUOTA_TASKS] == 7);
+    RIFT_TEST_CHECK(usage.used[RIFT_QUOTA_MEMORY] == 900);
+    RIFT_TEST_CHECK(usage.used[RIFT_QUOTA_CPU] == 500);
+    test_release_all();
+}
+
+int main(void) {
+    RIFT_TEST_CHECK(rift_simulated_init() == 0);
+    g_gate = RIFT_CHAN_CREATE(int, 0);
+
+    test_fanout();
+    test_nested();
+    test_claims();
+
+    rift_chan_destroy(g_gate);
+    rift_simulated_cleanup();
+    printf("[TEST] Subtree quota: fan-out, nested and declared-claim rejection passed\n");
+    return 0;
+}
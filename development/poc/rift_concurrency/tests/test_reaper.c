@@ -0,0 +1,113 @@
+/**
+ * @file test_reaper.c
+ * @brief Reaper Tests - Exit Status Publication
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Three process children end differently: one returns from its work, one
+ * calls _exit() with a code of its own, one kills itself. The reaper
+ * collects each exit through its pidfd and publishes it without anyone
+ * calling rift_true_wait(): the telemetry entry records the wait status
+ * and the task is finished. Only the child that returned stamped its exit
+ * time, and only the killed one counts as signalled.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_true_reaper.h"
+#include "rift_telemetry.h"
+#include "rift_test.h"
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define TEST_EXIT_CODE 7
+#define TEST_CHILDREN 3
+#define TEST_TIMEOUT_S 10
+
+typedef enum {
+    TEST_ENDING_RETURN,
+    TEST_ENDING_EXIT,
+    TEST_ENDING_KILL
+} test_ending_t;
+
+static test_ending_t g_endings[TEST_CHILDREN] = {TEST_ENDING_RETURN, TEST_ENDING_EXIT,
+                                                 TEST_ENDING_KILL};
+
+// Runs in the child
+static void test_child(void* data) {
+    switch (*(const test_ending_t*)data) {
+    case TEST_ENDING_EXIT:
+        _exit(TEST_EXIT_CODE);
+    case TEST_ENDING_KILL:
+        raise(SIGKILL);
+        break;
+    case TEST_ENDING_RETURN:
+        break;
+    }
+}
+
+/**
+ * @brief Wait for the reaper to publish an exit, without reaping it here;
+ *        entries are read through snapshots, taken under the registry lock
+ * @return Wait status recorded in telemetry
+ */
+static int test_published_status(uint64_t rift_id) {
+    static rift_spawn_telemetry_t entries[RIFT_MAX_THREAD_COUNT];
+    for (;;) {
+        uint32_t count = rift_telemetry_snapshot(entries, RIFT_MAX_THREAD_COUNT);
+        bool found = false;
+        for (uint32_t i = 0; i < count; i++) {
+            if (entries[i].rift_thread_id == rift_id) {
+                found = true;
+                if (entries[i].exited) {
+                    return entries[i].exit_status;
+                }
+            }
+        }
+        RIFT_TEST_CHECK(found);
+        usleep(1000);
+    }
+}
+
+int main(void) {
+    alarm(TEST_TIMEOUT_S);
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+    RIFT_TEST_CHECK(rift_true_reaper_start() == 0);
+    rift_true_reaper_stats_t before;
+    rift_true_reaper_get_stats(&before);
+
+    // One batch, so no later spawn frees a finished child before it is read
+    void* data[TEST_CHILDREN];
+    for (int i = 0; i < TEST_CHILDREN; i++) {
+        data[i] = &g_endings[i];
+    }
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_TRUE_PROCESS);
+    uint64_t returned = rift_true_spawn_batch(0, &policy, test_child, data, TEST_CHILDREN,
+                                              "reaper_child");
+    RIFT_TEST_CHECK(returned != 0);
+    uint64_t exited = returned + 1;
+    uint64_t killed = returned + 2;
+
+    int status = test_published_status(returned);
+    RIFT_TEST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    status = test_published_status(exited);
+    RIFT_TEST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == TEST_EXIT_CODE);
+    status = test_published_status(killed);
+    RIFT_TEST_CHECK(WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL);
+
+    // Published as finished: an immediate wait does not time out
+    RIFT_TEST_CHECK(rift_true_wait(returned, 1) == 0);
+    RIFT_TEST_CHECK(rift_true_wait(exited, 1) == 0);
+    RIFT_TEST_CHECK(rift_true_wait(killed, 1) == 0);
+
+    rift_true_reaper_stats_t after;
+    rift_true_reaper_get_stats(&after);
+    RIFT_TEST_CHECK(after.watched - before.watched == TEST_CHILDREN);
+    RIFT_TEST_CHECK(after.reaped - before.reaped == TEST_CHILDREN);
+    RIFT_TEST_CHECK(after.signaled - before.signaled == 1);
+    RIFT_TEST_CHECK(after.unstamped - before.unstamped == TEST_CHILDREN - 1);
+
+    rift_true_concurrency_cleanup();
+    printf("[TEST] Reaper: exit status publication passed\n");
+    return 0;
+}
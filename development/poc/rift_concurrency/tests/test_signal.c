@@ -0,0 +1,108 @@
+/**
+ * @file test_signal.c
+ * @brief Signal Routing Tests - Batched signalfd Dispatch
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Signals raised while nobody dispatches queue up on the signalfd; one
+ * dispatch then drains them all in a single read and runs each signal's
+ * handler once, with its record count and its data pointer. Only the routed
+ * signals take a handler, a SIGTERM nobody claimed still ends the process,
+ * and cleanup leaves nothing to dispatch.
+ */
+
+#include "rift_signal.h"
+#include "rift_test.h"
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define TEST_CHILDREN 3
+#define TEST_RAISES 4
+
+typedef struct {
+    int signal_number;
+    uint32_t calls;
+    uint32_t records;
+} test_route_t;
+
+static test_route_t g_report = { SIGUSR1, 0, 0 };
+static test_route_t g_child = { SIGCHLD, 0, 0 };
+
+static void test_handler(int signal_number, uint32_t count, void* data) {
+    test_route_t* route = data;
+    RIFT_TEST_CHECK(route->signal_number == signal_number);
+    route->calls++;
+    route->records += count;
+}
+
+/**
+ * @brief Without a handler, SIGTERM keeps its default action
+ */
+static void test_unclaimed_terminate(void) {
+    pid_t pid = fork();
+    RIFT_TEST_CHECK(pid >= 0);
+    if (pid == 0) {
+        if (rift_signal_init() != 0) {
+            _exit(1);
+        }
+        kill(getpid(), SIGTERM);
+        rift_signal_dispatch();
+        _exit(0);
+    }
+    int status;
+    RIFT_TEST_CHECK(waitpid(pid, &status, 0) == pid);
+    RIFT_TEST_CHECK(WIFSIGNALED(status) && WTERMSIG(status) == SIGTERM);
+}
+
+static void test_batch(void) {
+    RIFT_TEST_CHECK(rift_signal_init() == 0);
+    RIFT_TEST_CHECK(rift_signal_active() && rift_signal_fd() >= 0);
+    RIFT_TEST_CHECK(rift_signal_set_handler(SIGUSR1, test_handler, &g_report) == 0);
+    RIFT_TEST_CHECK(rift_signal_set_handler(SIGCHLD, test_handler, &g_child) == 0);
+    RIFT_TEST_CHECK(rift_signal_set_handler(SIGHUP, test_handler, NULL) == -1);
+    RIFT_TEST_CHECK(rift_signal_dispatch() == 0);
+
+    // Everything is pending before the dispatch; a standard signal keeps
+    // one record however often it was raised
+    for (int i = 0; i < TEST_RAISES; i++) {
+        RIFT_TEST_CHECK(kill(getpid(), SIGUSR1) == 0);
+    }
+    for (int i = 0; i < TEST_CHILDREN; i++) {
+        pid_t pid = fork();
+        RIFT_TEST_CHECK(pid >= 0);
+        if (pid == 0) {
+            _exit(0);
+        }
+        RIFT_TEST_CHECK(waitpid(pid, NULL, 0) == pid);
+    }
+
+    rift_signal_stats_t before;
+    rift_signal_get_stats(&before);
+    RIFT_TEST_CHECK(rift_signal_dispatch() == 2);
+    RIFT_TEST_CHECK(g_report.calls == 1 && g_report.records == 1);
+    RIFT_TEST_CHECK(g_child.calls == 1 && g_child.records == 1);
+
+    rift_signal_stats_t after;
+    rift_signal_get_stats(&after);
+    RIFT_TEST_CHECK(after.reads - before.reads == 1);
+    RIFT_TEST_CHECK(after.handled - before.handled == 2);
+    RIFT_TEST_CHECK(after.max_batch >= 2);
+    RIFT_TEST_CHECK(after.received[RIFT_SIGNAL_REPORT] == 1);
+    RIFT_TEST_CHECK(after.received[RIFT_SIGNAL_CHILD] == 1);
+    RIFT_TEST_CHECK(after.received[RIFT_SIGNAL_TERMINATE] == 0);
+
+    // Drained: a second dispatch finds nothing
+    RIFT_TEST_CHECK(rift_signal_dispatch() == 0);
+    RIFT_TEST_CHECK(g_report.calls == 1 && g_child.calls == 1);
+
+    rift_signal_cleanup();
+    RIFT_TEST_CHECK(!rift_signal_active() && rift_signal_fd() == -1);
+    RIFT_TEST_CHECK(rift_signal_dispatch() == 0);
+}
+
+int main(void) {
+    test_unclaimed_terminate();
+    test_batch();
+    printf("[TEST] Signal routing: batched dispatch and default SIGTERM passed\n");
+    return 0;
+}
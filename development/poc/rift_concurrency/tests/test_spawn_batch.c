@@ -0,0 +1,146 @@
+/**
+ * @file test_spawn_batch.c
+ * @brief Spawn Batch Tests - All or Nothing
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A batch of dedicated threads and a batch of forked processes each run
+ * every member's work once, with contiguous IDs. When one member cannot be
+ * created the call fails and none of the members that had already started
+ * runs its work: threads are held back in the batch's gang, processes on
+ * its start pipe. Thread and process creation are wrapped here so one of
+ * them can be made to fail on demand.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_telemetry.h"
+#include "rift_test.h"
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define TEST_MEMBERS 6
+#define TEST_FAILING_MEMBER 3
+#define TEST_WAIT_MS 5000
+
+typedef int (*test_create_t)(pthread_t*, const pthread_attr_t*, void* (*)(void*), void*);
+typedef pid_t (*test_fork_t)(void);
+
+static _Atomic bool g_counting;
+static _Atomic int g_created;
+static _Atomic int g_fail_at = -1;
+static _Atomic int g_ran;
+static int g_report[2];
+
+// Counts the creations the runtime makes and fails the g_fail_at-th one,
+// after giving the members already started time to run if they could
+static bool test_creation_fails(void) {
+    if (!atomic_load(&g_counting)) {
+        return false;
+    }
+    if (atomic_load(&g_created) == atomic_load(&g_fail_at)) {
+        usleep(50000);
+        return true;
+    }
+    atomic_fetch_add(&g_created, 1);
+    return false;
+}
+
+int pthread_create(pthread_t* thread, const pthread_attr_t* attr,
+                   void* (*start)(void*), void* arg) {
+    static test_create_t next;
+    if (!next) {
+        next = (test_create_t)dlsym(RTLD_NEXT, "pthread_create");
+    }
+    return test_creation_fails() ? EAGAIN : next(thread, attr, start, arg);
+}
+
+pid_t fork(void) {
+    static test_fork_t next;
+    if (!next) {
+        next = (test_fork_t)dlsym(RTLD_NEXT, "fork");
+    }
+    if (test_creation_fails()) {
+        errno = EAGAIN;
+        return -1;
+    }
+    return next();
+}
+
+static void test_thread_member(void* data) {
+    (void)data;
+    atomic_fetch_add(&g_ran, 1);
+}
+
+// Runs in the child: report through the pipe the parent drains
+static void test_process_member(void* data) {
+    (void)data;
+    RIFT_TEST_CHECK(write(g_report[1], "x", 1) == 1);
+}
+
+static int test_drain_reports(void) {
+    char reports[TEST_MEMBERS * 2];
+    ssize_t count = read(g_report[0], reports, sizeof(reports));
+    return count < 0 ? 0 : (int)count;
+}
+
+static uint64_t test_spawn(rift_concurrency_mode_t mode, void (*work)(void*), int fail_at) {
+    atomic_store(&g_created, 0);
+    atomic_store(&g_ran, 0);
+    atomic_store(&g_fail_at, fail_at);
+    atomic_store(&g_counting, true);
+    rift_governance_policy_t policy = rift_test_policy(mode);
+    policy.dedicated_thread = true;
+    uint64_t first = rift_true_spawn_batch(0, &policy, work, NULL, TEST_MEMBERS, "batch_member");
+    atomic_store(&g_counting, false);
+    return first;
+}
+
+// A member reaped before the wait, as the failed batch's terminations may
+// do, is finished as well; its telemetry went with it
+static void test_wait_all(uint64_t first, int count) {
+    for (int i = 0; i < count; i++) {
+        uint64_t rift_id = first + (uint64_t)i;
+        RIFT_TEST_CHECK(rift_true_wait(rift_id, TEST_WAIT_MS) == 0 || !rift_telemetry_get(rift_id));
+    }
+}
+
+/**
+ * @brief A full batch, then one whose member TEST_FAILING_MEMBER fails
+ * @return Number of members whose work ran in the failed batch
+ */
+static int test_all_or_nothing(rift_concurrency_mode_t mode, void (*work)(void*),
+                               int (*ran)(void)) {
+    uint64_t first = test_spawn(mode, work, -1);
+    RIFT_TEST_CHECK(first != 0);
+    test_wait_all(first, TEST_MEMBERS);
+    RIFT_TEST_CHECK(ran() == TEST_MEMBERS);
+
+    // IDs are handed out in order: the failed batch follows the full one
+    RIFT_TEST_CHECK(test_spawn(mode, work, TEST_FAILING_MEMBER) == 0);
+    RIFT_TEST_CHECK(atomic_load(&g_created) == TEST_FAILING_MEMBER);
+    test_wait_all(first + TEST_MEMBERS, TEST_FAILING_MEMBER);
+    RIFT_TEST_CHECK(rift_true_wait(first + TEST_MEMBERS + TEST_FAILING_MEMBER, 0) == -1);
+    return ran();
+}
+
+static int test_threads_ran(void) {
+    return atomic_load(&g_ran);
+}
+
+int main(void) {
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+    RIFT_TEST_CHECK(pipe(g_report) == 0);
+    RIFT_TEST_CHECK(fcntl(g_report[0], F_SETFL, O_NONBLOCK) == 0);
+
+    RIFT_TEST_CHECK(test_all_or_nothing(CONCURRENCY_TRUE_THREAD, test_thread_member,
+                                        test_threads_ran) == 0);
+    RIFT_TEST_CHECK(test_all_or_nothing(CONCURRENCY_TRUE_PROCESS, test_process_member,
+                                        test_drain_reports) == 0);
+
+    rift_true_concurrency_cleanup();
+    printf("[TEST] Spawn batch: full batches run, failed batches run nothing\n");
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file test_teardown.c
+ * @brief Subtree Teardown Tests - No Stragglers After killpg
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A process task spawns a process task of its own and forks a plain child
+ * the runtime knows nothing about; both report their PIDs and sleep. The
+ * process task is then torn down, once by rift_true_terminate() and once
+ * by destroying its thread parent under DESTROY_IMMEDIATE. The test is a
+ * child subreaper, so whatever outlives the process task is reparented
+ * here: every descendant must already be dead, and waiting for one that
+ * is still running turns into a failure through the alarm.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_telemetry.h"
+#include "rift_test.h"
+#include <errno.h>
+#include <signal.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define TEST_LEAVES 2
+#define TEST_WAIT_MS 5000
+#define TEST_TIMEOUT_S 20
+
+static int g_report[2];
+static _Atomic bool g_parent_release;
+
+// Runs in a grandchild
+static void test_leaf(void* data) {
+    (void)data;
+    pid_t pid = getpid();
+    RIFT_TEST_CHECK(write(g_report[1], &pid, sizeof(pid)) == (ssize_t)sizeof(pid));
+    for (;;) {
+        pause();
+    }
+}
+
+// Runs in the child: one leaf the runtime tracks, one it does not
+static void test_subtree_root(void* data) {
+    (void)data;
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_TRUE_PROCESS);
+    RIFT_TEST_CHECK(rift_true_spawn_process(0, &policy, test_leaf, NULL, "nested_leaf"));
+    pid_t raw = fork();
+    if (raw == 0) {
+        test_leaf(NULL);
+    }
+    RIFT_TEST_CHECK(raw > 0);
+    for (;;) {
+        pause();
+    }
+}
+
+static void test_parent(void* data) {
+    (void)data;
+    while (!atomic_load(&g_parent_release)) {
+        usleep(1000);
+    }
+}
+
+static uint64_t test_spawn_subtree(uint64_t parent_id, pid_t leaves[TEST_LEAVES]) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_TRUE_PROCESS);
+    uint64_t root = rift_true_spawn_process(parent_id, &policy, test_subtree_root, NULL,
+                                            "subtree_root");
+    RIFT_TEST_CHECK(root != 0);
+    for (int i = 0; i < TEST_LEAVES; i++) {
+        RIFT_TEST_CHECK(read(g_report[0], &leaves[i], sizeof(leaves[i])) ==
+                        (ssize_t)sizeof(leaves[i]));
+    }
+    return root;
+}
+
+/**
+ * @brief The subtree root has finished; its orphaned leaves are ours to
+ *        wait for, unless its own reaper collected them first
+ */
+static void test_no_stragglers(uint64_t root, const pid_t leaves[TEST_LEAVES]) {
+    RIFT_TEST_CHECK(rift_true_wait(root, TEST_WAIT_MS) == 0 || !rift_telemetry_get(root));
+    for (int i = 0; i < TEST_LEAVES; i++) {
+        int status;
+        pid_t result = waitpid(leaves[i], &status, 0);
+        RIFT_TEST_CHECK((result == leaves[i] && WIFSIGNALED(status)) ||
+                        (result < 0 && errno == ECHILD));
+        RIFT_TEST_CHECK(kill(leaves[i], 0) != 0 && errno == ESRCH);
+    }
+}
+
+static void test_terminate(void) {
+    pid_t leaves[TEST_LEAVES];
+    uint64_t root = test_spawn_subtree(0, leaves);
+    RIFT_TEST_CHECK(rift_true_terminate(root) == 0);
+    test_no_stragglers(root, leaves);
+}
+
+static void test_parent_destruction(void) {
+    rift_governance_policy_t policy = rift_test_policy(CONCURRENCY_TRUE_THREAD);
+    policy.destroy_policy = DESTROY_IMMEDIATE;
+    policy.dedicated_thread = true;
+    uint64_t parent = rift_true_spawn_thread(0, &policy, test_parent, NULL, "subtree_parent");
+    RIFT_TEST_CHECK(parent != 0);
+
+    pid_t leaves[TEST_LEAVES];
+    uint64_t root = test_spawn_subtree(parent, leaves);
+    RIFT_TEST_CHECK(rift_true_handle_parent_destruction(parent) == 0);
+    test_no_stragglers(root, leaves);
+
+    atomic_store(&g_parent_release, true);
+    RIFT_TEST_CHECK(rift_true_wait(parent, TEST_WAIT_MS) == 0 || !rift_telemetry_get(parent));
+}
+
+int main(void) {
+    alarm(TEST_TIMEOUT_S);
+    RIFT_TEST_CHECK(prctl(PR_SET_CHILD_SUBREAPER, 1) == 0);
+    RIFT_TEST_CHECK(pipe(g_report) == 0);
+    RIFT_TEST_CHECK(rift_true_concurrency_init() == 0);
+
+    test_terminate();
+    test_parent_destruction();
+
+    rift_true_concurrency_cleanup();
+    printf("[TEST] Teardown: no stragglers after killpg passed\n");
+    return 0;
+}
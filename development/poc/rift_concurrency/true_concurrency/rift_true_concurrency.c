@@ -0,0 +1,1618 @@
+/**
+ * @file rift_true_concurrency.c
+ * @brief RIFT True Concurrency - POSIX Threads and Forked Processes
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * TRUE_THREAD tasks run as units of work on the persistent worker pool
+ * (rift_true_pool.c) unless the policy asks for a dedicated pthread or for
+ * CPU/NUMA placement, which cannot be applied to a shared worker; every
+ * TRUE_PROCESS task is a forked child, either of this process or, with
+ * zygote_spawn, of the zygote helper (rift_true_zygote.c). Children we fork
+ * ourselves are watched by the pidfd reaper (rift_true_reaper.c) and polled
+ * with waitpid() only where pidfd_open is unavailable. Placement
+ * (rift_true_placement.c) is resolved at spawn time and applied by the new
+ * thread or child itself; a policy IPC ring (rift_true_ipc.c) is bound to
+ * each process child at spawn. Contexts live in a table until their
+ * work has finished and they have been joined (dedicated threads) or waited
+ * for (processes); finished contexts are reaped lazily on the next spawn,
+ * terminate or cleanup.
+ *
+ * Thread termination is cooperative through the cancellation token
+ * (rift_cancel.c), which also wakes a thread blocked in rift_true_wait();
+ * processes are signalled. Parent destruction applies the parent's destroy_policy to its
+ * direct children, recursing for DESTROY_CASCADE; a process task whose exit
+ * is reported by the reaper or the zygote gets the same treatment on an
+ * enforcer thread, so a grace period never stalls the reporter. Tasks
+ * overrunning max_execution_time_ms are escalated the same way from the
+ * watchdog (rift_watchdog.c): flagged, then signalled, then killed.
+ *
+ * A batch is all or nothing: its dedicated threads and forked processes
+ * hold back their work until the last member has started, so a member that
+ * cannot be started leaves the others to be cancelled before they run.
+ *
+ * A gang_start batch runs on dedicated threads that place themselves and
+ * park on a shared futex word; once the last has arrived the spawner
+ * releases all of them with one FUTEX_WAKE, so no member gets a head start
+ * while later ones are still being created. The span from the first member
+ * starting work to the last is recorded in telemetry as the gang's skew.
+ *
+ * Thread tasks with a deadline (rift_edf.c) have it resolved at spawn and
+ * its outcome recorded when their work returns; pooled ones are admitted
+ * against the pool's claims and queued by deadline. Processes take none:
+ * their outcome would be recorded in the child's own telemetry.
+ *
+ * Every process child of a top-level spawner leads its own process group,
+ * and everything it forks stays in that group, so one killpg() tears down a
+ * whole process subtree, including tasks living in the child's own table.
+ * Subtree roots therefore do not receive terminal-generated signals. Parent
+ * destruction plans the whole subtree from one snapshot of the table and
+ * cancels every thread in it under a single lock.
+ */
+
+#include "rift_true_concurrency.h"
+#include "rift_telemetry.h"
+#include "rift_watchdog.h"
+#include "rift_edf.h"
+#include "rift_cancel.h"
+#include "rift_quota.h"
+#include "rift_signal.h"
+#include "rift_true_placement.h"
+#include "rift_true_pool.h"
+#include "rift_true_zygote.h"
+#include "rift_true_ipc.h"
+#include "rift_true_reaper.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <limits.h>
+#include <stddef.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+
+// =============================================================================
+// CONTEXT TABLE
+// =============================================================================
+
+typedef struct {
+    rift_true_context_t* contexts[RIFT_MAX_THREAD_COUNT];
+    uint32_t context_count;
+    pthread_mutex_t table_mutex;
+} rift_true_table_t;
+
+static rift_true_table_t g_true_table = {
+    .table_mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+static bool g_true_initialized = false;
+static bool g_true_in_subtree = false;        // Forked child: already inside a process group
+static _Atomic uint32_t g_true_enforcers = 0; // Destroy-policy threads in flight
+static bool g_true_cleaning = false;          // Cleanup started; guarded by table_mutex
+
+static __thread rift_true_context_t* t_true_current = NULL; // Task running on this thread
+
+static bool true_is_process(const rift_true_context_t* context) {
+    return context->base_context.policy.mode == CONCURRENCY_TRUE_PROCESS;
+}
+
+static bool true_uses_pool(rift_concurrency_mode_t mode, const rift_governance_policy_t* policy) {
+    return mode == CONCURRENCY_TRUE_THREAD && !policy->dedicated_thread &&
+           !policy->gang_start && !rift_true_placement_requested(policy);
+}
+
+/**
+ * @brief Find context by RIFT ID; caller holds table_mutex
+ */
+static rift_true_context_t* true_find_locked(uint64_t rift_id) {
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        rift_true_context_t* context = g_true_table.contexts[i];
+        if (context && context->base_context.telemetry.rift_thread_id == rift_id) {
+            return context;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Signal a process task and, when it leads one, its whole group
+ */
+static void true_signal_process(pid_t pid, pid_t process_group, int signal_number) {
+    if (process_group <= 0 || killpg(process_group, signal_number) != 0) {
+        kill(pid, signal_number); // Group not formed yet (zygote child) or shared
+    }
+}
+
+// =============================================================================
+// LIFECYCLE WORD
+// =============================================================================
+
+static uint32_t true_state(uint32_t word) {
+    return word & TRUE_LIFECYCLE_STATE_MASK;
+}
+
+static uint32_t true_lifecycle(const rift_true_context_t* context) {
+    return atomic_load_explicit(&context->lifecycle, memory_order_acquire);
+}
+
+static void true_futex_wake_all(rift_true_context_t* context) {
+    // The context may already be reaped; a private wake never touches the memory
+    syscall(SYS_futex, (uint32_t*)&context->lifecycle, FUTEX_WAKE_PRIVATE, INT_MAX,
+            NULL, NULL, 0);
+}
+
+/**
+ * @brief Move state from one value to another, keeping the flags
+ * @return false if the state was not from
+ */
+static bool true_lifecycle_transition(rift_true_context_t* context, uint32_t from, uint32_t to) {
+    uint32_t word = atomic_load_explicit(&context->lifecycle, memory_order_relaxed);
+    do {
+        if (true_state(word) != from) {
+            return false;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&context->lifecycle, &word,
+                                                    (word & ~TRUE_LIFECYCLE_STATE_MASK) | to,
+                                                    memory_order_acq_rel, memory_order_relaxed));
+    return true;
+}
+
+/**
+ * @brief Apply an update to the word and wake parked waiters, entering the
+ *        kernel only if one announced itself
+ */
+static void true_lifecycle_publish(rift_true_context_t* context, uint32_t clear, uint32_t set) {
+    uint32_t word = atomic_load_explicit(&context->lifecycle, memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&context->lifecycle, &word,
+                                                  (word & ~(clear | TRUE_LIFECYCLE_WAITERS)) | set,
+                                                  memory_order_acq_rel, memory_order_relaxed)) {
+    }
+    if (word & TRUE_LIFECYCLE_WAITERS) {
+        true_futex_wake_all(context);
+    }
+}
+
+/**
+ * @brief Park while the word still equals word
+ * @param deadline Absolute CLOCK_MONOTONIC deadline, NULL to wait forever
+ * @param cancellable Also return when the calling task is cancelled
+ * @return 0 when woken, -1 once the deadline has passed, 1 if cancelled
+ */
+static int true_lifecycle_park(rift_true_context_t* context, uint32_t word,
+                               const struct timespec* deadline, bool cancellable) {
+    if (!(word & TRUE_LIFECYCLE_WAITERS)) {
+        if (!atomic_compare_exchange_strong_explicit(&context->lifecycle, &word,
+                                                     word | TRUE_LIFECYCLE_WAITERS,
+                                                     memory_order_acq_rel, memory_order_acquire)) {
+            return 0; // Changed under us: let the caller look again
+        }
+        word |= TRUE_LIFECYCLE_WAITERS;
+    }
+    if (cancellable) {
+        return rift_cancel_futex_wait(&context->lifecycle, word, deadline);
+    }
+    long result = syscall(SYS_futex, (uint32_t*)&context->lifecycle,
+                          FUTEX_WAIT_BITSET_PRIVATE, word, deadline, NULL,
+                          FUTEX_BITSET_MATCH_ANY);
+    return result != 0 && errno == ETIMEDOUT ? -1 : 0;
+}
+
+/**
+ * @brief Wait for FINISHED; with watched_only, also stop once the reaper
+ *        no longer watches the child
+ * @return 0 when finished, -1 on timeout or once the waiting task is
+ *         cancelled (cancellable waits), 1 if the child is not watched
+ */
+static int true_lifecycle_wait(rift_true_context_t* context, const struct timespec* deadline,
+                               bool watched_only, bool cancellable) {
+    for (;;) {
+        uint32_t word = true_lifecycle(context);
+        if (true_state(word) == TRUE_TASK_FINISHED) {
+            return 0;
+        }
+        if (watched_only && !(word & TRUE_LIFECYCLE_WATCHED)) {
+            return 1;
+        }
+        if (true_lifecycle_park(context, word, deadline, cancellable) != 0) {
+            return true_state(true_lifecycle(context)) == TRUE_TASK_FINISHED ? 0 : -1;
+        }
+    }
+}
+
+// =============================================================================
+// EXECUTION DEADLINE
+// =============================================================================
+
+// Escalation stages of an expired max_execution_time_ms deadline
+enum {
+    TRUE_DEADLINE_FLAG,                   // Cooperative should_terminate
+    TRUE_DEADLINE_SIGNAL,                 // SIGTERM, or SIGKILL for DESTROY_IMMEDIATE
+    TRUE_DEADLINE_KILL,                   // SIGKILL once the grace period is over
+    TRUE_DEADLINE_DONE
+};
+
+/**
+ * @brief Watchdog callback: flag first, then signal and kill process tasks
+ *        per destroy_policy; threads can only be asked to stop
+ */
+static uint32_t true_deadline_expired(rift_watchdog_timer_t* timer) {
+    rift_true_context_t* context = (rift_true_context_t*)((char*)timer -
+                                                           offsetof(rift_true_context_t, deadline));
+    uint64_t rift_id = context->base_context.telemetry.rift_thread_id;
+    uint32_t state = true_state(true_lifecycle(context));
+    if (state == TRUE_TASK_EXITING || state == TRUE_TASK_FINISHED) {
+        return 0;
+    }
+
+    rift_destroy_policy_t policy = context->base_context.policy.destroy_policy;
+    switch (timer->stage) {
+    case TRUE_DEADLINE_FLAG:
+        rift_cancel_context(&context->base_context);
+        printf("[WATCHDOG] RIFT ID %lu exceeded %u ms\n", (unsigned long)rift_id,
+               context->base_context.policy.max_execution_time_ms);
+        if (!true_is_process(context)) {
+            return 0;
+        }
+        timer->stage = TRUE_DEADLINE_SIGNAL;
+        // fall through
+    case TRUE_DEADLINE_SIGNAL:
+        if (state == TRUE_TASK_STARTING) {
+            return 1; // PID not published yet
+        }
+        break;
+    case TRUE_DEADLINE_KILL:
+        break;
+    default:
+        return 0;
+    }
+
+    // A keep-alive task's subtree outlives it; signal the task alone
+    pid_t process_group = policy == DESTROY_KEEP_ALIVE ? 0 : context->process_group;
+    if (timer->stage == TRUE_DEADLINE_KILL || policy == DESTROY_IMMEDIATE) {
+        true_signal_process(context->child_process_id, process_group, SIGKILL);
+        printf("[WATCHDOG] Killed RIFT ID %lu\n", (unsigned long)rift_id);
+        timer->stage = TRUE_DEADLINE_DONE;
+        return 0;
+    }
+    true_signal_process(context->child_process_id, process_group, SIGTERM);
+    timer->stage = TRUE_DEADLINE_KILL;
+    return RIFT_TRUE_GRACE_PERIOD_MS;
+}
+
+/**
+ * @brief Publish process exit once, whoever reports it first
+ */
+static void true_process_finished(rift_true_context_t* context, int status) {
+    // Reporters race (reaper, zygote listener, pollers); one claims the exit
+    if (!true_lifecycle_transition(context, TRUE_TASK_RUNNING, TRUE_TASK_EXITING) &&
+        !true_lifecycle_transition(context, TRUE_TASK_STARTING, TRUE_TASK_EXITING)) {
+        return;
+    }
+    rift_watchdog_disarm(&context->deadline);
+    rift_telemetry_record_exit(context->base_context.telemetry.rift_thread_id, status);
+
+    // A child returning from its work released its IPC binding itself
+    if (context->ipc_bound) {
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            rift_ipc_producer_exited(context->ipc_ring);
+        }
+        context->ipc_bound = false;
+    }
+    true_lifecycle_publish(context, TRUE_LIFECYCLE_STATE_MASK, TRUE_TASK_FINISHED);
+}
+
+/**
+ * @brief Whether nobody but a poller will see this process exit: running,
+ *        not watched by the reaper, and not a zygote's child
+ */
+static bool true_needs_poll(rift_true_context_t* context) {
+    if (!true_is_process(context) || context->zygote_child) {
+        return false; // A zygote child's exit is reported by the zygote
+    }
+    uint32_t word = true_lifecycle(context);
+    return true_state(word) == TRUE_TASK_RUNNING && !(word & TRUE_LIFECYCLE_WATCHED);
+}
+
+/**
+ * @brief Collect finished process exit status without blocking
+ */
+static void true_poll_process(rift_true_context_t* context) {
+    if (true_needs_poll(context)) {
+        int status = 0;
+        pid_t result = waitpid(context->child_process_id, &status, WNOHANG);
+        if (result == context->child_process_id || (result < 0 && errno == ECHILD)) {
+            true_process_finished(context, status);
+        }
+    }
+}
+
+static bool true_is_finished(rift_true_context_t* context) {
+    true_poll_process(context);
+    return true_state(true_lifecycle(context)) == TRUE_TASK_FINISHED;
+}
+
+/**
+ * @brief Free context memory, quota charge and IPC binding (no telemetry entry)
+ */
+static void true_context_free(rift_true_context_t* context) {
+    rift_cancel_detach(&context->base_context);
+    rift_quota_release(&context->base_context);
+    rift_watchdog_disarm(&context->deadline);
+    if (context->pooled) {
+        rift_true_pool_release(context); // Work never ran
+    }
+    if (context->ipc_ring) {
+        if (context->ipc_bound) {
+            rift_ipc_producer_exited(context->ipc_ring); // Child never started
+        }
+        rift_ipc_destroy(context->ipc_ring);
+    }
+    free(context);
+}
+
+/**
+ * @brief Release joined context and its telemetry entry
+ */
+static void true_context_destroy(rift_true_context_t* context) {
+    rift_telemetry_unregister(context->base_context.telemetry.rift_thread_id);
+    true_context_free(context);
+}
+
+/**
+ * @brief Join and free every finished context nobody is waiting on. Unwatched
+ *        processes are polled (waitpid, exit telemetry) outside the table
+ *        lock, held as waiters meanwhile so they are not freed under us.
+ */
+static void true_reap_finished(void) {
+    rift_true_context_t* polled[RIFT_MAX_THREAD_COUNT];
+    rift_true_context_t* reaped[RIFT_MAX_THREAD_COUNT];
+    uint32_t polled_count = 0;
+    uint32_t reaped_count = 0;
+
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        rift_true_context_t* context = g_true_table.contexts[i];
+        if (context && true_needs_poll(context)) {
+            context->waiters++;
+            polled[polled_count++] = context;
+        }
+    }
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+
+    for (uint32_t i = 0; i < polled_count; i++) {
+        true_poll_process(polled[i]);
+    }
+
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    for (uint32_t i = 0; i < polled_count; i++) {
+        polled[i]->waiters--;
+    }
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        rift_true_context_t* context = g_true_table.contexts[i];
+        if (context && context->waiters == 0 &&
+            true_state(true_lifecycle(context)) == TRUE_TASK_FINISHED) {
+            g_true_table.contexts[i] = NULL;
+            g_true_table.context_count--;
+            reaped[reaped_count++] = context;
+        }
+    }
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+
+    for (uint32_t i = 0; i < reaped_count; i++) {
+        if (!true_is_process(reaped[i]) && !reaped[i]->pooled) {
+            pthread_join(reaped[i]->pthread_handle, NULL);
+        }
+        true_context_destroy(reaped[i]);
+    }
+}
+
+/**
+ * @brief Insert contexts into the table under one lock
+ * @return 0 on success, -1 if the table cannot hold all of them
+ */
+static int true_table_insert(rift_true_context_t** contexts, uint32_t count) {
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    if (g_true_table.context_count + count > RIFT_MAX_THREAD_COUNT) {
+        pthread_mutex_unlock(&g_true_table.table_mutex);
+        fprintf(stderr, "[TRUE] Context table full\n");
+        return -1;
+    }
+
+    uint32_t inserted = 0;
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT && inserted < count; i++) {
+        if (!g_true_table.contexts[i]) {
+            g_true_table.contexts[i] = contexts[inserted++];
+        }
+    }
+    g_true_table.context_count += count;
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+    return 0;
+}
+
+static void true_table_remove(rift_true_context_t* context) {
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        if (g_true_table.contexts[i] == context) {
+            g_true_table.contexts[i] = NULL;
+            g_true_table.context_count--;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+}
+
+// =============================================================================
+// CONTEXT CREATION
+// =============================================================================
+
+/**
+ * @brief Depth of a child of parent_id, -1 when rejected by policy
+ */
+static int true_child_depth(uint64_t parent_id, const rift_governance_policy_t* policy) {
+    uint32_t depth = rift_telemetry_child_depth(parent_id);
+
+    if (policy->trace_capped && depth > policy->max_hierarchy_depth) {
+        printf("[TRUE] Spawn rejected: depth %u exceeds policy limit %u\n",
+               depth, policy->max_hierarchy_depth);
+        return -1;
+    }
+    return (int)depth;
+}
+
+static rift_true_context_t* true_context_alloc(uint64_t parent_id, uint32_t depth,
+                                               const rift_governance_policy_t* policy,
+                                               rift_concurrency_mode_t mode,
+                                               void (*work_func)(void*), void* work_data) {
+    rift_true_context_t* context = calloc(1, sizeof(rift_true_context_t));
+    if (!context) {
+        return NULL;
+    }
+
+    if (rift_true_placement_resolve(parent_id, policy, &context->placement) != 0) {
+        free(context);
+        return NULL;
+    }
+
+    if (mode == CONCURRENCY_TRUE_PROCESS && policy->ipc_ring) {
+        if (rift_ipc_bind(policy->ipc_ring, parent_id) != 0) {
+            free(context);
+            return NULL;
+        }
+        context->ipc_ring = policy->ipc_ring;
+        context->ipc_bound = true;
+    }
+
+    atomic_init(&context->lifecycle, TRUE_TASK_STARTING);
+    context->start_gate[0] = -1;
+    context->start_gate[1] = -1;
+    context->work_function = work_func;
+    context->work_data = work_data;
+
+    context->base_context.policy = *policy;
+    context->base_context.policy.mode = mode;
+    context->pooled = true_uses_pool(mode, policy);
+    context->base_context.telemetry.parent_rift_id = parent_id;
+    context->base_context.telemetry.parent_process_id = getpid();
+    context->base_context.telemetry.hierarchy_depth = depth;
+    context->base_context.telemetry.is_daemon = policy->daemon_mode;
+    context->base_context.module_specific_data = context;
+    return context;
+}
+
+/**
+ * @brief Give new thread contexts their deadline and admit pooled ones
+ *        against the pool's EDF claims
+ * @return 0 on success, -1 if rejected; freeing the contexts drops claims
+ */
+static int true_admit_deadlines(uint64_t parent_id, const rift_governance_policy_t* policy,
+                                rift_true_context_t** contexts, uint32_t count) {
+    if (true_is_process(contexts[0])) {
+        return 0;
+    }
+
+    uint64_t deadline_ns;
+    if (rift_edf_resolve(parent_id, policy, &deadline_ns) != 0) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        contexts[i]->base_context.telemetry.deadline_ns = deadline_ns;
+    }
+
+    // Dedicated threads are ordered by the kernel; only outcomes are recorded
+    if (deadline_ns == 0 || !contexts[0]->pooled) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (rift_true_pool_admit(contexts[i]) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void true_context_registered(rift_true_context_t* context) {
+    context->base_context.policy.rift_id = context->base_context.telemetry.rift_thread_id;
+    context->base_context.last_heartbeat = context->base_context.telemetry.spawn_time;
+    rift_cancel_attach(&context->base_context, NULL);
+    if (context->ipc_ring) {
+        rift_ipc_bind_producer(context->ipc_ring, context->base_context.policy.rift_id);
+    }
+    // Started before the task is, so time queued on the pool counts
+    if (context->base_context.policy.max_execution_time_ms > 0) {
+        rift_watchdog_arm(&context->deadline, context->base_context.policy.max_execution_time_ms,
+                          true_deadline_expired);
+    }
+}
+
+// =============================================================================
+// EXECUTION
+// =============================================================================
+
+/**
+ * @brief Run task body on the calling thread (dedicated or pool worker)
+ */
+void rift_true_execute(rift_true_context_t* context) {
+    true_lifecycle_transition(context, TRUE_TASK_STARTING, TRUE_TASK_RUNNING);
+
+    // Nested when a waiting worker helps run queued work
+    rift_true_context_t* outer = t_true_current;
+    t_true_current = context;
+    rift_thread_context_t* outer_context = rift_current_swap(&context->base_context);
+    if (!rift_cancel_requested(&context->base_context.cancel)) {
+        context->work_function(context->work_data);
+    }
+    rift_current_swap(outer_context);
+    t_true_current = outer;
+
+    rift_watchdog_disarm(&context->deadline);
+    uint64_t deadline_ns = context->base_context.telemetry.deadline_ns;
+    if (deadline_ns != 0) {
+        rift_telemetry_record_deadline(context->base_context.telemetry.rift_thread_id,
+                                       deadline_ns);
+        if (context->pooled) {
+            rift_true_pool_release(context);
+        }
+    }
+    true_lifecycle_publish(context, TRUE_LIFECYCLE_STATE_MASK, TRUE_TASK_FINISHED);
+}
+
+/**
+ * @brief Apply placement on the new thread and record where it landed
+ */
+static void true_place_thread(rift_true_context_t* context) {
+    if (!context->placement.active || rift_true_placement_apply(&context->placement) != 0) {
+        return;
+    }
+
+    int32_t node = rift_true_placement_current_node();
+    rift_telemetry_record_placement(context->base_context.telemetry.rift_thread_id, node,
+                                    node == context->placement.parent_node);
+}
+
+// =============================================================================
+// GANG START
+// =============================================================================
+
+enum {
+    TRUE_GANG_HELD,                       // Members park until the broadcast
+    TRUE_GANG_RELEASED,                   // Every member arrived: run
+    TRUE_GANG_ABORTED                     // Batch failed: members are cancelled
+};
+
+// Shared by the members of a dedicated-thread batch and its spawner
+struct rift_true_gang {
+    _Atomic uint32_t arrived;             // Members placed and parked (futex word)
+    _Atomic uint32_t release;             // TRUE_GANG_* (futex word)
+    _Atomic uint32_t started;             // Members past the release
+    _Atomic uint32_t references;          // Unfinished members plus the spawner
+    _Atomic uint64_t first_start_ns;
+    _Atomic uint64_t last_start_ns;
+    uint32_t count;
+    uint64_t first_id;
+    bool measured;                        // gang_start: wait for arrivals, record skew
+};
+
+static uint64_t true_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static void true_gang_put(rift_true_gang_t* gang, uint32_t references) {
+    if (atomic_fetch_sub(&gang->references, references) == references) {
+        free(gang);
+    }
+}
+
+/**
+ * @brief Member side: report arrival, park until the release, stamp start
+ */
+static void true_gang_join(rift_true_gang_t* gang) {
+    if (atomic_fetch_add(&gang->arrived, 1) + 1 == gang->count && gang->measured) {
+        syscall(SYS_futex, (uint32_t*)&gang->arrived, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+
+    uint32_t release;
+    while ((release = atomic_load_explicit(&gang->release, memory_order_acquire)) ==
+           TRUE_GANG_HELD) {
+        syscall(SYS_futex, (uint32_t*)&gang->release, FUTEX_WAIT_PRIVATE, TRUE_GANG_HELD,
+                NULL, NULL, 0);
+    }
+
+    if (release == TRUE_GANG_RELEASED && gang->measured) {
+        uint64_t now = true_now_ns();
+        uint64_t first = atomic_load(&gang->first_start_ns);
+        while (now < first && !atomic_compare_exchange_weak(&gang->first_start_ns, &first, now)) {
+        }
+        uint64_t last = atomic_load(&gang->last_start_ns);
+        while (now > last && !atomic_compare_exchange_weak(&gang->last_start_ns, &last, now)) {
+        }
+        // Every other member stamped before counting itself in
+        if (atomic_fetch_add(&gang->started, 1) + 1 == gang->count) {
+            rift_telemetry_record_gang(gang->first_id, gang->count,
+                                       atomic_load(&gang->last_start_ns) -
+                                       atomic_load(&gang->first_start_ns));
+        }
+    }
+    true_gang_put(gang, 1);
+}
+
+static rift_true_gang_t* true_gang_create(rift_true_context_t** contexts, uint32_t count,
+                                          bool measured) {
+    rift_true_gang_t* gang = calloc(1, sizeof(rift_true_gang_t));
+    if (!gang) {
+        return NULL;
+    }
+    atomic_init(&gang->references, count + 1);
+    atomic_init(&gang->first_start_ns, UINT64_MAX);
+    gang->count = count;
+    gang->first_id = contexts[0]->base_context.telemetry.rift_thread_id;
+    gang->measured = measured;
+    for (uint32_t i = 0; i < count; i++) {
+        contexts[i]->gang = gang;
+    }
+    return gang;
+}
+
+/**
+ * @brief Spawner side: wait for every member of a measured gang to park,
+ *        then wake them all with one broadcast; an unmeasured or aborted
+ *        gang is woken as soon as possible
+ * @param started Members whose thread was created
+ */
+static void true_gang_release(rift_true_gang_t* gang, uint32_t started, bool aborted) {
+    if (!aborted && gang->measured) {
+        uint32_t arrived;
+        while ((arrived = atomic_load(&gang->arrived)) < gang->count) {
+            syscall(SYS_futex, (uint32_t*)&gang->arrived, FUTEX_WAIT_PRIVATE, arrived,
+                    NULL, NULL, 0);
+        }
+    }
+    atomic_store_explicit(&gang->release, aborted ? TRUE_GANG_ABORTED : TRUE_GANG_RELEASED,
+                          memory_order_release);
+    syscall(SYS_futex, (uint32_t*)&gang->release, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+    true_gang_put(gang, 1 + gang->count - started); // Unstarted members never join
+}
+
+static void* true_thread_entry(void* arg) {
+    rift_true_context_t* context = arg;
+    rift_signal_block_thread();
+    true_place_thread(context);
+    if (context->gang) {
+        true_gang_join(context->gang);
+    }
+    rift_true_execute(context);
+    return NULL;
+}
+
+/**
+ * @brief Forked batch member: hold back until the spawner has started the
+ *        whole batch; end of file means a later member failed
+ */
+static bool true_start_gate_pass(rift_true_context_t* context) {
+    if (context->start_gate[0] < 0) {
+        return true;
+    }
+    close(context->start_gate[1]);
+    char go;
+    ssize_t result;
+    do {
+        result = read(context->start_gate[0], &go, 1);
+    } while (result < 0 && errno == EINTR);
+    close(context->start_gate[0]);
+    return result == 1;
+}
+
+/**
+ * @brief Spawner side: let released members through, one byte each, and
+ *        drop the pipe
+ */
+static void true_start_gate_close(int start_gate[2], uint32_t released) {
+    if (start_gate[0] < 0) {
+        return;
+    }
+    char go[64] = {0};
+    while (released > 0) {
+        ssize_t written = write(start_gate[1], go,
+                                released < sizeof(go) ? released : sizeof(go));
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            break; // Not expected: the spawner itself holds the read end
+        }
+        released -= (uint32_t)written;
+    }
+    close(start_gate[0]);
+    close(start_gate[1]);
+}
+
+/**
+ * @brief Start registered context on the pool, a dedicated thread or a
+ *        forked child
+ * @return 0 on success, -1 if the thread or process could not be created
+ */
+static int true_start(rift_true_context_t* context) {
+    if (context->pooled) {
+        rift_true_pool_submit(context);
+        return 0;
+    }
+
+    if (!true_is_process(context)) {
+        int result = pthread_create(&context->pthread_handle, NULL, true_thread_entry, context);
+        if (result != 0) {
+            fprintf(stderr, "[TRUE] pthread_create failed: %s\n", strerror(result));
+            return -1;
+        }
+        return 0;
+    }
+
+    pid_t pid;
+    pid_t process_group = 0;
+    if (context->base_context.policy.zygote_spawn) {
+        // A lazily started zygote inherits the current image; start it early
+        if (rift_true_zygote_start() != 0) {
+            return -1;
+        }
+        context->zygote_child = true;
+        pid = rift_true_zygote_spawn(&context->base_context,
+                                     context->work_function, context->work_data,
+                                     &context->placement,
+                                     context->ipc_ring ? rift_ipc_fd(context->ipc_ring) : -1);
+        if (pid < 0) {
+            return -1;
+        }
+        if (!g_true_in_subtree) {
+            process_group = pid; // The zygote child forms its group itself
+        }
+    } else {
+        int slot = rift_true_reaper_reserve();
+        if (slot >= 0) {
+            atomic_fetch_or(&context->lifecycle, TRUE_LIFECYCLE_WATCHED);
+        }
+
+        fflush(stdout);
+        pid = fork();
+        if (pid < 0) {
+            fprintf(stderr, "[TRUE] fork failed: %s\n", strerror(errno));
+            rift_true_reaper_release(slot);
+            return -1;
+        }
+
+        if (pid == 0) {
+            rift_true_enter_subtree(&context->base_context);
+            rift_true_reaper_enter_child(slot);
+            if (context->ipc_ring) {
+                rift_ipc_enter_child(context->ipc_ring);
+            }
+            if (rift_true_placement_apply(&context->placement) != 0) {
+                _exit(1);
+            }
+            if (!true_start_gate_pass(context)) {
+                _exit(1);
+            }
+            rift_current_swap(&context->base_context);
+            context->work_function(context->work_data);
+            rift_ipc_leave_child();
+            fflush(stdout);
+            rift_true_reaper_child_exit();
+            _exit(0);
+        }
+
+        if (!g_true_in_subtree && setpgid(pid, pid) == 0) {
+            process_group = pid; // Child does the same; whoever runs first wins
+        }
+        if (slot >= 0 &&
+            rift_true_reaper_watch(slot, context->base_context.telemetry.rift_thread_id, pid) != 0) {
+            // Waiters parked for the reaper fall back to polling
+            true_lifecycle_publish(context, TRUE_LIFECYCLE_WATCHED, 0);
+        }
+    }
+
+    context->child_process_id = pid;
+    context->process_group = process_group;
+    context->base_context.telemetry.process_id = pid;
+    // Releases the fields above; a child may already have exited
+    true_lifecycle_transition(context, TRUE_TASK_STARTING, TRUE_TASK_RUNNING);
+
+    // The child's telemetry is not shared; record the node it was bound to
+    if (context->placement.active && context->placement.node >= 0) {
+        rift_telemetry_record_placement(context->base_context.telemetry.rift_thread_id,
+                                        context->placement.node,
+                                        context->placement.node == context->placement.parent_node);
+    }
+    return 0;
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+/**
+ * @brief Child side of a spawn: drop every module's state that belongs to
+ *        the spawner - its tasks, threads and locks another thread may have
+ *        held across fork() - keeping only the forked task, and lead a
+ *        process group for the new subtree
+ */
+void rift_true_enter_subtree(rift_thread_context_t* context) {
+    // Another thread may have held the lock across fork()
+    pthread_mutex_init(&g_true_table.table_mutex, NULL);
+    rift_watchdog_forget_parent();
+    rift_cancel_forget_parent();
+    rift_signal_forget_parent(); // Destroy policies signal us; take SIGTERM again
+    rift_true_pool_forget_parent();
+    rift_true_zygote_forget_parent();
+
+    // The token's links point into the spawner's tree, and its quota groups
+    // are copies
+    context->cancel = (rift_cancel_token_t){ .state = atomic_load(&context->cancel.state) };
+    rift_quota_rebase(context);
+    rift_telemetry_forget_parent(&context->telemetry);
+
+    memset(g_true_table.contexts, 0, sizeof(g_true_table.contexts));
+    g_true_table.context_count = 0;
+    atomic_store(&g_true_enforcers, 0);
+    g_true_cleaning = false;
+
+    if (!g_true_in_subtree) {
+        setpgid(0, 0);
+        g_true_in_subtree = true;
+    }
+}
+
+/**
+ * @brief Initialize true concurrency subsystem
+ */
+int rift_true_concurrency_init(void) {
+    if (g_true_initialized) {
+        return 0;
+    }
+
+    if (rift_telemetry_init() != 0) {
+        fprintf(stderr, "[TRUE] Telemetry initialization failed\n");
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    memset(g_true_table.contexts, 0, sizeof(g_true_table.contexts));
+    g_true_table.context_count = 0;
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+
+    // Routed signals need a consumer even before the first fork
+    if (rift_signal_active()) {
+        rift_true_reaper_start();
+    }
+
+    g_true_initialized = true;
+    printf("[TRUE] True concurrency subsystem initialized\n");
+    return 0;
+}
+
+static uint64_t true_spawn(uint64_t parent_id, const rift_governance_policy_t* policy,
+                           rift_concurrency_mode_t mode, void (*work_func)(void*),
+                           void* work_data, const char* spawn_location) {
+    if (!g_true_initialized || !policy || !work_func || !spawn_location) {
+        return 0;
+    }
+    if (policy->mode == CONCURRENCY_AUTO) {
+        fprintf(stderr, "[TRUE] CONCURRENCY_AUTO spawns go through rift_auto_spawn()\n");
+        return 0;
+    }
+
+    true_reap_finished();
+
+    if (!rift_telemetry_validate_spawn(parent_id, policy)) {
+        return 0;
+    }
+
+    int depth = true_child_depth(parent_id, policy);
+    if (depth < 0) {
+        return 0;
+    }
+
+    // A bounded pool holds the spawn here, before its context exists
+    int throttle = 0;
+    if (true_uses_pool(mode, policy)) {
+        if (rift_true_pool_init(0) != 0) {
+            return 0;
+        }
+        throttle = rift_true_pool_throttle(policy, 1);
+        if (throttle < 0) {
+            return 0;
+        }
+    }
+
+    rift_true_context_t* context = true_context_alloc(parent_id, (uint32_t)depth, policy, mode,
+                                                      work_func, work_data);
+    if (!context) {
+        return 0;
+    }
+
+    if (true_admit_deadlines(parent_id, policy, &context, 1) != 0 ||
+        rift_quota_charge(&context->base_context) != 0) {
+        true_context_free(context);
+        return 0;
+    }
+
+    if (rift_telemetry_register_spawn(&context->base_context, spawn_location) != 0) {
+        true_context_destroy(context);
+        return 0;
+    }
+    true_context_registered(context);
+
+    uint64_t rift_id = context->base_context.telemetry.rift_thread_id;
+    if (parent_id != 0) {
+        rift_telemetry_add_child(parent_id, rift_id, spawn_location);
+    }
+
+    if (true_table_insert(&context, 1) != 0) {
+        true_context_destroy(context);
+        return 0;
+    }
+
+    if (throttle > 0) {
+        rift_true_execute(context); // Caller runs; reaped like any finished task
+        return rift_id;
+    }
+
+    if (true_start(context) != 0) {
+        true_table_remove(context);
+        true_context_destroy(context);
+        return 0;
+    }
+
+    return rift_id;
+}
+
+/**
+ * @brief Spawn new thread with true concurrency
+ */
+uint64_t rift_true_spawn_thread(uint64_t parent_id,
+                                const rift_governance_policy_t* policy,
+                                void (*work_func)(void*),
+                                void* work_data,
+                                const char* spawn_location) {
+    return true_spawn(parent_id, policy, CONCURRENCY_TRUE_THREAD, work_func, work_data,
+                      spawn_location);
+}
+
+/**
+ * @brief Spawn new process with true concurrency
+ */
+uint64_t rift_true_spawn_process(uint64_t parent_id,
+                                 const rift_governance_policy_t* policy,
+                                 void (*work_func)(void*),
+                                 void* work_data,
+                                 const char* spawn_location) {
+    return true_spawn(parent_id, policy, CONCURRENCY_TRUE_PROCESS, work_func, work_data,
+                      spawn_location);
+}
+
+/**
+ * @brief Spawn count threads (or processes, per policy mode) with one
+ *        admission check, one ID reservation and one telemetry pass
+ */
+uint64_t rift_true_spawn_batch(uint64_t parent_id,
+                               const rift_governance_policy_t* policy,
+                               void (*work_func)(void*),
+                               void** data_array,
+                               uint32_t count,
+                               const char* spawn_location) {
+    if (!g_true_initialized || !policy || !work_func || !spawn_location ||
+        count == 0 || count > RIFT_MAX_THREAD_COUNT) {
+        return 0;
+    }
+    if (policy->mode == CONCURRENCY_AUTO) {
+        fprintf(stderr, "[TRUE] CONCURRENCY_AUTO spawns go through rift_auto_spawn()\n");
+        return 0;
+    }
+
+    true_reap_finished();
+
+    if (!rift_telemetry_validate_spawn_batch(parent_id, policy, count)) {
+        return 0;
+    }
+
+    int depth = true_child_depth(parent_id, policy);
+    if (depth < 0) {
+        return 0;
+    }
+
+    rift_concurrency_mode_t mode = policy->mode == CONCURRENCY_TRUE_PROCESS ?
+                                   CONCURRENCY_TRUE_PROCESS : CONCURRENCY_TRUE_THREAD;
+    if (policy->gang_start && mode == CONCURRENCY_TRUE_PROCESS) {
+        fprintf(stderr, "[TRUE] gang_start applies to thread batches only\n");
+        return 0;
+    }
+    bool pooled = true_uses_pool(mode, policy);
+    int throttle = 0;
+    if (pooled) {
+        if (rift_true_pool_init(0) != 0) {
+            return 0;
+        }
+        throttle = rift_true_pool_throttle(policy, count);
+        if (throttle < 0) {
+            return 0;
+        }
+    }
+
+    rift_true_context_t* contexts[RIFT_MAX_THREAD_COUNT];
+    rift_thread_context_t* base_contexts[RIFT_MAX_THREAD_COUNT];
+    for (uint32_t i = 0; i < count; i++) {
+        contexts[i] = true_context_alloc(parent_id, (uint32_t)depth, policy, mode, work_func,
+                                         data_array ? data_array[i] : NULL);
+        if (!contexts[i]) {
+            for (uint32_t j = 0; j < i; j++) {
+                true_context_free(contexts[j]);
+            }
+            return 0;
+        }
+        base_contexts[i] = &contexts[i]->base_context;
+    }
+
+    if (true_admit_deadlines(parent_id, policy, contexts, count) != 0 ||
+        rift_quota_charge_batch(base_contexts, count) != 0 ||
+        rift_telemetry_register_spawn_batch(base_contexts, count, spawn_location) != 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            true_context_free(contexts[i]);
+        }
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        true_context_registered(contexts[i]);
+    }
+
+    uint64_t first_id = contexts[0]->base_context.telemetry.rift_thread_id;
+    if (parent_id != 0) {
+        rift_telemetry_add_children(parent_id, first_id, count, spawn_location);
+    }
+
+    if (true_table_insert(contexts, count) != 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            true_context_destroy(contexts[i]);
+        }
+        return 0;
+    }
+
+    if (throttle > 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            rift_true_execute(contexts[i]);
+        }
+        return first_id;
+    }
+    if (pooled) {
+        rift_true_pool_submit_batch(contexts, count);
+        return first_id;
+    }
+
+    // Members hold back their work until the whole batch has started:
+    // threads in an (unmeasured unless gang_start) gang, forked processes on
+    // a pipe the spawner fills once all are forked
+    rift_true_gang_t* gang = NULL;
+    int start_gate[2] = { -1, -1 };
+    bool gated = true;
+    if (mode == CONCURRENCY_TRUE_THREAD && (policy->gang_start || count > 1)) {
+        gated = (gang = true_gang_create(contexts, count, policy->gang_start)) != NULL;
+    } else if (mode == CONCURRENCY_TRUE_PROCESS && count > 1 && !policy->zygote_spawn) {
+        gated = pipe(start_gate) == 0;
+        for (uint32_t i = 0; gated && i < count; i++) {
+            contexts[i]->start_gate[0] = start_gate[0];
+            contexts[i]->start_gate[1] = start_gate[1];
+        }
+    }
+    if (!gated) {
+        for (uint32_t i = 0; i < count; i++) {
+            true_table_remove(contexts[i]);
+            true_context_destroy(contexts[i]);
+        }
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (true_start(contexts[i]) != 0) {
+            // Tasks already started are cancelled before their work; the rest
+            // never start
+            for (uint32_t j = 0; j < i; j++) {
+                rift_true_terminate(first_id + j);
+            }
+            if (gang) {
+                true_gang_release(gang, i, true);
+            }
+            true_start_gate_close(start_gate, 0); // Forked members read EOF
+            for (uint32_t j = i; j < count; j++) {
+                true_table_remove(contexts[j]);
+                true_context_destroy(contexts[j]);
+            }
+            return 0;
+        }
+    }
+
+    if (gang) {
+        true_gang_release(gang, count, false);
+    }
+    true_start_gate_close(start_gate, count);
+    return first_id;
+}
+
+/**
+ * @brief Wait on a pool worker: run queued work instead of blocking so a
+ *        task waiting for its children cannot starve the pool
+ */
+static int true_wait_helping(rift_true_context_t* context, uint32_t timeout_ms,
+                             const struct timespec* deadline, bool cancellable) {
+    for (;;) {
+        uint32_t word = true_lifecycle(context);
+        if (true_state(word) == TRUE_TASK_FINISHED) {
+            return 0;
+        }
+        if (cancellable && rift_current_should_terminate()) {
+            return -1;
+        }
+
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (timeout_ms != 0 && (now.tv_sec > deadline->tv_sec ||
+            (now.tv_sec == deadline->tv_sec && now.tv_nsec >= deadline->tv_nsec))) {
+            return -1;
+        }
+
+        if (rift_true_pool_help()) {
+            continue;
+        }
+
+        // Nothing queued: park briefly on the lifecycle word, then look again
+        struct timespec slice = now;
+        slice.tv_nsec += RIFT_TRUE_POOL_HELP_INTERVAL_MS * 1000000L;
+        if (slice.tv_nsec >= 1000000000L) {
+            slice.tv_sec++;
+            slice.tv_nsec -= 1000000000L;
+        }
+        true_lifecycle_park(context, word, &slice, cancellable);
+    }
+}
+
+/**
+ * @brief Wait for thread or process to finish; a cancellable wait also ends
+ *        when the waiting task is cancelled
+ */
+static int true_wait(uint64_t rift_id, uint32_t timeout_ms, bool cancellable) {
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    rift_true_context_t* context = true_find_locked(rift_id);
+    if (context) {
+        context->waiters++;
+    }
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+
+    if (!context) {
+        return -1;
+    }
+
+    // Priority inheritance: a deadline task lends its deadline to a queued child
+    if (t_true_current && context->pooled) {
+        rift_true_pool_boost(context, t_true_current->base_context.telemetry.deadline_ns);
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    int result = 0;
+    if (true_is_process(context) && !context->zygote_child) {
+        result = true_lifecycle_wait(context, timeout_ms ? &deadline : NULL, true, cancellable);
+
+        // Nobody publishes an unwatched child's exit; poll its exit status
+        uint32_t waited_ms = 0;
+        while (result > 0 && !true_is_finished(context)) {
+            if ((timeout_ms != 0 && waited_ms >= timeout_ms) ||
+                (cancellable && rift_current_should_terminate())) {
+                result = -1;
+                break;
+            }
+            usleep(1000);
+            waited_ms++;
+        }
+        if (result > 0) {
+            result = 0;
+        }
+    } else if (!true_is_process(context) && rift_true_pool_on_worker()) {
+        result = true_wait_helping(context, timeout_ms, &deadline, cancellable);
+    } else {
+        result = true_lifecycle_wait(context, timeout_ms ? &deadline : NULL, false, cancellable);
+    }
+
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    context->waiters--;
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+    return result;
+}
+
+/**
+ * @brief Wait for thread or process to finish
+ */
+int rift_true_wait(uint64_t rift_id, uint32_t timeout_ms) {
+    return true_wait(rift_id, timeout_ms, true);
+}
+
+static void* true_enforcer_entry(void* arg) {
+    rift_true_context_t* context = arg;
+    rift_true_handle_parent_destruction(context->base_context.telemetry.rift_thread_id);
+
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    context->waiters--;
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+    atomic_fetch_sub(&g_true_enforcers, 1);
+    return NULL;
+}
+
+/**
+ * @brief Mark process task finished on an exit reported by the zygote or the
+ *        reaper, and apply its destroy policy to any children it leaves
+ */
+void rift_true_process_exited(uint64_t rift_id, int status) {
+    bool orphans = false;
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    rift_true_context_t* context = true_find_locked(rift_id);
+    if (context) {
+        true_process_finished(context, status);
+
+        for (int i = 0; i < RIFT_MAX_THREAD_COUNT && !orphans; i++) {
+            rift_true_context_t* child = g_true_table.contexts[i];
+            orphans = child && child->base_context.telemetry.parent_rift_id == rift_id;
+        }
+        orphans = orphans && !g_true_cleaning; // Cleanup terminates them anyway
+        if (orphans) {
+            context->waiters++; // Keeps the parent's destroy policy in the table
+            atomic_fetch_add(&g_true_enforcers, 1);
+        }
+    }
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+
+    if (!orphans) {
+        return;
+    }
+    pthread_t enforcer;
+    if (pthread_create(&enforcer, NULL, true_enforcer_entry, context) != 0) {
+        fprintf(stderr, "[TRUE] No enforcer for exited parent %lu\n", (unsigned long)rift_id);
+        pthread_mutex_lock(&g_true_table.table_mutex);
+        context->waiters--;
+        pthread_mutex_unlock(&g_true_table.table_mutex);
+        atomic_fetch_sub(&g_true_enforcers, 1);
+        return;
+    }
+    pthread_detach(enforcer);
+}
+
+/**
+ * @brief Terminate thread or process
+ */
+int rift_true_terminate(uint64_t rift_id) {
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    rift_true_context_t* context = true_find_locked(rift_id);
+    if (context) {
+        rift_cancel_context(&context->base_context);
+        if (true_is_process(context) && context->child_process_id > 0) {
+            true_signal_process(context->child_process_id, context->process_group, SIGTERM);
+        }
+    }
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+
+    if (!context) {
+        return -1;
+    }
+
+    printf("[TRUE] Termination requested for RIFT ID %lu\n", (unsigned long)rift_id);
+    true_reap_finished();
+    return 0;
+}
+
+static void true_kill(uint64_t rift_id) {
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    rift_true_context_t* context = true_find_locked(rift_id);
+    if (context) {
+        rift_cancel_context(&context->base_context);
+        if (true_is_process(context) && context->child_process_id > 0) {
+            true_signal_process(context->child_process_id, context->process_group, SIGKILL);
+        }
+    }
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+}
+
+// =============================================================================
+// SUBTREE TEARDOWN
+// =============================================================================
+
+typedef enum {
+    TEARDOWN_NONE,
+    TEARDOWN_REPARENT,                    // keep_alive boundary: detach from parent
+    TEARDOWN_TERMINATE,                   // SIGTERM / cancel
+    TEARDOWN_GRACEFUL,                    // SIGTERM / cancel, SIGKILL after grace period
+    TEARDOWN_KILL                         // SIGKILL / cancel
+} rift_true_teardown_action_t;
+
+// Snapshot of one table entry, linked into its parent's child list
+typedef struct {
+    uint64_t rift_id;
+    uint64_t parent_id;
+    rift_true_context_t* context;
+    int32_t first_child;
+    int32_t next_sibling;
+    rift_true_teardown_action_t action;
+} rift_true_teardown_node_t;
+
+// Process to signal once the table lock is released
+typedef struct {
+    uint64_t rift_id;
+    pid_t pid;
+    pid_t process_group;
+    rift_true_teardown_action_t action;
+} rift_true_teardown_signal_t;
+
+static int true_teardown_compare(const void* a, const void* b) {
+    uint64_t left = ((const rift_true_teardown_node_t*)a)->rift_id;
+    uint64_t right = ((const rift_true_teardown_node_t*)b)->rift_id;
+    return (left > right) - (left < right);
+}
+
+static int32_t true_teardown_find(const rift_true_teardown_node_t* nodes, uint32_t count,
+                                  uint64_t rift_id) {
+    uint32_t low = 0;
+    uint32_t high = count;
+    while (low < high) {
+        uint32_t middle = (low + high) / 2;
+        if (nodes[middle].rift_id < rift_id) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low < count && nodes[low].rift_id == rift_id ? (int32_t)low : -1;
+}
+
+/**
+ * @brief Decide what happens to every node below parent_id; caller holds
+ *        table_mutex. Mirrors per-level enforcement: a node's children get
+ *        the node's own destroy_policy, and only DESTROY_CASCADE descends.
+ * @return Number of direct children of parent_id
+ */
+static uint32_t true_teardown_plan(rift_true_teardown_node_t* nodes, uint32_t count,
+                                   uint64_t parent_id, rift_destroy_policy_t* root_policy) {
+    qsort(nodes, count, sizeof(nodes[0]), true_teardown_compare);
+
+    int32_t root_children = -1;
+    for (uint32_t i = count; i-- > 0;) {
+        int32_t parent = true_teardown_find(nodes, count, nodes[i].parent_id);
+        if (parent >= 0 && nodes[i].parent_id != 0) {
+            nodes[i].next_sibling = nodes[parent].first_child;
+            nodes[parent].first_child = (int32_t)i;
+        } else if (nodes[i].parent_id == parent_id) {
+            nodes[i].next_sibling = root_children; // Parent already gone from the table
+            root_children = (int32_t)i;
+        }
+    }
+
+    int32_t root = true_teardown_find(nodes, count, parent_id);
+    *root_policy = root >= 0 ? nodes[root].context->base_context.policy.destroy_policy :
+                               DESTROY_CASCADE;
+
+    // Explicit stack of (first child, policy applied to that sibling list)
+    int32_t stack_child[RIFT_MAX_THREAD_COUNT + 1];
+    rift_destroy_policy_t stack_policy[RIFT_MAX_THREAD_COUNT + 1];
+    uint32_t depth = 0;
+    stack_child[depth] = root >= 0 ? nodes[root].first_child : root_children;
+    stack_policy[depth++] = *root_policy;
+
+    uint32_t direct = 0;
+    for (int32_t child = stack_child[0]; child >= 0; child = nodes[child].next_sibling) {
+        direct++;
+    }
+
+    while (depth > 0) {
+        depth--;
+        rift_destroy_policy_t policy = stack_policy[depth];
+        for (int32_t child = stack_child[depth]; child >= 0; child = nodes[child].next_sibling) {
+            rift_true_teardown_node_t* node = &nodes[child];
+
+            // keep_alive children outlive their parent unless destruction is immediate
+            bool keep_alive = node->context->base_context.policy.keep_alive;
+            if (policy == DESTROY_KEEP_ALIVE || (keep_alive && policy != DESTROY_IMMEDIATE)) {
+                node->action = TEARDOWN_REPARENT;
+                continue;
+            }
+            switch (policy) {
+                case DESTROY_CASCADE:
+                    node->action = TEARDOWN_TERMINATE;
+                    if (node->first_child >= 0) {
+                        stack_child[depth] = node->first_child;
+                        stack_policy[depth++] = node->context->base_context.policy.destroy_policy;
+                    }
+                    break;
+                case DESTROY_GRACEFUL:
+                    node->action = TEARDOWN_GRACEFUL;
+                    break;
+                case DESTROY_IMMEDIATE:
+                    node->action = TEARDOWN_KILL;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    return direct;
+}
+
+/**
+ * @brief Handle parent destruction with policy enforcement
+ */
+int rift_true_handle_parent_destruction(uint64_t parent_id) {
+    rift_true_teardown_node_t nodes[RIFT_MAX_THREAD_COUNT];
+    rift_true_teardown_signal_t signals[RIFT_MAX_THREAD_COUNT];
+    uint32_t count = 0;
+    uint32_t signal_count = 0;
+    uint32_t torn_down = 0;
+    rift_destroy_policy_t policy;
+
+    // One snapshot, one plan, and one cancellation pass under a single lock
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        rift_true_context_t* context = g_true_table.contexts[i];
+        if (context) {
+            nodes[count++] = (rift_true_teardown_node_t){
+                .rift_id = context->base_context.telemetry.rift_thread_id,
+                .parent_id = context->base_context.telemetry.parent_rift_id,
+                .context = context,
+                .first_child = -1,
+                .next_sibling = -1
+            };
+        }
+    }
+    uint32_t direct = true_teardown_plan(nodes, count, parent_id, &policy);
+
+    for (uint32_t i = 0; i < count; i++) {
+        rift_true_context_t* context = nodes[i].context;
+        if (nodes[i].action == TEARDOWN_NONE) {
+            continue;
+        }
+        if (nodes[i].action == TEARDOWN_REPARENT) {
+            context->base_context.telemetry.parent_rift_id = 0;
+            continue;
+        }
+        rift_cancel_context(&context->base_context);
+        torn_down++;
+        if (true_is_process(context) && context->child_process_id > 0) {
+            signals[signal_count++] = (rift_true_teardown_signal_t){
+                nodes[i].rift_id, context->child_process_id, context->process_group,
+                nodes[i].action
+            };
+        }
+    }
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+
+    // A process leading its group takes its whole process subtree with it
+    for (uint32_t i = 0; i < signal_count; i++) {
+        true_signal_process(signals[i].pid, signals[i].process_group,
+                            signals[i].action == TEARDOWN_KILL ? SIGKILL : SIGTERM);
+    }
+
+    // Graceful children share one grace period instead of one each
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < count; i++) {
+        if (nodes[i].action != TEARDOWN_GRACEFUL) {
+            continue;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        int64_t elapsed_ms = (int64_t)(now.tv_sec - start.tv_sec) * 1000 +
+                             (now.tv_nsec - start.tv_nsec) / 1000000;
+        int64_t remaining_ms = RIFT_TRUE_GRACE_PERIOD_MS - elapsed_ms;
+        // Not cancellable: the grace period runs out even if we are cancelled
+        if (true_wait(nodes[i].rift_id, remaining_ms > 0 ? (uint32_t)remaining_ms : 1,
+                      false) != 0) {
+            printf("[TRUE] RIFT ID %lu ignored grace period, killing\n",
+                   (unsigned long)nodes[i].rift_id);
+            true_kill(nodes[i].rift_id);
+        }
+    }
+
+    printf("[TRUE] Parent %lu destroyed - policy %d applied to %u children (%u tasks torn down)\n",
+           (unsigned long)parent_id, policy, direct, torn_down);
+    true_reap_finished();
+    return 0;
+}
+
+/**
+ * @brief Clean up true concurrency subsystem
+ */
+void rift_true_concurrency_cleanup(void) {
+    if (!g_true_initialized) {
+        return;
+    }
+
+    // Destroy policies of exited parents finish before anything is torn down
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    g_true_cleaning = true;
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+    while (atomic_load(&g_true_enforcers) > 0) {
+        usleep(1000);
+    }
+
+    pthread_mutex_lock(&g_true_table.table_mutex);
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        rift_true_context_t* context = g_true_table.contexts[i];
+        if (context) {
+            rift_cancel_context(&context->base_context);
+            if (true_is_process(context) && context->child_process_id > 0) {
+                true_signal_process(context->child_process_id, context->process_group, SIGTERM);
+            }
+        }
+    }
+    pthread_mutex_unlock(&g_true_table.table_mutex);
+
+    // Queued pool work is dropped: the drain finishes each task without running it,
+    // as its cancel is already requested
+    rift_true_pool_cleanup();
+
+    // Zygote and watched children finish through the listener or the reaper,
+    // which must outlive them
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        rift_true_context_t* context = g_true_table.contexts[i];
+        if (context && true_is_process(context)) {
+            true_lifecycle_wait(context, NULL, !context->zygote_child, false);
+        }
+    }
+    rift_true_zygote_stop();
+    rift_true_reaper_stop();
+
+    for (int i = 0; i < RIFT_MAX_THREAD_COUNT; i++) {
+        rift_true_context_t* context = g_true_table.contexts[i];
+        if (!context) {
+            continue;
+        }
+        if (true_is_process(context)) {
+            if (context->child_process_id > 0 && !context->zygote_child &&
+                !(true_lifecycle(context) & TRUE_LIFECYCLE_WATCHED)) {
+                int status = 0;
+                waitpid(context->child_process_id, &status, 0);
+                true_process_finished(context, status);
+            }
+        } else if (!context->pooled) {
+            pthread_join(context->pthread_handle, NULL);
+        }
+        g_true_table.contexts[i] = NULL;
+        true_context_destroy(context);
+    }
+    g_true_table.context_count = 0;
+    rift_watchdog_stop();
+
+    g_true_cleaning = false;
+    g_true_initialized = false;
+    printf("[TRUE] True concurrency subsystem cleaned up\n");
+}
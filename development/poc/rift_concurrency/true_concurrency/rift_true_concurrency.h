@@ -0,0 +1,170 @@
+/**
+ * @file rift_true_concurrency.h
+ * @brief True Concurrency Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_TRUE_CONCURRENCY_H
+#define RIFT_TRUE_CONCURRENCY_H
+
+#include "rift_common.h"
+#include "rift_watchdog.h"
+#include "rift_true_placement.h"
+
+#define RIFT_TRUE_GRACE_PERIOD_MS 1000
+
+// Lifecycle of a true thread or process, kept in the low bits of the
+// context's lifecycle word
+typedef enum {
+    TRUE_TASK_STARTING,                   // Registered, not yet running
+    TRUE_TASK_RUNNING,                    // Work function executing
+    TRUE_TASK_EXITING,                    // Process exit claimed, being published
+    TRUE_TASK_FINISHED                    // Work returned, awaiting reap
+} rift_true_task_state_t;
+
+// Lifecycle word layout: state plus flags, also the futex waiters park on
+#define TRUE_LIFECYCLE_STATE_MASK 0x3u
+#define TRUE_LIFECYCLE_WATCHED 0x4u       // Exit is published by the pidfd reaper
+#define TRUE_LIFECYCLE_WAITERS 0x8u       // Someone may be parked on the futex
+
+typedef struct rift_true_gang rift_true_gang_t;
+
+// True concurrency specific structures
+typedef struct rift_true_context {
+    rift_thread_context_t base_context;   // Common thread context
+    pthread_t pthread_handle;             // POSIX thread handle (dedicated threads)
+    bool pooled;                          // Runs as a unit of work on the worker pool
+    struct rift_true_context* next;       // Worker pool queue link
+    pid_t child_process_id;               // Child process ID (if process mode)
+    bool zygote_child;                    // Forked by the zygote, not by us
+    _Atomic uint32_t lifecycle;           // State and TRUE_LIFECYCLE_* flags (futex word)
+    uint32_t waiters;                     // Callers blocked in rift_true_wait()
+    rift_true_placement_t placement;      // CPU/NUMA placement to apply at start
+    rift_ipc_ring_t* ipc_ring;            // IPC ring bound to the child process
+    bool ipc_bound;                       // Child's producer binding not yet released
+    pid_t process_group;                  // Group led by the child (its subtree), 0 if shared
+    rift_watchdog_timer_t deadline;       // max_execution_time_ms watchdog
+    rift_true_gang_t* gang;               // Gang released together, NULL for none
+    int start_gate[2];                    // Forked batch member's start pipe, -1 for none
+    void (*work_function)(void*);         // Work function pointer
+    void* work_data;                      // Work function data
+} rift_true_context_t;
+
+/**
+ * @brief Initialize true concurrency subsystem
+ * @return 0 on success, error code otherwise
+ */
+int rift_true_concurrency_init(void);
+
+/**
+ * @brief Spawn new thread with true concurrency
+ * @param parent_id Parent RIFT thread ID
+ * @param policy Governance policy for new thread
+ * @param work_func Work function to execute
+ * @param work_data Data to pass to work function
+ * @param spawn_location Source location of spawn
+ * @return RIFT thread ID on success, 0 on failure (CONCURRENCY_AUTO policies
+ *         are refused; they spawn through rift_auto_spawn())
+ */
+uint64_t rift_true_spawn_thread(uint64_t parent_id,
+                                const rift_governance_policy_t* policy,
+                                void (*work_func)(void*),
+                                void* work_data,
+                                const char* spawn_location);
+
+/**
+ * @brief Spawn new process with true concurrency
+ * @param parent_id Parent RIFT thread ID
+ * @param policy Governance policy for new process
+ * @param work_func Work function to execute
+ * @param work_data Data to pass to work function
+ * @param spawn_location Source location of spawn
+ * @return RIFT thread ID on success, 0 on failure (or for CONCURRENCY_AUTO)
+ */
+uint64_t rift_true_spawn_process(uint64_t parent_id,
+                                 const rift_governance_policy_t* policy,
+                                 void (*work_func)(void*),
+                                 void* work_data,
+                                 const char* spawn_location);
+
+/**
+ * @brief Spawn batch of threads or processes sharing one work function,
+ *        all or nothing: dedicated threads and forked processes hold back
+ *        their work until every member has started, and if one cannot be
+ *        started the others are cancelled without having run it. Zygote
+ *        children are the exception, they may have begun before a later
+ *        member fails. With gang_start the threads are dedicated, and none
+ *        runs its work before all are created, placed and registered; the
+ *        call returns once they have been released together. Process
+ *        batches refuse gang_start.
+ * @param parent_id Parent RIFT thread ID
+ * @param policy Governance policy for every task (mode selects thread/process)
+ * @param work_func Work function to execute
+ * @param data_array Per-task work data (may be NULL)
+ * @param count Number of tasks
+ * @param spawn_location Source location of spawn
+ * @return First RIFT thread ID of a contiguous range, 0 on failure (or for
+ *         CONCURRENCY_AUTO)
+ */
+uint64_t rift_true_spawn_batch(uint64_t parent_id,
+                               const rift_governance_policy_t* policy,
+                               void (*work_func)(void*),
+                               void** data_array,
+                               uint32_t count,
+                               const char* spawn_location);
+
+/**
+ * @brief Wait for thread or process to finish
+ * @param rift_id RIFT thread ID to wait for
+ * @param timeout_ms Maximum wait (0 waits forever)
+ * @return 0 when finished, -1 on timeout or unknown ID
+ */
+int rift_true_wait(uint64_t rift_id, uint32_t timeout_ms);
+
+/**
+ * @brief Handle parent destruction with policy enforcement
+ * @param parent_id RIFT ID of destroyed parent
+ * @return 0 on success, error code otherwise
+ */
+int rift_true_handle_parent_destruction(uint64_t parent_id);
+
+/**
+ * @brief Terminate thread or process
+ * @param rift_id RIFT thread ID to terminate
+ * @return 0 on success, error code otherwise
+ */
+int rift_true_terminate(uint64_t rift_id);
+
+/**
+ * @brief Clean up true concurrency subsystem
+ */
+void rift_true_concurrency_cleanup(void);
+
+/**
+ * @brief Mark a process task finished when its exit is reported by someone
+ *        other than waitpid() on the spawning path (the zygote, the reaper)
+ * @param rift_id RIFT ID of the exited process task
+ * @param status Wait status of the exited process
+ */
+void rift_true_process_exited(uint64_t rift_id, int status);
+
+/**
+ * @brief Child side of a process spawn: forget the spawner's tasks, and the
+ *        state and locks of every true-mode module, and, in a child of a
+ *        top-level spawner, lead a process group so the whole subtree can be
+ *        signalled at once (spawn internal). The simulated and hybrid
+ *        runtimes stay the spawner's and refuse spawns in the child.
+ * @param context Copy of the forked task's context; its cancellation token
+ *        and quota start over and its telemetry entry is kept
+ */
+void rift_true_enter_subtree(rift_thread_context_t* context);
+
+/**
+ * @brief Run context's work on the calling thread and publish completion
+ *        (worker pool internal)
+ * @param context Registered thread context
+ */
+void rift_true_execute(rift_true_context_t* context);
+
+#endif // RIFT_TRUE_CONCURRENCY_H
@@ -0,0 +1,623 @@
+/**
+ * @file rift_true_ipc.c
+ * @brief RIFT True Concurrency - Shared-Memory IPC Rings
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Byte ring in a memfd shared between a parent and its TRUE_PROCESS
+ * children. The data area is mapped twice back to back, so every record is
+ * contiguous in memory however it straddles the end of the ring: producers
+ * write payloads in place (rift_ipc_reserve/commit) and the consumer reads
+ * them in place (rift_ipc_peek/consume) without copying or padding records.
+ *
+ * Records are a length header followed by the payload, 8-byte aligned.
+ * Producers claim space by advancing reserve (a plain store for SPSC, a CAS
+ * for MPSC). The SPSC producer publishes by advancing tail. MPSC producers
+ * set a committed flag in their own record instead, so none waits for a
+ * slower producer that reserved earlier; the consumer zeroes every record
+ * it frees, which keeps a clear flag at head meaning "not committed yet"
+ * rather than stale bytes from the previous lap. Sleeping
+ * sides park on futex eventcounts in the shared header (after a short spin
+ * on multi-CPU machines); the other side clears the parked flag as it
+ * wakes them, so a burst of messages costs one wake, not one per message.
+ *
+ * A ring named in a policy's ipc_ring is bound to each process spawned
+ * with that policy: the child reaches it through rift_ipc_parent_ring(),
+ * and the ring closes once every bound child has exited. A child that
+ * returns from its work function releases its binding itself; any other
+ * exit (signal, non-zero status) is released by the parent when it reaps
+ * the child, so the consumer is never left waiting on a dead producer.
+ */
+
+#include "rift_true_ipc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define RIFT_IPC_CACHE_LINE 64
+#define RIFT_IPC_RECORD_ALIGN 8u
+#define RIFT_IPC_SPIN_ITERATIONS 256
+
+// =============================================================================
+// SHARED LAYOUT
+// =============================================================================
+
+typedef struct {
+    uint32_t length;                      // Payload bytes
+    _Atomic uint32_t committed;           // MPSC: payload published
+} rift_ipc_record_t;
+
+// Header page at offset 0 of the memfd; the data area follows it
+typedef struct {
+    // Producer side
+    _Alignas(RIFT_IPC_CACHE_LINE) _Atomic uint64_t reserve; // Next position to claim
+    _Atomic uint64_t head_cache;          // Producers' last view of head
+    _Atomic uint32_t space_epoch;         // Futex: bumped when space is freed
+    _Atomic uint32_t producers_waiting;   // Some producer parked on space_epoch
+    _Atomic uint64_t producer_waits;      // Times a producer slept on a full ring
+
+    // SPSC: published end of committed records
+    _Alignas(RIFT_IPC_CACHE_LINE) _Atomic uint64_t tail;
+
+    // Consumer side
+    _Alignas(RIFT_IPC_CACHE_LINE) _Atomic uint64_t head; // Next position to read
+    _Atomic uint32_t data_epoch;          // Futex: bumped when data is published
+    _Atomic uint32_t consumer_waiting;    // Consumer parked on data_epoch
+    _Atomic uint64_t consumer_waits;      // Times the consumer slept on an empty ring
+
+    // Binding, rarely written
+    _Alignas(RIFT_IPC_CACHE_LINE) _Atomic uint32_t producers; // Bound children alive
+    _Atomic uint32_t bindings;            // Children ever bound
+    _Atomic uint32_t closed;
+    uint32_t kind;
+    uint32_t capacity;
+    _Atomic uint64_t consumer_rift_id;    // Parent the ring is bound to
+    _Atomic uint64_t producer_rift_id;    // Most recently bound child
+} rift_ipc_shared_t;
+
+// Process-local handle; the mapping itself is shared
+struct rift_ipc_ring {
+    rift_ipc_shared_t* shared;
+    uint8_t* data;                        // Two consecutive views of the data area
+    uint32_t capacity;
+    uint32_t mask;
+    size_t header_size;
+    int fd;
+    _Atomic uint32_t references;          // Creator plus one per bound context
+};
+
+// Ring bound to this process at spawn, NULL in the parent
+static rift_ipc_ring_t* g_parent_ring = NULL;
+
+// Spinning only helps when the other side runs on another CPU
+static int g_spin_iterations = -1;
+
+// =============================================================================
+// FUTEX AND MAPPING HELPERS
+// =============================================================================
+
+static void ipc_futex_wait(_Atomic uint32_t* word, uint32_t expected) {
+    // Shared (not PRIVATE) futex: the waker lives in another process
+    syscall(SYS_futex, (uint32_t*)word, FUTEX_WAIT, expected, NULL, NULL, 0);
+}
+
+static void ipc_futex_wake(_Atomic uint32_t* word, int count) {
+    syscall(SYS_futex, (uint32_t*)word, FUTEX_WAKE, count, NULL, NULL, 0);
+}
+
+static inline void ipc_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+static int ipc_spin_iterations(void) {
+    if (g_spin_iterations < 0) {
+        g_spin_iterations = sysconf(_SC_NPROCESSORS_ONLN) > 1 ? RIFT_IPC_SPIN_ITERATIONS : 0;
+    }
+    return g_spin_iterations;
+}
+
+static uint32_t ipc_record_size(uint32_t length) {
+    return (uint32_t)((sizeof(rift_ipc_record_t) + length + RIFT_IPC_RECORD_ALIGN - 1) &
+                      ~(uint64_t)(RIFT_IPC_RECORD_ALIGN - 1));
+}
+
+/**
+ * @brief Map header and a doubled view of the data area from fd
+ */
+static rift_ipc_ring_t* ipc_map(int fd, uint32_t capacity) {
+    long page = sysconf(_SC_PAGESIZE);
+    size_t header_size = (sizeof(rift_ipc_shared_t) + (size_t)page - 1) & ~((size_t)page - 1);
+
+    rift_ipc_ring_t* ring = calloc(1, sizeof(rift_ipc_ring_t));
+    if (!ring) {
+        return NULL;
+    }
+
+    // Reserve the whole span, then overlay the shared views onto it
+    uint8_t* base = mmap(NULL, header_size + 2 * (size_t)capacity, PROT_NONE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        free(ring);
+        return NULL;
+    }
+    if (mmap(base, header_size + capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+             fd, 0) == MAP_FAILED ||
+        mmap(base + header_size + capacity, capacity, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_FIXED, fd, (off_t)header_size) == MAP_FAILED) {
+        munmap(base, header_size + 2 * (size_t)capacity);
+        free(ring);
+        return NULL;
+    }
+
+    ring->shared = (rift_ipc_shared_t*)base;
+    ring->data = base + header_size;
+    ring->capacity = capacity;
+    ring->mask = capacity - 1;
+    ring->header_size = header_size;
+    ring->fd = fd;
+    atomic_init(&ring->references, 1);
+    return ring;
+}
+
+static void ipc_unmap(rift_ipc_ring_t* ring) {
+    munmap(ring->shared, ring->header_size + 2 * (size_t)ring->capacity);
+    close(ring->fd);
+    free(ring);
+}
+
+// =============================================================================
+// WAITING
+// =============================================================================
+
+static rift_ipc_record_t* ipc_record_at(rift_ipc_ring_t* ring, uint64_t position) {
+    return (rift_ipc_record_t*)(ring->data + (position & ring->mask));
+}
+
+/**
+ * @brief Whether the record at head has been committed
+ */
+static bool ipc_ready(rift_ipc_ring_t* ring, uint64_t head) {
+    if (ring->shared->kind == RIFT_IPC_SPSC) {
+        return atomic_load(&ring->shared->tail) != head;
+    }
+    return atomic_load(&ipc_record_at(ring, head)->committed) != 0;
+}
+
+static bool ipc_has_data(rift_ipc_ring_t* ring, uint64_t head) {
+    return ipc_ready(ring, head) || atomic_load(&ring->shared->closed);
+}
+
+/**
+ * @brief Park the consumer until data is published or the ring closes
+ */
+static void ipc_wait_data(rift_ipc_ring_t* ring, uint64_t head) {
+    rift_ipc_shared_t* shared = ring->shared;
+    for (int spin = 0; spin < ipc_spin_iterations(); spin++) {
+        if (ipc_has_data(ring, head)) {
+            return;
+        }
+        ipc_cpu_relax();
+    }
+    if (ipc_spin_iterations() == 0) {
+        // Single CPU: give producers a slice instead of being woken per message
+        sched_yield();
+        if (ipc_has_data(ring, head)) {
+            return;
+        }
+    }
+
+    // Read the epoch before advertising, recheck after: a commit in between
+    // either sees consumer_waiting or is visible to the recheck
+    uint32_t epoch = atomic_load(&shared->data_epoch);
+    atomic_store(&shared->consumer_waiting, 1);
+    if (!ipc_has_data(ring, head)) {
+        atomic_fetch_add_explicit(&shared->consumer_waits, 1, memory_order_relaxed);
+        ipc_futex_wait(&shared->data_epoch, epoch);
+    }
+}
+
+static bool ipc_has_space(rift_ipc_ring_t* ring, uint64_t position, uint32_t size) {
+    rift_ipc_shared_t* shared = ring->shared;
+    return position + size - atomic_load(&shared->head) <= ring->capacity ||
+           atomic_load(&shared->closed);
+}
+
+/**
+ * @brief Park a producer until the consumer frees space or the ring closes
+ */
+static void ipc_wait_space(rift_ipc_ring_t* ring, uint64_t position, uint32_t size) {
+    rift_ipc_shared_t* shared = ring->shared;
+    for (int spin = 0; spin < ipc_spin_iterations(); spin++) {
+        if (ipc_has_space(ring, position, size)) {
+            return;
+        }
+        ipc_cpu_relax();
+    }
+    if (ipc_spin_iterations() == 0) {
+        sched_yield(); // Single CPU: let the consumer drain before parking
+        if (ipc_has_space(ring, position, size)) {
+            return;
+        }
+    }
+
+    uint32_t epoch = atomic_load(&shared->space_epoch);
+    atomic_store(&shared->producers_waiting, 1);
+    if (!ipc_has_space(ring, position, size)) {
+        atomic_fetch_add_explicit(&shared->producer_waits, 1, memory_order_relaxed);
+        ipc_futex_wait(&shared->space_epoch, epoch);
+    }
+}
+
+// =============================================================================
+// RING LIFECYCLE
+// =============================================================================
+
+/**
+ * @brief Create ring with at least capacity bytes of record space
+ */
+rift_ipc_ring_t* rift_ipc_create(rift_ipc_kind_t kind, uint32_t capacity) {
+    long page = sysconf(_SC_PAGESIZE);
+    if (capacity > RIFT_IPC_MAX_CAPACITY) {
+        fprintf(stderr, "[IPC] Ring capacity %u exceeds %u\n", capacity, RIFT_IPC_MAX_CAPACITY);
+        return NULL;
+    }
+
+    // Power of two for masking, whole pages for the double mapping
+    uint32_t rounded = (uint32_t)page;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+
+    int fd = memfd_create("rift_ipc", MFD_CLOEXEC);
+    if (fd < 0) {
+        fprintf(stderr, "[IPC] memfd_create failed: %s\n", strerror(errno));
+        return NULL;
+    }
+
+    size_t header_size = (sizeof(rift_ipc_shared_t) + (size_t)page - 1) & ~((size_t)page - 1);
+    if (ftruncate(fd, (off_t)(header_size + rounded)) != 0) {
+        fprintf(stderr, "[IPC] ftruncate failed: %s\n", strerror(errno));
+        close(fd);
+        return NULL;
+    }
+
+    rift_ipc_ring_t* ring = ipc_map(fd, rounded);
+    if (!ring) {
+        fprintf(stderr, "[IPC] mmap failed: %s\n", strerror(errno));
+        close(fd);
+        return NULL;
+    }
+
+    // The fresh memfd is zero-filled: only the constants need writing
+    ring->shared->kind = (uint32_t)kind;
+    ring->shared->capacity = rounded;
+    return ring;
+}
+
+/**
+ * @brief Drop the caller's reference; unmapped once bound contexts are
+ *        reaped as well
+ */
+void rift_ipc_destroy(rift_ipc_ring_t* ring) {
+    if (ring && atomic_fetch_sub(&ring->references, 1) == 1) {
+        ipc_unmap(ring);
+    }
+}
+
+/**
+ * @brief Close ring: sends fail, receives drain what was committed
+ */
+void rift_ipc_close(rift_ipc_ring_t* ring) {
+    rift_ipc_shared_t* shared = ring->shared;
+    if (atomic_exchange(&shared->closed, 1)) {
+        return;
+    }
+    atomic_fetch_add(&shared->data_epoch, 1);
+    atomic_fetch_add(&shared->space_epoch, 1);
+    ipc_futex_wake(&shared->data_epoch, INT_MAX);
+    ipc_futex_wake(&shared->space_epoch, INT_MAX);
+}
+
+// =============================================================================
+// PRODUCER
+// =============================================================================
+
+static void* ipc_reserve(rift_ipc_ring_t* ring, uint32_t length, rift_ipc_slot_t* slot,
+                         bool block, int* status) {
+    rift_ipc_shared_t* shared = ring->shared;
+    uint32_t size = ipc_record_size(length);
+    if (size > ring->capacity) {
+        *status = RIFT_IPC_TOO_LARGE;
+        return NULL;
+    }
+
+    uint64_t position = atomic_load_explicit(&shared->reserve, memory_order_relaxed);
+    for (;;) {
+        if (atomic_load_explicit(&shared->closed, memory_order_relaxed)) {
+            *status = RIFT_IPC_CLOSED;
+            return NULL;
+        }
+
+        // Cached head first; the consumer's line is touched only when full
+        // Acquire/release on the cache too: the freed space was zeroed by the
+        // consumer before it advanced head
+        uint64_t head = atomic_load_explicit(&shared->head_cache, memory_order_acquire);
+        if (position + size - head > ring->capacity) {
+            head = atomic_load_explicit(&shared->head, memory_order_acquire);
+            atomic_store_explicit(&shared->head_cache, head, memory_order_release);
+            if (position + size - head > ring->capacity) {
+                if (!block) {
+                    *status = RIFT_IPC_WOULD_BLOCK;
+                    return NULL;
+                }
+                ipc_wait_space(ring, position, size);
+                position = atomic_load_explicit(&shared->reserve, memory_order_relaxed);
+                continue;
+            }
+        }
+
+        if (shared->kind == RIFT_IPC_SPSC) {
+            atomic_store_explicit(&shared->reserve, position + size, memory_order_relaxed);
+            break;
+        }
+        if (atomic_compare_exchange_weak_explicit(&shared->reserve, &position, position + size,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    rift_ipc_record_t* record = ipc_record_at(ring, position);
+    record->length = length;
+    slot->position = position;
+    slot->size = size;
+    *status = RIFT_IPC_OK;
+    return record + 1;
+}
+
+/**
+ * @brief Reserve length payload bytes in place, waiting for space
+ */
+void* rift_ipc_reserve(rift_ipc_ring_t* ring, uint32_t length, rift_ipc_slot_t* slot) {
+    int status;
+    return ipc_reserve(ring, length, slot, true, &status);
+}
+
+/**
+ * @brief Publish a reserved record and wake the consumer if it sleeps
+ */
+void rift_ipc_commit(rift_ipc_ring_t* ring, const rift_ipc_slot_t* slot) {
+    rift_ipc_shared_t* shared = ring->shared;
+    if (shared->kind == RIFT_IPC_SPSC) {
+        atomic_store(&shared->tail, slot->position + slot->size);
+    } else {
+        atomic_store(&ipc_record_at(ring, slot->position)->committed, 1);
+    }
+
+    // Cheap load first; only the producer that finds the consumer parked
+    // pays for the exchange and the wake
+    if (atomic_load(&shared->consumer_waiting) &&
+        atomic_exchange(&shared->consumer_waiting, 0)) {
+        atomic_fetch_add(&shared->data_epoch, 1);
+        ipc_futex_wake(&shared->data_epoch, 1);
+    }
+}
+
+static int ipc_send(rift_ipc_ring_t* ring, const void* message, uint32_t length, bool block) {
+    rift_ipc_slot_t slot;
+    int status;
+    void* payload = ipc_reserve(ring, length, &slot, block, &status);
+    if (!payload) {
+        return status;
+    }
+    memcpy(payload, message, length);
+    rift_ipc_commit(ring, &slot);
+    return RIFT_IPC_OK;
+}
+
+/**
+ * @brief Copy message into the ring, waiting for space
+ */
+int rift_ipc_send(rift_ipc_ring_t* ring, const void* message, uint32_t length) {
+    return ipc_send(ring, message, length, true);
+}
+
+/**
+ * @brief Copy message into the ring if it fits now
+ */
+int rift_ipc_try_send(rift_ipc_ring_t* ring, const void* message, uint32_t length) {
+    return ipc_send(ring, message, length, false);
+}
+
+// =============================================================================
+// CONSUMER
+// =============================================================================
+
+static const void* ipc_peek(rift_ipc_ring_t* ring, uint32_t* length, bool block, int* status) {
+    rift_ipc_shared_t* shared = ring->shared;
+    uint64_t head = atomic_load_explicit(&shared->head, memory_order_relaxed);
+
+    for (;;) {
+        if (ipc_ready(ring, head)) {
+            rift_ipc_record_t* record = ipc_record_at(ring, head);
+            *length = record->length;
+            *status = RIFT_IPC_OK;
+            return record + 1;
+        }
+        // Closed only counts once everything committed before it is read;
+        // a record still uncommitted then belongs to a producer that died
+        if (atomic_load(&shared->closed) && !ipc_ready(ring, head)) {
+            *status = RIFT_IPC_CLOSED;
+            return NULL;
+        }
+        if (!block) {
+            *status = RIFT_IPC_WOULD_BLOCK;
+            return NULL;
+        }
+        ipc_wait_data(ring, head);
+    }
+}
+
+/**
+ * @brief Next record in place, waiting for one; NULL once closed and drained
+ */
+const void* rift_ipc_peek(rift_ipc_ring_t* ring, uint32_t* length) {
+    int status;
+    return ipc_peek(ring, length, true, &status);
+}
+
+/**
+ * @brief Free the record returned by the last peek and wake parked producers
+ */
+void rift_ipc_consume(rift_ipc_ring_t* ring) {
+    rift_ipc_shared_t* shared = ring->shared;
+    uint64_t head = atomic_load_explicit(&shared->head, memory_order_relaxed);
+    rift_ipc_record_t* record = ipc_record_at(ring, head);
+    uint32_t size = ipc_record_size(record->length);
+    if (shared->kind == RIFT_IPC_MPSC) {
+        memset(record, 0, size); // Any 8-byte word may hold a header next lap
+    }
+    atomic_store(&shared->head, head + size);
+
+    if (atomic_load(&shared->producers_waiting) &&
+        atomic_exchange(&shared->producers_waiting, 0)) {
+        atomic_fetch_add(&shared->space_epoch, 1);
+        ipc_futex_wake(&shared->space_epoch, INT_MAX);
+    }
+}
+
+static int ipc_recv(rift_ipc_ring_t* ring, void* buffer, uint32_t buffer_size, uint32_t* length,
+                    bool block) {
+    int status;
+    const void* payload = ipc_peek(ring, length, block, &status);
+    if (!payload) {
+        return status;
+    }
+    if (*length > buffer_size) {
+        return RIFT_IPC_TOO_LARGE; // Left in the ring; *length says what is needed
+    }
+    memcpy(buffer, payload, *length);
+    rift_ipc_consume(ring);
+    return RIFT_IPC_OK;
+}
+
+/**
+ * @brief Copy the next message out, waiting for one
+ */
+int rift_ipc_recv(rift_ipc_ring_t* ring, void* buffer, uint32_t buffer_size, uint32_t* length) {
+    return ipc_recv(ring, buffer, buffer_size, length, true);
+}
+
+/**
+ * @brief Copy the next message out if one is ready
+ */
+int rift_ipc_try_recv(rift_ipc_ring_t* ring, void* buffer, uint32_t buffer_size,
+                      uint32_t* length) {
+    return ipc_recv(ring, buffer, buffer_size, length, false);
+}
+
+// =============================================================================
+// SPAWN BINDING
+// =============================================================================
+
+/**
+ * @brief Count a child about to be spawned as a producer of ring
+ */
+int rift_ipc_bind(rift_ipc_ring_t* ring, uint64_t parent_id) {
+    rift_ipc_shared_t* shared = ring->shared;
+    if (atomic_load(&shared->closed)) {
+        fprintf(stderr, "[IPC] Spawn rejected: ring already closed\n");
+        return -1;
+    }
+    if (shared->kind == RIFT_IPC_SPSC && atomic_fetch_add(&shared->bindings, 1) != 0) {
+        fprintf(stderr, "[IPC] Spawn rejected: SPSC ring already bound to RIFT ID %lu\n",
+                (unsigned long)atomic_load(&shared->producer_rift_id));
+        return -1;
+    }
+    if (shared->kind == RIFT_IPC_MPSC) {
+        atomic_fetch_add(&shared->bindings, 1);
+    }
+
+    atomic_store(&shared->consumer_rift_id, parent_id);
+    atomic_fetch_add(&shared->producers, 1);
+    atomic_fetch_add(&ring->references, 1);
+    return 0;
+}
+
+void rift_ipc_bind_producer(rift_ipc_ring_t* ring, uint64_t child_id) {
+    atomic_store(&ring->shared->producer_rift_id, child_id);
+}
+
+/**
+ * @brief Release one producer binding; the last one closes the ring
+ */
+void rift_ipc_producer_exited(rift_ipc_ring_t* ring) {
+    if (atomic_fetch_sub(&ring->shared->producers, 1) == 1) {
+        rift_ipc_close(ring);
+    }
+}
+
+/**
+ * @brief Child side of a fork: publish the inherited ring
+ */
+void rift_ipc_enter_child(rift_ipc_ring_t* ring) {
+    g_parent_ring = ring;
+}
+
+/**
+ * @brief Child side of a zygote spawn: map the ring from the passed memfd
+ */
+int rift_ipc_attach(int fd) {
+    rift_ipc_shared_t header;
+    if (pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) {
+        close(fd);
+        return -1;
+    }
+    rift_ipc_ring_t* ring = ipc_map(fd, header.capacity);
+    if (!ring) {
+        close(fd);
+        return -1;
+    }
+    g_parent_ring = ring;
+    return 0;
+}
+
+/**
+ * @brief Child exit path: a normal return releases its own binding
+ */
+void rift_ipc_leave_child(void) {
+    if (g_parent_ring) {
+        rift_ipc_producer_exited(g_parent_ring);
+    }
+}
+
+rift_ipc_ring_t* rift_ipc_parent_ring(void) {
+    return g_parent_ring;
+}
+
+int rift_ipc_fd(const rift_ipc_ring_t* ring) {
+    return ring->fd;
+}
+
+void rift_ipc_get_stats(const rift_ipc_ring_t* ring, rift_ipc_stats_t* stats) {
+    rift_ipc_shared_t* shared = ring->shared;
+    stats->kind = (rift_ipc_kind_t)shared->kind;
+    stats->capacity = ring->capacity;
+    stats->consumer_rift_id = atomic_load(&shared->consumer_rift_id);
+    stats->producer_rift_id = atomic_load(&shared->producer_rift_id);
+    stats->producers = atomic_load(&shared->producers);
+    stats->closed = atomic_load(&shared->closed) != 0;
+    stats->bytes_reserved = atomic_load(&shared->reserve);
+    stats->bytes_consumed = atomic_load(&shared->head);
+    stats->producer_waits = atomic_load(&shared->producer_waits);
+    stats->consumer_waits = atomic_load(&shared->consumer_waits);
+}
@@ -0,0 +1,188 @@
+/**
+ * @file rift_true_ipc.h
+ * @brief Shared-Memory IPC Ring Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_TRUE_IPC_H
+#define RIFT_TRUE_IPC_H
+
+#include "rift_common.h"
+
+#define RIFT_IPC_MAX_CAPACITY (1u << 30)
+
+// IPC operation results
+typedef enum {
+    RIFT_IPC_OK = 0,                      // Message transferred
+    RIFT_IPC_CLOSED = -1,                 // Ring closed (recv: and drained)
+    RIFT_IPC_WOULD_BLOCK = -2,            // Full (send) or empty (recv)
+    RIFT_IPC_TOO_LARGE = -3               // Exceeds ring or receive buffer
+} rift_ipc_status_t;
+
+typedef enum {
+    RIFT_IPC_SPSC,                        // One producer process, one consumer
+    RIFT_IPC_MPSC                         // Many producers, one consumer
+} rift_ipc_kind_t;
+
+// Space claimed by rift_ipc_reserve(), published by rift_ipc_commit()
+typedef struct {
+    uint64_t position;
+    uint32_t size;
+} rift_ipc_slot_t;
+
+// Ring counters, read from the shared header
+typedef struct {
+    rift_ipc_kind_t kind;
+    uint32_t capacity;                    // Record space in bytes
+    uint64_t consumer_rift_id;            // Parent the ring is bound to
+    uint64_t producer_rift_id;            // Most recently bound child
+    uint32_t producers;                   // Bound children still running
+    bool closed;
+    uint64_t bytes_reserved;              // Record bytes claimed (headers included)
+    uint64_t bytes_consumed;              // Record bytes freed by the consumer
+    uint64_t producer_waits;              // Producer sleeps on a full ring
+    uint64_t consumer_waits;              // Consumer sleeps on an empty ring
+} rift_ipc_stats_t;
+
+/**
+ * @brief Create shared ring; bind it to children through policy.ipc_ring
+ * @param kind SPSC (one bound child) or MPSC (any number of producers)
+ * @param capacity Record space in bytes, rounded up to a power-of-two
+ *        number of pages
+ * @return Ring on success, NULL on failure
+ */
+rift_ipc_ring_t* rift_ipc_create(rift_ipc_kind_t kind, uint32_t capacity);
+
+/**
+ * @brief Drop the creator's reference; the mapping lives on until every
+ *        bound process context has been reaped
+ * @param ring Ring to release
+ */
+void rift_ipc_destroy(rift_ipc_ring_t* ring);
+
+/**
+ * @brief Close ring: sends fail with RIFT_IPC_CLOSED, receives drain
+ *        committed messages first
+ * @param ring Ring to close
+ */
+void rift_ipc_close(rift_ipc_ring_t* ring);
+
+/**
+ * @brief Reserve space for a message and write it in place
+ * @param ring Ring to produce into
+ * @param length Payload bytes
+ * @param slot Output reservation for rift_ipc_commit()
+ * @return Payload pointer (8-byte aligned), NULL if closed or too large
+ */
+void* rift_ipc_reserve(rift_ipc_ring_t* ring, uint32_t length, rift_ipc_slot_t* slot);
+
+/**
+ * @brief Publish a reserved message
+ * @param ring Ring the slot was reserved in
+ * @param slot Reservation from rift_ipc_reserve()
+ */
+void rift_ipc_commit(rift_ipc_ring_t* ring, const rift_ipc_slot_t* slot);
+
+/**
+ * @brief Copy message into the ring, waiting while it is full
+ * @param ring Ring to produce into
+ * @param message Payload
+ * @param length Payload bytes
+ * @return RIFT_IPC_OK, RIFT_IPC_CLOSED or RIFT_IPC_TOO_LARGE
+ */
+int rift_ipc_send(rift_ipc_ring_t* ring, const void* message, uint32_t length);
+
+/**
+ * @brief Copy message into the ring without waiting
+ * @return RIFT_IPC_OK, RIFT_IPC_WOULD_BLOCK, RIFT_IPC_CLOSED or
+ *         RIFT_IPC_TOO_LARGE
+ */
+int rift_ipc_try_send(rift_ipc_ring_t* ring, const void* message, uint32_t length);
+
+/**
+ * @brief Read the next message in place, waiting while the ring is empty
+ * @param ring Ring to consume from
+ * @param length Output payload bytes
+ * @return Payload pointer valid until rift_ipc_consume(), NULL once the
+ *         ring is closed and drained
+ */
+const void* rift_ipc_peek(rift_ipc_ring_t* ring, uint32_t* length);
+
+/**
+ * @brief Release the message returned by the last rift_ipc_peek()
+ * @param ring Ring to consume from
+ */
+void rift_ipc_consume(rift_ipc_ring_t* ring);
+
+/**
+ * @brief Copy the next message out, waiting while the ring is empty
+ * @param ring Ring to consume from
+ * @param buffer Destination
+ * @param buffer_size Destination bytes
+ * @param length Output payload bytes (required size on RIFT_IPC_TOO_LARGE)
+ * @return RIFT_IPC_OK, RIFT_IPC_CLOSED or RIFT_IPC_TOO_LARGE
+ */
+int rift_ipc_recv(rift_ipc_ring_t* ring, void* buffer, uint32_t buffer_size, uint32_t* length);
+
+/**
+ * @brief Copy the next message out without waiting
+ * @return RIFT_IPC_OK, RIFT_IPC_WOULD_BLOCK, RIFT_IPC_CLOSED or
+ *         RIFT_IPC_TOO_LARGE
+ */
+int rift_ipc_try_recv(rift_ipc_ring_t* ring, void* buffer, uint32_t buffer_size,
+                      uint32_t* length);
+
+/**
+ * @brief Ring bound to the calling process at spawn
+ * @return Ring in a bound child, NULL otherwise
+ */
+rift_ipc_ring_t* rift_ipc_parent_ring(void);
+
+/**
+ * @brief Get ring counters
+ * @param ring Ring to inspect
+ * @param stats Output statistics
+ */
+void rift_ipc_get_stats(const rift_ipc_ring_t* ring, rift_ipc_stats_t* stats);
+
+/**
+ * @brief Count a process about to be spawned as a producer (spawn internal)
+ * @param ring Ring named by the spawn policy
+ * @param parent_id Consumer RIFT ID
+ * @return 0 on success, -1 if closed or an SPSC ring is already bound
+ */
+int rift_ipc_bind(rift_ipc_ring_t* ring, uint64_t parent_id);
+
+/**
+ * @brief Record the bound child's RIFT ID once registered (spawn internal)
+ */
+void rift_ipc_bind_producer(rift_ipc_ring_t* ring, uint64_t child_id);
+
+/**
+ * @brief Release one producer binding; the last closes the ring
+ */
+void rift_ipc_producer_exited(rift_ipc_ring_t* ring);
+
+/**
+ * @brief Publish an inherited ring in a forked child (spawn internal)
+ */
+void rift_ipc_enter_child(rift_ipc_ring_t* ring);
+
+/**
+ * @brief Map a ring from a memfd passed to a zygote child (spawn internal)
+ * @return 0 on success, -1 on failure
+ */
+int rift_ipc_attach(int fd);
+
+/**
+ * @brief Release the calling child's binding before a normal exit
+ */
+void rift_ipc_leave_child(void);
+
+/**
+ * @brief Memfd backing ring, for passing to another process
+ */
+int rift_ipc_fd(const rift_ipc_ring_t* ring);
+
+#endif // RIFT_TRUE_IPC_H
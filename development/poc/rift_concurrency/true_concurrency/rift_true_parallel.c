@@ -0,0 +1,493 @@
+/**
+ * @file rift_true_parallel.c
+ * @brief RIFT True Concurrency - Parallel-For and Reduce with Lazy Binary Splitting
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * A parallel loop is one governed RIFT task: it is admitted, registered
+ * in telemetry and subject to max_execution_time_ms once, however many
+ * chunks it runs. The calling thread is the first participant; pool
+ * workers join as unregistered units of work, one participant each, so
+ * chunks never pay for a spawn.
+ *
+ * Ranges are divided by lazy binary splitting (Tzannes, Caragea, Barua
+ * and Vishkin, PPoPP 2010): a participant working through a range runs it
+ * grain iterations at a time and, only when its own deque is empty - that
+ * is, when nothing is left for an idle participant to steal - splits the
+ * rest in half and pushes the upper half. A loop nobody steals from
+ * therefore costs one deque check per chunk, while idle participants
+ * always find work near the top of a busy one's deque. Reductions fold
+ * chunks into a private accumulator per participant and join them once
+ * at the end. Each loop reports its iterations, chunks, splits and steals
+ * to telemetry as one aggregate record.
+ */
+
+#include "rift_true_parallel.h"
+#include "rift_telemetry.h"
+#include "rift_deque.h"
+#include "rift_watchdog.h"
+#include "rift_cancel.h"
+#include "rift_quota.h"
+#include "rift_true_concurrency.h"
+#include "rift_true_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <sched.h>
+
+#define RIFT_PARALLEL_SLAB_PIECES 64
+#define RIFT_PARALLEL_AUTO_CHUNKS 64      // Chunks per participant for grain 0
+#define RIFT_PARALLEL_ALIGN 64
+
+// Range split off for thieves; lives in its owner's slab until the loop ends
+typedef struct {
+    int64_t begin;
+    int64_t end;
+} rift_parallel_piece_t;
+
+typedef struct rift_parallel_slab {
+    struct rift_parallel_slab* next;
+    uint32_t used;
+    rift_parallel_piece_t pieces[RIFT_PARALLEL_SLAB_PIECES];
+} rift_parallel_slab_t;
+
+typedef struct {
+    rift_deque_t deque;                   // Split-off pieces, stolen from the top
+    rift_parallel_slab_t* slabs;          // Piece storage, owner allocates only
+    uint64_t rng_state;                   // Victim selection PRNG state
+    void* accumulator;                    // Reduction partial, NULL for loops
+    uint64_t iterations;                  // Written by the owner only
+    uint64_t chunks;
+    uint64_t splits;
+    uint64_t steals;
+} rift_parallel_participant_t;
+
+typedef struct {
+    rift_thread_context_t base_context;   // The governed loop task
+    rift_watchdog_timer_t deadline;       // max_execution_time_ms watchdog
+    rift_parallel_body_t for_body;
+    rift_reduce_body_t reduce_body;
+    void* data;
+    int64_t grain;
+    _Atomic int64_t remaining;            // Iterations not yet run
+    _Atomic uint32_t next_participant;    // Helpers claim participant slots
+    uint32_t participant_count;
+    rift_parallel_participant_t* participants;
+    rift_true_context_t* helpers;         // Pool units, not in the true table
+    uint32_t helper_count;
+    uint8_t* accumulators;
+} rift_parallel_region_t;
+
+typedef struct {
+    _Atomic uint64_t loops;
+    _Atomic uint64_t iterations;
+    _Atomic uint64_t chunks;
+    _Atomic uint64_t splits;
+    _Atomic uint64_t steals;
+    _Atomic uint64_t helpers;
+} rift_parallel_counters_t;
+
+static rift_parallel_counters_t g_parallel_counters;
+
+// =============================================================================
+// LAZY BINARY SPLITTING
+// =============================================================================
+
+static rift_parallel_piece_t* parallel_piece_alloc(rift_parallel_participant_t* self) {
+    rift_parallel_slab_t* slab = self->slabs;
+    if (!slab || slab->used == RIFT_PARALLEL_SLAB_PIECES) {
+        slab = malloc(sizeof(rift_parallel_slab_t));
+        if (!slab) {
+            return NULL;
+        }
+        slab->used = 0;
+        slab->next = self->slabs;
+        self->slabs = slab;
+    }
+    return &slab->pieces[slab->used++];
+}
+
+static uint64_t parallel_next_random(rift_parallel_participant_t* self) {
+    uint64_t x = self->rng_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    self->rng_state = x;
+    return x;
+}
+
+/**
+ * @brief Try every other participant once, starting at a random victim
+ */
+static rift_parallel_piece_t* parallel_steal(rift_parallel_region_t* region,
+                                             rift_parallel_participant_t* self) {
+    uint32_t count = region->participant_count;
+    uint32_t start = (uint32_t)(parallel_next_random(self) % count);
+    for (uint32_t i = 0; i < count; i++) {
+        rift_parallel_participant_t* victim = &region->participants[(start + i) % count];
+        if (victim == self) {
+            continue;
+        }
+        rift_parallel_piece_t* piece = rift_deque_steal(&victim->deque);
+        if (piece) {
+            self->steals++;
+            return piece;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Run [begin, end) grain iterations at a time, splitting off the
+ *        upper half whenever the own deque has run dry
+ */
+static void parallel_run(rift_parallel_region_t* region, rift_parallel_participant_t* self,
+                         int64_t begin, int64_t end) {
+    int64_t executed = 0;
+    while (begin < end && !rift_cancel_requested(&region->base_context.cancel)) {
+        if (end - begin > region->grain && region->participant_count > 1 &&
+            rift_deque_size(&self->deque) == 0) {
+            rift_parallel_piece_t* piece = parallel_piece_alloc(self);
+            if (piece) {
+                int64_t middle = begin + (end - begin) / 2;
+                piece->begin = middle;
+                piece->end = end;
+                if (rift_deque_push(&self->deque, piece) == 0) {
+                    self->splits++;
+                    end = middle;
+                    continue;
+                }
+            }
+        }
+
+        int64_t stop = end - begin > region->grain ? begin + region->grain : end;
+        if (region->reduce_body) {
+            region->reduce_body(begin, stop, region->data, self->accumulator);
+        } else {
+            region->for_body(begin, stop, region->data);
+        }
+        self->chunks++;
+        executed += stop - begin;
+        begin = stop;
+    }
+
+    self->iterations += (uint64_t)executed;
+    atomic_fetch_sub_explicit(&region->remaining, executed, memory_order_release);
+}
+
+/**
+ * @brief Run own and stolen pieces until every iteration has run
+ */
+static void parallel_participate(rift_parallel_region_t* region,
+                                 rift_parallel_participant_t* self) {
+    for (;;) {
+        rift_parallel_piece_t* piece = rift_deque_pop(&self->deque);
+        if (!piece && region->participant_count > 1) {
+            piece = parallel_steal(region, self);
+        }
+        if (piece) {
+            parallel_run(region, self, piece->begin, piece->end);
+            continue;
+        }
+        if (atomic_load_explicit(&region->remaining, memory_order_acquire) <= 0 ||
+            rift_cancel_requested(&region->base_context.cancel)) {
+            return;
+        }
+        sched_yield(); // The rest is being run, and possibly split, elsewhere
+    }
+}
+
+static void parallel_helper_entry(void* arg) {
+    rift_parallel_region_t* region = arg;
+    uint32_t index = atomic_fetch_add(&region->next_participant, 1);
+    // Bodies run as the loop task, not as the anonymous pool unit
+    rift_thread_context_t* outer = rift_current_swap(&region->base_context);
+    parallel_participate(region, &region->participants[index]);
+    rift_current_swap(outer);
+}
+
+static uint32_t parallel_deadline_expired(rift_watchdog_timer_t* timer) {
+    rift_parallel_region_t* region = (rift_parallel_region_t*)((char*)timer -
+                                                               offsetof(rift_parallel_region_t,
+                                                                        deadline));
+    rift_cancel_context(&region->base_context);
+    printf("[WATCHDOG] RIFT ID %lu exceeded %u ms\n",
+           (unsigned long)region->base_context.telemetry.rift_thread_id,
+           region->base_context.policy.max_execution_time_ms);
+    return 0;
+}
+
+// =============================================================================
+// LOOP TASK LIFECYCLE
+// =============================================================================
+
+/**
+ * @brief Admit and register the loop task; NULL if governance refuses it
+ */
+static rift_parallel_region_t* parallel_region_create(uint64_t parent_id,
+                                                      const rift_governance_policy_t* policy,
+                                                      const char* spawn_location) {
+    if (policy->mode == CONCURRENCY_TRUE_PROCESS) {
+        printf("[PARALLEL] Loop rejected: bodies share memory, TRUE_PROCESS unsupported\n");
+        return NULL;
+    }
+    if (!rift_telemetry_validate_spawn(parent_id, policy)) {
+        return NULL;
+    }
+
+    uint32_t depth = rift_telemetry_child_depth(parent_id);
+    if (policy->trace_capped && depth > policy->max_hierarchy_depth) {
+        printf("[PARALLEL] Loop rejected: depth %u exceeds policy limit %u\n",
+               depth, policy->max_hierarchy_depth);
+        return NULL;
+    }
+
+    rift_parallel_region_t* region = calloc(1, sizeof(rift_parallel_region_t));
+    if (!region) {
+        return NULL;
+    }
+    region->base_context.policy = *policy;
+    region->base_context.telemetry.parent_rift_id = parent_id;
+    region->base_context.telemetry.parent_process_id = getpid();
+    region->base_context.telemetry.hierarchy_depth = depth;
+    region->base_context.telemetry.is_daemon = policy->daemon_mode;
+    region->base_context.module_specific_data = region;
+    if (rift_quota_charge(&region->base_context) != 0 ||
+        rift_telemetry_register_spawn(&region->base_context, spawn_location) != 0) {
+        rift_quota_release(&region->base_context);
+        free(region);
+        return NULL;
+    }
+
+    uint64_t rift_id = region->base_context.telemetry.rift_thread_id;
+    region->base_context.policy.rift_id = rift_id;
+    if (parent_id != 0) {
+        rift_telemetry_add_child(parent_id, rift_id, spawn_location);
+    }
+    return region;
+}
+
+/**
+ * @brief Size the participants and queue the pool helpers
+ * @return 0 on success, -1 if storage could not be allocated
+ */
+static int parallel_region_start(rift_parallel_region_t* region, rift_range_t range,
+                                 int64_t grain, const void* identity, size_t result_size) {
+    int64_t total = range.end - range.begin;
+    rift_concurrency_mode_t mode = region->base_context.policy.mode;
+
+    uint32_t helpers = 0;
+    if (mode != CONCURRENCY_SIMULATED && rift_true_pool_init(0) == 0) {
+        rift_true_pool_stats_t pool;
+        rift_true_pool_get_stats(&pool);
+        helpers = pool.worker_count - (rift_true_pool_on_worker() ? 1 : 0);
+    }
+
+    int64_t participants = (int64_t)helpers + 1;
+    region->grain = grain > 0 ? grain : total / (participants * RIFT_PARALLEL_AUTO_CHUNKS);
+    if (region->grain < 1) {
+        region->grain = 1;
+    }
+    int64_t chunks = (total + region->grain - 1) / region->grain;
+    if ((int64_t)helpers > chunks - 1) {
+        helpers = (uint32_t)(chunks - 1);
+    }
+
+    region->helper_count = helpers;
+    region->participant_count = helpers + 1;
+    region->participants = calloc(region->participant_count, sizeof(rift_parallel_participant_t));
+    region->helpers = helpers ? calloc(helpers, sizeof(rift_true_context_t)) : NULL;
+    size_t stride = (result_size + RIFT_PARALLEL_ALIGN - 1) & ~(size_t)(RIFT_PARALLEL_ALIGN - 1);
+    if (result_size > 0) {
+        region->accumulators = aligned_alloc(RIFT_PARALLEL_ALIGN,
+                                             stride * region->participant_count);
+    }
+    if (!region->participants || (helpers && !region->helpers) ||
+        (result_size > 0 && !region->accumulators)) {
+        region->participant_count = 0;
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < region->participant_count; i++) {
+        rift_parallel_participant_t* participant = &region->participants[i];
+        if (rift_deque_init(&participant->deque, 16) != 0) {
+            region->participant_count = i;
+            return -1;
+        }
+        participant->rng_state = 0x9E3779B97F4A7C15ULL * (i + 1);
+        if (result_size > 0) {
+            participant->accumulator = region->accumulators + stride * i;
+            memcpy(participant->accumulator, identity, result_size);
+        }
+    }
+    atomic_init(&region->remaining, total);
+    atomic_init(&region->next_participant, 1); // The caller is participant 0
+
+    // Cancelling the spawning task stops the loop at the next chunk
+    rift_cancel_attach(&region->base_context, NULL);
+    if (region->base_context.policy.max_execution_time_ms > 0) {
+        rift_watchdog_arm(&region->deadline, region->base_context.policy.max_execution_time_ms,
+                          parallel_deadline_expired);
+    }
+
+    if (helpers > 0) {
+        rift_true_context_t* units[RIFT_TRUE_POOL_MAX_WORKERS];
+        for (uint32_t i = 0; i < helpers; i++) {
+            rift_true_context_t* helper = &region->helpers[i];
+            atomic_init(&helper->lifecycle, TRUE_TASK_STARTING);
+            helper->pooled = true;
+            helper->base_context.policy.mode = CONCURRENCY_TRUE_THREAD;
+            helper->work_function = parallel_helper_entry;
+            helper->work_data = region;
+            units[i] = helper;
+        }
+        rift_true_pool_submit_batch(units, helpers);
+    }
+    return 0;
+}
+
+/**
+ * @brief Wait for queued helpers; late ones find no work and return at once
+ */
+static void parallel_region_join(rift_parallel_region_t* region) {
+    for (uint32_t i = 0; i < region->helper_count; i++) {
+        rift_true_context_t* helper = &region->helpers[i];
+        while ((atomic_load_explicit(&helper->lifecycle, memory_order_acquire) &
+                TRUE_LIFECYCLE_STATE_MASK) != TRUE_TASK_FINISHED) {
+            if (!rift_true_pool_help()) {
+                sched_yield();
+            }
+        }
+    }
+    rift_watchdog_disarm(&region->deadline);
+}
+
+/**
+ * @brief Report the aggregate of a loop that ran and release it
+ */
+static void parallel_region_destroy(rift_parallel_region_t* region, bool ran) {
+    uint64_t iterations = 0, chunks = 0, splits = 0, steals = 0;
+    for (uint32_t i = 0; i < region->participant_count; i++) {
+        rift_parallel_participant_t* participant = &region->participants[i];
+        iterations += participant->iterations;
+        chunks += participant->chunks;
+        splits += participant->splits;
+        steals += participant->steals;
+        rift_deque_destroy(&participant->deque);
+        while (participant->slabs) {
+            rift_parallel_slab_t* next = participant->slabs->next;
+            free(participant->slabs);
+            participant->slabs = next;
+        }
+    }
+
+    uint64_t rift_id = region->base_context.telemetry.rift_thread_id;
+    if (ran) {
+        atomic_fetch_add_explicit(&g_parallel_counters.loops, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_parallel_counters.iterations, iterations,
+                                  memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_parallel_counters.chunks, chunks, memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_parallel_counters.splits, splits, memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_parallel_counters.steals, steals, memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_parallel_counters.helpers, region->helper_count,
+                                  memory_order_relaxed);
+        rift_telemetry_record_parallel(rift_id, iterations, chunks, splits, steals);
+    }
+    rift_cancel_detach(&region->base_context);
+    rift_telemetry_unregister(rift_id);
+    rift_quota_release(&region->base_context);
+
+    free(region->participants);
+    free(region->helpers);
+    free(region->accumulators);
+    free(region);
+}
+
+/**
+ * @brief Shared body of rift_parallel_for() and rift_parallel_reduce()
+ */
+static int parallel_loop(uint64_t parent_id, const rift_governance_policy_t* policy,
+                         rift_range_t range, int64_t grain, rift_parallel_body_t for_body,
+                         rift_reduce_body_t reduce_body, rift_reduce_join_t join,
+                         const void* identity, size_t result_size, void* data, void* result,
+                         const char* spawn_location) {
+    if (result_size > 0) {
+        memcpy(result, identity, result_size);
+    }
+    if (range.end <= range.begin) {
+        return 0;
+    }
+
+    rift_parallel_region_t* region = parallel_region_create(parent_id, policy, spawn_location);
+    if (!region) {
+        return -1;
+    }
+    region->for_body = for_body;
+    region->reduce_body = reduce_body;
+    region->data = data;
+
+    if (parallel_region_start(region, range, grain, identity, result_size) != 0) {
+        fprintf(stderr, "[PARALLEL] Loop setup failed for RIFT ID %lu\n",
+                (unsigned long)region->base_context.telemetry.rift_thread_id);
+        parallel_region_destroy(region, false);
+        return -1;
+    }
+
+    rift_thread_context_t* outer = rift_current_swap(&region->base_context);
+    parallel_run(region, &region->participants[0], range.begin, range.end);
+    parallel_participate(region, &region->participants[0]);
+    rift_current_swap(outer);
+    parallel_region_join(region);
+
+    int status = rift_cancel_requested(&region->base_context.cancel) ? -1 : 0;
+    if (result_size > 0) {
+        for (uint32_t i = 0; i < region->participant_count; i++) {
+            if (region->participants[i].iterations > 0) {
+                join(result, region->participants[i].accumulator, data);
+            }
+        }
+    }
+    parallel_region_destroy(region, true);
+    return status;
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+int rift_parallel_for(uint64_t parent_id, const rift_governance_policy_t* policy,
+                      rift_range_t range, int64_t grain, rift_parallel_body_t body, void* data,
+                      const char* spawn_location) {
+    if (!policy || !body || !spawn_location) {
+        return -1;
+    }
+    return parallel_loop(parent_id, policy, range, grain, body, NULL, NULL, NULL, 0, data, NULL,
+                         spawn_location);
+}
+
+int rift_parallel_reduce(uint64_t parent_id, const rift_governance_policy_t* policy,
+                         rift_range_t range, int64_t grain, rift_reduce_body_t body,
+                         rift_reduce_join_t join, const void* identity, size_t result_size,
+                         void* data, void* result, const char* spawn_location) {
+    if (!policy || !body || !join || !identity || result_size == 0 || !result ||
+        !spawn_location) {
+        return -1;
+    }
+    return parallel_loop(parent_id, policy, range, grain, NULL, body, join, identity, result_size,
+                         data, result, spawn_location);
+}
+
+void rift_parallel_get_stats(rift_parallel_stats_t* stats) {
+    if (!stats) {
+        return;
+    }
+    stats->loops = atomic_load_explicit(&g_parallel_counters.loops, memory_order_relaxed);
+    stats->iterations = atomic_load_explicit(&g_parallel_counters.iterations,
+                                             memory_order_relaxed);
+    stats->chunks = atomic_load_explicit(&g_parallel_counters.chunks, memory_order_relaxed);
+    stats->splits = atomic_load_explicit(&g_parallel_counters.splits, memory_order_relaxed);
+    stats->steals = atomic_load_explicit(&g_parallel_counters.steals, memory_order_relaxed);
+    stats->helpers = atomic_load_explicit(&g_parallel_counters.helpers, memory_order_relaxed);
+}
@@ -0,0 +1,100 @@
+/**
+ * @file rift_true_parallel.h
+ * @brief Parallel Loop Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_TRUE_PARALLEL_H
+#define RIFT_TRUE_PARALLEL_H
+
+#include "rift_common.h"
+
+// Half-open iteration range [begin, end)
+typedef struct {
+    int64_t begin;
+    int64_t end;
+} rift_range_t;
+
+/**
+ * @brief Loop body over one chunk [begin, end) of the range
+ */
+typedef void (*rift_parallel_body_t)(int64_t begin, int64_t end, void* data);
+
+/**
+ * @brief Reduction body: fold chunk [begin, end) into the participant's
+ *        accumulator
+ */
+typedef void (*rift_reduce_body_t)(int64_t begin, int64_t end, void* data, void* accumulator);
+
+/**
+ * @brief Combine a participant's partial result into accumulator; must be
+ *        associative and commutative
+ */
+typedef void (*rift_reduce_join_t)(void* accumulator, const void* partial, void* data);
+
+// Aggregate parallel loop statistics
+typedef struct {
+    uint64_t loops;                       // Loops run
+    uint64_t iterations;                  // Iterations executed
+    uint64_t chunks;                      // Body invocations
+    uint64_t splits;                      // Lazy splits pushed for thieves
+    uint64_t steals;                      // Ranges run by another participant
+    uint64_t helpers;                     // Pool units that joined a loop
+} rift_parallel_stats_t;
+
+// Spawn-location helpers: RIFT_PARALLEL_FOR(0, &policy, range, 0, body, data)
+#define RIFT_PARALLEL_FOR(parent_id, policy, range, grain, body, data) \
+    rift_parallel_for((parent_id), (policy), (range), (grain), (body), (data), __func__)
+#define RIFT_PARALLEL_REDUCE(parent_id, policy, range, grain, body, join, identity, result_size, \
+                             data, result) \
+    rift_parallel_reduce((parent_id), (policy), (range), (grain), (body), (join), (identity), \
+                         (result_size), (data), (result), __func__)
+
+/**
+ * @brief Run body over range as one governed RIFT task; the calling thread
+ *        takes part and pool workers join it through lazy binary splitting
+ * @param parent_id Parent RIFT ID of the loop task (0 for root)
+ * @param policy Governance policy; TRUE_THREAD and HYBRID run on the
+ *        worker pool, SIMULATED on the caller alone, TRUE_PROCESS is refused
+ * @param range Iterations to run
+ * @param grain Smallest chunk handed to body (0 picks one from the range)
+ * @param body Loop body
+ * @param data Passed to body
+ * @param spawn_location Spawn location of the loop task
+ * @return 0 when every iteration ran, -1 if refused or stopped by its
+ *         max_execution_time_ms deadline
+ */
+int rift_parallel_for(uint64_t parent_id, const rift_governance_policy_t* policy,
+                      rift_range_t range, int64_t grain, rift_parallel_body_t body, void* data,
+                      const char* spawn_location);
+
+/**
+ * @brief Reduce range as one governed RIFT task; every participant folds
+ *        its chunks into a private accumulator started from identity
+ * @param parent_id Parent RIFT ID of the loop task (0 for root)
+ * @param policy Governance policy, as for rift_parallel_for()
+ * @param range Iterations to reduce
+ * @param grain Smallest chunk handed to body (0 picks one from the range)
+ * @param body Reduction body
+ * @param join Combines partial results
+ * @param identity Identity element of join (result_size bytes)
+ * @param result_size Size of the accumulator in bytes
+ * @param data Passed to body and join
+ * @param result Output accumulator (result_size bytes)
+ * @param spawn_location Spawn location of the loop task
+ * @return 0 when every iteration ran, -1 if refused or stopped by its
+ *         max_execution_time_ms deadline
+ */
+int rift_parallel_reduce(uint64_t parent_id, const rift_governance_policy_t* policy,
+                         rift_range_t range, int64_t grain, rift_reduce_body_t body,
+                         rift_reduce_join_t join, const void* identity, size_t result_size,
+                         void* data, void* result, const char* spawn_location);
+
+/**
+ * @brief Get parallel loop statistics
+ * @param stats Output statistics
+ */
+void rift_parallel_get_stats(rift_parallel_stats_t* stats);
+
+#endif // RIFT_TRUE_PARALLEL_H
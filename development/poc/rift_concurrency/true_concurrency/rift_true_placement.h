@@ -0,0 +1,61 @@
+/**
+ * @file rift_true_placement.h
+ * @brief CPU and NUMA Placement Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_TRUE_PLACEMENT_H
+#define RIFT_TRUE_PLACEMENT_H
+
+#include "rift_common.h"
+
+#define RIFT_PLACEMENT_MAX_NODES 64
+
+// Placement resolved at spawn time and applied on the new thread/process
+typedef struct {
+    bool active;                    // Anything to apply
+    bool bind_memory;               // MPOL_BIND instead of MPOL_PREFERRED
+    int32_t node;                   // Target NUMA node, -1 for CPU set only
+    int32_t parent_node;            // Spawner's node for local/remote accounting
+    cpu_set_t cpus;                 // Effective CPU set
+} rift_true_placement_t;
+
+/**
+ * @brief Whether policy asks for any CPU or NUMA placement
+ * @param policy Governance policy
+ * @return true if placement fields are set
+ */
+bool rift_true_placement_requested(const rift_governance_policy_t* policy);
+
+/**
+ * @brief Resolve policy placement into a target node and CPU set
+ * @param parent_id Parent RIFT thread ID (for PLACEMENT_NEAR_PARENT)
+ * @param policy Governance policy
+ * @param placement Output placement
+ * @return 0 on success, -1 if the policy names an unknown node or no CPUs
+ */
+int rift_true_placement_resolve(uint64_t parent_id, const rift_governance_policy_t* policy,
+                                rift_true_placement_t* placement);
+
+/**
+ * @brief Apply placement to the calling thread (sched_setaffinity and
+ *        set_mempolicy)
+ * @param placement Resolved placement
+ * @return 0 on success, -1 if the CPU affinity could not be set
+ */
+int rift_true_placement_apply(const rift_true_placement_t* placement);
+
+/**
+ * @brief NUMA node of the CPU the caller is running on
+ * @return Node ID (0 on single-node systems)
+ */
+int32_t rift_true_placement_current_node(void);
+
+/**
+ * @brief Number of NUMA nodes with CPUs
+ * @return Node count (at least 1)
+ */
+uint32_t rift_true_placement_node_count(void);
+
+#endif // RIFT_TRUE_PLACEMENT_H
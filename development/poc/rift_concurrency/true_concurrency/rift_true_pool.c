@@ -0,0 +1,682 @@
+/**
+ * @file rift_true_pool.c
+ * @brief RIFT True Concurrency - Persistent Work-Stealing Worker Pool
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Runs TRUE_THREAD tasks as units of work on long-lived worker threads
+ * instead of creating a pthread per task. Each task keeps its own RIFT ID,
+ * telemetry entry and lifecycle state; only the OS thread is shared.
+ *
+ * Each worker owns a Chase-Lev deque. Spawns from inside a pooled task go
+ * to the spawning worker's deque and are executed LIFO, so a task's most
+ * recent children run next while their data is still in cache; spawns from
+ * outside the pool go to a shared injection queue. Idle workers steal the
+ * oldest work from randomly chosen victims.
+ *
+ * Tasks with a deadline (SCHEDULE_EDF, or inherited) skip the deques: they
+ * wait in one shared deadline heap that every worker checks first, and are
+ * admitted against the runtime already claimed there (rift_edf.c). A
+ * deadline task waiting for a child still in the heap lends it its
+ * deadline; batch work already in a deque cannot be reordered.
+ *
+ * A spawn whose policy sets max_queued is held before its context exists
+ * while that many units are queued: a worker runs queued work until there
+ * is room, any other thread sleeps until workers make it; fail-fast spawns
+ * are refused and caller-runs spawns execute on the spawning thread.
+ *
+ * A worker waiting in rift_true_wait() keeps executing queued work so a
+ * task that waits for its own children cannot starve the pool. Tasks that
+ * block on anything else for long periods should set dedicated_thread.
+ */
+
+#include "rift_true_pool.h"
+#include "rift_telemetry.h"
+#include "rift_deque.h"
+#include "rift_edf.h"
+#include "rift_signal.h"
+#include "rift_true_concurrency.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sched.h>
+
+// =============================================================================
+// POOL STATE
+// =============================================================================
+
+typedef struct {
+    rift_deque_t deque;                 // Local work-stealing deque
+    pthread_t thread;                   // Worker thread handle
+    uint64_t rng_state;                 // Victim selection PRNG state
+    _Atomic uint64_t executed;          // Units of work run on this worker
+    _Atomic uint64_t helped;            // Run inline while waiting
+    _Atomic uint64_t local_pushes;      // Spawns queued on own deque
+    _Atomic uint64_t steals;            // Successful steals from peers
+} rift_true_worker_t;
+
+typedef struct {
+    rift_true_worker_t* workers;
+    uint32_t worker_count;
+
+    // Injection queue for spawns from non-worker threads
+    rift_true_context_t* inject_head;
+    rift_true_context_t* inject_tail;
+    pthread_mutex_t inject_mutex;
+    _Atomic int64_t inject_pending;
+
+    // Deadline heap, served before the deques and the injection queue
+    rift_edf_queue_t edf_queue;
+    pthread_mutex_t edf_mutex;
+    _Atomic int64_t edf_pending;
+    _Atomic uint64_t edf_submitted;
+    rift_edf_ledger_t edf_ledger;       // EDF admission claims across the workers
+
+    // Queued units across all deques and the injection queue
+    _Atomic int64_t queued;
+    _Atomic int64_t queued_peak;
+    _Atomic uint64_t submitted;
+
+    // Idle parking and spawns blocked at max_queued
+    pthread_mutex_t idle_mutex;
+    pthread_cond_t idle_condition;
+    pthread_cond_t space_condition;
+    _Atomic uint32_t idle_workers;
+    _Atomic uint32_t blocked_spawners;
+
+    _Atomic bool shutdown;
+    _Atomic bool initialized;
+    pthread_mutex_t lifecycle_mutex;    // Serializes lazy start and cleanup
+} rift_true_pool_t;
+
+static rift_true_pool_t g_true_pool = {
+    .inject_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .edf_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .edf_ledger = { .runners = 1, .mutex = PTHREAD_MUTEX_INITIALIZER },
+    .idle_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .idle_condition = PTHREAD_COND_INITIALIZER,
+    .space_condition = PTHREAD_COND_INITIALIZER,
+    .lifecycle_mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+static void pool_stop_locked(void);
+
+static __thread rift_true_worker_t* t_true_worker = NULL;
+
+// =============================================================================
+// QUEUEING AND WAKEUP
+// =============================================================================
+
+/**
+ * @brief Account for newly queued units and track the peak depth
+ */
+static void pool_count_queued(uint32_t count) {
+    int64_t depth = atomic_fetch_add(&g_true_pool.queued, count) + count;
+    int64_t peak = atomic_load_explicit(&g_true_pool.queued_peak, memory_order_relaxed);
+    while (depth > peak &&
+           !atomic_compare_exchange_weak_explicit(&g_true_pool.queued_peak, &peak, depth,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+    atomic_fetch_add_explicit(&g_true_pool.submitted, count, memory_order_relaxed);
+}
+
+/**
+ * @brief Wake up to count parked workers
+ */
+static void pool_notify(uint32_t count) {
+    uint32_t idle = atomic_load(&g_true_pool.idle_workers);
+    if (idle == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_true_pool.idle_mutex);
+    if (count >= idle) {
+        pthread_cond_broadcast(&g_true_pool.idle_condition);
+    } else {
+        for (uint32_t i = 0; i < count; i++) {
+            pthread_cond_signal(&g_true_pool.idle_condition);
+        }
+    }
+    pthread_mutex_unlock(&g_true_pool.idle_mutex);
+}
+
+/**
+ * @brief Wake spawners blocked at max_queued after a unit left the queue
+ */
+static void pool_notify_space(void) {
+    if (atomic_load(&g_true_pool.blocked_spawners) == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&g_true_pool.idle_mutex);
+    pthread_cond_broadcast(&g_true_pool.space_condition);
+    pthread_mutex_unlock(&g_true_pool.idle_mutex);
+}
+
+/**
+ * @brief Splice a pre-linked chain onto the injection queue
+ */
+static void pool_inject_chain(rift_true_context_t* head, rift_true_context_t* tail,
+                              uint32_t count) {
+    tail->next = NULL;
+
+    pthread_mutex_lock(&g_true_pool.inject_mutex);
+    if (g_true_pool.inject_tail) {
+        g_true_pool.inject_tail->next = head;
+    } else {
+        g_true_pool.inject_head = head;
+    }
+    g_true_pool.inject_tail = tail;
+    atomic_fetch_add(&g_true_pool.inject_pending, count);
+    pthread_mutex_unlock(&g_true_pool.inject_mutex);
+}
+
+static rift_true_context_t* pool_inject_pop(void) {
+    if (atomic_load(&g_true_pool.inject_pending) <= 0) {
+        return NULL; // Fast path: skip the lock when nothing is injected
+    }
+
+    pthread_mutex_lock(&g_true_pool.inject_mutex);
+    rift_true_context_t* context = g_true_pool.inject_head;
+    if (context) {
+        g_true_pool.inject_head = context->next;
+        if (!g_true_pool.inject_head) {
+            g_true_pool.inject_tail = NULL;
+        }
+        context->next = NULL;
+        atomic_fetch_sub(&g_true_pool.inject_pending, 1);
+    }
+    pthread_mutex_unlock(&g_true_pool.inject_mutex);
+    return context;
+}
+
+/**
+ * @brief Queue the leading contexts that have a deadline on the heap
+ * @return Number queued; the rest take the deque/injection path
+ */
+static uint32_t pool_edf_push(rift_true_context_t** contexts, uint32_t count) {
+    uint32_t queued = 0;
+    pthread_mutex_lock(&g_true_pool.edf_mutex);
+    while (queued < count) {
+        uint64_t deadline_ns = contexts[queued]->base_context.telemetry.deadline_ns;
+        if (deadline_ns == 0 ||
+            rift_edf_queue_push(&g_true_pool.edf_queue, contexts[queued], deadline_ns) != 0) {
+            break;
+        }
+        queued++;
+    }
+    atomic_fetch_add(&g_true_pool.edf_pending, queued);
+    pthread_mutex_unlock(&g_true_pool.edf_mutex);
+    atomic_fetch_add_explicit(&g_true_pool.edf_submitted, queued, memory_order_relaxed);
+    return queued;
+}
+
+static rift_true_context_t* pool_edf_pop(void) {
+    if (atomic_load(&g_true_pool.edf_pending) <= 0) {
+        return NULL; // Fast path: no deadline work
+    }
+
+    pthread_mutex_lock(&g_true_pool.edf_mutex);
+    rift_true_context_t* context = rift_edf_queue_pop(&g_true_pool.edf_queue);
+    if (context) {
+        atomic_fetch_sub(&g_true_pool.edf_pending, 1);
+    }
+    pthread_mutex_unlock(&g_true_pool.edf_mutex);
+    return context;
+}
+
+static uint64_t pool_next_random(rift_true_worker_t* worker) {
+    // xorshift64 - cheap victim selection, quality is irrelevant here
+    uint64_t x = worker->rng_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    worker->rng_state = x;
+    return x;
+}
+
+/**
+ * @brief Try every peer once, starting at a random victim
+ */
+static rift_true_context_t* pool_steal(rift_true_worker_t* self) {
+    uint32_t count = g_true_pool.worker_count;
+    if (count < 2) {
+        return NULL;
+    }
+
+    uint32_t start = (uint32_t)(pool_next_random(self) % count);
+    for (uint32_t i = 0; i < count; i++) {
+        rift_true_worker_t* victim = &g_true_pool.workers[(start + i) % count];
+        if (victim == self) {
+            continue;
+        }
+
+        rift_true_context_t* context = rift_deque_steal(&victim->deque);
+        if (context) {
+            atomic_fetch_add_explicit(&self->steals, 1, memory_order_relaxed);
+            return context;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Next unit for worker: earliest deadline, own deque (LIFO),
+ *        injected work, then steal
+ */
+static rift_true_context_t* pool_find_work(rift_true_worker_t* worker) {
+    rift_true_context_t* context = pool_edf_pop();
+    if (!context) {
+        context = rift_deque_pop(&worker->deque);
+    }
+    if (!context) {
+        context = pool_inject_pop();
+    }
+    if (!context) {
+        context = pool_steal(worker);
+    }
+    if (context) {
+        atomic_fetch_sub(&g_true_pool.queued, 1);
+        pool_notify_space();
+    }
+    return context;
+}
+
+/**
+ * @brief Park until work is queued or the pool shuts down
+ */
+static void pool_park(void) {
+    pthread_mutex_lock(&g_true_pool.idle_mutex);
+    atomic_fetch_add(&g_true_pool.idle_workers, 1);
+
+    // Recheck after advertising idleness so a concurrent submit cannot be lost
+    if (atomic_load(&g_true_pool.queued) <= 0 && !atomic_load(&g_true_pool.shutdown)) {
+        pthread_cond_wait(&g_true_pool.idle_condition, &g_true_pool.idle_mutex);
+    }
+
+    atomic_fetch_sub(&g_true_pool.idle_workers, 1);
+    pthread_mutex_unlock(&g_true_pool.idle_mutex);
+}
+
+// =============================================================================
+// WORKER EXECUTION
+// =============================================================================
+
+static void* pool_worker_main(void* arg) {
+    rift_true_worker_t* worker = (rift_true_worker_t*)arg;
+    t_true_worker = worker;
+    rift_signal_block_thread();
+
+    for (;;) {
+        rift_true_context_t* context = pool_find_work(worker);
+        if (!context) {
+            // Shutdown drains: exit only once nothing is queued anywhere
+            if (atomic_load(&g_true_pool.queued) <= 0) {
+                if (atomic_load_explicit(&g_true_pool.shutdown, memory_order_acquire)) {
+                    break;
+                }
+                pool_park();
+            } else {
+                sched_yield(); // Queued work is mid-push or held by a thief
+            }
+            continue;
+        }
+
+        rift_true_execute(context);
+        atomic_fetch_add_explicit(&worker->executed, 1, memory_order_relaxed);
+    }
+
+    t_true_worker = NULL;
+    return NULL;
+}
+
+// =============================================================================
+// PUBLIC API
+// =============================================================================
+
+/**
+ * @brief Start persistent worker pool
+ */
+int rift_true_pool_init(uint32_t worker_count) {
+    if (atomic_load(&g_true_pool.initialized)) {
+        return 0; // Fast path for the lazy start on every pooled spawn
+    }
+
+    pthread_mutex_lock(&g_true_pool.lifecycle_mutex);
+    if (atomic_load(&g_true_pool.initialized)) {
+        pthread_mutex_unlock(&g_true_pool.lifecycle_mutex);
+        return 0;
+    }
+
+    if (worker_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        worker_count = online > 0 ? (uint32_t)online : 1;
+    }
+    if (worker_count > RIFT_TRUE_POOL_MAX_WORKERS) {
+        worker_count = RIFT_TRUE_POOL_MAX_WORKERS;
+    }
+
+    g_true_pool.workers = calloc(worker_count, sizeof(rift_true_worker_t));
+    if (!g_true_pool.workers) {
+        pthread_mutex_unlock(&g_true_pool.lifecycle_mutex);
+        return -1;
+    }
+
+    g_true_pool.inject_head = NULL;
+    g_true_pool.inject_tail = NULL;
+    atomic_store(&g_true_pool.inject_pending, 0);
+    atomic_store(&g_true_pool.edf_pending, 0);
+    atomic_store(&g_true_pool.edf_submitted, 0);
+    rift_edf_ledger_reset(&g_true_pool.edf_ledger, worker_count);
+    atomic_store(&g_true_pool.queued, 0);
+    atomic_store(&g_true_pool.queued_peak, 0);
+    atomic_store(&g_true_pool.submitted, 0);
+    atomic_store(&g_true_pool.idle_workers, 0);
+    atomic_store(&g_true_pool.blocked_spawners, 0);
+    atomic_store(&g_true_pool.shutdown, false);
+
+    for (uint32_t i = 0; i < worker_count; i++) {
+        rift_true_worker_t* worker = &g_true_pool.workers[i];
+        worker->rng_state = 0x9E3779B97F4A7C15ULL * (i + 1);
+        if (rift_deque_init(&worker->deque, 64) != 0) {
+            for (uint32_t j = 0; j < i; j++) {
+                rift_deque_destroy(&g_true_pool.workers[j].deque);
+            }
+            free(g_true_pool.workers);
+            g_true_pool.workers = NULL;
+            pthread_mutex_unlock(&g_true_pool.lifecycle_mutex);
+            return -1;
+        }
+    }
+
+    // Thieves index the worker array, so its size is fixed before any start
+    g_true_pool.worker_count = worker_count;
+    for (uint32_t i = 0; i < worker_count; i++) {
+        if (pthread_create(&g_true_pool.workers[i].thread, NULL, pool_worker_main,
+                           &g_true_pool.workers[i]) != 0) {
+            fprintf(stderr, "[POOL] Failed to start worker %u\n", i);
+            g_true_pool.worker_count = i;
+            pool_stop_locked();
+            for (uint32_t j = i; j < worker_count; j++) {
+                rift_deque_destroy(&g_true_pool.workers[j].deque);
+            }
+            free(g_true_pool.workers);
+            g_true_pool.workers = NULL;
+            pthread_mutex_unlock(&g_true_pool.lifecycle_mutex);
+            return -1;
+        }
+    }
+
+    atomic_store(&g_true_pool.initialized, true);
+    pthread_mutex_unlock(&g_true_pool.lifecycle_mutex);
+    printf("[POOL] Worker pool started - %u work-stealing workers\n", worker_count);
+    return 0;
+}
+
+void rift_true_pool_submit(rift_true_context_t* context) {
+    rift_true_pool_submit_batch(&context, 1);
+}
+
+/**
+ * @brief Queue contexts with a deadline on the deadline heap, the rest on
+ *        the caller's deque when it is a worker, else on the injection
+ *        queue, and wake as many idle workers as units queued
+ */
+void rift_true_pool_submit_batch(rift_true_context_t** contexts, uint32_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    rift_true_worker_t* worker = t_true_worker;
+    pool_count_queued(count);
+
+    // A batch shares one deadline, so it is usually all or nothing
+    uint32_t pushed = 0;
+    if (contexts[0]->base_context.telemetry.deadline_ns != 0) {
+        pushed = pool_edf_push(contexts, count);
+    }
+    if (worker) {
+        uint32_t first = pushed;
+        while (pushed < count && rift_deque_push(&worker->deque, contexts[pushed]) == 0) {
+            pushed++;
+        }
+        atomic_fetch_add_explicit(&worker->local_pushes, pushed - first, memory_order_relaxed);
+    }
+
+    if (pushed < count) {
+        for (uint32_t i = pushed; i + 1 < count; i++) {
+            contexts[i]->next = contexts[i + 1];
+        }
+        pool_inject_chain(contexts[pushed], contexts[count - 1], count - pushed);
+    }
+
+    pool_notify(count);
+}
+
+static uint64_t pool_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Whether count more units fit under the bound; a batch larger than
+ *        the bound is let in once nothing is queued
+ */
+static bool pool_has_room(uint32_t count, uint32_t max_queued) {
+    int64_t depth = atomic_load(&g_true_pool.queued);
+    return depth <= 0 || depth + count <= max_queued;
+}
+
+/**
+ * @brief Hold a spawn at the pool's bound according to its policy
+ */
+int rift_true_pool_throttle(const rift_governance_policy_t* policy, uint32_t count) {
+    if (policy->max_queued == 0 || pool_has_room(count, policy->max_queued)) {
+        return 0;
+    }
+
+    int64_t queued = atomic_load(&g_true_pool.queued);
+    uint32_t depth = queued > 0 ? (uint32_t)queued : 0;
+    if (policy->overflow_policy == OVERFLOW_FAIL_FAST) {
+        printf("[POOL] Spawn rejected: queue full (%u/%u)\n", depth, policy->max_queued);
+        rift_telemetry_record_backpressure(OVERFLOW_FAIL_FAST, depth, policy->max_queued, 0);
+        return -1;
+    }
+    if (policy->overflow_policy == OVERFLOW_CALLER_RUNS) {
+        rift_telemetry_record_backpressure(OVERFLOW_CALLER_RUNS, depth, policy->max_queued, 0);
+        return 1;
+    }
+
+    uint64_t start = pool_now_ns();
+    if (t_true_worker) {
+        // Sleeping here could leave no worker to drain the queue
+        while (!pool_has_room(count, policy->max_queued)) {
+            if (!rift_true_pool_help()) {
+                sched_yield();
+            }
+        }
+    } else {
+        pthread_mutex_lock(&g_true_pool.idle_mutex);
+        atomic_fetch_add(&g_true_pool.blocked_spawners, 1);
+        while (!pool_has_room(count, policy->max_queued) &&
+               !atomic_load(&g_true_pool.shutdown)) {
+            pthread_cond_wait(&g_true_pool.space_condition, &g_true_pool.idle_mutex);
+        }
+        atomic_fetch_sub(&g_true_pool.blocked_spawners, 1);
+        pthread_mutex_unlock(&g_true_pool.idle_mutex);
+    }
+    rift_telemetry_record_backpressure(OVERFLOW_BLOCK, depth, policy->max_queued,
+                                       pool_now_ns() - start);
+    return 0;
+}
+
+/**
+ * @brief Admit context against the claims of deadline work on the pool
+ */
+int rift_true_pool_admit(rift_true_context_t* context) {
+    return rift_edf_admit(&g_true_pool.edf_ledger, context,
+                          context->base_context.telemetry.deadline_ns,
+                          (uint64_t)context->base_context.policy.expected_runtime_ms * 1000000ull);
+}
+
+void rift_true_pool_release(rift_true_context_t* context) {
+    if (context->base_context.telemetry.deadline_ns != 0 &&
+        context->base_context.policy.expected_runtime_ms != 0) {
+        rift_edf_release(&g_true_pool.edf_ledger, context);
+    }
+}
+
+/**
+ * @brief Lend a waiter's deadline to a context still on the deadline heap
+ */
+bool rift_true_pool_boost(rift_true_context_t* context, uint64_t deadline_ns) {
+    if (deadline_ns == 0 || atomic_load(&g_true_pool.edf_pending) <= 0) {
+        return false;
+    }
+
+    pthread_mutex_lock(&g_true_pool.edf_mutex);
+    bool queued = rift_edf_queue_boost(&g_true_pool.edf_queue, context, deadline_ns);
+    // Not popped yet, so no worker reads the deadline concurrently
+    bool moved = queued && deadline_ns < context->base_context.telemetry.deadline_ns;
+    if (moved) {
+        context->base_context.telemetry.deadline_ns = deadline_ns;
+    }
+    pthread_mutex_unlock(&g_true_pool.edf_mutex);
+
+    if (moved) {
+        rift_telemetry_set_deadline(context->base_context.telemetry.rift_thread_id, deadline_ns);
+    }
+    return queued;
+}
+
+/**
+ * @brief Execute one queued unit of work on a waiting worker
+ */
+bool rift_true_pool_help(void) {
+    rift_true_worker_t* worker = t_true_worker;
+    if (!worker) {
+        return false;
+    }
+
+    rift_true_context_t* context = pool_find_work(worker);
+    if (!context) {
+        return false;
+    }
+
+    rift_true_execute(context);
+    atomic_fetch_add_explicit(&worker->executed, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&worker->helped, 1, memory_order_relaxed);
+    return true;
+}
+
+bool rift_true_pool_on_worker(void) {
+    return t_true_worker != NULL;
+}
+
+void rift_true_pool_get_stats(rift_true_pool_stats_t* stats) {
+    if (!stats) {
+        return;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    pthread_mutex_lock(&g_true_pool.lifecycle_mutex);
+    stats->worker_count = g_true_pool.worker_count;
+    for (uint32_t i = 0; i < g_true_pool.worker_count; i++) {
+        rift_true_worker_t* worker = &g_true_pool.workers[i];
+        stats->tasks_executed += atomic_load_explicit(&worker->executed, memory_order_relaxed);
+        stats->tasks_helped += atomic_load_explicit(&worker->helped, memory_order_relaxed);
+        stats->tasks_local += atomic_load_explicit(&worker->local_pushes, memory_order_relaxed);
+        stats->tasks_stolen += atomic_load_explicit(&worker->steals, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&g_true_pool.lifecycle_mutex);
+
+    int64_t depth = atomic_load(&g_true_pool.queued);
+    stats->tasks_submitted = atomic_load_explicit(&g_true_pool.submitted, memory_order_relaxed);
+    stats->tasks_deadline = atomic_load_explicit(&g_true_pool.edf_submitted,
+                                                 memory_order_relaxed);
+    stats->queue_depth = depth > 0 ? (uint32_t)depth : 0;
+    stats->queue_depth_peak = (uint32_t)atomic_load(&g_true_pool.queued_peak);
+}
+
+/**
+ * @brief Stop workers after they drain queued work; caller holds
+ *        lifecycle_mutex
+ */
+static void pool_stop_locked(void) {
+    pthread_mutex_lock(&g_true_pool.idle_mutex);
+    atomic_store_explicit(&g_true_pool.shutdown, true, memory_order_release);
+    pthread_cond_broadcast(&g_true_pool.idle_condition);
+    pthread_cond_broadcast(&g_true_pool.space_condition);
+    pthread_mutex_unlock(&g_true_pool.idle_mutex);
+
+    for (uint32_t i = 0; i < g_true_pool.worker_count; i++) {
+        pthread_join(g_true_pool.workers[i].thread, NULL);
+    }
+}
+
+/**
+ * @brief Forget the parent's pool in a forked child; the queues are left
+ *        unfreed, as a worker may have been halfway through changing them
+ */
+void rift_true_pool_forget_parent(void) {
+    // Workers and spawners may have held any of the locks across fork()
+    pthread_mutex_init(&g_true_pool.inject_mutex, NULL);
+    pthread_mutex_init(&g_true_pool.edf_mutex, NULL);
+    pthread_mutex_init(&g_true_pool.idle_mutex, NULL);
+    pthread_cond_init(&g_true_pool.idle_condition, NULL);
+    pthread_cond_init(&g_true_pool.space_condition, NULL);
+    pthread_mutex_init(&g_true_pool.lifecycle_mutex, NULL);
+    rift_edf_ledger_forget_parent(&g_true_pool.edf_ledger);
+    t_true_worker = NULL; // The forking thread may have been a worker
+
+    if (!atomic_load(&g_true_pool.initialized)) {
+        return;
+    }
+    g_true_pool.workers = NULL;
+    g_true_pool.worker_count = 0;
+    g_true_pool.inject_head = NULL;
+    g_true_pool.inject_tail = NULL;
+    memset(&g_true_pool.edf_queue, 0, sizeof(g_true_pool.edf_queue));
+    atomic_store(&g_true_pool.inject_pending, 0);
+    atomic_store(&g_true_pool.edf_pending, 0);
+    atomic_store(&g_true_pool.queued, 0);
+    atomic_store(&g_true_pool.idle_workers, 0);
+    atomic_store(&g_true_pool.blocked_spawners, 0);
+    atomic_store(&g_true_pool.initialized, false);
+}
+
+/**
+ * @brief Drain queued work and stop the worker threads
+ */
+void rift_true_pool_cleanup(void) {
+    pthread_mutex_lock(&g_true_pool.lifecycle_mutex);
+    if (!atomic_load(&g_true_pool.initialized)) {
+        pthread_mutex_unlock(&g_true_pool.lifecycle_mutex);
+        return;
+    }
+
+    pool_stop_locked();
+
+    uint64_t executed = 0, helped = 0, steals = 0;
+    for (uint32_t i = 0; i < g_true_pool.worker_count; i++) {
+        rift_true_worker_t* worker = &g_true_pool.workers[i];
+        executed += atomic_load(&worker->executed);
+        helped += atomic_load(&worker->helped);
+        steals += atomic_load(&worker->steals);
+        rift_deque_destroy(&worker->deque);
+    }
+    pthread_mutex_lock(&g_true_pool.edf_mutex);
+    rift_edf_queue_destroy(&g_true_pool.edf_queue);
+    pthread_mutex_unlock(&g_true_pool.edf_mutex);
+    printf("[POOL] Worker pool stopped - %lu tasks executed (%lu helped, %lu stolen), "
+           "peak queue %ld\n", (unsigned long)executed, (unsigned long)helped,
+           (unsigned long)steals, (long)atomic_load(&g_true_pool.queued_peak));
+
+    free(g_true_pool.workers);
+    g_true_pool.workers = NULL;
+    g_true_pool.worker_count = 0;
+    atomic_store(&g_true_pool.initialized, false);
+    pthread_mutex_unlock(&g_true_pool.lifecycle_mutex);
+}
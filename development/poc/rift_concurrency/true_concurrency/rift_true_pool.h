@@ -0,0 +1,114 @@
+/**
+ * @file rift_true_pool.h
+ * @brief True Thread Worker Pool Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_TRUE_POOL_H
+#define RIFT_TRUE_POOL_H
+
+#include "rift_common.h"
+#include "rift_true_concurrency.h"
+
+#define RIFT_TRUE_POOL_MAX_WORKERS 64
+#define RIFT_TRUE_POOL_HELP_INTERVAL_MS 1
+
+// Aggregate worker pool statistics
+typedef struct {
+    uint32_t worker_count;                // Worker threads in pool
+    uint64_t tasks_submitted;             // Units of work queued
+    uint64_t tasks_executed;              // Units of work completed
+    uint64_t tasks_helped;                // Run inline by a waiting worker
+    uint64_t tasks_local;                 // Spawned onto a worker's own deque
+    uint64_t tasks_stolen;                // Taken from a peer's deque
+    uint64_t tasks_deadline;              // Queued by deadline (EDF)
+    uint32_t queue_depth;                 // Currently queued
+    uint32_t queue_depth_peak;            // Highest queue depth observed
+} rift_true_pool_stats_t;
+
+/**
+ * @brief Start persistent worker pool; no-op if already running
+ * @param worker_count Worker threads (0 for online CPU count)
+ * @return 0 on success, error code otherwise
+ */
+int rift_true_pool_init(uint32_t worker_count);
+
+/**
+ * @brief Queue registered context for execution on the pool
+ * @param context Pooled thread context
+ */
+void rift_true_pool_submit(rift_true_context_t* context);
+
+/**
+ * @brief Queue batch of contexts; local deque on a worker, else injected
+ * @param contexts Pooled thread contexts
+ * @param count Number of contexts
+ */
+void rift_true_pool_submit_batch(rift_true_context_t** contexts, uint32_t count);
+
+/**
+ * @brief Apply policy's max_queued to the pool before count units are
+ *        created; OVERFLOW_BLOCK runs queued work on a worker and otherwise
+ *        sleeps until workers make room
+ * @param policy Spawn policy
+ * @param count Units about to be queued
+ * @return 0 to queue them, 1 to run them on the caller, -1 if refused
+ */
+int rift_true_pool_throttle(const rift_governance_policy_t* policy, uint32_t count);
+
+/**
+ * @brief Admit context with a deadline against the pool's outstanding EDF
+ *        claims, spread over its workers
+ * @param context Pooled context with telemetry.deadline_ns set
+ * @return 0 if admitted, -1 if its deadline is infeasible
+ */
+int rift_true_pool_admit(rift_true_context_t* context);
+
+/**
+ * @brief Release context's admission claim once its work has run
+ * @param context Admitted or unadmitted context
+ */
+void rift_true_pool_release(rift_true_context_t* context);
+
+/**
+ * @brief Priority inheritance: move a context queued by deadline to a
+ *        waiter's earlier deadline
+ * @param context Pooled context waited for
+ * @param deadline_ns Waiter's deadline
+ * @return true if the context was still queued by deadline
+ */
+bool rift_true_pool_boost(rift_true_context_t* context, uint64_t deadline_ns);
+
+/**
+ * @brief Run one queued unit of work (local, injected or stolen) if the
+ *        caller is a pool worker
+ * @return true if a unit of work was executed
+ */
+bool rift_true_pool_help(void);
+
+/**
+ * @brief Whether the calling thread is a pool worker
+ * @return true on worker threads
+ */
+bool rift_true_pool_on_worker(void);
+
+/**
+ * @brief Get worker pool statistics
+ * @param stats Output statistics
+ */
+void rift_true_pool_get_stats(rift_true_pool_stats_t* stats);
+
+/**
+ * @brief Forget a pool inherited across fork(): its workers did not survive
+ *        and its queued work belongs to the parent. A later pooled spawn in
+ *        the child starts a pool of its own.
+ */
+void rift_true_pool_forget_parent(void);
+
+/**
+ * @brief Drain queued work and stop the worker threads
+ */
+void rift_true_pool_cleanup(void);
+
+#endif // RIFT_TRUE_POOL_H
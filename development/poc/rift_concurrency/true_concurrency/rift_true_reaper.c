@@ -0,0 +1,421 @@
+/**
+ * @file rift_true_reaper.c
+ * @brief RIFT True Concurrency - pidfd/epoll Child Reaper
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * One thread reaps every forked TRUE_PROCESS child. Each child gets a pidfd
+ * (pidfd_open) registered in a single epoll set; when a pidfd turns
+ * readable the reaper collects the exit status and publishes it through
+ * rift_true_process_exited(), which finishes the context, records the exit
+ * in telemetry and enforces the task's destroy policy on its children. No
+ * SIGCHLD handler is installed and nobody else calls waitpid() on a
+ * watched child, so thread workers never race the reaper for a status.
+ *
+ * Exit latency is the time from a child's exit to the reaper publishing
+ * it. Children stamp CLOCK_MONOTONIC into a shared page just before
+ * _exit(); children killed by a signal leave no stamp and are counted
+ * separately. Latencies go into a log2 histogram in microseconds. A forked
+ * child drops the inherited reaper and starts its own for its own children.
+ *
+ * With signal routing on (rift_signal.c) the signalfd sits in the same
+ * epoll set and the reaper dispatches routed signals as they arrive.
+ *
+ * Without pidfd_open (pre-5.3 kernels, or filtered by seccomp) slots are
+ * refused and contexts fall back to waitpid() polling.
+ */
+
+#include "rift_true_reaper.h"
+#include "rift_signal.h"
+#include "rift_true_concurrency.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+
+#ifndef SYS_pidfd_open
+#define SYS_pidfd_open 434
+#endif
+
+#define RIFT_REAPER_WAKE_SLOT UINT32_MAX
+#define RIFT_REAPER_SIGNAL_SLOT (UINT32_MAX - 1)
+#define RIFT_REAPER_EVENT_BATCH 64
+
+typedef struct {
+    bool in_use;
+    int pidfd;
+    pid_t pid;
+    uint64_t rift_id;
+} rift_reaper_entry_t;
+
+typedef struct {
+    int epoll_fd;
+    int wake_fd;                          // eventfd: stop request
+    pthread_t thread;
+    pthread_mutex_t lifecycle_mutex;
+    pthread_mutex_t slot_mutex;           // Guards entries
+    rift_reaper_entry_t entries[RIFT_MAX_THREAD_COUNT];
+    _Atomic uint64_t* exit_stamps;        // Shared with children: exit time per slot
+    _Atomic uint64_t* own_stamp;          // In a child: where to stamp our own exit
+    pid_t owner;                          // Process running the reaper thread
+    _Atomic bool running;
+    _Atomic bool unavailable;             // pidfd_open refused once
+
+    _Atomic uint64_t watched;
+    _Atomic uint64_t reaped;
+    _Atomic uint64_t signaled;
+    _Atomic uint64_t unstamped;
+    _Atomic uint64_t latency_buckets[RIFT_REAPER_LATENCY_BUCKETS];
+    _Atomic uint64_t latency_total_ns;
+    _Atomic uint64_t latency_max_ns;
+} rift_reaper_t;
+
+static rift_reaper_t g_reaper = {
+    .epoll_fd = -1,
+    .wake_fd = -1,
+    .lifecycle_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .slot_mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+static uint64_t reaper_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+// =============================================================================
+// REAPER THREAD
+// =============================================================================
+
+static void reaper_record_latency(uint64_t latency_ns) {
+    uint64_t micros = latency_ns / 1000;
+    uint32_t bucket = 0;
+    while (bucket < RIFT_REAPER_LATENCY_BUCKETS - 1 && micros >= (1ull << bucket)) {
+        bucket++;
+    }
+    atomic_fetch_add_explicit(&g_reaper.latency_buckets[bucket], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&g_reaper.latency_total_ns, latency_ns, memory_order_relaxed);
+
+    uint64_t max = atomic_load_explicit(&g_reaper.latency_max_ns, memory_order_relaxed);
+    while (latency_ns > max &&
+           !atomic_compare_exchange_weak_explicit(&g_reaper.latency_max_ns, &max, latency_ns,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief Collect a child whose pidfd became readable and publish its exit
+ */
+static void reaper_collect(uint32_t slot) {
+    pthread_mutex_lock(&g_reaper.slot_mutex);
+    rift_reaper_entry_t entry = g_reaper.entries[slot];
+    pthread_mutex_unlock(&g_reaper.slot_mutex);
+    if (!entry.in_use) {
+        return;
+    }
+
+    int status = 0;
+    pid_t result = waitpid(entry.pid, &status, WNOHANG);
+    if (result == 0) {
+        return; // Spurious readiness; stays registered
+    }
+    uint64_t reaped_ns = reaper_now_ns();
+
+    uint64_t stamp = atomic_load(&g_reaper.exit_stamps[slot]);
+    if (stamp != 0 && stamp <= reaped_ns) {
+        reaper_record_latency(reaped_ns - stamp);
+    } else {
+        atomic_fetch_add_explicit(&g_reaper.unstamped, 1, memory_order_relaxed);
+    }
+    if (result > 0 && WIFSIGNALED(status)) {
+        atomic_fetch_add_explicit(&g_reaper.signaled, 1, memory_order_relaxed);
+    }
+    atomic_fetch_add_explicit(&g_reaper.reaped, 1, memory_order_relaxed);
+
+    epoll_ctl(g_reaper.epoll_fd, EPOLL_CTL_DEL, entry.pidfd, NULL);
+    close(entry.pidfd);
+    pthread_mutex_lock(&g_reaper.slot_mutex);
+    g_reaper.entries[slot].in_use = false;
+    pthread_mutex_unlock(&g_reaper.slot_mutex);
+
+    rift_true_process_exited(entry.rift_id, status);
+}
+
+static void* reaper_main(void* arg) {
+    (void)arg;
+    rift_signal_block_thread();
+    struct epoll_event events[RIFT_REAPER_EVENT_BATCH];
+    for (;;) {
+        int ready = epoll_wait(g_reaper.epoll_fd, events, RIFT_REAPER_EVENT_BATCH, -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        for (int i = 0; i < ready; i++) {
+            if (events[i].data.u32 == RIFT_REAPER_WAKE_SLOT) {
+                return NULL;
+            }
+            if (events[i].data.u32 == RIFT_REAPER_SIGNAL_SLOT) {
+                rift_signal_dispatch();
+                continue;
+            }
+            reaper_collect(events[i].data.u32);
+        }
+    }
+    return NULL;
+}
+
+// =============================================================================
+// LIFECYCLE
+// =============================================================================
+
+/**
+ * @brief Forget a reaper inherited across fork(); its thread did not
+ *        survive and its epoll set still belongs to the parent
+ */
+static void reaper_forget_parent(void) {
+    if (!atomic_load(&g_reaper.running) || g_reaper.owner == getpid()) {
+        return;
+    }
+    for (int slot = 0; slot < RIFT_MAX_THREAD_COUNT; slot++) {
+        if (g_reaper.entries[slot].in_use && g_reaper.entries[slot].pidfd >= 0) {
+            close(g_reaper.entries[slot].pidfd);
+        }
+        g_reaper.entries[slot].in_use = false;
+    }
+    close(g_reaper.epoll_fd);
+    close(g_reaper.wake_fd);
+    g_reaper.epoll_fd = g_reaper.wake_fd = -1;
+    g_reaper.exit_stamps = NULL; // Left mapped: own_stamp may point into it
+    atomic_store(&g_reaper.running, false);
+}
+
+/**
+ * @brief Start reaper thread; no-op if already running
+ */
+int rift_true_reaper_start(void) {
+    pthread_mutex_lock(&g_reaper.lifecycle_mutex);
+    reaper_forget_parent();
+    if (atomic_load(&g_reaper.running)) {
+        pthread_mutex_unlock(&g_reaper.lifecycle_mutex);
+        return 0;
+    }
+
+    // Probe once: our own PID always has a pidfd if the syscall exists
+    int probe = (int)syscall(SYS_pidfd_open, getpid(), 0);
+    if (probe < 0) {
+        if (!atomic_exchange(&g_reaper.unavailable, true)) {
+            fprintf(stderr, "[REAPER] pidfd_open unavailable (%s), polling children\n",
+                    strerror(errno));
+        }
+        pthread_mutex_unlock(&g_reaper.lifecycle_mutex);
+        return -1;
+    }
+    close(probe);
+
+    g_reaper.exit_stamps = mmap(NULL, sizeof(uint64_t) * RIFT_MAX_THREAD_COUNT,
+                                PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    g_reaper.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    g_reaper.wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    struct epoll_event wake = { .events = EPOLLIN, .data.u32 = RIFT_REAPER_WAKE_SLOT };
+    struct epoll_event routed = { .events = EPOLLIN, .data.u32 = RIFT_REAPER_SIGNAL_SLOT };
+    int signal_fd = rift_signal_fd();
+    if (g_reaper.exit_stamps == MAP_FAILED || g_reaper.epoll_fd < 0 || g_reaper.wake_fd < 0 ||
+        epoll_ctl(g_reaper.epoll_fd, EPOLL_CTL_ADD, g_reaper.wake_fd, &wake) != 0 ||
+        (signal_fd >= 0 &&
+         epoll_ctl(g_reaper.epoll_fd, EPOLL_CTL_ADD, signal_fd, &routed) != 0) ||
+        pthread_create(&g_reaper.thread, NULL, reaper_main, NULL) != 0) {
+        fprintf(stderr, "[REAPER] Start failed: %s\n", strerror(errno));
+        if (g_reaper.exit_stamps != MAP_FAILED) {
+            munmap(g_reaper.exit_stamps, sizeof(uint64_t) * RIFT_MAX_THREAD_COUNT);
+        }
+        if (g_reaper.epoll_fd >= 0) {
+            close(g_reaper.epoll_fd);
+        }
+        if (g_reaper.wake_fd >= 0) {
+            close(g_reaper.wake_fd);
+        }
+        g_reaper.exit_stamps = NULL;
+        g_reaper.epoll_fd = g_reaper.wake_fd = -1;
+        pthread_mutex_unlock(&g_reaper.lifecycle_mutex);
+        return -1;
+    }
+
+    memset(g_reaper.entries, 0, sizeof(g_reaper.entries));
+    atomic_store(&g_reaper.watched, 0);
+    atomic_store(&g_reaper.reaped, 0);
+    atomic_store(&g_reaper.signaled, 0);
+    atomic_store(&g_reaper.unstamped, 0);
+    for (uint32_t i = 0; i < RIFT_REAPER_LATENCY_BUCKETS; i++) {
+        atomic_store(&g_reaper.latency_buckets[i], 0);
+    }
+    atomic_store(&g_reaper.latency_total_ns, 0);
+    atomic_store(&g_reaper.latency_max_ns, 0);
+    g_reaper.owner = getpid();
+    atomic_store(&g_reaper.running, true);
+    pthread_mutex_unlock(&g_reaper.lifecycle_mutex);
+    printf("[REAPER] Started - pidfd/epoll child reaper\n");
+    return 0;
+}
+
+/**
+ * @brief Reserve a slot for a child about to be forked
+ */
+int rift_true_reaper_reserve(void) {
+    if (atomic_load(&g_reaper.unavailable)) {
+        return -1;
+    }
+    if ((!atomic_load(&g_reaper.running) || g_reaper.owner != getpid()) &&
+        rift_true_reaper_start() != 0) {
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_reaper.slot_mutex);
+    for (int slot = 0; slot < RIFT_MAX_THREAD_COUNT; slot++) {
+        if (!g_reaper.entries[slot].in_use) {
+            g_reaper.entries[slot] = (rift_reaper_entry_t){ .in_use = true, .pidfd = -1 };
+            atomic_store(&g_reaper.exit_stamps[slot], 0);
+            pthread_mutex_unlock(&g_reaper.slot_mutex);
+            return slot;
+        }
+    }
+    pthread_mutex_unlock(&g_reaper.slot_mutex);
+    return -1;
+}
+
+void rift_true_reaper_release(int slot) {
+    if (slot < 0) {
+        return;
+    }
+    pthread_mutex_lock(&g_reaper.slot_mutex);
+    g_reaper.entries[slot].in_use = false;
+    pthread_mutex_unlock(&g_reaper.slot_mutex);
+}
+
+/**
+ * @brief Open the child's pidfd and add it to the epoll set
+ */
+int rift_true_reaper_watch(int slot, uint64_t rift_id, pid_t pid) {
+    int pidfd = (int)syscall(SYS_pidfd_open, pid, 0);
+    if (pidfd < 0) {
+        rift_true_reaper_release(slot);
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_reaper.slot_mutex);
+    g_reaper.entries[slot].pidfd = pidfd;
+    g_reaper.entries[slot].pid = pid;
+    g_reaper.entries[slot].rift_id = rift_id;
+    pthread_mutex_unlock(&g_reaper.slot_mutex);
+
+    // A child that already exited is a readable pidfd: reaped on the next wait
+    struct epoll_event event = { .events = EPOLLIN, .data.u32 = (uint32_t)slot };
+    if (epoll_ctl(g_reaper.epoll_fd, EPOLL_CTL_ADD, pidfd, &event) != 0) {
+        close(pidfd);
+        rift_true_reaper_release(slot);
+        return -1;
+    }
+    atomic_fetch_add_explicit(&g_reaper.watched, 1, memory_order_relaxed);
+    return 0;
+}
+
+/**
+ * @brief Child side: remember own stamp and drop the parent's reaper
+ */
+void rift_true_reaper_enter_child(int slot) {
+    g_reaper.own_stamp = slot >= 0 ? &g_reaper.exit_stamps[slot] : NULL;
+    reaper_forget_parent();
+}
+
+/**
+ * @brief Child side: stamp exit time just before _exit()
+ */
+void rift_true_reaper_child_exit(void) {
+    if (g_reaper.own_stamp) {
+        atomic_store(g_reaper.own_stamp, reaper_now_ns());
+    }
+}
+
+void rift_true_reaper_get_stats(rift_true_reaper_stats_t* stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->watched = atomic_load(&g_reaper.watched);
+    stats->reaped = atomic_load(&g_reaper.reaped);
+    stats->signaled = atomic_load(&g_reaper.signaled);
+    stats->unstamped = atomic_load(&g_reaper.unstamped);
+    for (uint32_t i = 0; i < RIFT_REAPER_LATENCY_BUCKETS; i++) {
+        stats->latency_buckets[i] = atomic_load(&g_reaper.latency_buckets[i]);
+    }
+    stats->latency_total_ns = atomic_load(&g_reaper.latency_total_ns);
+    stats->latency_max_ns = atomic_load(&g_reaper.latency_max_ns);
+}
+
+/**
+ * @brief Upper bound in microseconds of the bucket holding the given
+ *        percentile of stamped exits
+ */
+uint64_t rift_true_reaper_latency_percentile(const rift_true_reaper_stats_t* stats,
+                                             uint32_t percentile) {
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < RIFT_REAPER_LATENCY_BUCKETS; i++) {
+        total += stats->latency_buckets[i];
+    }
+    uint64_t target = (total * percentile + 99) / 100;
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < RIFT_REAPER_LATENCY_BUCKETS; i++) {
+        seen += stats->latency_buckets[i];
+        if (total > 0 && seen >= target) {
+            return 1ull << i;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Stop the reaper; every watched child must already be reaped
+ */
+void rift_true_reaper_stop(void) {
+    pthread_mutex_lock(&g_reaper.lifecycle_mutex);
+    if (!atomic_load(&g_reaper.running)) {
+        pthread_mutex_unlock(&g_reaper.lifecycle_mutex);
+        return;
+    }
+
+    uint64_t one = 1;
+    if (write(g_reaper.wake_fd, &one, sizeof(one)) != (ssize_t)sizeof(one)) {
+        fprintf(stderr, "[REAPER] Wake failed: %s\n", strerror(errno));
+    }
+    pthread_join(g_reaper.thread, NULL);
+    atomic_store(&g_reaper.running, false);
+
+    for (int slot = 0; slot < RIFT_MAX_THREAD_COUNT; slot++) {
+        if (g_reaper.entries[slot].in_use && g_reaper.entries[slot].pidfd >= 0) {
+            close(g_reaper.entries[slot].pidfd);
+        }
+        g_reaper.entries[slot].in_use = false;
+    }
+    close(g_reaper.epoll_fd);
+    close(g_reaper.wake_fd);
+    munmap(g_reaper.exit_stamps, sizeof(uint64_t) * RIFT_MAX_THREAD_COUNT);
+    g_reaper.exit_stamps = NULL;
+    g_reaper.epoll_fd = g_reaper.wake_fd = -1;
+
+    rift_true_reaper_stats_t stats;
+    rift_true_reaper_get_stats(&stats);
+    uint64_t stamped = stats.reaped - stats.unstamped;
+    printf("[REAPER] Stopped - %lu reaped (%lu by signal), exit latency avg %lu us, "
+           "p50 <%lu us, p99 <%lu us, max %lu us\n",
+           (unsigned long)stats.reaped, (unsigned long)stats.signaled,
+           (unsigned long)(stamped ? stats.latency_total_ns / stamped / 1000 : 0),
+           (unsigned long)rift_true_reaper_latency_percentile(&stats, 50),
+           (unsigned long)rift_true_reaper_latency_percentile(&stats, 99),
+           (unsigned long)(stats.latency_max_ns / 1000));
+    pthread_mutex_unlock(&g_reaper.lifecycle_mutex);
+}
@@ -0,0 +1,85 @@
+/**
+ * @file rift_true_reaper.h
+ * @brief pidfd Child Reaper Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_TRUE_REAPER_H
+#define RIFT_TRUE_REAPER_H
+
+#include "rift_common.h"
+
+#define RIFT_REAPER_LATENCY_BUCKETS 20    // log2 microseconds; last is overflow
+
+typedef struct {
+    uint64_t watched;                     // Children registered with the reaper
+    uint64_t reaped;                      // Exits collected
+    uint64_t signaled;                    // Of those, terminated by a signal
+    uint64_t unstamped;                   // Exits without a child exit stamp
+    uint64_t latency_buckets[RIFT_REAPER_LATENCY_BUCKETS]; // Bucket i: < 2^i us
+    uint64_t latency_total_ns;
+    uint64_t latency_max_ns;
+} rift_true_reaper_stats_t;
+
+/**
+ * @brief Start the reaper thread ahead of the first fork, e.g. so routed
+ *        signals have a consumer; no-op if already running
+ * @return 0 on success, -1 if pidfd_open is unavailable
+ */
+int rift_true_reaper_start(void);
+
+/**
+ * @brief Reserve a reaper slot before forking, starting the reaper on first use
+ * @return Slot index, or -1 if the child must be polled with waitpid()
+ */
+int rift_true_reaper_reserve(void);
+
+/**
+ * @brief Release a reserved slot whose fork failed
+ * @param slot Slot from rift_true_reaper_reserve()
+ */
+void rift_true_reaper_release(int slot);
+
+/**
+ * @brief Watch a forked child's pidfd; its exit is published through
+ *        rift_true_process_exited()
+ * @param slot Slot from rift_true_reaper_reserve()
+ * @param rift_id RIFT ID of the process task
+ * @param pid Child process ID
+ * @return 0 on success, -1 if the child must be polled (slot released)
+ */
+int rift_true_reaper_watch(int slot, uint64_t rift_id, pid_t pid);
+
+/**
+ * @brief Drop the inherited reaper state in a freshly forked child
+ * @param slot The child's own slot (-1 if unwatched)
+ */
+void rift_true_reaper_enter_child(int slot);
+
+/**
+ * @brief Stamp the calling child's exit time just before _exit()
+ */
+void rift_true_reaper_child_exit(void);
+
+/**
+ * @brief Get reaper statistics and exit-latency histogram
+ * @param stats Output statistics
+ */
+void rift_true_reaper_get_stats(rift_true_reaper_stats_t* stats);
+
+/**
+ * @brief Exit latency percentile from a histogram
+ * @param stats Statistics from rift_true_reaper_get_stats()
+ * @param percentile Percentile (1-100)
+ * @return Upper bound of the bucket holding it in microseconds, 0 if empty
+ */
+uint64_t rift_true_reaper_latency_percentile(const rift_true_reaper_stats_t* stats,
+                                             uint32_t percentile);
+
+/**
+ * @brief Stop the reaper thread once every watched child has been reaped
+ */
+void rift_true_reaper_stop(void);
+
+#endif // RIFT_TRUE_REAPER_H
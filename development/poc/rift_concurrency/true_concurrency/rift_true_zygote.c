@@ -0,0 +1,392 @@
+/**
+ * @file rift_true_zygote.c
+ * @brief RIFT True Concurrency - Zygote Process Spawner
+ * @author Aegis Development Team
+ * @version 1.0.0
+ *
+ * Forking a large parent copies its page tables on every spawn. The zygote
+ * is a helper forked once, ideally right after startup while the parent is
+ * still small; TRUE_PROCESS tasks with zygote_spawn set are then forked from
+ * the helper instead of the parent, so spawn cost no longer grows with the
+ * parent's RSS.
+ *
+ * Requests go over a SOCK_SEQPACKET socket and are answered with the new
+ * PID; a child's IPC ring travels with the request as an SCM_RIGHTS memfd. The zygote reaps its children through a signalfd and reports each
+ * exit on a second socket, which a listener thread in the parent turns into
+ * rift_true_process_exited() calls.
+ *
+ * A zygote child runs in the zygote's copy of the address space: the work
+ * function and work_data must refer to code or memory that already existed
+ * when the zygote was started (static data, or heap allocated before
+ * rift_true_zygote_start()).
+ *
+ * The zygote loop uses only async-signal-safe calls, so it may be forked
+ * from a parent that already runs other threads.
+ */
+
+#include "rift_true_zygote.h"
+#include "rift_signal.h"
+#include "rift_true_placement.h"
+#include "rift_true_concurrency.h"
+#include "rift_true_ipc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/signalfd.h>
+#include <sys/wait.h>
+
+// =============================================================================
+// WIRE FORMAT AND STATE
+// =============================================================================
+
+typedef struct {
+    rift_thread_context_t context;  // Copied in; current in the child
+    void (*work_function)(void*);
+    void* work_data;
+    rift_true_placement_t placement;
+} rift_zygote_request_t;
+
+// Spawn reply (status unused) and exit event share one layout
+typedef struct {
+    uint64_t rift_id;
+    pid_t pid;
+    int status;
+} rift_zygote_event_t;
+
+typedef struct {
+    pid_t zygote_pid;
+    int request_fd;                 // Parent end: requests out, replies in
+    int event_fd;                   // Parent end: exit events in
+    pthread_t listener;
+    pthread_mutex_t request_mutex;  // One outstanding request at a time
+    pthread_mutex_t lifecycle_mutex;
+    _Atomic bool running;
+    _Atomic uint64_t spawned;
+} rift_zygote_t;
+
+static rift_zygote_t g_zygote = {
+    .zygote_pid = -1,
+    .request_fd = -1,
+    .event_fd = -1,
+    .request_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .lifecycle_mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+// =============================================================================
+// ZYGOTE PROCESS
+// =============================================================================
+
+typedef struct {
+    pid_t pid;
+    uint64_t rift_id;
+} rift_zygote_child_t;
+
+/**
+ * @brief Reap exited children and report them; returns live child count
+ */
+static uint32_t zygote_reap(int event_fd, rift_zygote_child_t* children, uint32_t count) {
+    int status;
+    pid_t pid;
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (children[i].pid == pid) {
+                rift_zygote_event_t event = { children[i].rift_id, pid, status };
+                send(event_fd, &event, sizeof(event), MSG_NOSIGNAL);
+                children[i] = children[--count];
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+static void zygote_run_child(const rift_zygote_request_t* request, int ipc_fd,
+                             const sigset_t* old_mask) {
+    signal(SIGCHLD, SIG_DFL);
+    sigprocmask(SIG_SETMASK, old_mask, NULL);
+    rift_thread_context_t context = request->context;
+    context.module_specific_data = NULL; // Points into the spawner's memory
+    rift_true_enter_subtree(&context);
+    if (ipc_fd >= 0 && rift_ipc_attach(ipc_fd) != 0) {
+        _exit(1);
+    }
+    if (rift_true_placement_apply(&request->placement) != 0) {
+        _exit(1);
+    }
+    rift_current_swap(&context);
+    request->work_function(request->work_data);
+    rift_ipc_leave_child();
+    fflush(stdout);
+    _exit(0);
+}
+
+/**
+ * @brief Receive one request and its memfd, if any
+ * @return Bytes received (request size on success)
+ */
+static ssize_t zygote_recv_request(int request_fd, rift_zygote_request_t* request, int* ipc_fd) {
+    char control[CMSG_SPACE(sizeof(int))];
+    struct iovec iov = { .iov_base = request, .iov_len = sizeof(*request) };
+    struct msghdr message = {
+        .msg_iov = &iov,
+        .msg_iovlen = 1,
+        .msg_control = control,
+        .msg_controllen = sizeof(control)
+    };
+
+    *ipc_fd = -1;
+    ssize_t received = recvmsg(request_fd, &message, MSG_CMSG_CLOEXEC);
+    struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+    if (header && header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS) {
+        memcpy(ipc_fd, CMSG_DATA(header), sizeof(int));
+    }
+    return received;
+}
+
+/**
+ * @brief Zygote main loop: fork on request, report exits, leave once the
+ *        parent has hung up and every child has been reaped
+ */
+static void zygote_main(int request_fd, int event_fd) {
+    static rift_zygote_child_t children[RIFT_MAX_THREAD_COUNT];
+    uint32_t child_count = 0;
+    bool parent_gone = false;
+
+    sigset_t chld_mask, old_mask;
+    sigemptyset(&chld_mask);
+    sigaddset(&chld_mask, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &chld_mask, &old_mask);
+    int signal_fd = signalfd(-1, &chld_mask, SFD_CLOEXEC | SFD_NONBLOCK);
+    if (signal_fd < 0) {
+        _exit(1);
+    }
+
+    while (!parent_gone || child_count > 0) {
+        struct pollfd fds[2] = {
+            { .fd = signal_fd, .events = POLLIN },
+            { .fd = parent_gone ? -1 : request_fd, .events = POLLIN }
+        };
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            struct signalfd_siginfo info;
+            while (read(signal_fd, &info, sizeof(info)) == (ssize_t)sizeof(info)) {
+                // Drain; waitpid() below collects every exited child
+            }
+            child_count = zygote_reap(event_fd, children, child_count);
+        }
+
+        if (fds[1].revents & (POLLIN | POLLHUP)) {
+            rift_zygote_request_t request;
+            int ipc_fd;
+            ssize_t received = zygote_recv_request(request_fd, &request, &ipc_fd);
+            if (received != (ssize_t)sizeof(request)) {
+                if (ipc_fd >= 0) {
+                    close(ipc_fd);
+                }
+                parent_gone = true; // EOF or broken request: stop accepting
+                continue;
+            }
+
+            uint64_t rift_id = request.context.telemetry.rift_thread_id;
+            rift_zygote_event_t reply = { rift_id, -1, 0 };
+            if (child_count < RIFT_MAX_THREAD_COUNT) {
+                pid_t pid = fork();
+                if (pid == 0) {
+                    close(request_fd);
+                    close(event_fd);
+                    close(signal_fd);
+                    zygote_run_child(&request, ipc_fd, &old_mask);
+                }
+                if (pid > 0) {
+                    children[child_count++] = (rift_zygote_child_t){ pid, rift_id };
+                }
+                reply.pid = pid;
+            }
+            if (ipc_fd >= 0) {
+                close(ipc_fd);
+            }
+            send(request_fd, &reply, sizeof(reply), MSG_NOSIGNAL);
+        }
+    }
+    _exit(0);
+}
+
+// =============================================================================
+// PARENT SIDE
+// =============================================================================
+
+static void* zygote_listener_main(void* arg) {
+    (void)arg;
+    rift_zygote_event_t event;
+    while (recv(g_zygote.event_fd, &event, sizeof(event), 0) == (ssize_t)sizeof(event)) {
+        rift_true_process_exited(event.rift_id, event.status);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Fork the zygote helper and start the exit listener
+ */
+int rift_true_zygote_start(void) {
+    pthread_mutex_lock(&g_zygote.lifecycle_mutex);
+    if (atomic_load(&g_zygote.running)) {
+        pthread_mutex_unlock(&g_zygote.lifecycle_mutex);
+        return 0;
+    }
+
+    int request_pair[2], event_pair[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, request_pair) != 0) {
+        pthread_mutex_unlock(&g_zygote.lifecycle_mutex);
+        fprintf(stderr, "[ZYGOTE] socketpair failed: %s\n", strerror(errno));
+        return -1;
+    }
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, event_pair) != 0) {
+        close(request_pair[0]);
+        close(request_pair[1]);
+        pthread_mutex_unlock(&g_zygote.lifecycle_mutex);
+        fprintf(stderr, "[ZYGOTE] socketpair failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(request_pair[0]);
+        close(request_pair[1]);
+        close(event_pair[0]);
+        close(event_pair[1]);
+        pthread_mutex_unlock(&g_zygote.lifecycle_mutex);
+        fprintf(stderr, "[ZYGOTE] fork failed: %s\n", strerror(errno));
+        return -1;
+    }
+
+    if (pid == 0) {
+        close(request_pair[0]);
+        close(event_pair[0]);
+        rift_signal_forget_parent(); // Children inherit the zygote's mask
+        zygote_main(request_pair[1], event_pair[1]);
+    }
+
+    close(request_pair[1]);
+    close(event_pair[1]);
+    g_zygote.zygote_pid = pid;
+    g_zygote.request_fd = request_pair[0];
+    g_zygote.event_fd = event_pair[0];
+
+    if (pthread_create(&g_zygote.listener, NULL, zygote_listener_main, NULL) != 0) {
+        close(g_zygote.request_fd);
+        close(g_zygote.event_fd);
+        waitpid(pid, NULL, 0);
+        g_zygote.zygote_pid = -1;
+        pthread_mutex_unlock(&g_zygote.lifecycle_mutex);
+        return -1;
+    }
+
+    atomic_store(&g_zygote.spawned, 0);
+    atomic_store(&g_zygote.running, true);
+    pthread_mutex_unlock(&g_zygote.lifecycle_mutex);
+    printf("[ZYGOTE] Started - PID %d\n", pid);
+    return 0;
+}
+
+bool rift_true_zygote_running(void) {
+    return atomic_load(&g_zygote.running);
+}
+
+/**
+ * @brief Ask the zygote to fork a child running work_function(work_data)
+ */
+pid_t rift_true_zygote_spawn(const rift_thread_context_t* context,
+                             void (*work_function)(void*), void* work_data,
+                             const rift_true_placement_t* placement, int ipc_fd) {
+    if (!atomic_load(&g_zygote.running)) {
+        return -1;
+    }
+
+    uint64_t rift_id = context->telemetry.rift_thread_id;
+    rift_zygote_request_t request = { *context, work_function, work_data, *placement };
+    rift_zygote_event_t reply = { 0, -1, 0 };
+
+    char control[CMSG_SPACE(sizeof(int))];
+    memset(control, 0, sizeof(control));
+    struct iovec iov = { .iov_base = &request, .iov_len = sizeof(request) };
+    struct msghdr message = { .msg_iov = &iov, .msg_iovlen = 1 };
+    if (ipc_fd >= 0) {
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+        header->cmsg_level = SOL_SOCKET;
+        header->cmsg_type = SCM_RIGHTS;
+        header->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(header), &ipc_fd, sizeof(int));
+    }
+
+    pthread_mutex_lock(&g_zygote.request_mutex);
+    if (sendmsg(g_zygote.request_fd, &message, MSG_NOSIGNAL) != (ssize_t)sizeof(request) ||
+        recv(g_zygote.request_fd, &reply, sizeof(reply), 0) != (ssize_t)sizeof(reply)) {
+        reply.pid = -1;
+    }
+    pthread_mutex_unlock(&g_zygote.request_mutex);
+
+    if (reply.pid < 0) {
+        fprintf(stderr, "[ZYGOTE] Spawn of RIFT ID %lu failed\n", (unsigned long)rift_id);
+        return -1;
+    }
+
+    atomic_fetch_add_explicit(&g_zygote.spawned, 1, memory_order_relaxed);
+    return reply.pid;
+}
+
+void rift_true_zygote_forget_parent(void) {
+    // The zygote itself is forked with lifecycle_mutex held
+    pthread_mutex_init(&g_zygote.request_mutex, NULL);
+    pthread_mutex_init(&g_zygote.lifecycle_mutex, NULL);
+    if (!atomic_load(&g_zygote.running)) {
+        return;
+    }
+    // Our copies of the sockets; the zygote and its listener stay the parent's
+    close(g_zygote.request_fd);
+    close(g_zygote.event_fd);
+    g_zygote.request_fd = g_zygote.event_fd = -1;
+    g_zygote.zygote_pid = -1;
+    atomic_store(&g_zygote.running, false);
+}
+
+/**
+ * @brief Hang up on the zygote; it exits once its remaining children have
+ *        been reaped and reported
+ */
+void rift_true_zygote_stop(void) {
+    pthread_mutex_lock(&g_zygote.lifecycle_mutex);
+    if (!atomic_load(&g_zygote.running)) {
+        pthread_mutex_unlock(&g_zygote.lifecycle_mutex);
+        return;
+    }
+    atomic_store(&g_zygote.running, false);
+
+    pthread_mutex_lock(&g_zygote.request_mutex);
+    close(g_zygote.request_fd);
+    g_zygote.request_fd = -1;
+    pthread_mutex_unlock(&g_zygote.request_mutex);
+
+    pthread_join(g_zygote.listener, NULL);
+    close(g_zygote.event_fd);
+    g_zygote.event_fd = -1;
+    waitpid(g_zygote.zygote_pid, NULL, 0);
+
+    printf("[ZYGOTE] Stopped - %lu processes spawned\n",
+           (unsigned long)atomic_load(&g_zygote.spawned));
+    g_zygote.zygote_pid = -1;
+    pthread_mutex_unlock(&g_zygote.lifecycle_mutex);
+}
@@ -0,0 +1,52 @@
+/**
+ * @file rift_true_zygote.h
+ * @brief Zygote Process Spawner Interface
+ * @author Aegis Development Team
+ * @version 1.0.0
+ */
+
+#ifndef RIFT_TRUE_ZYGOTE_H
+#define RIFT_TRUE_ZYGOTE_H
+
+#include "rift_common.h"
+#include "rift_true_placement.h"
+
+/**
+ * @brief Fork the zygote helper; call early, before the parent grows
+ * @return 0 on success (or already running), -1 on failure
+ */
+int rift_true_zygote_start(void);
+
+/**
+ * @brief Whether the zygote helper is running
+ * @return true if started and not stopped
+ */
+bool rift_true_zygote_running(void);
+
+/**
+ * @brief Fork a child from the zygote running work_function(work_data)
+ * @param context Task context; its RIFT ID is reported back when the child
+ *        exits, and a copy is the child's rift_current()
+ * @param work_function Work function (must exist in the zygote image)
+ * @param work_data Work data (must predate rift_true_zygote_start())
+ * @param placement Placement applied in the child
+ * @param ipc_fd Memfd of the child's IPC ring, -1 for none
+ * @return Child PID, -1 on failure
+ */
+pid_t rift_true_zygote_spawn(const rift_thread_context_t* context,
+                             void (*work_function)(void*), void* work_data,
+                             const rift_true_placement_t* placement, int ipc_fd);
+
+/**
+ * @brief Stop accepting spawns and wait for the zygote to exit after its
+ *        remaining children have been reaped
+ */
+void rift_true_zygote_stop(void);
+
+/**
+ * @brief Drop the connection to the spawner's zygote in a forked child; a
+ *        later zygote spawn in the child starts a zygote of its own
+ */
+void rift_true_zygote_forget_parent(void);
+
+#endif // RIFT_TRUE_ZYGOTE_H